@@ -395,6 +395,18 @@ using HostInitializeImportMetaObjectCallback = void (*)(Local<Context> context,
 using HostCreateShadowRealmContextCallback =
     MaybeLocal<Context> (*)(Local<Context> initiator_context);
 
+/**
+ * FinalizationRegistryNativeCleanupCallback is called from a
+ * FinalizationRegistry cleanup task once per cleared cell of a registry on
+ * which a native cleanup function was installed via
+ * v8::Isolate::SetFinalizationRegistryNativeCleanup, passing the cell's
+ * holdings. It replaces the registry's JavaScript cleanup callback; no
+ * JavaScript is executed.
+ */
+using FinalizationRegistryNativeCleanupCallback = void (*)(Isolate* isolate,
+                                                           Local<Value> holdings,
+                                                           void* data);
+
 /**
  * PrepareStackTraceCallback is called when the stack property of an error is
  * first accessed. The return value will be used as the stack value. If this
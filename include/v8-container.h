@@ -76,6 +76,15 @@ class V8_EXPORT Map : public Object {
    */
   static Local<Map> New(Isolate* isolate);
 
+  /**
+   * Creates a new empty Map whose backing store is pre-sized to hold at
+   * least |expected_size| entries without being grown. Use this when the
+   * number of entries is known up front to avoid the cost of repeatedly
+   * doubling and rehashing the backing store. Hints larger than the maximum
+   * supported table size are clamped.
+   */
+  static Local<Map> New(Isolate* isolate, size_t expected_size);
+
   V8_INLINE static Map* Cast(Value* value) {
 #ifdef V8_ENABLE_CHECKS
     CheckCast(value);
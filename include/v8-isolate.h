@@ -630,6 +630,18 @@ class V8_EXPORT Isolate {
    */
   void ClearKeptObjects();
 
+  /**
+   * Installs a native cleanup function on |finalization_registry|, which must
+   * be a FinalizationRegistry instance. Cleared cells of such a registry are
+   * drained in batches directly from the cleanup task, invoking |callback|
+   * once per cell with the cell's holdings and |data|, instead of entering
+   * the registry's JavaScript cleanup callback. Returns false if
+   * |finalization_registry| is not a FinalizationRegistry.
+   */
+  bool SetFinalizationRegistryNativeCleanup(
+      Local<Value> finalization_registry,
+      FinalizationRegistryNativeCleanupCallback callback, void* data);
+
   /**
    * Custom callback used by embedders to help V8 determine if it should abort
    * when it throws and no internal handler is predicted to catch the
@@ -1137,6 +1149,24 @@ class V8_EXPORT Isolate {
    */
   void RequestInterrupt(InterruptCallback callback, void* data);
 
+  /**
+   * Configure a CPU-time slice budget for this isolate. Once the isolate has
+   * consumed more than |slice_ms| milliseconds of CPU time executing
+   * JavaScript, the given |callback| is invoked at the next interrupt check
+   * in the interpreter or baseline code. The callback may block in order to
+   * park the isolate; execution resumes with fully preserved script state
+   * when it returns, and a new slice starts at that point. This enables fair
+   * time-slicing of many isolates over few threads without resorting to
+   * TerminateExecution.
+   *
+   * Passing a null |callback| or a non-positive |slice_ms| disables the
+   * budget. Must be called from the thread running the isolate, or before
+   * the isolate starts executing. Registered |callback| must not reenter the
+   * preempted isolate.
+   */
+  void SetCpuTimeSliceBudget(double slice_ms, InterruptCallback callback,
+                             void* data = nullptr);
+
   /**
    * Returns true if there is ongoing background work within V8 that will
    * eventually post a foreground task, like asynchronous WebAssembly
@@ -1325,6 +1355,43 @@ class V8_EXPORT Isolate {
    */
   void LowMemoryNotification();
 
+  /**
+   * Returns true while second pass phantom callbacks registered with
+   * WeakCallbackInfo::SetThreadSafeSecondPassCallback are still queued or
+   * running on a worker thread. Once this returns false, all side effects of
+   * such callbacks scheduled by earlier garbage collections are visible to
+   * the calling thread.
+   */
+  bool HasPendingThreadSafeSecondPassCallbacks();
+
+  /**
+   * Attempts to exempt the object graph rooted at the given value from
+   * ongoing garbage collection work. The graph is first validated: every
+   * object reachable through own properties and elements must be deeply
+   * frozen, of a plain object or array shape, and free of external state
+   * (no functions, JavaScript accessors, interceptors, embedder fields or
+   * external strings). Prototypes are not followed and are not pinned.
+   *
+   * On success the graph is kept alive for the rest of the isolate's
+   * lifetime and its old-space pages are excluded from compaction, so the
+   * objects are never copied again; this is intended for large long-lived
+   * configuration or constant data. Returns false and has no effect if
+   * validation fails. Pinning cannot be undone.
+   */
+  bool TryPinImmutableObjectGraph(Local<Value> object);
+
+  /**
+   * Resets the isolate for reuse, as a cheaper alternative to disposing it
+   * and creating a new one. The embedder must have exited all contexts and
+   * should have released its handles to them before calling this. V8 drops
+   * its caches (compilation cache, IC stub caches, descriptor lookup cache)
+   * and runs a memory-reducing garbage collection that returns the heap to
+   * close to its post-snapshot footprint. The read-only heap, the embedded
+   * blob mapping and the isolate's virtual memory reservations are retained,
+   * which is what makes this cheaper than Dispose() followed by New().
+   */
+  void Reset();
+
   /**
    * Optional notification that a context has been disposed. V8 uses these
    * notifications to guide the GC heuristic and cancel FinalizationRegistry
@@ -5,12 +5,15 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
 class Value;
 class String;
 
@@ -40,6 +43,42 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Assembles a JSON document from a sequence of byte chunks, e.g. network
+   * reads, and parses it, without requiring the embedder to concatenate the
+   * chunks into one JavaScript string first. The chunk bytes are buffered
+   * off the V8 heap and decoded once when parsing starts; chunk boundaries
+   * may fall anywhere, including inside a multi-byte UTF-8 sequence.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    explicit StreamingParser(Isolate* isolate);
+    ~StreamingParser();
+
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Appends a chunk of UTF-8 encoded JSON text. The bytes are copied and
+     * the caller's buffer may be reused once this returns.
+     */
+    void Append(const char* data, size_t length);
+
+    /**
+     * Parses the accumulated document. Must be called at most once; a
+     * repeated call reports a fatal API failure. The buffered chunks are
+     * released as they are consumed.
+     *
+     * \param the context in which to parse and create the value.
+     * \return The corresponding value if successfully parsed.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Parse(Local<Context> context);
+
+   private:
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 }  // namespace v8
@@ -100,6 +100,48 @@ struct GarbageCollectionYoungCycle {
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
+// Attributes the pause time of a GC cycle to its main cost centers. Only
+// reported when the --gc-pause-breakdown flag is enabled.
+struct GarbageCollectionPauseBreakdown {
+  struct RootCategory {
+    // Statically allocated name of the root-set category, e.g.
+    // "(Global handles)".
+    const char* name = nullptr;
+    int64_t wall_clock_duration_in_us = -1;
+  };
+  struct EvacuatedSpace {
+    // Statically allocated name of the heap space pages were evacuated from.
+    const char* name = nullptr;
+    int64_t bytes_moved = -1;
+  };
+  int reason = -1;
+  // Time the initiating main thread spent waiting for all other threads to
+  // reach the safepoint.
+  int64_t time_to_safepoint_wall_clock_duration_in_us = -1;
+  // Root-set categories visited during the pause, in visitation order.
+  // Categories that were not visited are omitted.
+  std::vector<RootCategory> root_categories;
+  // Live bytes moved per space during mark-compact evacuation. Spaces without
+  // evacuated pages are omitted.
+  std::vector<EvacuatedSpace> evacuated_spaces;
+};
+
+// Per-instance-type histogram of the live heap, derived from the marking
+// phase of a full GC. Only reported when the --marking-type-stats flag is
+// enabled.
+struct GarbageCollectionObjectTypeHistogram {
+  struct Entry {
+    // Statically allocated name of the instance type, e.g. "JS_OBJECT_TYPE".
+    const char* instance_type_name = nullptr;
+    // Numeric value of the v8::internal::InstanceType.
+    int instance_type = -1;
+    size_t live_bytes = 0;
+    size_t live_count = 0;
+  };
+  // One entry per instance type with live objects; empty types are omitted.
+  std::vector<Entry> entries;
+};
+
 struct WasmModuleDecoded {
   bool async = false;
   bool streamed = false;
@@ -134,6 +176,22 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+/**
+ * Emitted once per finished per-function compilation in any tier. The
+ * function is identified by script id and source positions, which are stable
+ * across processes for the same source, so events can be aggregated to decide
+ * e.g. what to precompile into snapshots.
+ */
+struct FunctionCompiled {
+  // 0 = Ignition (bytecode), 1 = Sparkplug (baseline), 2 = Maglev,
+  // 3 = Turbofan.
+  int tier = -1;
+  int script_id = -1;
+  int start_position = -1;
+  int end_position = -1;
+  int64_t wall_clock_duration_in_us = -1;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -183,9 +241,12 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalSweep)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionYoungCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionPauseBreakdown)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionObjectTypeHistogram)
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(FunctionCompiled)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
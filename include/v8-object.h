@@ -261,6 +261,20 @@ class V8_EXPORT Object : public Value {
                                                        uint32_t index,
                                                        Local<Value> value);
 
+  // Implements CreateDataProperty for a batch of properties.
+  //
+  // Equivalent to calling CreateDataProperty() once per key/value pair, but
+  // enters V8 only once for the whole batch, which is significantly cheaper
+  // when populating an object with many properties. Properties are defined
+  // in order; the operation stops at the first definition that fails or
+  // throws.
+  //
+  // Returns true when all properties were defined successfully.
+  V8_WARN_UNUSED_RESULT Maybe<bool> CreateDataProperties(Local<Context> context,
+                                                         Local<Name>* keys,
+                                                         Local<Value>* values,
+                                                         size_t length);
+
   // Implements DefineOwnProperty.
   //
   // In general, CreateDataProperty will be faster, however, does not allow
@@ -293,6 +307,18 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Batch variant of Get: reads {count} properties off the object while
+   * entering the VM only once, writing the results to {out_values}, which
+   * must have room for {count} handles. This saves the per-call API boundary
+   * overhead for embedders that extract many properties per object. Returns
+   * Nothing if reading a property throws; in that case {out_values} may be
+   * partially written.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetMany(Local<Context> context,
+                                            Local<Value>* keys, size_t count,
+                                            Local<Value>* out_values);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -591,6 +617,28 @@ class V8_EXPORT Object : public Value {
   // TODO(dcarney): take an isolate and optionally bail out?
   Local<Object> Clone();
 
+  /**
+   * Clone this object together with everything reachable from it through
+   * plain objects and arrays, without serializing. Maps are reused, so the
+   * copies stay in the same (fast or dictionary) mode as the originals.
+   * Values other than plain objects and arrays (functions, dates, regexps,
+   * ...) are shared with the source graph rather than copied. Cyclic graphs
+   * are not supported; cloning one fails with an exception.
+   */
+  MaybeLocal<Object> DeepClone(Local<Context> context);
+
+  /**
+   * Creates a deeply-immutable copy of this object's graph in the shared
+   * heap. Plain objects become shared structs with frozen fields, strings
+   * and numbers are shared in place, and aliasing (including cycles) is
+   * preserved, so the result can be handed to other isolates in the same
+   * process without serialization. Fails with an exception if the graph
+   * contains a value that cannot be shared (functions, arrays, exotic
+   * objects, indexed properties). Requires a shared heap
+   * (--shared-string-table).
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<Object> ShareDeep(Local<Context> context);
+
   /**
    * Returns the context in which the object was created.
    */
@@ -682,6 +730,20 @@ class V8_EXPORT Object : public Value {
                            Local<Name>* names, Local<Value>* values,
                            size_t length);
 
+  /**
+   * Declares an object shape up front: eagerly builds the hidden-class
+   * transition chain for a plain object of the given context to which the
+   * given properties are added in order as ordinary data properties. The
+   * values are not stored anywhere; they only determine the field
+   * representations, so they should be representative of the values the
+   * properties will typically hold. Embedders that create many objects with
+   * a fixed set of shapes can call this once per context at startup, making
+   * the first allocation of each shape as fast as the steady state instead
+   * of discovering the transitions at runtime.
+   */
+  static void DeclareShape(Local<Context> context, Local<Name>* names,
+                           Local<Value>* values, size_t length);
+
   V8_INLINE static Object* Cast(Value* obj);
 
   /**
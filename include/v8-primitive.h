@@ -5,6 +5,8 @@
 #ifndef INCLUDE_V8_PRIMITIVE_H_
 #define INCLUDE_V8_PRIMITIVE_H_
 
+#include <memory>
+
 #include "v8-data.h"          // NOLINT(build/include_directory)
 #include "v8-internal.h"      // NOLINT(build/include_directory)
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
@@ -13,6 +15,7 @@
 
 namespace v8 {
 
+class BackingStore;
 class Context;
 class Isolate;
 class String;
@@ -427,6 +430,24 @@ class V8_EXPORT String : public Name {
       Isolate* isolate, const char* data,
       NewStringType type = NewStringType::kNormal, int length = -1);
 
+  /**
+   * Allocates internalized strings for a batch of UTF-8 inputs in one pass,
+   * amortizing the per-call overhead of NewFromUtf8 with
+   * NewStringType::kInternalized. out[i] receives the internalized string for
+   * data[i]. lengths may be nullptr, or individual lengths may be -1, in
+   * which case the corresponding input must be null-terminated. Returns false
+   * without writing to |out| if any input exceeds kMaxLength.
+   *
+   * Intended for embedders that resolve a fixed set of keys up front (e.g.
+   * protocol field names) and keep the handles in an array of v8::Eternal, so
+   * that per-message key lookups become array indexing.
+   **/
+  static V8_WARN_UNUSED_RESULT bool NewFromUtf8Batch(Isolate* isolate,
+                                                     const char* const* data,
+                                                     const int* lengths,
+                                                     size_t count,
+                                                     Local<String>* out);
+
   /** Allocates a new string from Latin-1 data.  Only returns an empty value
    * when length > kMaxLength. **/
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewFromOneByte(
@@ -479,6 +500,20 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new external one-byte string that aliases a range of the given
+   * backing store without copying the characters. The range must contain
+   * Latin-1 data and the caller must guarantee that it is not modified for as
+   * long as the string (or any string derived from it) is live. The string
+   * keeps a reference to the backing store, so detaching the owning
+   * ArrayBuffer or dropping all other references does not free the aliased
+   * memory while the string is reachable.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String>
+  NewExternalOneByteFromBackingStore(Isolate* isolate,
+                                     std::shared_ptr<BackingStore> backing_store,
+                                     size_t byte_offset, size_t length);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -1124,6 +1124,38 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Starts sampling-based accounting of heap bytes per embedder-defined
+   * allocation tag, for embedders that multiplex several tenants within one
+   * isolate. Allocations are sampled using a randomized Poisson process; on
+   * average one allocation is sampled every |sample_interval| bytes, so the
+   * overhead is proportional to the sampling rate and independent of the
+   * allocation volume in between.
+   *
+   * Returns false if allocation tag tracking is already running.
+   */
+  bool StartAllocationTagTracking(uint64_t sample_interval = 512 * 1024);
+
+  /**
+   * Stops allocation tag tracking and discards all accounting data.
+   */
+  void StopAllocationTagTracking();
+
+  /**
+   * Sets the tag attributed to subsequent allocations on this isolate.
+   * Typically bracketed around each unit of work (e.g. a request) on behalf
+   * of a tenant. Has no effect unless allocation tag tracking is running.
+   */
+  void SetCurrentAllocationTag(uint64_t tag);
+
+  /**
+   * Returns an estimate of the bytes currently retained by objects that were
+   * allocated while |tag| was the current allocation tag, extrapolated from
+   * the samples that are still live. Objects collected by the GC stop
+   * counting towards their tag. Returns 0 if tracking is not running.
+   */
+  size_t GetRetainedBytesForAllocationTag(uint64_t tag);
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
@@ -85,6 +85,16 @@ class V8_EXPORT UnboundScript {
    */
   int GetColumnNumber(int code_pos = 0);
 
+  /**
+   * Posts every function of this script that already has bytecode for
+   * compilation with the baseline (Sparkplug) compiler in one background
+   * batch, bypassing the usual warm-up heuristics. Functions that were
+   * compiled lazily and have not run yet are skipped. This is a hint: it does
+   * nothing if baseline or concurrent baseline compilation is unavailable.
+   * Returns whether a batch was posted.
+   */
+  bool CompileAllFunctionsWithBaseline();
+
   static const int kNoScriptId = 0;
 };
 
@@ -466,6 +476,20 @@ class V8_EXPORT ScriptCompiler {
      * V8 has parsed the data it received so far.
      */
     virtual size_t GetMoreData(const uint8_t** src) = 0;
+
+    /**
+     * V8 calls this to learn who owns the chunks returned from GetMoreData().
+     * By default V8 takes ownership and eventually frees each chunk with
+     * delete[], which forces embedders whose source lives in memory they
+     * cannot hand off — e.g. an mmap'd bundle file — to copy every chunk
+     * into a freshly allocated buffer. Overriding this to return true keeps
+     * ownership with the embedder: V8 reads the chunk bytes in place and
+     * never frees them, and the embedder must keep all returned chunks alive
+     * and unmodified until the streaming task and any compilation consuming
+     * this stream (including re-parsing of lazy functions from the same
+     * streamed source) have completed.
+     */
+    virtual bool RetainsOwnershipOfChunks() const { return false; }
   };
 
   /**
@@ -159,6 +159,16 @@ class V8_EXPORT SnapshotCreator {
   /**
    * Created a snapshot data blob.
    * This must not be called from within a handle scope.
+   *
+   * Embedders that repeatedly rebuild large custom snapshots can avoid
+   * recompiling unchanged scripts by keeping a per-script code cache (see
+   * ScriptCompiler::CreateCodeCache) alongside the snapshot, consuming it
+   * with ScriptCompiler::kConsumeCodeCache in the SnapshotCreator's isolate,
+   * and passing FunctionCodeHandling::kKeep here. Cached entries embed a hash
+   * of the script source; entries for scripts that changed since the cache
+   * was produced are rejected and those scripts are recompiled, so only the
+   * modified scripts pay the compilation cost.
+   *
    * \param function_code_handling whether to include compiled function code
    *        in the snapshot.
    * \returns { nullptr, 0 } on failure, and a startup snapshot on success. The
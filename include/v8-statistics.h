@@ -203,11 +203,23 @@ class V8_EXPORT HeapCodeStatistics {
   size_t external_script_source_size() { return external_script_source_size_; }
   size_t cpu_profiler_metadata_size() { return cpu_profiler_metadata_size_; }
 
+  /**
+   * The size of the virtual memory reservation for executable code, and the
+   * part of it that is still allocatable. Both are zero when V8 runs without
+   * a code range (e.g. in jitless mode). The reservation is a hard limit:
+   * when the free size reaches zero, further code allocation aborts, so
+   * embedders of JIT-heavy workloads should monitor these values.
+   */
+  size_t code_range_size() { return code_range_size_; }
+  size_t code_range_free_size() { return code_range_free_size_; }
+
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
   size_t external_script_source_size_;
   size_t cpu_profiler_metadata_size_;
+  size_t code_range_size_;
+  size_t code_range_free_size_;
 
   friend class Isolate;
 };
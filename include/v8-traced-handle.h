@@ -35,6 +35,12 @@ enum class GlobalHandleStoreMode {
 V8_EXPORT internal::Address* GlobalizeTracedReference(
     internal::Isolate* isolate, internal::Address* handle,
     internal::Address* slot, GlobalHandleStoreMode store_mode);
+V8_EXPORT void GlobalizeTracedReferences(internal::Isolate* isolate,
+                                         internal::Address* const* handles,
+                                         internal::Address** out_slots,
+                                         size_t count);
+V8_EXPORT void DisposeTracedReferences(internal::Address* const* locations,
+                                       size_t count);
 V8_EXPORT void MoveTracedReference(internal::Address** from,
                                    internal::Address** to);
 V8_EXPORT void CopyTracedReference(const internal::Address* const* from,
@@ -279,6 +285,22 @@ class TracedReference : public BasicTracedReference<T> {
   template <class S>
   V8_INLINE void Reset(Isolate* isolate, const Local<S>& other);
 
+  /**
+   * Creates |count| TracedReferences in one batch, pointing to the objects
+   * given by the contiguous array |values|. The resulting references are
+   * stored into the contiguous array |out|, whose entries must be empty
+   * references. All entries of |values| must be non-empty. Handle block
+   * management inside V8 is amortized over the whole batch.
+   */
+  static void CreateBatch(Isolate* isolate, const Local<T>* values,
+                          TracedReference<T>* out, size_t count);
+
+  /**
+   * Resets |count| TracedReferences stored in the contiguous array |handles|
+   * in one batch. Equivalent to calling Reset() on each of them.
+   */
+  static void ResetBatch(TracedReference<T>* handles, size_t count);
+
   template <class S>
   V8_INLINE TracedReference<S>& As() const {
     return reinterpret_cast<TracedReference<S>&>(
@@ -298,6 +320,31 @@ internal::Address* BasicTracedReference<T>::New(
       reinterpret_cast<internal::Address*>(slot), store_mode);
 }
 
+template <class T>
+void TracedReference<T>::CreateBatch(Isolate* isolate, const Local<T>* values,
+                                     TracedReference<T>* out, size_t count) {
+  static_assert(sizeof(Local<T>) == sizeof(internal::Address*),
+                "Local must wrap a single pointer");
+  static_assert(sizeof(TracedReference<T>) == sizeof(internal::Address*),
+                "TracedReference must wrap a single pointer");
+  internal::GlobalizeTracedReferences(
+      reinterpret_cast<internal::Isolate*>(isolate),
+      reinterpret_cast<internal::Address* const*>(values),
+      reinterpret_cast<internal::Address**>(out), count);
+}
+
+template <class T>
+void TracedReference<T>::ResetBatch(TracedReference<T>* handles,
+                                    size_t count) {
+  static_assert(sizeof(TracedReference<T>) == sizeof(internal::Address*),
+                "TracedReference must wrap a single pointer");
+  internal::DisposeTracedReferences(
+      reinterpret_cast<internal::Address* const*>(handles), count);
+  for (size_t i = 0; i < count; ++i) {
+    handles[i].SetSlotThreadSafe(nullptr);
+  }
+}
+
 void TracedReferenceBase::Reset() {
   if (IsEmpty()) return;
   internal::DisposeTracedReference(reinterpret_cast<internal::Address*>(val_));
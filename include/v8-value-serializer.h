@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8-maybe.h"         // NOLINT(build/include_directory)
@@ -18,6 +19,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -159,6 +161,28 @@ class V8_EXPORT ValueSerializer {
    */
   V8_WARN_UNUSED_RESULT std::pair<uint8_t*, size_t> Release();
 
+  /**
+   * A piece of the serialized data, produced in vectored output mode. If
+   * |backing_store| is null, |data| points into the serializer's own buffer
+   * and remains valid until Release() is called or the serializer is
+   * destroyed. Otherwise the chunk references the contents of an ArrayBuffer
+   * that was serialized, and |backing_store| keeps that memory alive.
+   */
+  struct OutputChunk {
+    const uint8_t* data;
+    size_t size;
+    std::shared_ptr<BackingStore> backing_store;
+  };
+
+  /**
+   * Returns the serialized data as an ordered list of chunks, suitable for a
+   * scatter/gather write (e.g. writev). May only be called in vectored output
+   * mode; see SetVectoredOutput. Unlike Release(), this does not transfer
+   * ownership of the serializer's buffer: the chunks are invalidated by
+   * Release() or by destroying the serializer.
+   */
+  std::vector<OutputChunk> GetOutputChunks() const;
+
   /**
    * Marks an ArrayBuffer as havings its contents transferred out of band.
    * Pass the corresponding ArrayBuffer in the deserializing context to
@@ -176,6 +200,20 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Indicate whether ArrayBuffer contents should be kept out of line rather
+   * than copied into the serializer's buffer. In this mode the serialized
+   * data must be retrieved with GetOutputChunks(); concatenating the chunks
+   * yields exactly the wire format an ordinary serializer would have
+   * produced, so the deserializing side needs no special support. Chunks
+   * that reference a backing store alias live ArrayBuffer memory: the
+   * embedder must consume them before script can mutate or detach the
+   * buffer.
+   *
+   * The default is to copy ArrayBuffer contents into the buffer.
+   */
+  void SetVectoredOutput(bool mode);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -175,6 +175,17 @@ class V8_EXPORT WasmStreaming final {
    */
   bool SetCompiledModuleBytes(const uint8_t* bytes, size_t size);
 
+  /**
+   * Hints which functions (by index in the module's function index space)
+   * should be compiled first, e.g. because profile data shows that they are
+   * on the startup path. Compilation units of these functions are scheduled
+   * ahead of other functions' as their bytes arrive, both for baseline
+   * compilation and for eager tier-up. This is a pure scheduling hint; it
+   * does not change which functions get compiled or to which tier. Must be
+   * called before {OnBytesReceived}.
+   */
+  void SetFunctionsToCompileFirst(MemorySpan<const uint32_t> function_indices);
+
   /**
    * Sets a callback which is called whenever a significant number of new
    * functions are ready for serialization.
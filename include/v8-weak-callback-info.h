@@ -25,8 +25,12 @@ class WeakCallbackInfo {
 
   WeakCallbackInfo(Isolate* isolate, T* parameter,
                    void* embedder_fields[kEmbedderFieldsInWeakCallback],
-                   Callback* callback)
-      : isolate_(isolate), parameter_(parameter), callback_(callback) {
+                   Callback* callback,
+                   bool* second_pass_thread_safe = nullptr)
+      : isolate_(isolate),
+        parameter_(parameter),
+        callback_(callback),
+        second_pass_thread_safe_(second_pass_thread_safe) {
     for (int i = 0; i < kEmbedderFieldsInWeakCallback; ++i) {
       embedder_fields_[i] = embedder_fields[i];
     }
@@ -44,11 +48,23 @@ class WeakCallbackInfo {
   // Calling SetSecondPassCallback on the second pass will immediately crash.
   void SetSecondPassCallback(Callback callback) const { *callback_ = callback; }
 
+  // As SetSecondPassCallback, but additionally marks the callback as safe to
+  // run off the main thread. Such callbacks may be batched and invoked on a
+  // worker thread after the garbage collection has finished; they must not
+  // call any V8 APIs or otherwise touch the isolate. Use
+  // Isolate::HasPendingThreadSafeSecondPassCallbacks as a completion fence.
+  // Calling this on the second pass will immediately crash.
+  void SetThreadSafeSecondPassCallback(Callback callback) const {
+    *callback_ = callback;
+    *second_pass_thread_safe_ = true;
+  }
+
  private:
   Isolate* isolate_;
   T* parameter_;
   Callback* callback_;
   void* embedder_fields_[kEmbedderFieldsInWeakCallback];
+  bool* second_pass_thread_safe_;
 };
 
 /**
@@ -9,6 +9,7 @@
 #include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>  // For move
 #include <vector>
 
@@ -28,12 +29,14 @@
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/bits.h"
 #include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
 #include "src/base/safe_conversions.h"
+#include "src/base/small-vector.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/builtins/accessors.h"
@@ -63,9 +66,12 @@
 #include "src/handles/global-handles.h"
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
+#include "src/heap/basic-memory-chunk.h"
+#include "src/heap/code-range.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-write-barrier.h"
+#include "src/heap/read-only-heap.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/icu_util.h"
@@ -80,8 +86,10 @@
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/contexts.h"
+#include "src/objects/descriptor-array-inl.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/js-array-buffer-inl.h"
@@ -127,7 +135,10 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
 #include "src/utils/version.h"
+
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
 #include "src/web-snapshot/web-snapshot.h"
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/trap-handler/trap-handler.h"
@@ -601,8 +612,9 @@ StartupData SnapshotCreator::CreateBlob(
     i_isolate->heap()->SetSerializedGlobalProxySizes(*global_proxy_sizes);
   }
 
-  // We might rehash strings and re-sort descriptors. Clear the lookup cache.
+  // We might rehash strings and re-sort descriptors. Clear the lookup caches.
   i_isolate->descriptor_lookup_cache()->Clear();
+  i_isolate->negative_lookup_cache()->Clear();
 
   // If we don't do this then we end up with a stray root pointing at the
   // context even after we have disposed of the context.
@@ -811,10 +823,33 @@ void CopyTracedReference(const internal::Address* const* from,
   GlobalHandles::CopyTracedReference(from, to);
 }
 
+void GlobalizeTracedReferences(i::Isolate* i_isolate,
+                               i::Address* const* handles,
+                               i::Address** out_slots, size_t count) {
+  API_RCS_SCOPE(i_isolate, TracedGlobal, New);
+  i_isolate->global_handles()->CreateTracedBatch(handles, out_slots, count);
+#ifdef VERIFY_HEAP
+  if (i::v8_flags.verify_heap) {
+    for (size_t i = 0; i < count; ++i) {
+      i::Object(*handles[i]).ObjectVerify(i_isolate);
+    }
+  }
+#endif  // VERIFY_HEAP
+}
+
 void DisposeTracedReference(internal::Address* location) {
   GlobalHandles::DestroyTracedReference(location);
 }
 
+void DisposeTracedReferences(internal::Address* const* locations,
+                             size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    if (locations[i] != nullptr) {
+      GlobalHandles::DestroyTracedReference(locations[i]);
+    }
+  }
+}
+
 }  // namespace internal
 
 namespace api_internal {
@@ -830,6 +865,19 @@ i::Address* GlobalizeReference(i::Isolate* i_isolate, i::Address* obj) {
   return result.location();
 }
 
+void GlobalizeReferences(i::Isolate* i_isolate, i::Address* const* handles,
+                         i::Address** out_locations, size_t count) {
+  API_RCS_SCOPE(i_isolate, Persistent, New);
+  i_isolate->global_handles()->CreateBatch(handles, out_locations, count);
+#ifdef VERIFY_HEAP
+  if (i::v8_flags.verify_heap) {
+    for (size_t i = 0; i < count; ++i) {
+      i::Object(*handles[i]).ObjectVerify(i_isolate);
+    }
+  }
+#endif  // VERIFY_HEAP
+}
+
 i::Address* CopyGlobalReference(i::Address* from) {
   i::Handle<i::Object> result = i::GlobalHandles::CopyGlobal(from);
   return result.location();
@@ -861,6 +909,14 @@ void DisposeGlobal(i::Address* location) {
   i::GlobalHandles::Destroy(location);
 }
 
+void DisposeGlobals(i::Address* const* locations, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    if (locations[i] != nullptr) {
+      i::GlobalHandles::Destroy(locations[i]);
+    }
+  }
+}
+
 Value* Eternalize(Isolate* v8_isolate, Value* value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   i::Object object = *Utils::OpenHandle(value);
@@ -2028,6 +2084,17 @@ int UnboundScript::GetColumnNumber(int code_pos) {
   }
 }
 
+bool UnboundScript::CompileAllFunctionsWithBaseline() {
+  i::Handle<i::SharedFunctionInfo> obj =
+      i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
+  i::Isolate* i_isolate = obj->GetIsolate();
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, UnboundScript, CompileAllFunctionsWithBaseline);
+  if (!obj->script().IsScript()) return false;
+  return i_isolate->baseline_batch_compiler()->CompileScriptConcurrent(
+      i::Script::cast(obj->script()));
+}
+
 Local<Value> UnboundScript::GetScriptName() {
   i::Handle<i::SharedFunctionInfo> obj =
       i::Handle<i::SharedFunctionInfo>::cast(Utils::OpenHandle(this));
@@ -2126,6 +2193,7 @@ MaybeLocal<Value> Script::Run(Local<Context> context,
     }
   }
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   if (V8_UNLIKELY(i::v8_flags.experimental_web_snapshots)) {
     i::Handle<i::HeapObject> maybe_script =
         handle(fun->shared().script(), i_isolate);
@@ -2140,6 +2208,7 @@ MaybeLocal<Value> Script::Run(Local<Context> context,
       RETURN_ESCAPED(result);
     }
   }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   i::Handle<i::Object> receiver = i_isolate->global_proxy();
   // TODO(cbruni, chromium:1244145): Remove once migrated to the context.
@@ -3369,6 +3438,61 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  explicit PrivateData(i::Isolate* i_isolate) : isolate(i_isolate) {}
+  i::Isolate* isolate;
+  std::vector<std::vector<char>> chunks;
+  size_t total_length = 0;
+  bool parsed = false;
+};
+
+JSON::StreamingParser::StreamingParser(Isolate* v8_isolate)
+    : private_(
+          new PrivateData(reinterpret_cast<i::Isolate*>(v8_isolate))) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+void JSON::StreamingParser::Append(const char* data, size_t length) {
+  private_->chunks.emplace_back(data, data + length);
+  private_->total_length += length;
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Parse(Local<Context> context) {
+  Utils::ApiCheck(!private_->parsed, "v8::JSON::StreamingParser::Parse",
+                  "Parse called more than once");
+  private_->parsed = true;
+  // Assemble the chunks into one buffer, releasing each chunk as soon as it
+  // has been copied so peak memory stays close to the document size.
+  std::vector<char> merged;
+  merged.reserve(private_->total_length);
+  for (auto& chunk : private_->chunks) {
+    merged.insert(merged.end(), chunk.begin(), chunk.end());
+    std::vector<char>().swap(chunk);
+  }
+  private_->chunks.clear();
+  private_->total_length = 0;
+
+  PREPARE_FOR_EXECUTION(context, JSON, Parse, Value);
+  i::Handle<i::String> source;
+  has_pending_exception =
+      !i_isolate->factory()
+           ->NewStringFromUtf8(base::VectorOf(merged))
+           .ToHandle(&source);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  // The decoded string is flat; the raw bytes are no longer needed while
+  // parsing.
+  std::vector<char>().swap(merged);
+  i::Handle<i::Object> undefined = i_isolate->factory()->undefined_value();
+  auto maybe =
+      source->IsOneByteRepresentation()
+          ? i::JsonParser<uint8_t>::Parse(i_isolate, source, undefined)
+          : i::JsonParser<uint16_t>::Parse(i_isolate, source, undefined);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(maybe, &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3451,6 +3575,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetVectoredOutput(bool mode) {
+  private_->serializer.SetVectoredOutput(mode);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -3467,6 +3595,17 @@ std::pair<uint8_t*, size_t> ValueSerializer::Release() {
   return private_->serializer.Release();
 }
 
+std::vector<ValueSerializer::OutputChunk> ValueSerializer::GetOutputChunks()
+    const {
+  std::vector<OutputChunk> chunks;
+  for (const auto& chunk : private_->serializer.GetOutputChunks()) {
+    std::shared_ptr<i::BackingStoreBase> bs_base = chunk.backing_store;
+    chunks.push_back({chunk.data, chunk.size,
+                      std::static_pointer_cast<v8::BackingStore>(bs_base)});
+  }
+  return chunks;
+}
+
 void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
                                           Local<ArrayBuffer> array_buffer) {
   private_->serializer.TransferArrayBuffer(transfer_id,
@@ -4423,6 +4562,53 @@ Maybe<bool> v8::Object::CreateDataProperty(v8::Local<v8::Context> context,
   }
 }
 
+namespace {
+
+template <typename Receiver>
+Maybe<bool> CreateDataPropertiesImpl(i::Isolate* i_isolate,
+                                     i::Handle<i::JSReceiver> self,
+                                     Local<Name>* keys, Local<Value>* values,
+                                     size_t length) {
+  for (size_t i = 0; i < length; ++i) {
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*keys[i]);
+    i::Handle<i::Object> value_obj = Utils::OpenHandle(*values[i]);
+    i::PropertyKey lookup_key(i_isolate, key_obj);
+    i::LookupIterator it(i_isolate, self, lookup_key, i::LookupIterator::OWN);
+    Maybe<bool> result =
+        Receiver::CreateDataProperty(&it, value_obj, Just(i::kDontThrow));
+    if (result.IsNothing() || !result.FromJust()) return result;
+  }
+  return Just(true);
+}
+
+}  // namespace
+
+Maybe<bool> v8::Object::CreateDataProperties(v8::Local<v8::Context> context,
+                                             Local<Name>* keys,
+                                             Local<Value>* values,
+                                             size_t length) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  i::Handle<i::JSReceiver> self = Utils::OpenHandle(this);
+
+  if (self->IsJSProxy()) {
+    ENTER_V8(i_isolate, context, Object, CreateDataProperties, Nothing<bool>(),
+             i::HandleScope);
+    Maybe<bool> result = CreateDataPropertiesImpl<i::JSReceiver>(
+        i_isolate, self, keys, values, length);
+    has_pending_exception = result.IsNothing();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    return result;
+  } else {
+    ENTER_V8_NO_SCRIPT(i_isolate, context, Object, CreateDataProperties,
+                       Nothing<bool>(), i::HandleScope);
+    Maybe<bool> result = CreateDataPropertiesImpl<i::JSObject>(
+        i_isolate, self, keys, values, length);
+    has_pending_exception = result.IsNothing();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    return result;
+  }
+}
+
 struct v8::PropertyDescriptor::PrivateData {
   PrivateData() : desc() {}
   i::PropertyDescriptor desc;
@@ -4617,6 +4803,30 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+Maybe<bool> v8::Object::GetMany(Local<Context> context, Local<Value>* keys,
+                                size_t count, Local<Value>* out_values) {
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  if (i_isolate->is_execution_terminating()) return Nothing<bool>();
+  // Deliberately no internal HandleScope: the result handles are created
+  // directly in the currently entered scope so that they survive the return
+  // to the caller.
+  CallDepthScope<false> call_depth_scope(i_isolate, context);
+  API_RCS_SCOPE(i_isolate, Object, GetMany);
+  i::VMState<v8::OTHER> state(i_isolate);
+  bool has_pending_exception = false;
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; ++i) {
+    auto key_obj = Utils::OpenHandle(*keys[i]);
+    i::Handle<i::Object> result;
+    has_pending_exception =
+        !i::Runtime::GetObjectProperty(i_isolate, self, key_obj)
+             .ToHandle(&result);
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    out_values[i] = Utils::ToLocal(result);
+  }
+  return Just(true);
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, Local<Value>(reinterpret_cast<Value*>(*key)));
@@ -5142,6 +5352,28 @@ Local<v8::Object> v8::Object::Clone() {
   return Utils::ToLocal(result);
 }
 
+MaybeLocal<v8::Object> v8::Object::DeepClone(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, Object, DeepClone, Object);
+  auto self = i::Handle<i::JSObject>::cast(Utils::OpenHandle(this));
+  Local<Object> result;
+  has_pending_exception =
+      !ToLocal<Object>(i::JSObject::DeepCopy(i_isolate, self), &result);
+  RETURN_ON_FAILED_EXECUTION(Object);
+  RETURN_ESCAPED(result);
+}
+
+MaybeLocal<v8::Object> v8::Object::ShareDeep(Local<Context> context) {
+  Utils::ApiCheck(i::v8_flags.shared_string_table, "v8::Object::ShareDeep",
+                  "Sharing requires a shared heap (--shared-string-table)");
+  PREPARE_FOR_EXECUTION(context, Object, ShareDeep, Object);
+  auto self = Utils::OpenHandle(this);
+  Local<Object> result;
+  has_pending_exception = !ToLocal<Object>(
+      i::Object::ShareDeep(i_isolate, self, i::kThrowOnError), &result);
+  RETURN_ON_FAILED_EXECUTION(Object);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<v8::Context> v8::Object::GetCreationContext() {
   auto self = Utils::OpenHandle(this);
   i::Handle<i::Context> context;
@@ -6302,7 +6534,9 @@ HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0),
-      cpu_profiler_metadata_size_(0) {}
+      cpu_profiler_metadata_size_(0),
+      code_range_size_(0),
+      code_range_free_size_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -7005,6 +7239,31 @@ MaybeLocal<String> String::NewFromUtf8(Isolate* v8_isolate, const char* data,
   return result;
 }
 
+bool String::NewFromUtf8Batch(Isolate* v8_isolate, const char* const* data,
+                              const int* lengths, size_t count,
+                              Local<String>* out) {
+  i::Isolate* i_isolate = reinterpret_cast<internal::Isolate*>(v8_isolate);
+  // Resolve and validate all lengths up front so that |out| is only written
+  // on success.
+  base::SmallVector<int, 64> resolved_lengths(count);
+  for (size_t i = 0; i < count; i++) {
+    int length = lengths == nullptr ? -1 : lengths[i];
+    if (length < 0) length = StringLength(data[i]);
+    if (length > i::String::kMaxLength) return false;
+    resolved_lengths[i] = length;
+  }
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewFromUtf8Batch);
+  for (size_t i = 0; i < count; i++) {
+    i::Handle<i::String> handle_result =
+        NewString(i_isolate->factory(), NewStringType::kInternalized,
+                  base::Vector<const char>(data[i], resolved_lengths[i]))
+            .ToHandleChecked();
+    out[i] = Utils::ToLocal(handle_result);
+  }
+  return true;
+}
+
 MaybeLocal<String> String::NewFromOneByte(Isolate* v8_isolate,
                                           const uint8_t* data,
                                           NewStringType type, int length) {
@@ -7081,6 +7340,59 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+namespace {
+
+// A one-byte string resource that aliases a range of a backing store and
+// keeps the backing store alive for the lifetime of the string, so that
+// detaching the owning ArrayBuffer cannot free the aliased characters.
+class BackingStoreOneByteStringResource
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  BackingStoreOneByteStringResource(
+      std::shared_ptr<v8::BackingStore> backing_store, size_t byte_offset,
+      size_t length)
+      : backing_store_(std::move(backing_store)),
+        byte_offset_(byte_offset),
+        length_(length) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(backing_store_->Data()) + byte_offset_;
+  }
+  size_t length() const override { return length_; }
+
+ private:
+  std::shared_ptr<v8::BackingStore> backing_store_;
+  size_t byte_offset_;
+  size_t length_;
+};
+
+}  // namespace
+
+MaybeLocal<String> v8::String::NewExternalOneByteFromBackingStore(
+    Isolate* v8_isolate, std::shared_ptr<BackingStore> backing_store,
+    size_t byte_offset, size_t length) {
+  CHECK(backing_store);
+  CHECK_LE(byte_offset, backing_store->ByteLength());
+  CHECK_LE(length, backing_store->ByteLength() - byte_offset);
+  // TODO(dcarney): throw a context free exception.
+  if (length > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalOneByteFromBackingStore);
+  if (length == 0) {
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  auto resource = std::make_unique<BackingStoreOneByteStringResource>(
+      std::move(backing_store), byte_offset, length);
+  i::Handle<i::String> string =
+      i_isolate->factory()
+          ->NewExternalStringFromOneByte(resource.release())
+          .ToHandleChecked();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
@@ -7279,6 +7591,35 @@ Local<v8::Object> v8::Object::New(Isolate* v8_isolate,
   }
 }
 
+void v8::Object::DeclareShape(Local<Context> context, Local<Name>* names,
+                              Local<Value>* values, size_t length) {
+  i::Handle<i::Context> env = Utils::OpenHandle(*context);
+  i::Isolate* i_isolate = env->GetIsolate();
+  API_RCS_SCOPE(i_isolate, Object, DeclareShape);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::HandleScope scope(i_isolate);
+
+  // Walk (and thereby eagerly create) the transition chain that adding the
+  // given properties in order to a fresh plain object would take, exactly as
+  // a named store would. The values only determine the field representations
+  // and are not retained.
+  i::Handle<i::JSFunction> constructor(
+      env->native_context().object_function(), i_isolate);
+  i::Handle<i::Map> map(constructor->initial_map(), i_isolate);
+  for (size_t i = 0; i < length; ++i) {
+    i::Handle<i::Name> name = Utils::OpenHandle(*names[i]);
+    // Array indices are stored in the elements backing store and have no
+    // bearing on the shape.
+    uint32_t index;
+    if (name->AsArrayIndex(&index)) continue;
+    name = i_isolate->factory()->InternalizeName(name);
+    i::Handle<i::Object> value = Utils::OpenHandle(*values[i]);
+    map = i::Map::TransitionToDataProperty(
+        i_isolate, map, name, value, i::NONE, i::PropertyConstness::kConst,
+        i::StoreOrigin::kNamed);
+  }
+}
+
 Local<v8::Value> v8::NumberObject::New(Isolate* v8_isolate, double value) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   API_RCS_SCOPE(i_isolate, NumberObject, New);
@@ -7552,6 +7893,29 @@ Local<v8::Map> v8::Map::New(Isolate* v8_isolate) {
   return Utils::ToLocal(obj);
 }
 
+Local<v8::Map> v8::Map::New(Isolate* v8_isolate, size_t expected_size) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  API_RCS_SCOPE(i_isolate, Map, New);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::JSMap> obj = i_isolate->factory()->NewJSMap();
+  if (expected_size >
+      static_cast<size_t>(i::OrderedHashMap::kInitialCapacity)) {
+    // OrderedHashMap capacities are powers of two; clamp oversized hints to
+    // the largest power of two the table implementation supports.
+    const size_t max_capacity =
+        static_cast<size_t>(base::bits::RoundDownToPowerOfTwo32(
+            static_cast<uint32_t>(i::OrderedHashMap::MaxCapacity())));
+    int capacity = static_cast<int>(std::min(expected_size, max_capacity));
+    i::Handle<i::OrderedHashMap> table;
+    if (i::OrderedHashMap::Allocate(i_isolate, capacity).ToHandle(&table)) {
+      obj->set_table(*table);
+    }
+    // On allocation failure the map keeps its default-sized table and grows
+    // on demand as usual.
+  }
+  return Utils::ToLocal(obj);
+}
+
 size_t v8::Map::Size() const {
   i::Handle<i::JSMap> obj = Utils::OpenHandle(this);
   return i::OrderedHashMap::cast(obj->table()).NumberOfElements();
@@ -8555,6 +8919,22 @@ void Isolate::ClearKeptObjects() {
   i_isolate->ClearKeptObjects();
 }
 
+bool Isolate::SetFinalizationRegistryNativeCleanup(
+    Local<Value> finalization_registry,
+    FinalizationRegistryNativeCleanupCallback callback, void* data) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  i::Handle<i::Object> obj = Utils::OpenHandle(*finalization_registry);
+  if (!obj->IsJSFinalizationRegistry()) return false;
+  i::Handle<i::JSFinalizationRegistry> registry =
+      i::Handle<i::JSFinalizationRegistry>::cast(obj);
+  registry->set_native_cleanup(*i_isolate->factory()->NewForeign(
+      reinterpret_cast<i::Address>(callback)));
+  registry->set_native_cleanup_data(
+      *i_isolate->factory()->NewForeign(reinterpret_cast<i::Address>(data)));
+  return true;
+}
+
 v8::Local<v8::Context> Isolate::GetCurrentContext() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i::Context context = i_isolate->context();
@@ -8708,6 +9088,12 @@ void Isolate::RequestInterrupt(InterruptCallback callback, void* data) {
   i_isolate->RequestInterrupt(callback, data);
 }
 
+void Isolate::SetCpuTimeSliceBudget(double slice_ms, InterruptCallback callback,
+                                    void* data) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->SetCpuTimeSlice(slice_ms, callback, data);
+}
+
 bool Isolate::HasPendingBackgroundTasks() {
 #if V8_ENABLE_WEBASSEMBLY
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -9176,6 +9562,12 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   code_statistics->cpu_profiler_metadata_size_ =
       i::CpuProfiler::GetAllProfilersMemorySize(i_isolate);
 
+  if (i::CodeRange* code_range = i_isolate->heap()->code_range()) {
+    code_statistics->code_range_size_ = code_range->page_allocator()->size();
+    code_statistics->code_range_free_size_ =
+        code_range->page_allocator()->free_size();
+  }
+
   return true;
 }
 
@@ -9382,6 +9774,127 @@ void Isolate::LowMemoryNotification() {
   }
 }
 
+bool Isolate::HasPendingThreadSafeSecondPassCallbacks() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  return i_isolate->global_handles()->HasPendingThreadSafeSecondPassCallbacks();
+}
+
+namespace {
+
+// Validates that every object reachable from {root} through own properties
+// and elements is deeply frozen, free of external state, and of a shape whose
+// heap layout cannot change anymore, collecting the graph into {graph}.
+// Prototypes are deliberately not followed: shared prototypes like
+// Object.prototype stay ordinary mutable objects outside the pinned graph.
+bool ValidateImmutableGraph(i::Isolate* i_isolate, i::Handle<i::Object> root,
+                            std::vector<i::HeapObject>* graph) {
+  i::DisallowGarbageCollection no_gc;
+  std::unordered_set<i::Address> visited;
+  std::vector<i::HeapObject> worklist;
+  auto enqueue = [&](i::Object value) {
+    if (!value.IsHeapObject()) return;
+    i::HeapObject heap_object = i::HeapObject::cast(value);
+    if (i::ReadOnlyHeap::Contains(heap_object)) return;
+    if (visited.insert(heap_object.address()).second) {
+      worklist.push_back(heap_object);
+    }
+  };
+  enqueue(*root);
+  while (!worklist.empty()) {
+    i::HeapObject current = worklist.back();
+    worklist.pop_back();
+    graph->push_back(current);
+    if (current.IsString()) {
+      // String contents are immutable, but external strings carry embedder
+      // state.
+      if (current.IsExternalString()) return false;
+      continue;
+    }
+    if (current.IsHeapNumber()) continue;
+    if (!current.IsJSObject()) return false;
+    i::JSObject js_object = i::JSObject::cast(current);
+    i::Map map = js_object.map();
+    i::InstanceType instance_type = map.instance_type();
+    if (instance_type != i::JS_OBJECT_TYPE &&
+        instance_type != i::JS_ARRAY_TYPE) {
+      return false;
+    }
+    if (map.is_access_check_needed() || map.has_named_interceptor() ||
+        map.has_indexed_interceptor() || map.is_dictionary_map() ||
+        map.IsCustomElementsReceiverMap()) {
+      return false;
+    }
+    if (js_object.GetEmbedderFieldCount() > 0) return false;
+    if (js_object.HasSloppyArgumentsElements()) return false;
+    if (!i::JSObject::TestIntegrityLevel(i::handle(js_object, i_isolate),
+                                         i::FROZEN)
+             .FromJust()) {
+      return false;
+    }
+    i::DescriptorArray descriptors = map.instance_descriptors();
+    for (i::InternalIndex index : map.IterateOwnDescriptors()) {
+      i::PropertyDetails details = descriptors.GetDetails(index);
+      if (details.kind() == i::PropertyKind::kAccessor) {
+        // Engine-implemented accessors like the frozen array's "length" are
+        // fine; JavaScript accessor pairs are mutable state.
+        if (details.location() != i::PropertyLocation::kDescriptor ||
+            !descriptors.GetStrongValue(index).IsAccessorInfo()) {
+          return false;
+        }
+        continue;
+      }
+      if (details.location() == i::PropertyLocation::kField) {
+        enqueue(js_object.RawFastPropertyAt(
+            i::FieldIndex::ForDescriptor(map, index)));
+      } else {
+        enqueue(descriptors.GetStrongValue(index));
+      }
+    }
+    if (i::IsFrozenElementsKind(js_object.GetElementsKind())) {
+      i::FixedArray elements = i::FixedArray::cast(js_object.elements());
+      for (int i = 0; i < elements.length(); i++) enqueue(elements.get(i));
+    } else if (js_object.elements().length() != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool Isolate::TryPinImmutableObjectGraph(Local<Value> object) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScope scope(i_isolate);
+  i::Handle<i::Object> root = Utils::OpenHandle(*object);
+  if (!root->IsHeapObject()) return true;
+  std::vector<i::HeapObject> graph;
+  if (!ValidateImmutableGraph(i_isolate, root, &graph)) return false;
+  {
+    i::DisallowGarbageCollection no_gc;
+    for (i::HeapObject graph_object : graph) {
+      i::BasicMemoryChunk* chunk =
+          i::BasicMemoryChunk::FromHeapObject(graph_object);
+      // Only old-space pages take part in compaction; large pages are never
+      // moved and new-space objects are relocated by the next GC anyway.
+      if (chunk->owner()->identity() == i::OLD_SPACE) {
+        chunk->MarkNeverEvacuate();
+      }
+    }
+  }
+  // Root the graph for the rest of the isolate's lifetime.
+  int index;
+  i_isolate->eternal_handles()->Create(i_isolate, *root, &index);
+  return true;
+}
+
+void Isolate::Reset() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  Utils::ApiCheck(i_isolate->context().is_null(), "v8::Isolate::Reset",
+                  "Cannot reset an isolate while a context is entered");
+  TRACE_EVENT0("v8", "V8.IsolateReset");
+  i_isolate->ResetForReuse();
+}
+
 int Isolate::ContextDisposedNotification(bool dependant_context) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
 #if V8_ENABLE_WEBASSEMBLY
@@ -10435,6 +10948,24 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+bool HeapProfiler::StartAllocationTagTracking(uint64_t sample_interval) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->StartAllocationTagTracking(
+      sample_interval);
+}
+
+void HeapProfiler::StopAllocationTagTracking() {
+  reinterpret_cast<i::HeapProfiler*>(this)->StopAllocationTagTracking();
+}
+
+void HeapProfiler::SetCurrentAllocationTag(uint64_t tag) {
+  reinterpret_cast<i::HeapProfiler*>(this)->SetCurrentAllocationTag(tag);
+}
+
+size_t HeapProfiler::GetRetainedBytesForAllocationTag(uint64_t tag) {
+  return reinterpret_cast<i::HeapProfiler*>(this)
+      ->GetRetainedBytesForAllocationTag(tag);
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
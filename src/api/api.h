@@ -342,10 +342,10 @@ class HandleScopeImplementer {
 
   explicit HandleScopeImplementer(Isolate* isolate)
       : isolate_(isolate),
-        spare_(nullptr),
+        spare_block_count_(0),
         last_handle_before_deferred_block_(nullptr) {}
 
-  ~HandleScopeImplementer() { DeleteArray(spare_); }
+  ~HandleScopeImplementer() { FreeSpareBlocks(); }
 
   HandleScopeImplementer(const HandleScopeImplementer&) = delete;
   HandleScopeImplementer& operator=(const HandleScopeImplementer&) = delete;
@@ -385,8 +385,7 @@ class HandleScopeImplementer {
 
   void ReturnBlock(Address* block) {
     DCHECK_NOT_NULL(block);
-    if (spare_ != nullptr) DeleteArray(spare_);
-    spare_ = block;
+    CacheSpareBlock(block);
   }
 
   static const size_t kEnteredContextsOffset;
@@ -398,7 +397,8 @@ class HandleScopeImplementer {
     entered_contexts_.detach();
     is_microtask_context_.detach();
     saved_contexts_.detach();
-    spare_ = nullptr;
+    // The archived copy keeps ownership of the cached spare blocks.
+    spare_block_count_ = 0;
     last_handle_before_deferred_block_ = nullptr;
   }
 
@@ -412,16 +412,29 @@ class HandleScopeImplementer {
     entered_contexts_.free();
     is_microtask_context_.free();
     saved_contexts_.free();
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-      spare_ = nullptr;
-    }
+    FreeSpareBlocks();
     DCHECK(isolate_->thread_local_top()->CallDepthIsZero());
   }
 
   void BeginDeferredScope();
   std::unique_ptr<PersistentHandles> DetachPersistent(Address* first_block);
 
+  // Takes ownership of |block|, keeping it for reuse by a later scope or
+  // freeing it if the cache is already full.
+  void CacheSpareBlock(Address* block) {
+    if (spare_block_count_ == kSpareBlockCapacity) {
+      DeleteArray(block);
+      return;
+    }
+    spare_blocks_[spare_block_count_++] = block;
+  }
+
+  void FreeSpareBlocks() {
+    while (spare_block_count_ > 0) {
+      DeleteArray(spare_blocks_[--spare_block_count_]);
+    }
+  }
+
   Isolate* isolate_;
   DetachableVector<Address*> blocks_;
 
@@ -435,7 +448,13 @@ class HandleScopeImplementer {
 
   // Used as a stack to keep track of saved contexts.
   DetachableVector<Context> saved_contexts_;
-  Address* spare_;
+  // Handle blocks recycled across scopes. Scope teardown parks blocks here
+  // instead of freeing them, so that the parser and compiler front-end,
+  // which repeatedly grow and shrink scopes, do not hit the system
+  // allocator for every block.
+  static const int kSpareBlockCapacity = 8;
+  Address* spare_blocks_[kSpareBlockCapacity];
+  int spare_block_count_;
   Address* last_handle_before_deferred_block_;
   // This is only used for threading support.
   HandleScopeData handle_scope_data_;
@@ -478,11 +497,8 @@ bool HandleScopeImplementer::LastEnteredContextWas(Context context) {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Address* HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Address* block =
-      (spare_ != nullptr) ? spare_
-                          : NewArray<internal::Address>(kHandleBlockSize);
-  spare_ = nullptr;
-  return block;
+  if (spare_block_count_ > 0) return spare_blocks_[--spare_block_count_];
+  return NewArray<internal::Address>(kHandleBlockSize);
 }
 
 void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
@@ -507,10 +523,7 @@ void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-    }
-    spare_ = block_start;
+    CacheSpareBlock(block_start);
   }
   DCHECK((blocks_.empty() && prev_limit == nullptr) ||
          (!blocks_.empty() && prev_limit != nullptr));
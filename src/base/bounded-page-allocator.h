@@ -68,6 +68,10 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
   Address begin() const;
   size_t size() const;
 
+  // Returns the amount of allocatable space that is still available in the
+  // range controlled by this allocator instance.
+  size_t free_size();
+
   // Returns true if given address is in the range controlled by the bounded
   // page allocator instance.
   bool contains(Address address) const {
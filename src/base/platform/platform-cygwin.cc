@@ -204,6 +204,21 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // No huge-page hinting on Cygwin.
+}
+
+// static
+void OS::AdviseWillNeed(void* address, size_t size) {
+  // No prefetch hinting on Cygwin.
+}
+
+// static
+void OS::AdviseMergeable(void* address, size_t size) {
+  // No samepage-merging hinting on Cygwin.
+}
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
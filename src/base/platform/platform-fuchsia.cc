@@ -318,6 +318,21 @@ bool OS::DecommitPages(void* address, size_t size) {
          DiscardSystemPages(address, size);
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // No huge-page hinting on Fuchsia.
+}
+
+// static
+void OS::AdviseWillNeed(void* address, size_t size) {
+  // No prefetch hinting on Fuchsia.
+}
+
+// static
+void OS::AdviseMergeable(void* address, size_t size) {
+  // No samepage-merging hinting on Fuchsia.
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
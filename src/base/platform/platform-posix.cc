@@ -604,6 +604,37 @@ bool OS::DecommitPages(void* address, size_t size) {
 }
 #endif  // !defined(_AIX)
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+#if defined(V8_OS_LINUX)
+  // Transparent huge pages on Linux are 2 MB; madvise only applies to whole
+  // huge pages within the region.
+  constexpr uintptr_t kTransparentHugePageSize = uintptr_t{1} << 21;
+  const uintptr_t huge_start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kTransparentHugePageSize);
+  const uintptr_t huge_end = RoundDown(
+      reinterpret_cast<uintptr_t>(address) + size, kTransparentHugePageSize);
+  if (huge_end > huge_start) {
+    madvise(reinterpret_cast<void*>(huge_start), huge_end - huge_start,
+            MADV_HUGEPAGE);
+  }
+#endif  // defined(V8_OS_LINUX)
+}
+
+// static
+void OS::AdviseWillNeed(void* address, size_t size) {
+#if defined(MADV_WILLNEED)
+  madvise(address, size, MADV_WILLNEED);
+#endif
+}
+
+// static
+void OS::AdviseMergeable(void* address, size_t size) {
+#if defined(MADV_MERGEABLE)
+  madvise(address, size, MADV_MERGEABLE);
+#endif
+}
+
 // static
 bool OS::CanReserveAddressSpace() { return true; }
 
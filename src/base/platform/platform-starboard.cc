@@ -490,6 +490,21 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // Starboard API does not support this function yet.
+}
+
+// static
+void OS::AdviseWillNeed(void* address, size_t size) {
+  // Starboard API does not support this function yet.
+}
+
+// static
+void OS::AdviseMergeable(void* address, size_t size) {
+  // Starboard API does not support this function yet.
+}
+
 // static
 Stack::StackSlot Stack::GetCurrentStackPosition() {
   void* addresses[kStackSize];
@@ -1070,6 +1070,23 @@ bool OS::DecommitPages(void* address, size_t size) {
   return VirtualFree(address, size, MEM_DECOMMIT) != 0;
 }
 
+// static
+void OS::AdviseHugePages(void* address, size_t size) {
+  // Large-page support on Windows requires a privileged commit-time
+  // allocation; there is no madvise-style hint.
+}
+
+// static
+void OS::AdviseWillNeed(void* address, size_t size) {
+  // PrefetchVirtualMemory exists on Windows 8+, but the callers of this hint
+  // touch the pages themselves anyway, so it is not worth the dynamic lookup.
+}
+
+// static
+void OS::AdviseMergeable(void* address, size_t size) {
+  // Windows has no user-controllable page deduplication.
+}
+
 // static
 bool OS::CanReserveAddressSpace() {
   return VirtualAlloc2 != nullptr && MapViewOfFile3 != nullptr &&
@@ -392,6 +392,22 @@ class V8_BASE_EXPORT OS {
 
   V8_WARN_UNUSED_RESULT static bool DecommitPages(void* address, size_t size);
 
+  // Advises the OS to back the given region with (transparent) huge pages
+  // where supported. This is best effort; no-op on platforms without an
+  // equivalent of madvise(MADV_HUGEPAGE).
+  static void AdviseHugePages(void* address, size_t size);
+
+  // Advises the OS that the given region will be needed soon, so that it can
+  // start reading it in ahead of the first access. This is best effort; no-op
+  // on platforms without an equivalent of madvise(MADV_WILLNEED).
+  static void AdviseWillNeed(void* address, size_t size);
+
+  // Advises the OS that pages in the given region may be deduplicated with
+  // identical pages of other mappings and shared copy-on-write until written
+  // (Linux kernel samepage merging). This is best effort; no-op on platforms
+  // without an equivalent of madvise(MADV_MERGEABLE).
+  static void AdviseMergeable(void* address, size_t size);
+
   V8_WARN_UNUSED_RESULT static bool CanReserveAddressSpace();
 
   V8_WARN_UNUSED_RESULT static Optional<AddressSpaceReservation>
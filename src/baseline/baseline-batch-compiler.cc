@@ -286,6 +286,31 @@ void BaselineBatchCompiler::EnqueueSFI(SharedFunctionInfo shared) {
   }
 }
 
+bool BaselineBatchCompiler::CompileScriptConcurrent(Script script) {
+  if (!v8_flags.concurrent_sparkplug || !is_enabled()) return false;
+  HandleScope scope(isolate_);
+  int enqueued = 0;
+  SharedFunctionInfo::ScriptIterator iterator(isolate_, script);
+  for (SharedFunctionInfo shared = iterator.Next(); !shared.is_null();
+       shared = iterator.Next()) {
+    if (shared.is_sparkplug_compiling()) continue;
+    if (!CanCompileWithConcurrentBaseline(shared, isolate_)) continue;
+    Enqueue(Handle<SharedFunctionInfo>(shared, isolate_));
+    enqueued++;
+  }
+  if (enqueued == 0) return false;
+  if (v8_flags.trace_baseline_batch_compilation) {
+    CodeTracer::Scope trace_scope(isolate_->GetCodeTracer());
+    PrintF(trace_scope.file(),
+           "[Baseline batch compilation] Posting whole-script batch of %d "
+           "functions\n",
+           enqueued);
+  }
+  concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+  ClearBatch();
+  return true;
+}
+
 void BaselineBatchCompiler::Enqueue(Handle<SharedFunctionInfo> shared) {
   EnsureQueueCapacity();
   compilation_queue_->Set(last_index_++, HeapObjectReference::Weak(*shared));
@@ -427,6 +452,10 @@ void BaselineBatchCompiler::EnqueueSFI(SharedFunctionInfo shared) {
   UNREACHABLE();
 }
 
+bool BaselineBatchCompiler::CompileScriptConcurrent(Script script) {
+  return false;
+}
+
 }  // namespace baseline
 }  // namespace internal
 }  // namespace v8
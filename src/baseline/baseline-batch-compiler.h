@@ -27,6 +27,12 @@ class BaselineBatchCompiler {
   void EnqueueFunction(Handle<JSFunction> function);
   void EnqueueSFI(SharedFunctionInfo shared);
 
+  // Enqueues every already-compiled function of |script| and immediately posts
+  // the batch for concurrent compilation, bypassing the regular batch-size
+  // heuristics. Returns false if nothing was posted, e.g. because concurrent
+  // sparkplug is disabled or no function of the script has bytecode yet.
+  bool CompileScriptConcurrent(Script script);
+
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
 
@@ -604,8 +604,11 @@ void BaselineCompiler::UpdateInterruptBudgetAndJumpToLabel(
 
     if (weight < 0) {
       SaveAccumulatorScope accumulator_scope(&basm_);
-      CallRuntime(Runtime::kBytecodeBudgetInterruptWithStackCheck_Sparkplug,
-                  __ FunctionOperand());
+      // Call through a shared stub rather than inlining the runtime call
+      // sequence into every back edge; this path is rarely taken but
+      // emitted per loop.
+      CallBuiltin<Builtin::kBaselineBudgetInterruptWithStackCheck>(
+          __ FunctionOperand());
     }
   }
   if (label) __ Jump(label);
@@ -46,6 +46,10 @@ void ProcessorImpl::MultiplySingle(RWDigits Z, Digits X, digit_t y) {
 // implementations.
 // This method is *highly* performance sensitive even for the advanced
 // algorithms, which use this as the base case of their recursive calls.
+// It is intentionally scalar: SSE/AVX2/NEON provide no 64x64->128 bit vector
+// multiply, and the digits of Z form a serial carry chain, so vectorizing
+// this loop would require a different limb representation (e.g. 52-bit limbs
+// with AVX-512 IFMA), which so far has not been worth the complexity.
 void ProcessorImpl::MultiplySchoolbook(RWDigits Z, Digits X, Digits Y) {
   DCHECK(IsDigitNormalized(X));
   DCHECK(IsDigitNormalized(Y));
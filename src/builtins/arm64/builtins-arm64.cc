@@ -1349,21 +1349,28 @@ void Builtins::Generate_InterpreterEntryTrampoline(
   __ Push(x6, kInterpreterAccumulatorRegister);
 
   // Allocate the local and temporary register file on the stack.
-  Label stack_overflow;
+  Label stack_check_interrupt, after_stack_check_interrupt;
   {
     // Load frame size from the BytecodeArray object.
     __ Ldr(w11, FieldMemOperand(kInterpreterBytecodeArrayRegister,
                                 BytecodeArray::kFrameSizeOffset));
 
-    // Do a stack check to ensure we don't go over the limit.
+    // Stack/interrupt check. This folds the checks for both the interrupt
+    // stack limit check and the real stack limit into one by just checking
+    // for the interrupt limit. The interrupt limit is either equal to the
+    // real stack limit or tighter. By ensuring we have space until that
+    // limit after building the frame we can quickly precheck both at once.
+    // A failed check goes to Runtime::kStackGuardWithGap, which throws on a
+    // genuine overflow and handles interrupts otherwise.
     __ Sub(x10, sp, Operand(x11));
     {
       UseScratchRegisterScope temps(masm);
       Register scratch = temps.AcquireX();
-      __ LoadStackLimit(scratch, StackLimitKind::kRealStackLimit);
+      __ LoadStackLimit(scratch, StackLimitKind::kInterruptStackLimit);
       __ Cmp(x10, scratch);
     }
-    __ B(lo, &stack_overflow);
+    __ B(lo, &stack_check_interrupt);
+    __ Bind(&after_stack_check_interrupt);
 
     // If ok, push undefined as the initial value for all register file entries.
     // Note: there should always be at least one stack slot for the return
@@ -1388,14 +1395,6 @@ void Builtins::Generate_InterpreterEntryTrampoline(
   __ Str(x3, MemOperand(fp, x10, LSL, kSystemPointerSizeLog2));
   __ Bind(&no_incoming_new_target_or_generator_register);
 
-  // Perform interrupt stack check.
-  // TODO(solanes): Merge with the real stack limit check above.
-  Label stack_check_interrupt, after_stack_check_interrupt;
-  __ LoadStackLimit(x10, StackLimitKind::kInterruptStackLimit);
-  __ Cmp(sp, x10);
-  __ B(lo, &stack_check_interrupt);
-  __ Bind(&after_stack_check_interrupt);
-
   // The accumulator is already loaded with undefined.
 
   // Load the dispatch table into a register and dispatch to the bytecode
@@ -1458,7 +1457,13 @@ void Builtins::Generate_InterpreterEntryTrampoline(
                               kFunctionEntryBytecodeOffset)));
   __ Str(kInterpreterBytecodeOffsetRegister,
          MemOperand(fp, InterpreterFrameConstants::kBytecodeOffsetFromFp));
-  __ CallRuntime(Runtime::kStackGuard);
+
+  // The register file has not been pushed yet, so ask the stack guard to keep
+  // enough space for it. A genuine stack overflow throws from the runtime
+  // call and never returns here.
+  __ SmiTag(x11);
+  __ PushArgument(x11);
+  __ CallRuntime(Runtime::kStackGuardWithGap);
 
   // After the call, restore the bytecode array, bytecode offset and accumulator
   // registers again. Also, restore the bytecode offset in the stack to its
@@ -1472,6 +1477,9 @@ void Builtins::Generate_InterpreterEntryTrampoline(
   __ SmiTag(x10, kInterpreterBytecodeOffsetRegister);
   __ Str(x10, MemOperand(fp, InterpreterFrameConstants::kBytecodeOffsetFromFp));
 
+  // Reload the frame size and resume building the register file.
+  __ Ldr(w11, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                              BytecodeArray::kFrameSizeOffset));
   __ jmp(&after_stack_check_interrupt);
 
   __ bind(&flags_need_processing);
@@ -1512,10 +1520,6 @@ void Builtins::Generate_InterpreterEntryTrampoline(
   __ bind(&compile_lazy);
   __ GenerateTailCallToReturnedCode(Runtime::kCompileLazy);
   __ Unreachable();  // Should not return.
-
-  __ bind(&stack_overflow);
-  __ CallRuntime(Runtime::kThrowStackOverflow);
-  __ Unreachable();  // Should not return.
 }
 
 static void GenerateInterpreterPushArgs(MacroAssembler* masm, Register num_args,
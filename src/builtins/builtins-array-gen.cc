@@ -1648,7 +1648,11 @@ class ArrayFlattenAssembler : public CodeStubAssembler {
           // 2. Perform ? CreateDataPropertyOrThrow(target,
           //                                        ! ToString(targetIndex),
           //                                        element).
-          CallRuntime(Runtime::kCreateDataProperty, context, target,
+          // The target is usually a freshly created fast array, so go
+          // through FastCreateDataProperty, which appends through the
+          // elements-kind-specific fast paths (including double arrays)
+          // and only falls back to the runtime for non-fast targets.
+          CallBuiltin(Builtin::kFastCreateDataProperty, context, target,
                       target_index, element);
 
           // 3. Increase targetIndex by 1.
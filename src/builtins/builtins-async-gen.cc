@@ -82,39 +82,84 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
     value = var_value.value();
   }
 
-  static const int kClosureContextSize =
-      FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
-  TNode<Context> closure_context =
-      UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // All awaits of an async function frame share the same resolve/reject
+  // closure pair, and at most one await per frame is pending at any point
+  // in time, so the pair allocated for the first suspension is cached on
+  // the JSAsyncFunctionObject and reused by subsequent awaits. The cache
+  // is bypassed while instrumentation is active, since the debugger keys
+  // catch prediction state off the individual handlers.
+  TVARIABLE(HeapObject, var_on_resolve);
+  TVARIABLE(HeapObject, var_on_reject);
+  TVARIABLE(BoolT, var_cache_closures, Int32FalseConstant());
+  Label allocate_closures(this), cache_closures(this), closures_done(this);
+  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
+             promiseHookFlags),
+         &allocate_closures);
+  GotoIfNot(HasInstanceType(generator, JS_ASYNC_FUNCTION_OBJECT_TYPE),
+            &allocate_closures);
   {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
+    TNode<Object> cached_on_resolve = LoadObjectField(
+        generator, JSAsyncFunctionObject::kAwaitOnResolveOffset);
+    GotoIf(IsUndefined(cached_on_resolve), &cache_closures);
+    var_on_resolve = CAST(cached_on_resolve);
+    var_on_reject = LoadObjectField<JSFunction>(
+        generator, JSAsyncFunctionObject::kAwaitOnRejectOffset);
+    Goto(&closures_done);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
+  BIND(&cache_closures);
+  var_cache_closures = Int32TrueConstant();
+  Goto(&allocate_closures);
+
+  BIND(&allocate_closures);
+  {
+    static const int kClosureContextSize =
+        FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
+    TNode<Context> closure_context =
+        UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+    {
+      // Initialize the await context, storing the {generator} as extension.
+      TNode<Map> map = CAST(
+          LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+      StoreMapNoWriteBarrier(closure_context, map);
+      StoreObjectFieldNoWriteBarrier(
+          closure_context, Context::kLengthOffset,
+          SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+      const TNode<Object> empty_scope_info =
+          LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+      StoreContextElementNoWriteBarrier(
+          closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
+      StoreContextElementNoWriteBarrier(closure_context,
+                                        Context::PREVIOUS_INDEX,
+                                        native_context);
+      StoreContextElementNoWriteBarrier(closure_context,
+                                        Context::EXTENSION_INDEX, generator);
+    }
+
+    // Allocate and initialize resolve handler
+    TNode<HeapObject> on_resolve =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_resolve,
+                            on_resolve_sfi);
+    var_on_resolve = on_resolve;
+
+    // Allocate and initialize reject handler
+    TNode<HeapObject> on_reject =
+        AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+    InitializeNativeClosure(closure_context, native_context, on_reject,
+                            on_reject_sfi);
+    var_on_reject = on_reject;
 
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+    GotoIfNot(var_cache_closures.value(), &closures_done);
+    StoreObjectField(generator, JSAsyncFunctionObject::kAwaitOnResolveOffset,
+                     on_resolve);
+    StoreObjectField(generator, JSAsyncFunctionObject::kAwaitOnRejectOffset,
+                     on_reject);
+    Goto(&closures_done);
+  }
+
+  BIND(&closures_done);
 
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
@@ -122,7 +167,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   TVARIABLE(Object, var_throwaway, UndefinedConstant());
   Label if_instrumentation(this, Label::kDeferred),
       if_instrumentation_done(this);
-  TNode<Uint32T> promiseHookFlags = PromiseHookFlags();
   GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(
              promiseHookFlags),
          &if_instrumentation);
@@ -139,14 +183,16 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   BIND(&if_instrumentation);
   {
     var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
-                                native_context, value, outer_promise, on_reject,
-                                generator, is_predicted_as_caught);
+                                native_context, value, outer_promise,
+                                var_on_reject.value(), generator,
+                                is_predicted_as_caught);
     Goto(&if_instrumentation_done);
   }
   BIND(&if_instrumentation_done);
 
   return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+                     var_on_resolve.value(), var_on_reject.value(),
+                     var_throwaway.value());
 }
 
 void AsyncBuiltinsAssembler::InitializeNativeClosure(
@@ -4,6 +4,7 @@
 
 #include "src/builtins/builtins-call-gen.h"
 
+#include "src/builtins/builtins-iterator-gen.h"
 #include "src/builtins/builtins-utils-gen.h"
 #include "src/builtins/builtins.h"
 #include "src/codegen/macro-assembler.h"
@@ -407,10 +408,26 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
     TNode<Object> iterator_fn =
         GetProperty(context, spread, IteratorSymbolConstant());
     GotoIfNot(TaggedIsCallable(iterator_fn), &if_iterator_fn_not_callable);
-    TNode<JSArray> list =
-        CAST(CallBuiltin(Builtin::kIterableToListMayPreserveHoles, context,
-                         spread, iterator_fn));
 
+    // Strings, sets and map/set iterators with their iteration protectors
+    // intact can be materialized without running the iteration protocol at
+    // all; everything else goes through the generic iterator loop.
+    TVARIABLE(JSArray, var_list);
+    Label if_materialized(this), if_slow_iteration(this, Label::kDeferred);
+    IteratorBuiltinsAssembler iterator_assembler(state());
+    iterator_assembler.FastIterableToList(context, spread, &var_list,
+                                          &if_slow_iteration);
+    Goto(&if_materialized);
+
+    BIND(&if_slow_iteration);
+    {
+      var_list = CAST(CallBuiltin(Builtin::kIterableToList, context, spread,
+                                  iterator_fn));
+      Goto(&if_materialized);
+    }
+
+    BIND(&if_materialized);
+    TNode<JSArray> list = var_list.value();
     var_js_array = list;
     var_elements = LoadElements(list);
     var_elements_kind = LoadElementsKind(list);
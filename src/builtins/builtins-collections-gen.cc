@@ -550,6 +550,14 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
   template <typename TableType>
   std::tuple<TNode<Object>, TNode<IntPtrT>, TNode<IntPtrT>> NextSkipHoles(
       TNode<TableType> table, TNode<IntPtrT> index, Label* if_end);
+  // Overload for loops that walk the same table without returning to user
+  // code in between: such a table cannot be rehashed concurrently, so the
+  // bucket count and used capacity are loaded once by the caller and
+  // reused for every entry instead of being reloaded per step.
+  template <typename TableType>
+  std::tuple<TNode<Object>, TNode<IntPtrT>, TNode<IntPtrT>> NextSkipHoles(
+      TNode<TableType> table, TNode<IntPtrT> number_of_buckets,
+      TNode<IntPtrT> used_capacity, TNode<IntPtrT> index, Label* if_end);
 
   // Specialization for Smi.
   // The {result} variable will contain the entry index if the key was found,
@@ -1028,6 +1036,15 @@ TNode<JSArray> CollectionsBuiltinsAssembler::MapIteratorToList(
   Label done(this, {&var_index}), loop(this, vars), continue_loop(this, vars),
       write_key(this, vars), write_value(this, vars);
 
+  // No user code runs while this loop walks the {table}, so the rehash
+  // check done by TransitionAndUpdate above stays valid and the capacity
+  // computation can be hoisted out of the loop.
+  TNode<IntPtrT> number_of_buckets =
+      LoadAndUntagObjectField(table, OrderedHashMap::NumberOfBucketsOffset());
+  TNode<IntPtrT> number_of_deleted_elements = LoadAndUntagObjectField(
+      table, OrderedHashMap::NumberOfDeletedElementsOffset());
+  TNode<IntPtrT> used_capacity = IntPtrAdd(size, number_of_deleted_elements);
+
   Goto(&loop);
 
   BIND(&loop);
@@ -1037,7 +1054,8 @@ TNode<JSArray> CollectionsBuiltinsAssembler::MapIteratorToList(
     TNode<IntPtrT> entry_start_position;
     TNode<IntPtrT> cur_index;
     std::tie(entry_key, entry_start_position, cur_index) =
-        NextSkipHoles<OrderedHashMap>(table, var_index.value(), &done);
+        NextSkipHoles<OrderedHashMap>(table, number_of_buckets, used_capacity,
+                                      var_index.value(), &done);
 
     // Decide to write key or value.
     Branch(
@@ -1139,6 +1157,15 @@ TNode<JSArray> CollectionsBuiltinsAssembler::SetOrSetIteratorToList(
   Label done(this), finalize(this, {&var_index}),
       loop(this, {&var_index, &var_offset});
 
+  // No user code runs while this loop walks the {table}, so the rehash
+  // check done above stays valid and the capacity computation can be
+  // hoisted out of the loop.
+  TNode<IntPtrT> number_of_buckets =
+      LoadAndUntagObjectField(table, OrderedHashSet::NumberOfBucketsOffset());
+  TNode<IntPtrT> number_of_deleted_elements = LoadAndUntagObjectField(
+      table, OrderedHashSet::NumberOfDeletedElementsOffset());
+  TNode<IntPtrT> used_capacity = IntPtrAdd(size, number_of_deleted_elements);
+
   Goto(&loop);
 
   BIND(&loop);
@@ -1148,7 +1175,8 @@ TNode<JSArray> CollectionsBuiltinsAssembler::SetOrSetIteratorToList(
     TNode<IntPtrT> entry_start_position;
     TNode<IntPtrT> cur_index;
     std::tie(entry_key, entry_start_position, cur_index) =
-        NextSkipHoles<OrderedHashSet>(table, var_index.value(), &finalize);
+        NextSkipHoles<OrderedHashSet>(table, number_of_buckets, used_capacity,
+                                      var_index.value(), &finalize);
 
     Store(elements, var_offset.value(), entry_key);
 
@@ -1461,6 +1489,16 @@ CollectionsBuiltinsAssembler::NextSkipHoles(TNode<TableType> table,
   TNode<IntPtrT> used_capacity =
       IntPtrAdd(number_of_elements, number_of_deleted_elements);
 
+  return NextSkipHoles(table, number_of_buckets, used_capacity, index, if_end);
+}
+
+template <typename TableType>
+std::tuple<TNode<Object>, TNode<IntPtrT>, TNode<IntPtrT>>
+CollectionsBuiltinsAssembler::NextSkipHoles(TNode<TableType> table,
+                                            TNode<IntPtrT> number_of_buckets,
+                                            TNode<IntPtrT> used_capacity,
+                                            TNode<IntPtrT> index,
+                                            Label* if_end) {
   TNode<Object> entry_key;
   TNode<IntPtrT> entry_start_position;
   TVARIABLE(IntPtrT, var_index, index);
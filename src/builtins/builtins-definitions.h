@@ -192,6 +192,7 @@ namespace internal {
   ASM(BaselineOutOfLinePrologueDeopt, Void)                                    \
   ASM(BaselineOnStackReplacement, OnStackReplacement)                          \
   ASM(BaselineLeaveFrame, BaselineLeaveFrame)                                  \
+  TFS(BaselineBudgetInterruptWithStackCheck, kFunction)                        \
   ASM(BaselineOrInterpreterEnterAtBytecode, Void)                              \
   ASM(BaselineOrInterpreterEnterAtNextBytecode, Void)                          \
   ASM(InterpreterOnStackReplacement_ToBaseline, Void)                          \
@@ -623,10 +624,6 @@ namespace internal {
   CPP(JsonRawJson)                                                             \
   CPP(JsonIsRawJson)                                                           \
                                                                                \
-  /* Web snapshots */                                                          \
-  CPP(WebSnapshotSerialize)                                                    \
-  CPP(WebSnapshotDeserialize)                                                  \
-                                                                               \
   /* ICs */                                                                    \
   TFH(LoadIC, LoadWithVector)                                                  \
   TFH(LoadIC_Megamorphic, LoadWithVector)                                      \
@@ -1932,10 +1929,19 @@ namespace internal {
   CPP(StringPrototypeToUpperCase)
 #endif  // V8_INTL_SUPPORT
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
+#define BUILTIN_LIST_WEB_SNAPSHOTS(CPP) \
+  CPP(WebSnapshotSerialize)             \
+  CPP(WebSnapshotDeserialize)
+#else
+#define BUILTIN_LIST_WEB_SNAPSHOTS(CPP)
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
+
 #define BUILTIN_LIST(CPP, TFJ, TFC, TFS, TFH, BCH, ASM)  \
   BUILTIN_LIST_BASE(CPP, TFJ, TFC, TFS, TFH, ASM)        \
   BUILTIN_LIST_FROM_TORQUE(CPP, TFJ, TFC, TFS, TFH, ASM) \
   BUILTIN_LIST_INTL(CPP, TFJ, TFS)                       \
+  BUILTIN_LIST_WEB_SNAPSHOTS(CPP)                        \
   BUILTIN_LIST_BYTECODE_HANDLERS(BCH)
 
 // See the comment on top of BUILTIN_LIST_BASE_TIER0 for an explanation of
@@ -1947,6 +1953,7 @@ namespace internal {
   BUILTIN_LIST_BASE_TIER1(CPP, TFJ, TFC, TFS, TFH, ASM)       \
   BUILTIN_LIST_FROM_TORQUE(CPP, TFJ, TFC, TFS, TFH, ASM)      \
   BUILTIN_LIST_INTL(CPP, TFJ, TFS)                            \
+  BUILTIN_LIST_WEB_SNAPSHOTS(CPP)                             \
   BUILTIN_LIST_BYTECODE_HANDLERS(BCH)
 
 // The exception thrown in the following builtins are caught
@@ -1218,6 +1218,15 @@ TF_BUILTIN(AbortCSADcheck, CodeStubAssembler) {
   TailCallRuntime(Runtime::kAbortCSADcheck, NoContextConstant(), message);
 }
 
+// Shared stub for the interrupt-budget slow path of baseline back edges,
+// so that every JumpLoop doesn't have to inline the runtime call sequence.
+TF_BUILTIN(BaselineBudgetInterruptWithStackCheck, CodeStubAssembler) {
+  auto context = Parameter<Context>(Descriptor::kContext);
+  auto function = Parameter<JSFunction>(Descriptor::kFunction);
+  TailCallRuntime(Runtime::kBytecodeBudgetInterruptWithStackCheck_Sparkplug,
+                  context, function);
+}
+
 void Builtins::Generate_CEntry_Return1_DontSaveFPRegs_ArgvOnStack_NoBuiltinExit(
     MacroAssembler* masm) {
   Generate_CEntry(masm, 1, SaveFPRegsMode::kIgnore, ArgvMode::kStack, false);
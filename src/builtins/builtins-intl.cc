@@ -1113,8 +1113,11 @@ BUILTIN(CollatorInternalCompare) {
   // 7. Return CompareStrings(collator, X, Y).
   icu::Collator* icu_collator = collator->icu_collator().raw();
   CHECK_NOT_NULL(icu_collator);
-  return Smi::FromInt(
-      Intl::CompareStrings(isolate, *icu_collator, string_x, string_y));
+  const Intl::CompareStringsOptions compare_strings_options =
+      collator->fast_comparable() ? Intl::CompareStringsOptions::kTryFastPath
+                                  : Intl::CompareStringsOptions::kNone;
+  return Smi::FromInt(Intl::CompareStrings(
+      isolate, *icu_collator, string_x, string_y, compare_strings_options));
 }
 
 // ecma402 #sec-%segmentiteratorprototype%.next
@@ -603,12 +603,18 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   // Exit if the queue is empty.
   GotoIf(WordEqual(size, IntPtrConstant(0)), &done);
 
+  // |ring_buffer|, |capacity| and |start| must be reloaded on every
+  // iteration: running a microtask may enqueue further microtasks and thereby
+  // resize (reallocate) the ring buffer. For the same reason the next entry
+  // cannot be fetched ahead of the current invocation.
   TNode<RawPtrT> ring_buffer = GetMicrotaskRingBuffer(microtask_queue);
   TNode<IntPtrT> capacity = GetMicrotaskQueueCapacity(microtask_queue);
   TNode<IntPtrT> start = GetMicrotaskQueueStart(microtask_queue);
 
-  TNode<IntPtrT> offset =
-      CalculateRingBufferOffset(capacity, start, IntPtrConstant(0));
+  // |start| is always kept in [0, capacity), so the head entry's offset does
+  // not need the wrap-around masking of CalculateRingBufferOffset.
+  CSA_DCHECK(this, UintPtrLessThan(start, capacity));
+  TNode<IntPtrT> offset = TimesSystemPointerSize(start);
   TNode<RawPtrT> microtask_pointer = Load<RawPtrT>(ring_buffer, offset);
   TNode<Microtask> microtask = CAST(BitcastWordToTagged(microtask_pointer));
 
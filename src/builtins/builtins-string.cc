@@ -247,7 +247,7 @@ inline bool ToUpperOverflows(base::uc32 character) {
 template <class Converter>
 V8_WARN_UNUSED_RESULT static Object ConvertCaseHelper(
     Isolate* isolate, String string, SeqString result, int result_length,
-    unibrow::Mapping<Converter, 128>* mapping) {
+    unibrow::Mapping<Converter, 128>* mapping, int start_index) {
   DisallowGarbageCollection no_gc;
   // We try this twice, once with the assumption that the result is no longer
   // than the input and, if that assumption breaks, again with the exact
@@ -262,12 +262,14 @@ V8_WARN_UNUSED_RESULT static Object ConvertCaseHelper(
 
   // Convert all characters to upper case, assuming that they will fit
   // in the buffer
-  StringCharacterStream stream(string);
+  DCHECK_LT(start_index, string.length());
+  DCHECK_IMPLIES(start_index != 0, result_length == string.length());
+  StringCharacterStream stream(string, start_index);
   unibrow::uchar chars[Converter::kMaxWidth];
-  // We can assume that the string is not empty
+  // We can assume that there is at least one character left to process
   base::uc32 current = stream.GetNext();
   bool ignore_overflow = Converter::kIsToLower || result.IsSeqTwoByteString();
-  for (int i = 0; i < result_length;) {
+  for (int i = start_index; i < result_length;) {
     bool has_next = stream.HasMore();
     base::uc32 next = has_next ? stream.GetNext() : 0;
     int char_length = mapping->get(current, next, chars);
@@ -356,32 +358,42 @@ V8_WARN_UNUSED_RESULT static Object ConvertCase(
   // character is also ASCII.  This is currently the case, but it
   // might break in the future if we implement more context and locale
   // dependent upper/lower conversions.
+  Handle<SeqString> result;  // Same length as input.
+  int start_index = 0;
+  bool has_changed_character = false;
   if (String::IsOneByteRepresentationUnderneath(*s)) {
-    // Same length as input.
-    Handle<SeqOneByteString> result =
+    Handle<SeqOneByteString> one_byte_result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
     DisallowGarbageCollection no_gc;
     String::FlatContent flat_content = s->GetFlatContent(no_gc);
     DCHECK(flat_content.IsFlat());
-    bool has_changed_character = false;
     int index_to_first_unprocessed = FastAsciiConvert<Converter::kIsToLower>(
-        reinterpret_cast<char*>(result->GetChars(no_gc)),
+        reinterpret_cast<char*>(one_byte_result->GetChars(no_gc)),
         reinterpret_cast<const char*>(flat_content.ToOneByteVector().begin()),
         length, &has_changed_character);
-    // If not ASCII, we discard the result and take the 2 byte path.
     if (index_to_first_unprocessed == length)
-      return has_changed_character ? *result : *s;
-  }
-
-  Handle<SeqString> result;  // Same length as input.
-  if (s->IsOneByteRepresentation()) {
+      return has_changed_character ? *one_byte_result : *s;
+    // Some non-ASCII (Latin-1) character stopped the fast conversion. The
+    // converted ASCII prefix maps one to one, so the generic algorithm
+    // below can reuse the partial result and resume at the bail-out point
+    // instead of redoing the prefix.
+    result = one_byte_result;
+    start_index = index_to_first_unprocessed;
+  } else if (s->IsOneByteRepresentation()) {
     result = isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
   } else {
     result = isolate->factory()->NewRawTwoByteString(length).ToHandleChecked();
   }
 
-  Object answer = ConvertCaseHelper(isolate, *s, *result, length, mapping);
-  if (answer.IsException(isolate) || answer.IsString()) return answer;
+  Object answer =
+      ConvertCaseHelper(isolate, *s, *result, length, mapping, start_index);
+  if (answer.IsException(isolate) || answer.IsString()) {
+    // The helper returns the input string when the tail it processed needed
+    // no changes, but the fast path may already have converted characters
+    // in the prefix.
+    if (has_changed_character && answer == *s) return *result;
+    return answer;
+  }
 
   DCHECK(answer.IsSmi());
   length = Smi::ToInt(answer);
@@ -393,7 +405,9 @@ V8_WARN_UNUSED_RESULT static Object ConvertCase(
     ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
         isolate, result, isolate->factory()->NewRawTwoByteString(length));
   }
-  return ConvertCaseHelper(isolate, *s, *result, length, mapping);
+  // The result length differs from the input length here, so the prefix
+  // cannot be carried over; convert from the beginning.
+  return ConvertCaseHelper(isolate, *s, *result, length, mapping, 0);
 }
 
 }  // namespace
@@ -6,9 +6,13 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/flags/flags.h"
 #include "src/utils/utils.h"
 
@@ -33,6 +37,12 @@ class ProfileDataFromFileInternal : public ProfileDataFromFile {
         std::make_pair(true_block_id, false_block_id), hint != 0));
   }
 
+  void AddCountToBlock(size_t block_id, uint64_t count) {
+    // Counts from the same block may appear several times when data from
+    // several Isolates is concatenated.
+    block_counts_by_id[block_id] += count;
+  }
+
  private:
   bool hash_has_value_ = false;
 };
@@ -77,6 +87,25 @@ EnsureInitProfileData() {
       // Only the first hint for each branch will be used.
       hints_and_hash.AddHintToBlock(true_id, false_id, hint);
       CHECK(line_stream.eof());
+    } else if (token == ProfileDataFromFileConstants::kBlockCounterMarker) {
+      // Any line starting with kBlockCounterMarker is a raw block execution
+      // count. The format is:
+      //   literal kBlockCounterMarker , builtin_name , block_id , count
+      std::string builtin_name;
+      CHECK(std::getline(line_stream, builtin_name, ','));
+      CHECK(std::getline(line_stream, token, ','));
+      char* end = nullptr;
+      errno = 0;
+      uint32_t block_id =
+          static_cast<uint32_t>(strtoul(token.c_str(), &end, 0));
+      CHECK(errno == 0 && end != token.c_str());
+      std::getline(line_stream, token, ',');
+      CHECK(line_stream.eof());
+      uint64_t count = strtoull(token.c_str(), &end, 10);
+      CHECK(errno == 0 && end != token.c_str());
+      ProfileDataFromFileInternal& counts_and_hash =
+          (*data.get())[builtin_name];
+      counts_and_hash.AddCountToBlock(block_id, count);
     } else if (token == ProfileDataFromFileConstants::kBuiltinHashMarker) {
       // Any line starting with kBuiltinHashMarker is a function hash record.
       // As defined by V8FileLogger::BuiltinHashEvent, the format is:
@@ -105,6 +134,17 @@ EnsureInitProfileData() {
   return *data.get();
 }
 
+// Branch hints derived from in-process basic block counters, keyed by
+// function name. Entries are kept alive for the lifetime of the process,
+// since concurrent compile jobs may still hold pointers to them.
+struct ProfilerFeedback {
+  base::Mutex mutex;
+  std::unordered_map<std::string, ProfileDataFromFileInternal*> by_name;
+  std::vector<std::unique_ptr<ProfileDataFromFileInternal>> all;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ProfilerFeedback, GetProfilerFeedback)
+
 }  // namespace
 
 const ProfileDataFromFile* ProfileDataFromFile::TryRead(const char* name) {
@@ -113,5 +153,44 @@ const ProfileDataFromFile* ProfileDataFromFile::TryRead(const char* name) {
   return it == data.end() ? nullptr : &it->second;
 }
 
+const ProfileDataFromFile* ProfileDataFromFile::TryReadFromProfiler(
+    const char* name, int graph_hash) {
+  DCHECK(v8_flags.turbo_profiling_feedback);
+  BasicBlockProfilerData* counters =
+      BasicBlockProfiler::Get()->GetData(name, graph_hash);
+  if (counters == nullptr) return nullptr;
+
+  ProfilerFeedback* feedback = GetProfilerFeedback();
+  base::MutexGuard guard(&feedback->mutex);
+  auto it = feedback->by_name.find(name);
+  if (it != feedback->by_name.end() && it->second->hash() == graph_hash) {
+    return it->second;
+  }
+
+  auto data = std::make_unique<ProfileDataFromFileInternal>();
+  data->set_hash(graph_hash);
+  // The counters are indexed by reverse post-order block number; map the
+  // block IDs recorded for the branches back to their counter slots.
+  std::unordered_map<int32_t, uint32_t> count_by_id;
+  for (size_t i = 0; i < counters->n_blocks(); ++i) {
+    count_by_id[counters->block_ids()[i]] = counters->counts()[i];
+    data->AddCountToBlock(counters->block_ids()[i], counters->counts()[i]);
+  }
+  for (const auto& branch : counters->branches()) {
+    uint32_t true_count = count_by_id[branch.first];
+    uint32_t false_count = count_by_id[branch.second];
+    // Branches where both targets were executed equally often carry no
+    // layout signal; leave them to the static hints.
+    if (true_count == false_count) continue;
+    data->AddHintToBlock(branch.first, branch.second,
+                         true_count > false_count ? 1 : 0);
+  }
+
+  ProfileDataFromFileInternal* result = data.get();
+  feedback->by_name[name] = result;
+  feedback->all.push_back(std::move(data));
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -8,8 +8,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
+#include "src/base/optional.h"
 #include "src/common/globals.h"
 
 namespace v8 {
@@ -31,11 +33,32 @@ class ProfileDataFromFile {
     return BranchHint::kNone;
   }
 
+  // Returns true if the profile carries raw block execution counts in
+  // addition to branch hints.
+  bool has_block_counts() const { return !block_counts_by_id.empty(); }
+
+  // Returns the number of times the block with the given ID was executed
+  // while profiling, or nothing if the profile has no counter for it. Since
+  // zero counters are not logged, a missing counter in a profile that has
+  // counts at all means the block was never executed.
+  base::Optional<uint64_t> GetExecutedCount(size_t block_id) const {
+    auto it = block_counts_by_id.find(block_id);
+    if (it == block_counts_by_id.end()) return base::nullopt;
+    return it->second;
+  }
+
   // Load basic block profiling data for the builtin with the given name, if
   // such data exists. The returned vector is indexed by block ID, and its
   // values are the number of times each block was executed while profiling.
   static const ProfileDataFromFile* TryRead(const char* name);
 
+  // Derive branch hints from basic block counters that the in-process
+  // BasicBlockProfiler collected for an earlier instrumented compilation of
+  // the function with the given name and pre-scheduling graph hash. Returns
+  // nullptr if no matching counters exist. Used by --turbo-profiling-feedback.
+  static const ProfileDataFromFile* TryReadFromProfiler(const char* name,
+                                                        int graph_hash);
+
  protected:
   int hash_ = 0;
 
@@ -43,6 +66,10 @@ class ProfileDataFromFile {
   // the branch condition. The vector is indexed by the basic block ids of
   // the two destinations of the branch.
   std::map<std::pair<size_t, size_t>, bool> block_hints_by_id;
+
+  // Block execution counts, indexed by basic block ID. Only blocks that were
+  // executed at least once appear in profiles read from a file.
+  std::unordered_map<size_t, uint64_t> block_counts_by_id;
 };
 
 // The following strings can't be static members of ProfileDataFromFile until
@@ -37,6 +37,11 @@
 #ifdef V8_CODE_COMMENTS
 #include <iomanip>
 #endif
+#include <vector>
+
+#include "src/base/bits.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/vector.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/deoptimizer/deoptimizer.h"
@@ -96,19 +101,98 @@ AssemblerOptions AssemblerOptions::DefaultForOffHeapTrampoline(
 
 namespace {
 
+// Recycles the backing stores of DefaultAssemblerBuffers across
+// compilations. Sparkplug, Maglev and Turbofan each allocate (and free) one
+// growable buffer per compilation, possibly from background threads, which
+// shows up as allocator churn under compile storms. Buffers are bucketed by
+// power-of-two size class; the pool keeps at most kMaxPooledBytes alive and
+// frees anything beyond that eagerly, so the memory is given back once
+// compilation goes idle. It can also be flushed under memory pressure via
+// FlushAssemblerBufferPool. Wasm keeps its own per-engine cache for its
+// mmapped, PKU-protected buffers (see wasm/assembler-buffer-cache.h).
+class AssemblerBufferPool final {
+ public:
+  static constexpr int kMinPooledSize = 4 * KB;
+  static constexpr int kMaxPooledSize = 512 * KB;
+  static constexpr size_t kMaxPooledBytes = 8 * MB;
+
+  // Rounds |size| up to the nearest size class, or returns it unchanged if
+  // it is outside the pooled range.
+  static int RoundUpToSizeClass(int size) {
+    if (size < kMinPooledSize || size > kMaxPooledSize) return size;
+    return static_cast<int>(
+        base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(size)));
+  }
+
+  // Returns a pooled allocation of exactly |size| bytes, or null if none is
+  // available.
+  std::unique_ptr<uint8_t[]> Acquire(int size) {
+    int bucket = BucketIndex(size);
+    if (bucket < 0) return {};
+    base::MutexGuard guard(&mutex_);
+    if (buckets_[bucket].empty()) return {};
+    std::unique_ptr<uint8_t[]> result = std::move(buckets_[bucket].back());
+    buckets_[bucket].pop_back();
+    pooled_bytes_ -= size;
+    return result;
+  }
+
+  // Takes ownership of |buffer|; frees it right away if it doesn't belong
+  // to a size class or the pool is full.
+  void Release(std::unique_ptr<uint8_t[]> buffer, int size) {
+    int bucket = BucketIndex(size);
+    if (bucket < 0) return;
+    base::MutexGuard guard(&mutex_);
+    if (pooled_bytes_ + size > kMaxPooledBytes) return;
+    pooled_bytes_ += size;
+    buckets_[bucket].push_back(std::move(buffer));
+  }
+
+  void Flush() {
+    base::MutexGuard guard(&mutex_);
+    for (auto& bucket : buckets_) bucket.clear();
+    pooled_bytes_ = 0;
+  }
+
+ private:
+  static constexpr int kNumBuckets = 8;
+  static_assert(kMaxPooledSize == kMinPooledSize << (kNumBuckets - 1));
+
+  // Returns the bucket for |size|, or -1 if |size| is not exactly a pooled
+  // size class.
+  static int BucketIndex(int size) {
+    if (size < kMinPooledSize || size > kMaxPooledSize) return -1;
+    if (!base::bits::IsPowerOfTwo(size)) return -1;
+    return base::bits::WhichPowerOfTwo(size) -
+           base::bits::WhichPowerOfTwo(kMinPooledSize);
+  }
+
+  base::Mutex mutex_;
+  std::vector<std::unique_ptr<uint8_t[]>> buckets_[kNumBuckets];
+  size_t pooled_bytes_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(AssemblerBufferPool, GetAssemblerBufferPool)
+
 class DefaultAssemblerBuffer : public AssemblerBuffer {
  public:
   explicit DefaultAssemblerBuffer(int size)
-      : buffer_(base::OwnedVector<uint8_t>::NewForOverwrite(
+      : size_(AssemblerBufferPool::RoundUpToSizeClass(
             std::max(AssemblerBase::kMinimalBufferSize, size))) {
+    buffer_ = GetAssemblerBufferPool()->Acquire(size_);
+    if (!buffer_) buffer_.reset(new uint8_t[size_]);
 #ifdef DEBUG
-    ZapCode(reinterpret_cast<Address>(buffer_.start()), buffer_.size());
+    ZapCode(reinterpret_cast<Address>(buffer_.get()), size_);
 #endif
   }
 
-  byte* start() const override { return buffer_.start(); }
+  ~DefaultAssemblerBuffer() override {
+    GetAssemblerBufferPool()->Release(std::move(buffer_), size_);
+  }
+
+  byte* start() const override { return buffer_.get(); }
 
-  int size() const override { return static_cast<int>(buffer_.size()); }
+  int size() const override { return size_; }
 
   std::unique_ptr<AssemblerBuffer> Grow(int new_size) override {
     DCHECK_LT(size(), new_size);
@@ -116,7 +200,8 @@ class DefaultAssemblerBuffer : public AssemblerBuffer {
   }
 
  private:
-  base::OwnedVector<uint8_t> buffer_;
+  const int size_;
+  std::unique_ptr<uint8_t[]> buffer_;
 };
 
 class ExternalAssemblerBufferImpl : public AssemblerBuffer {
@@ -149,6 +234,8 @@ std::unique_ptr<AssemblerBuffer> NewAssemblerBuffer(int size) {
   return std::make_unique<DefaultAssemblerBuffer>(size);
 }
 
+void FlushAssemblerBufferPool() { GetAssemblerBufferPool()->Flush(); }
+
 // -----------------------------------------------------------------------------
 // Implementation of AssemblerBase
 
@@ -218,6 +218,10 @@ std::unique_ptr<AssemblerBuffer> ExternalAssemblerBuffer(void* buffer,
 V8_EXPORT_PRIVATE
 std::unique_ptr<AssemblerBuffer> NewAssemblerBuffer(int size);
 
+// Free the backing stores kept alive by the pool of recycled assembler
+// buffers; called under memory pressure.
+V8_EXPORT_PRIVATE void FlushAssemblerBufferPool();
+
 class V8_EXPORT_PRIVATE AssemblerBase : public Malloced {
  public:
   AssemblerBase(const AssemblerOptions& options,
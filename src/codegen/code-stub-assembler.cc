@@ -3719,6 +3719,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
     StoreFixedArrayElement(result, NameDictionary::kObjectHashIndex,
                            SmiConstant(PropertyArray::kNoHashSentinel),
                            SKIP_WRITE_BARRIER);
+    StoreFixedArrayElement(result, NameDictionary::kCachedEnumKeysIndex,
+                           UndefinedConstant(), SKIP_WRITE_BARRIER);
   }
 
   // Initialize NameDictionary elements.
@@ -4923,6 +4925,31 @@ void CodeStubAssembler::JumpIfPointersFromHereAreInteresting(
   BIND(&finished);
 }
 
+void CodeStubAssembler::CallRangeWriteBarrier(TNode<FixedArrayBase> elements,
+                                              ElementsKind kind,
+                                              TNode<IntPtrT> index,
+                                              TNode<IntPtrT> length) {
+  DCHECK(!IsDoubleElementsKind(kind));
+  static const int32_t fa_base_data_offset =
+      FixedArrayBase::kHeaderSize - kHeapObjectTag;
+  TNode<IntPtrT> elements_intptr = BitcastTaggedToWord(elements);
+  TNode<IntPtrT> start_address = IntPtrAdd(
+      elements_intptr,
+      ElementOffsetFromIndex(index, kind, fa_base_data_offset));
+  TNode<IntPtrT> end_address = IntPtrAdd(
+      elements_intptr, ElementOffsetFromIndex(IntPtrAdd(index, length), kind,
+                                              fa_base_data_offset));
+  TNode<ExternalReference> range_barrier =
+      ExternalConstant(ExternalReference::write_barrier_for_range_function());
+  TNode<ExternalReference> isolate_ptr =
+      ExternalConstant(ExternalReference::isolate_address(isolate()));
+  CallCFunction(range_barrier, base::nullopt,
+                std::make_pair(MachineType::Pointer(), elements_intptr),
+                std::make_pair(MachineType::Pointer(), start_address),
+                std::make_pair(MachineType::Pointer(), end_address),
+                std::make_pair(MachineType::Pointer(), isolate_ptr));
+}
+
 void CodeStubAssembler::MoveElements(ElementsKind kind,
                                      TNode<FixedArrayBase> elements,
                                      TNode<IntPtrT> dst_index,
@@ -4981,12 +5008,16 @@ void CodeStubAssembler::MoveElements(ElementsKind kind,
       const TNode<IntPtrT> delta =
           IntPtrMul(IntPtrSub(dst_index, begin),
                     IntPtrConstant(ElementsKindToByteSize(kind)));
+      // Move the elements with plain per-slot stores and cover the whole
+      // destination range with a single range write barrier afterwards.
       auto loop_body = [&](TNode<HeapObject> array, TNode<IntPtrT> offset) {
         const TNode<AnyTaggedT> element = Load<AnyTaggedT>(array, offset);
         const TNode<WordT> delta_offset = IntPtrAdd(offset, delta);
-        Store(array, delta_offset, element);
+        StoreNoWriteBarrier(MachineRepresentation::kTagged, array, delta_offset,
+                            element);
       };
 
+      Label write_range_barrier(this);
       Label iterate_forward(this);
       Label iterate_backward(this);
       Branch(IntPtrLessThan(delta, IntPtrConstant(0)), &iterate_forward,
@@ -4996,15 +5027,19 @@ void CodeStubAssembler::MoveElements(ElementsKind kind,
         // Make a loop for the stores.
         BuildFastArrayForEach(elements, kind, begin, end, loop_body,
                               ForEachDirection::kForward);
-        Goto(&finished);
+        Goto(&write_range_barrier);
       }
 
       BIND(&iterate_backward);
       {
         BuildFastArrayForEach(elements, kind, begin, end, loop_body,
                               ForEachDirection::kReverse);
-        Goto(&finished);
+        Goto(&write_range_barrier);
       }
+
+      BIND(&write_range_barrier);
+      CallRangeWriteBarrier(elements, kind, dst_index, length);
+      Goto(&finished);
     }
     BIND(&finished);
   }
@@ -5074,19 +5109,21 @@ void CodeStubAssembler::CopyElements(ElementsKind kind,
       const TNode<IntPtrT> delta =
           IntPtrMul(IntPtrSub(dst_index, src_index),
                     IntPtrConstant(ElementsKindToByteSize(kind)));
+      // Copy the elements with plain per-slot stores (which, unlike memcpy,
+      // cannot tear tagged values under concurrent marking) and cover the
+      // whole destination range with a single range write barrier afterwards.
       BuildFastArrayForEach(
           src_elements, kind, begin, end,
           [&](TNode<HeapObject> array, TNode<IntPtrT> offset) {
             const TNode<AnyTaggedT> element = Load<AnyTaggedT>(array, offset);
             const TNode<WordT> delta_offset = IntPtrAdd(offset, delta);
-            if (write_barrier == SKIP_WRITE_BARRIER) {
-              StoreNoWriteBarrier(MachineRepresentation::kTagged, dst_elements,
-                                  delta_offset, element);
-            } else {
-              Store(dst_elements, delta_offset, element);
-            }
+            StoreNoWriteBarrier(MachineRepresentation::kTagged, dst_elements,
+                                delta_offset, element);
           },
           ForEachDirection::kForward);
+      if (write_barrier != SKIP_WRITE_BARRIER) {
+        CallRangeWriteBarrier(dst_elements, kind, dst_index, length);
+      }
       Goto(&finished);
     }
     BIND(&finished);
@@ -7489,6 +7526,21 @@ TNode<String> CodeStubAssembler::NumberToString(TNode<Number> input,
   BIND(&if_smi);
   {
     Comment("NumberToString - Smi");
+    // Strings of small non-negative integers are pre-allocated in a shared
+    // read-only table, so they can be returned without consulting (or
+    // updating) the number string cache.
+    Label if_smi_cache(this);
+    TNode<FixedArray> smi_string_table = SmiStringTableConstant();
+    TNode<IntPtrT> untagged_input = SmiUntag(smi_input.value());
+    GotoIfNot(
+        UintPtrLessThan(untagged_input, LoadAndUntagFixedArrayBaseLength(
+                                            smi_string_table)),
+        &if_smi_cache);
+    result = CAST(UnsafeLoadFixedArrayElement(smi_string_table,
+                                              untagged_input));
+    Goto(&done);
+
+    BIND(&if_smi_cache);
     // Load the smi key, make sure it matches the smi we're looking for.
     TNode<Word32T> hash = Word32And(SmiToInt32(smi_input.value()), mask);
     TNode<IntPtrT> entry_index =
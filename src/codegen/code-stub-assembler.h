@@ -211,6 +211,7 @@ enum class PrimitiveType { kBoolean, kNumber, kString, kSymbol };
   V(search_symbol, search_symbol, SearchSymbol)                              \
   V(SingleCharacterStringTable, single_character_string_table,               \
     SingleCharacterStringTable)                                              \
+  V(SmiStringTable, smi_string_table, SmiStringTable)                        \
   V(species_symbol, species_symbol, SpeciesSymbol)                           \
   V(StaleRegister, stale_register, StaleRegister)                            \
   V(StoreHandler0Map, store_handler0_map, StoreHandler0Map)                  \
@@ -2246,6 +2247,13 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   void JumpIfPointersFromHereAreInteresting(TNode<Object> object,
                                             Label* interesting);
 
+  // Executes the range write barrier for the elements at
+  // [index, index + length) of |elements|, covering the whole range with one
+  // remembered-set pass. The elements must already have been stored (without
+  // a per-slot barrier) when this is called.
+  void CallRangeWriteBarrier(TNode<FixedArrayBase> elements, ElementsKind kind,
+                             TNode<IntPtrT> index, TNode<IntPtrT> length);
+
   // Efficiently copy elements within a single array. The regions
   // [src_index, src_index + length) and [dst_index, dst_index + length)
   // can be overlapping.
@@ -9,6 +9,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/compilation-cache-table-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
@@ -275,6 +276,25 @@ CompilationCacheScript::LookupResult CompilationCache::LookupScript(
   return script_.Lookup(source, script_details);
 }
 
+namespace {
+
+// With --relaxed-eval-cache, evals that parse at global scope (indirect
+// eval, the Function constructor and direct eval in global code) are keyed
+// on the source, the language mode and the scope position alone: variable
+// resolution in them does not depend on which function invoked the eval.
+// The native context's empty function stands in for the outer function in
+// the cache key. Compiler::GetFunctionFromEval re-attributes relaxed cache
+// hits to the requesting eval site.
+Handle<SharedFunctionInfo> EvalGlobalCacheOuterInfo(
+    Isolate* isolate, Handle<SharedFunctionInfo> outer_info,
+    Handle<Context> native_context) {
+  if (!v8_flags.relaxed_eval_cache) return outer_info;
+  return handle(native_context->native_context().empty_function().shared(),
+                isolate);
+}
+
+}  // namespace
+
 InfoCellPair CompilationCache::LookupEval(Handle<String> source,
                                           Handle<SharedFunctionInfo> outer_info,
                                           Handle<Context> context,
@@ -286,8 +306,9 @@ InfoCellPair CompilationCache::LookupEval(Handle<String> source,
   const char* cache_type;
 
   if (context->IsNativeContext()) {
-    result = eval_global_.Lookup(source, outer_info, context, language_mode,
-                                 position);
+    result = eval_global_.Lookup(
+        source, EvalGlobalCacheOuterInfo(isolate(), outer_info, context),
+        context, language_mode, position);
     cache_type = "eval-global";
 
   } else {
@@ -330,8 +351,9 @@ void CompilationCache::PutEval(Handle<String> source,
   const char* cache_type;
   HandleScope scope(isolate());
   if (context->IsNativeContext()) {
-    eval_global_.Put(source, outer_info, function_info, context, feedback_cell,
-                     position);
+    eval_global_.Put(source,
+                     EvalGlobalCacheOuterInfo(isolate(), outer_info, context),
+                     function_info, context, feedback_cell, position);
     cache_type = "eval-global";
   } else {
     DCHECK_NE(position, kNoSourcePosition);
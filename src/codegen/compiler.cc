@@ -47,6 +47,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -61,8 +62,11 @@
 #include "src/parsing/pending-compilation-error-handler.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/snapshot/shared-code-cache.h"
 #include "src/utils/ostreams.h"
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
 #include "src/web-snapshot/web-snapshot.h"
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
 
 #ifdef V8_ENABLE_MAGLEV
@@ -318,6 +322,39 @@ void Compiler::LogFunctionCompilation(Isolate* isolate,
   DCHECK_NE(*abstract_code,
             ToAbstractCode(*BUILTIN_CODE(isolate, CompileLazy)));
 
+  // Surface the per-function compilation cost to the embedder's metrics
+  // recorder, independently of the loggers below.
+  if (V8_UNLIKELY(isolate->metrics_recorder()->HasEmbedderRecorder())) {
+    v8::metrics::FunctionCompiled event;
+    switch (kind) {
+      case CodeKind::INTERPRETED_FUNCTION:
+        event.tier = 0;
+        break;
+      case CodeKind::BASELINE:
+        event.tier = 1;
+        break;
+      case CodeKind::MAGLEV:
+        event.tier = 2;
+        break;
+      case CodeKind::TURBOFAN:
+        event.tier = 3;
+        break;
+      default:
+        UNREACHABLE();
+    }
+    event.script_id = script->id();
+    event.start_position = shared->StartPosition();
+    event.end_position = shared->EndPosition();
+    event.wall_clock_duration_in_us =
+        base::TimeDelta::FromMillisecondsD(time_taken_ms).InMicroseconds();
+    v8::metrics::Recorder::ContextId context_id =
+        isolate->context().is_null()
+            ? v8::metrics::Recorder::ContextId::Empty()
+            : isolate->GetOrRegisterRecorderContextId(
+                  isolate->native_context());
+    isolate->metrics_recorder()->AddMainThreadEvent(event, context_id);
+  }
+
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
@@ -1045,6 +1082,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
                              compilation_info->osr_offset(),
                              ToCodeT(*compilation_info->code()),
                              compilation_info->function_context_specializing());
+  compilation_info->shared_info()->set_turbofan_compiled_before(true);
   job->RecordFunctionCompilation(LogEventListener::CodeTag::kFunction, isolate);
   return true;
 }
@@ -2520,12 +2558,39 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
     return true;
   }
 
+  uint64_t preparse_data_key = 0;
+  bool has_preparse_data_key =
+      v8_flags.shared_preparse_data && script->source().IsString() &&
+      PreparseDataCache::ComputeKey(
+          String::cast(script->source()), shared_info->StartPosition(),
+          shared_info->EndPosition(), shared_info->language_mode(),
+          &preparse_data_key);
+
   if (shared_info->HasUncompiledDataWithPreparseData()) {
-    parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
-        isolate,
-        handle(
-            shared_info->uncompiled_data_with_preparse_data().preparse_data(),
-            isolate)));
+    Handle<PreparseData> preparse_data(
+        shared_info->uncompiled_data_with_preparse_data().preparse_data(),
+        isolate);
+    if (has_preparse_data_key) {
+      PreparseDataCache::Publish(
+          preparse_data_key, String::cast(script->source()),
+          shared_info->StartPosition(), shared_info->EndPosition(),
+          *preparse_data);
+    }
+    parse_info.set_consumed_preparse_data(
+        ConsumedPreparseData::For(isolate, preparse_data));
+  } else if (has_preparse_data_key) {
+    // The preparse data for this function was discarded (e.g. by bytecode
+    // flushing) or never attached; an earlier compile of the same source may
+    // have published a copy.
+    Handle<PreparseData> cached_preparse_data;
+    if (PreparseDataCache::Lookup(isolate, preparse_data_key,
+                                  String::cast(script->source()),
+                                  shared_info->StartPosition(),
+                                  shared_info->EndPosition())
+            .ToHandle(&cached_preparse_data)) {
+      parse_info.set_consumed_preparse_data(
+          ConsumedPreparseData::For(isolate, cached_preparse_data));
+    }
   }
 
   // Parse and update ParseInfo with the results.
@@ -2800,6 +2865,41 @@ MaybeHandle<JSFunction> Compiler::GetFunctionFromEval(
   if (eval_result.has_shared()) {
     shared_info = Handle<SharedFunctionInfo>(eval_result.shared(), isolate);
     script = Handle<Script>(Script::cast(shared_info->script()), isolate);
+    if (v8_flags.relaxed_eval_cache && context->IsNativeContext() &&
+        script->has_eval_from_shared() &&
+        script->eval_from_shared() != *outer_info) {
+      // With --relaxed-eval-cache the global eval cache shares entries
+      // across eval sites. Clone the SharedFunctionInfo together with its
+      // Script so that this copy reports the requesting site as its eval
+      // origin in stack traces and the debugger. The clone shares the
+      // original's bytecode, so no recompilation happens; inner functions
+      // keep their association with the original script.
+      script = isolate->factory()->CloneScript(script);
+      Handle<SharedFunctionInfo> eval_from = outer_info;
+      if (eval_position == kNoSourcePosition) {
+        // As in the compilation path below, attribute the eval to the
+        // closest JavaScript frame, with a negative position for lazy
+        // translation of the code offset.
+        StackTraceFrameIterator it(isolate);
+        if (!it.done() && it.is_javascript()) {
+          FrameSummary summary = it.GetTopValidFrame();
+          eval_from =
+              handle(summary.AsJavaScript().function()->shared(), isolate);
+          eval_position = -summary.code_offset();
+        } else {
+          eval_position = 0;
+        }
+      }
+      script->set_eval_from_shared(*eval_from);
+      script->set_eval_from_position(eval_position);
+      Handle<WeakFixedArray> infos =
+          isolate->factory()->NewWeakFixedArray(1, AllocationType::kOld);
+      script->set_shared_function_infos(*infos);
+      shared_info = isolate->factory()->CloneSharedFunctionInfo(shared_info);
+      shared_info->set_script(*script);
+      infos->Set(kFunctionLiteralIdTopLevel,
+                 HeapObjectReference::Weak(*shared_info));
+    }
     is_compiled_scope = shared_info->is_compiled_scope(isolate);
     allow_eval_cache = true;
   } else {
@@ -3456,6 +3556,7 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     DCHECK_NULL(extension);
   }
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   if (V8_UNLIKELY(
           v8_flags.experimental_web_snapshots &&
           (source->IsExternalOneByteString() || source->IsSeqOneByteString() ||
@@ -3478,6 +3579,7 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
           isolate, source, script_details.name_obj);
     }
   }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   LanguageMode language_mode = construct_language_mode(v8_flags.use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
@@ -3556,6 +3658,19 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         compile_timer.set_consuming_code_cache_failed();
       }
     }
+
+    // Then check the process-wide shared code cache.
+    if (maybe_result.is_null() && v8_flags.shared_code_cache) {
+      maybe_result = SharedCodeCache::Lookup(
+          isolate, source, script_details.origin_options, language_mode);
+      Handle<SharedFunctionInfo> result;
+      if (maybe_result.ToHandle(&result)) {
+        is_compiled_scope = result->is_compiled_scope(isolate);
+        DCHECK(is_compiled_scope.is_compiled());
+        // Promote to per-isolate compilation cache.
+        compilation_cache->PutScript(source, language_mode, result);
+      }
+    }
   }
 
   if (maybe_result.is_null()) {
@@ -3592,6 +3707,11 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (v8_flags.shared_code_cache) {
+        // Publish the fresh compilation for other isolates in this process.
+        SharedCodeCache::Insert(isolate, source, script_details.origin_options,
+                                language_mode, result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -3800,6 +3920,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
   return maybe_result;
 }  // namespace internal
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
 // static
 Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForWebSnapshot(
     Isolate* isolate, Handle<String> source,
@@ -3823,6 +3944,7 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForWebSnapshot(
   shared->SetScript(isolate->factory()->read_only_roots(), *script, 0, false);
   return shared;
 }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
 // static
 template <typename IsolateT>
@@ -3968,6 +4090,7 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
             isolate, *compilation_info->closure(),
             compilation_info->osr_offset(), ToCodeT(*compilation_info->code()),
             compilation_info->function_context_specializing());
+        shared->set_turbofan_compiled_before(true);
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
         if (IsOSR(osr_offset)) {
           CompilerTracer::TraceOptimizeOSRFinished(isolate, function,
@@ -4020,6 +4143,11 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
                                function->code(),
                                job->specialize_to_function_context());
 
+    // Remember that this function reached Maglev. The bit is serialized with
+    // the code cache and lets fresh isolates re-tier the function with a
+    // reduced interrupt budget.
+    function->shared().set_maglev_compiled_before(true);
+
     // Reset ticks just after installation since ticks accumulated in lower
     // tiers use a different (lower) budget than ticks collected in Maglev
     // code.
@@ -224,8 +224,10 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       Isolate* isolate, Handle<String> source,
       const ScriptDetails& script_details, ScriptStreamingData* streaming_data);
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   static Handle<SharedFunctionInfo> GetSharedFunctionInfoForWebSnapshot(
       Isolate* isolate, Handle<String> source, MaybeHandle<Object> script_name);
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   // Create a shared function info object for the given function literal
   // node (the code may be lazily compiled).
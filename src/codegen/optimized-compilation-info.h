@@ -138,6 +138,15 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   std::unique_ptr<wasm::WasmCompilationResult> ReleaseWasmCompilationResult();
 #endif  // V8_ENABLE_WEBASSEMBLY
 
+  // Optimized code is always specialized to the closure's native context:
+  // the compiler embeds maps, protector cells, global property cells and
+  // other context-owned constants directly into the code, and the result is
+  // cached on the feedback vector, which is itself per-context. Reusing
+  // optimized code across structurally identical contexts would require
+  // compiling without those embedded constants and loading them from the
+  // incoming context instead; a previous attempt at this (the
+  // native-context-independent code experiment) was removed upstream after
+  // the indirection cost more than the cross-context reuse recovered.
   bool has_context() const;
   Context context() const;
 
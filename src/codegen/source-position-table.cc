@@ -145,6 +145,7 @@ SourcePositionTableBuilder::SourcePositionTableBuilder(
     Zone* zone, SourcePositionTableBuilder::RecordingMode mode)
     : mode_(mode),
       bytes_(zone),
+      checkpoints_(zone),
 #ifdef ENABLE_SLOW_DCHECKS
       raw_entries_(zone),
 #endif
@@ -165,11 +166,48 @@ void SourcePositionTableBuilder::AddEntry(const PositionTableEntry& entry) {
   SubtractFromEntry(&tmp, previous_);
   EncodeEntry(&bytes_, tmp);
   previous_ = entry;
+  if (++entry_count_ % kIndexGranularity == 0 &&
+      SourcePosition::FromRaw(entry.source_position).IsJavaScript()) {
+    // Only JavaScript positions are checkpointed; seeking to a checkpoint
+    // must land on an entry that satisfies the kJavaScriptOnly filter.
+    PositionTableCheckpoint checkpoint;
+    checkpoint.byte_offset = static_cast<int32_t>(bytes_.size());
+    checkpoint.code_offset =
+        entry.is_statement ? entry.code_offset : -entry.code_offset - 1;
+    checkpoint.source_position = entry.source_position;
+    checkpoints_.push_back(checkpoint);
+  }
 #ifdef ENABLE_SLOW_DCHECKS
   raw_entries_.push_back(entry);
 #endif
 }
 
+namespace {
+
+// The table layout is the delta-encoded stream, followed by the checkpoint
+// index, followed by an int32 checkpoint count.
+size_t TableSize(const ZoneVector<byte>& bytes,
+                 const ZoneVector<PositionTableCheckpoint>& checkpoints) {
+  return bytes.size() +
+         checkpoints.size() * sizeof(PositionTableCheckpoint) +
+         sizeof(int32_t);
+}
+
+void WriteTable(byte* data, const ZoneVector<byte>& bytes,
+                const ZoneVector<PositionTableCheckpoint>& checkpoints) {
+  MemCopy(data, bytes.data(), bytes.size());
+  data += bytes.size();
+  if (!checkpoints.empty()) {
+    MemCopy(data, checkpoints.data(),
+            checkpoints.size() * sizeof(PositionTableCheckpoint));
+    data += checkpoints.size() * sizeof(PositionTableCheckpoint);
+  }
+  int32_t num_checkpoints = static_cast<int32_t>(checkpoints.size());
+  MemCopy(data, &num_checkpoints, sizeof(num_checkpoints));
+}
+
+}  // namespace
+
 template <typename IsolateT>
 Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable(
     IsolateT* isolate) {
@@ -177,8 +215,8 @@ Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable(
   DCHECK(!Omit());
 
   Handle<ByteArray> table = isolate->factory()->NewByteArray(
-      static_cast<int>(bytes_.size()), AllocationType::kOld);
-  MemCopy(table->GetDataStartAddress(), bytes_.data(), bytes_.size());
+      static_cast<int>(TableSize(bytes_, checkpoints_)), AllocationType::kOld);
+  WriteTable(table->GetDataStartAddress(), bytes_, checkpoints_);
 
 #ifdef ENABLE_SLOW_DCHECKS
   // Brute force testing: Record all positions and decode
@@ -205,7 +243,9 @@ SourcePositionTableBuilder::ToSourcePositionTableVector() {
   if (bytes_.empty()) return base::OwnedVector<byte>();
   DCHECK(!Omit());
 
-  base::OwnedVector<byte> table = base::OwnedVector<byte>::Of(bytes_);
+  base::OwnedVector<byte> table =
+      base::OwnedVector<byte>::New(TableSize(bytes_, checkpoints_));
+  WriteTable(table.begin(), bytes_, checkpoints_);
 
 #ifdef ENABLE_SLOW_DCHECKS
   // Brute force testing: Record all positions and decode
@@ -221,6 +261,22 @@ SourcePositionTableBuilder::ToSourcePositionTableVector() {
 }
 
 void SourcePositionTableIterator::Initialize() {
+  base::Vector<const byte> bytes =
+      table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
+  if (bytes.length() == 0) {
+    stream_end_ = 0;
+    num_checkpoints_ = 0;
+  } else {
+    int32_t num_checkpoints;
+    MemCopy(&num_checkpoints, bytes.end() - sizeof(int32_t), sizeof(int32_t));
+    num_checkpoints_ = num_checkpoints;
+    stream_end_ = bytes.length() -
+                  static_cast<int>(sizeof(int32_t) +
+                                   num_checkpoints_ *
+                                       sizeof(PositionTableCheckpoint));
+    DCHECK_GE(num_checkpoints_, 0);
+    DCHECK_GT(stream_end_, 0);
+  }
   Advance();
   if (function_entry_filter_ == kSkipFunctionEntry &&
       current_.code_offset == kFunctionEntryBytecodeOffset && !done()) {
@@ -267,10 +323,10 @@ void SourcePositionTableIterator::Advance() {
   base::Vector<const byte> bytes =
       table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
   DCHECK(!done());
-  DCHECK(index_ >= 0 && index_ <= bytes.length());
+  DCHECK(index_ >= 0 && index_ <= stream_end_);
   bool filter_satisfied = false;
   while (!done() && !filter_satisfied) {
-    if (index_ >= bytes.length()) {
+    if (index_ >= stream_end_) {
       index_ = kDone;
     } else {
       PositionTableEntry tmp;
@@ -285,5 +341,47 @@ void SourcePositionTableIterator::Advance() {
   }
 }
 
+void SourcePositionTableIterator::SkipToPosition(int code_offset) {
+  if (num_checkpoints_ == 0 || done()) return;
+  // Checkpoints are only recorded for JavaScript positions, so seeking would
+  // skip external positions in between.
+  if (iteration_filter_ == kExternalOnly) return;
+  base::Vector<const byte> bytes =
+      table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
+  const byte* checkpoints = bytes.begin() + stream_end_;
+
+  auto load_checkpoint = [checkpoints](int i) {
+    PositionTableCheckpoint checkpoint;
+    MemCopy(&checkpoint, checkpoints + i * sizeof(PositionTableCheckpoint),
+            sizeof(PositionTableCheckpoint));
+    return checkpoint;
+  };
+  auto entry_code_offset = [](const PositionTableCheckpoint& checkpoint) {
+    return checkpoint.code_offset >= 0 ? checkpoint.code_offset
+                                       : -checkpoint.code_offset - 1;
+  };
+
+  // Binary search for the last checkpoint at or before {code_offset}.
+  int low = -1;
+  int high = num_checkpoints_;
+  while (high - low > 1) {
+    int mid = low + (high - low) / 2;
+    if (entry_code_offset(load_checkpoint(mid)) <= code_offset) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < 0) return;
+
+  PositionTableCheckpoint checkpoint = load_checkpoint(low);
+  int checkpoint_code_offset = entry_code_offset(checkpoint);
+  // Never seek backwards; the caller may already have advanced past it.
+  if (checkpoint_code_offset <= current_.code_offset) return;
+  index_ = checkpoint.byte_offset;
+  current_ = {checkpoint_code_offset, checkpoint.source_position,
+              checkpoint.code_offset >= 0};
+}
+
 }  // namespace internal
 }  // namespace v8
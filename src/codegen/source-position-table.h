@@ -35,6 +35,19 @@ struct PositionTableEntry {
   bool is_statement;
 };
 
+// A checkpoint into the delta-encoded position stream. For large tables, a
+// checkpoint is recorded for every kIndexGranularity-th entry and appended
+// after the stream, followed by an int32 checkpoint count, so that lookups
+// can seek close to a code offset instead of decoding the whole table.
+struct PositionTableCheckpoint {
+  // Position in the stream just after the checkpointed entry.
+  int32_t byte_offset;
+  // The entry's code offset, with is_statement encoded in the sign just like
+  // in the stream encoding.
+  int32_t code_offset;
+  int64_t source_position;
+};
+
 class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
  public:
   enum RecordingMode {
@@ -63,14 +76,20 @@ class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
   inline bool Lazy() const { return mode_ == LAZY_SOURCE_POSITIONS; }
 
  private:
+  // Record a checkpoint for every kIndexGranularity-th entry. Smaller tables
+  // carry no checkpoints at all.
+  static constexpr int kIndexGranularity = 64;
+
   void AddEntry(const PositionTableEntry& entry);
 
   RecordingMode mode_;
   ZoneVector<byte> bytes_;
+  ZoneVector<PositionTableCheckpoint> checkpoints_;
 #ifdef ENABLE_SLOW_DCHECKS
   ZoneVector<PositionTableEntry> raw_entries_;
 #endif
   PositionTableEntry previous_;  // Previously written entry, to compute delta.
+  int entry_count_ = 0;
 };
 
 class V8_EXPORT_PRIVATE SourcePositionTableIterator {
@@ -120,6 +139,13 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
 
   void Advance();
 
+  // Skips ahead to the last checkpointed entry at or before {code_offset},
+  // if the table carries checkpoints and that entry lies past the current
+  // one. Intended for the common "last entry with code_offset <= pc" lookup
+  // pattern; only JavaScript positions are checkpointed, so this is a no-op
+  // for kExternalOnly iteration.
+  void SkipToPosition(int code_offset);
+
   int code_offset() const {
     DCHECK(!done());
     return current_.code_offset;
@@ -155,6 +181,10 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
   base::Vector<const byte> raw_table_;
   Handle<ByteArray> table_;
   int index_ = 0;
+  // End of the delta-encoded stream; the checkpoint index and its footer
+  // follow from here to the end of the table.
+  int stream_end_ = 0;
+  int num_checkpoints_ = 0;
   PositionTableEntry current_;
   IterationFilter iteration_filter_;
   FunctionEntryFilter function_entry_filter_;
@@ -39,20 +39,16 @@ bool RwxMemoryWriteScope::IsSupported() { return true; }
 
 // static
 void RwxMemoryWriteScope::SetWritable() {
-  auto level_val = code_space_write_nesting_level_.Pointer();
-  auto level = level_val->Get();
-  if (level == 0) {
+  if (code_space_write_nesting_level_ == 0) {
     pthread_jit_write_protect_np(0);
   }
-  level_val->Set(level + 1);
+  code_space_write_nesting_level_++;
 }
 
 // static
 void RwxMemoryWriteScope::SetExecutable() {
-  auto level_val = code_space_write_nesting_level_.Pointer();
-  auto level = level_val->Get() - 1;
-  level_val->Set(level);
-  if (level == 0) {
+  code_space_write_nesting_level_--;
+  if (code_space_write_nesting_level_ == 0) {
     pthread_jit_write_protect_np(1);
   }
 }
@@ -70,26 +66,22 @@ bool RwxMemoryWriteScope::IsSupported() {
 void RwxMemoryWriteScope::SetWritable() {
   DCHECK(pkey_initialized);
   if (!IsSupported()) return;
-  auto level_val = code_space_write_nesting_level_.Pointer();
-  auto level = level_val->Get();
-  if (level == 0) {
+  if (code_space_write_nesting_level_ == 0) {
     DCHECK_NE(
         base::MemoryProtectionKey::GetKeyPermission(memory_protection_key_),
         base::MemoryProtectionKey::kNoRestrictions);
     base::MemoryProtectionKey::SetPermissionsForKey(
         memory_protection_key_, base::MemoryProtectionKey::kNoRestrictions);
   }
-  level_val->Set(level + 1);
+  code_space_write_nesting_level_++;
 }
 
 // static
 void RwxMemoryWriteScope::SetExecutable() {
   DCHECK(pkey_initialized);
   if (!IsSupported()) return;
-  auto level_val = code_space_write_nesting_level_.Pointer();
-  auto level = level_val->Get() - 1;
-  level_val->Set(level);
-  if (level == 0) {
+  code_space_write_nesting_level_--;
+  if (code_space_write_nesting_level_ == 0) {
     DCHECK_EQ(
         base::MemoryProtectionKey::GetKeyPermission(memory_protection_key_),
         base::MemoryProtectionKey::kNoRestrictions);
@@ -6,7 +6,6 @@
 #define V8_COMMON_CODE_MEMORY_ACCESS_H_
 
 #include "src/base/build_config.h"
-#include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
 #include "src/base/platform/platform.h"
 
@@ -94,9 +93,10 @@ class V8_NODISCARD RwxMemoryWriteScope {
   V8_INLINE static void SetExecutable();
 
 #if V8_HAS_PTHREAD_JIT_WRITE_PROTECT || V8_HAS_PKU_JIT_WRITE_PROTECT
-  // This counter is used for supporting scope reentrance.
-  static base::LazyInstance<base::ThreadLocalInt>::type
-      code_space_write_nesting_level_;
+  // This counter is used for supporting scope reentrance. A plain
+  // thread_local keeps entering and exiting the scope lock-free and cheap
+  // enough for concurrent code installation on background compiler threads.
+  static thread_local int code_space_write_nesting_level_;
 #endif  // V8_HAS_PTHREAD_JIT_WRITE_PROTECT || V8_HAS_PKU_JIT_WRITE_PROTECT
 
 #if V8_HAS_PKU_JIT_WRITE_PROTECT
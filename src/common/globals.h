@@ -1047,8 +1047,9 @@ enum class GarbageCollectionReason : int {
   kBackgroundAllocationFailure = 25,
   kFinalizeMinorMC = 26,
   kCppHeapAllocationFailure = 27,
+  kIsolateReset = 28,
 
-  kLastReason = kCppHeapAllocationFailure,
+  kLastReason = kIsolateReset,
 };
 
 static_assert(kGarbageCollectionReasonMaxValue ==
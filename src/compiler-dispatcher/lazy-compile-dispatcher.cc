@@ -4,6 +4,7 @@
 
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 
+#include <algorithm>
 #include <atomic>
 
 #include "include/v8-platform.h"
@@ -52,8 +53,9 @@ class LazyCompileDispatcher::JobTask : public v8::JobTask {
   LazyCompileDispatcher* lazy_compile_dispatcher_;
 };
 
-LazyCompileDispatcher::Job::Job(std::unique_ptr<BackgroundCompileTask> task)
-    : task(std::move(task)), state(Job::State::kPending) {}
+LazyCompileDispatcher::Job::Job(std::unique_ptr<BackgroundCompileTask> task,
+                                TaskPriority priority)
+    : task(std::move(task)), priority(priority), state(Job::State::kPending) {}
 
 LazyCompileDispatcher::Job::~Job() = default;
 
@@ -146,15 +148,18 @@ void SetUncompiledDataJobPointer(LocalIsolate* isolate,
 
 void LazyCompileDispatcher::Enqueue(
     LocalIsolate* isolate, Handle<SharedFunctionInfo> shared_info,
-    std::unique_ptr<Utf16CharacterStream> character_stream) {
+    std::unique_ptr<Utf16CharacterStream> character_stream,
+    TaskPriority priority) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.LazyCompilerDispatcherEnqueue");
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
-  Job* job = new Job(std::make_unique<BackgroundCompileTask>(
-      isolate_, shared_info, std::move(character_stream),
-      worker_thread_runtime_call_stats_, background_compile_timer_,
-      static_cast<int>(max_stack_size_)));
+  Job* job = new Job(
+      std::make_unique<BackgroundCompileTask>(
+          isolate_, shared_info, std::move(character_stream),
+          worker_thread_runtime_call_stats_, background_compile_timer_,
+          static_cast<int>(max_stack_size_)),
+      priority);
 
   SetUncompiledDataJobPointer(isolate, shared_info,
                               reinterpret_cast<Address>(job));
@@ -172,7 +177,7 @@ void LazyCompileDispatcher::Enqueue(
 #ifdef DEBUG
     all_jobs_.insert(job);
 #endif
-    pending_background_jobs_.push_back(job);
+    InsertPendingBackgroundJob(job, lock);
     NotifyAddedBackgroundJob(lock);
   }
   // This is not in NotifyAddedBackgroundJob to avoid being inside the mutex.
@@ -193,6 +198,18 @@ bool LazyCompileDispatcher::IsEnqueued(
   return job != nullptr;
 }
 
+void LazyCompileDispatcher::InsertPendingBackgroundJob(
+    Job* job, const base::MutexGuard&) {
+  // Keep |pending_background_jobs_| ordered by ascending priority, with new
+  // jobs placed behind existing jobs of the same priority. Background threads
+  // pop from the back, so higher-priority jobs are picked up first and jobs
+  // within a lane run in LIFO order, as before.
+  auto insert_pos = std::upper_bound(
+      pending_background_jobs_.begin(), pending_background_jobs_.end(), job,
+      [](Job* a, Job* b) { return a->priority < b->priority; });
+  pending_background_jobs_.insert(insert_pos, job);
+}
+
 void LazyCompileDispatcher::WaitForJobIfRunningOnBackground(
     Job* job, const base::MutexGuard& lock) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "include/v8-platform.h"
 #include "src/base/atomic-utils.h"
 #include "src/base/macros.h"
 #include "src/base/platform/condition-variable.h"
@@ -82,8 +83,12 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   LazyCompileDispatcher& operator=(const LazyCompileDispatcher&) = delete;
   ~LazyCompileDispatcher();
 
+  // Enqueues a job for the given function. |priority| selects the lane the
+  // job is queued in: background threads drain higher-priority lanes first,
+  // so best-effort bulk compiles cannot starve user-blocking requests.
   void Enqueue(LocalIsolate* isolate, Handle<SharedFunctionInfo> shared_info,
-               std::unique_ptr<Utf16CharacterStream> character_stream);
+               std::unique_ptr<Utf16CharacterStream> character_stream,
+               TaskPriority priority = TaskPriority::kUserVisible);
 
   // Returns true if there is a pending job registered for the given function.
   bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
@@ -107,6 +112,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(LazyCompileDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(LazyCompileDispatcherTest, EnqueuePriorityOrder);
 
   // JobTask for PostJob API.
   class JobTask;
@@ -138,7 +144,7 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
       kFinalized,
     };
 
-    explicit Job(std::unique_ptr<BackgroundCompileTask> task);
+    Job(std::unique_ptr<BackgroundCompileTask> task, TaskPriority priority);
     ~Job();
 
     bool is_running_on_background() const {
@@ -146,12 +152,14 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
     }
 
     std::unique_ptr<BackgroundCompileTask> task;
+    TaskPriority priority;
     State state = State::kPending;
   };
 
   using SharedToJobMap = IdentityMap<Job*, FreeStoreAllocationPolicy>;
 
   void WaitForJobIfRunningOnBackground(Job* job, const base::MutexGuard&);
+  void InsertPendingBackgroundJob(Job* job, const base::MutexGuard&);
   Job* GetJobFor(Handle<SharedFunctionInfo> shared,
                  const base::MutexGuard&) const;
   Job* PopSingleFinalizeJob();
@@ -202,7 +210,9 @@ class V8_EXPORT_PRIVATE LazyCompileDispatcher {
   // True if an idle task is scheduled to be run.
   bool idle_task_scheduled_;
 
-  // The set of jobs that can be run on a background thread.
+  // The set of jobs that can be run on a background thread, ordered by
+  // ascending priority. Background threads pop from the back, so the
+  // highest-priority lane drains first; within a lane jobs run in LIFO order.
   std::vector<Job*> pending_background_jobs_;
 
   // The set of jobs that can be finalized on the main thread.
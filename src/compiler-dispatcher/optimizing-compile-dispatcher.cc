@@ -183,14 +183,24 @@ void OptimizingCompileDispatcher::Stop() {
   DCHECK_EQ(input_queue_length_, 0);
 }
 
-void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
+void OptimizingCompileDispatcher::InstallOptimizedFunctions(InstallMode mode) {
   HandleScope handle_scope(isolate_);
 
+  const int install_limit = v8_flags.concurrent_recompilation_install_limit;
+  int installed = 0;
   for (;;) {
     std::unique_ptr<TurbofanCompilationJob> job;
     {
       base::MutexGuard access_output_queue_(&output_queue_mutex_);
       if (output_queue_.empty()) return;
+      // A burst of finished jobs can otherwise install dozens of code objects
+      // in a single stack guard pause; spread the work over several
+      // interrupts instead.
+      if (mode == InstallMode::kBounded && install_limit > 0 &&
+          installed >= install_limit) {
+        isolate_->stack_guard()->RequestInstallCode();
+        return;
+      }
       job.reset(output_queue_.front());
       output_queue_.pop();
     }
@@ -210,6 +220,7 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     }
 
     Compiler::FinalizeTurbofanCompilationJob(job.get(), isolate_);
+    installed++;
   }
 }
 
@@ -42,7 +42,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Takes ownership of |job|.
   void QueueForOptimization(TurbofanCompilationJob* job);
   void AwaitCompileTasks();
-  void InstallOptimizedFunctions();
+  // Finalizes and installs the code of finished compilation jobs. With
+  // kBounded, at most --concurrent-recompilation-install-limit jobs are
+  // installed per call to keep stack guard pauses short; leftover jobs
+  // re-request the install-code interrupt. kAll drains the whole queue.
+  enum class InstallMode { kAll, kBounded };
+  void InstallOptimizedFunctions(InstallMode mode = InstallMode::kAll);
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
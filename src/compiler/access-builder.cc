@@ -312,6 +312,26 @@ FieldAccess AccessBuilder::ForJSAsyncFunctionObjectPromise() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitOnResolve() {
+  FieldAccess access = {
+      kTaggedBase,       JSAsyncFunctionObject::kAwaitOnResolveOffset,
+      Handle<Name>(),    MaybeHandle<Map>(),
+      Type::Any(),       MachineType::AnyTagged(),
+      kFullWriteBarrier, "JSAsyncFunctionObjectAwaitOnResolve"};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitOnReject() {
+  FieldAccess access = {
+      kTaggedBase,       JSAsyncFunctionObject::kAwaitOnRejectOffset,
+      Handle<Name>(),    MaybeHandle<Map>(),
+      Type::Any(),       MachineType::AnyTagged(),
+      kFullWriteBarrier, "JSAsyncFunctionObjectAwaitOnReject"};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSAsyncGeneratorObjectQueue() {
   FieldAccess access = {
@@ -122,6 +122,12 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   // Provides access to JSAsyncFunctionObject::promise() field.
   static FieldAccess ForJSAsyncFunctionObjectPromise();
 
+  // Provides access to JSAsyncFunctionObject::await_on_resolve() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitOnResolve();
+
+  // Provides access to JSAsyncFunctionObject::await_on_reject() field.
+  static FieldAccess ForJSAsyncFunctionObjectAwaitOnReject();
+
   // Provides access to JSAsyncGeneratorObject::queue() field.
   static FieldAccess ForJSAsyncGeneratorObjectQueue();
 
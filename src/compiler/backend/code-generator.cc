@@ -75,6 +75,7 @@ CodeGenerator::CodeGenerator(
       safepoints_(codegen_zone),
       handlers_(codegen_zone),
       deoptimization_exits_(codegen_zone),
+      deopt_exit_dedup_map_(codegen_zone),
       deoptimization_literals_(codegen_zone),
       translations_(codegen_zone),
       max_unoptimized_frame_height_(max_unoptimized_frame_height),
@@ -773,13 +774,17 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleInstruction(
           DeoptImmedArgsCountField::decode(instr->opcode());
       DeoptimizationExit* const exit = AddDeoptimizationExit(
           instr, frame_state_offset, immediate_args_count);
+      // The continue label of a deduplicated exit is already bound at its
+      // first use; later uses fall through to a continuation of their own.
+      Label* continue_label = exit->continue_label();
+      if (continue_label->is_bound()) continue_label = zone()->New<Label>();
       BranchInfo branch;
       branch.condition = condition;
       branch.true_label = exit->label();
-      branch.false_label = exit->continue_label();
+      branch.false_label = continue_label;
       branch.fallthru = true;
       AssembleArchDeoptBranch(instr, &branch);
-      tasm()->bind(exit->continue_label());
+      tasm()->bind(continue_label);
       break;
     }
     case kFlags_set: {
@@ -1130,7 +1135,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   frame_state_offset++;
 
   const int update_feedback_count = entry.feedback().IsValid() ? 1 : 0;
-  const int translation_index = translations_.BeginTranslation(
+  int translation_index = translations_.BeginTranslation(
       static_cast<int>(descriptor->GetFrameCount()),
       static_cast<int>(descriptor->GetJSFrameCount()), update_feedback_count);
   if (entry.feedback().IsValid()) {
@@ -1142,6 +1147,27 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
   InstructionOperandIterator iter(instr, frame_state_offset);
   BuildTranslationForFrameStateDescriptor(descriptor, &iter, state_combine);
 
+  // Eager deoptimization exits with identical translations are
+  // interchangeable, so they can share a single out-of-line exit sequence and
+  // deoptimization data entry. Lazy exits are identified by the return
+  // address of their call site and must stay distinct, as must exits whose
+  // immediate arguments carry per-site operands.
+  const bool dedupe_exit = v8_flags.turbo_dedupe_deopt_exits &&
+                           pc_offset == -1 &&
+                           entry.kind() == DeoptimizeKind::kEager &&
+                           immediate_args_count == 0;
+  DeoptExitDedupKey dedup_key;
+  if (v8_flags.turbo_dedupe_deopt_exits) {
+    translation_index = translations_.DedupeLastTranslation(translation_index);
+  }
+  if (dedupe_exit) {
+    dedup_key = DeoptExitDedupKey(
+        translation_index, descriptor->bailout_id().ToInt(),
+        static_cast<int>(entry.reason()), current_source_position_.raw());
+    auto it = deopt_exit_dedup_map_.find(dedup_key);
+    if (it != deopt_exit_dedup_map_.end()) return it->second;
+  }
+
   DeoptimizationExit* const exit = zone()->New<DeoptimizationExit>(
       current_source_position_, descriptor->bailout_id(), translation_index,
       pc_offset, entry.kind(), entry.reason(),
@@ -1160,6 +1186,7 @@ DeoptimizationExit* CodeGenerator::BuildTranslation(
     exit->set_immediate_args(immediate_args);
   }
 
+  if (dedupe_exit) deopt_exit_dedup_map_.emplace(dedup_key, exit);
   deoptimization_exits_.push_back(exit);
   return exit;
 }
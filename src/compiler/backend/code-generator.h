@@ -6,6 +6,7 @@
 #define V8_COMPILER_BACKEND_CODE_GENERATOR_H_
 
 #include <memory>
+#include <tuple>
 
 #include "src/base/optional.h"
 #include "src/codegen/macro-assembler.h"
@@ -453,6 +454,11 @@ class V8_EXPORT_PRIVATE CodeGenerator final : public GapResolver::Assembler {
   int eager_deopt_count_ = 0;
   int lazy_deopt_count_ = 0;
   ZoneDeque<DeoptimizationExit*> deoptimization_exits_;
+  // Eager deoptimization exits without immediate arguments that agree on
+  // translation index, bytecode offset, deopt reason and source position are
+  // interchangeable and share a single exit, keyed by those four values.
+  using DeoptExitDedupKey = std::tuple<int, int, int, int64_t>;
+  ZoneMap<DeoptExitDedupKey, DeoptimizationExit*> deopt_exit_dedup_map_;
   ZoneDeque<DeoptimizationLiteral> deoptimization_literals_;
   size_t inlined_function_count_ = 0;
   TranslationArrayBuilder translations_;
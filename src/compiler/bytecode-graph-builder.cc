@@ -23,6 +23,7 @@
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/interpreter/bytecodes.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-generator.h"
 #include "src/objects/literal-objects-inl.h"
 #include "src/objects/scope-info.h"
@@ -322,6 +323,10 @@ class BytecodeGraphBuilder {
 
   // Control flow plumbing.
   void BuildJump();
+  // Returns the branch hint recorded by the interpreter for the conditional
+  // jump bytecode currently being visited. {jump_on_true} describes which
+  // branch direction takes the jump; see FeedbackVector::branch_bias.
+  BranchHint GetBranchBiasHint(bool jump_on_true);
   void BuildJumpIf(Node* condition);
   void BuildJumpIfNot(Node* condition);
   void BuildJumpIfEqual(Node* comperand);
@@ -3978,8 +3983,20 @@ void BytecodeGraphBuilder::BuildJump() {
   MergeIntoSuccessorEnvironment(bytecode_iterator().GetJumpTargetOffset());
 }
 
+BranchHint BytecodeGraphBuilder::GetBranchBiasHint(bool jump_on_true) {
+  if (!v8_flags.ignition_branch_bias) return BranchHint::kNone;
+  int bias = feedback_vector().object()->branch_bias(
+      bytecode_iterator().current_offset());
+  if (bias < FeedbackVector::kBranchBiasHintThreshold &&
+      bias > -FeedbackVector::kBranchBiasHintThreshold) {
+    return BranchHint::kNone;
+  }
+  bool mostly_taken = bias > 0;
+  return mostly_taken == jump_on_true ? BranchHint::kTrue : BranchHint::kFalse;
+}
+
 void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+  NewBranch(condition, GetBranchBiasHint(true));
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
@@ -3989,7 +4006,7 @@ void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfNot(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+  NewBranch(condition, GetBranchBiasHint(false));
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -4013,7 +4030,7 @@ void BytecodeGraphBuilder::BuildJumpIfNotEqual(Node* comperand) {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfFalse() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  NewBranch(environment()->LookupAccumulator(), GetBranchBiasHint(false));
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -4025,7 +4042,7 @@ void BytecodeGraphBuilder::BuildJumpIfFalse() {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfTrue() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  NewBranch(environment()->LookupAccumulator(), GetBranchBiasHint(true));
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
@@ -201,6 +201,7 @@ class EffectControlLinearizer {
   Node* LowerLoadMessage(Node* node);
   Node* AdaptFastCallTypedArrayArgument(Node* node,
                                         ElementsKind expected_elements_kind,
+                                        bool allow_shared,
                                         GraphAssemblerLabel<0>* bailout);
   Node* AdaptFastCallArgument(Node* node, CTypeInfo arg_type,
                               GraphAssemblerLabel<0>* if_error);
@@ -5089,7 +5090,7 @@ void EffectControlLinearizer::LowerStoreMessage(Node* node) {
 }
 
 Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
-    Node* node, ElementsKind expected_elements_kind,
+    Node* node, ElementsKind expected_elements_kind, bool allow_shared,
     GraphAssemblerLabel<0>* bailout) {
   Node* value_map = __ LoadField(AccessBuilder::ForMap(), node);
   Node* value_instance_type =
@@ -5120,12 +5121,17 @@ Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
       __ ZeroConstant());
   __ GotoIfNot(buffer_is_not_detached, bailout);
 
-  // Go to the slow path if the {buffer} is shared.
-  Node* buffer_is_not_shared = __ Word32Equal(
-      __ Word32And(buffer_bit_field,
-                   __ Int32Constant(JSArrayBuffer::IsSharedBit::kMask)),
-      __ ZeroConstant());
-  __ GotoIfNot(buffer_is_not_shared, bailout);
+  // Go to the slow path if the {buffer} is shared, unless the signature
+  // declared the argument with {CTypeInfo::Flags::kAllowSharedBit}. Note that
+  // views on growable shared buffers have RAB/GSAB elements kinds and thus
+  // never reach this point.
+  if (!allow_shared) {
+    Node* buffer_is_not_shared = __ Word32Equal(
+        __ Word32And(buffer_bit_field,
+                     __ Int32Constant(JSArrayBuffer::IsSharedBit::kMask)),
+        __ ZeroConstant());
+    __ GotoIfNot(buffer_is_not_shared, bailout);
+  }
 
   // Unpack the store and length, and store them to a struct
   // FastApiTypedArray.
@@ -5352,9 +5358,11 @@ Node* EffectControlLinearizer::AdaptFastCallArgument(
       Node* value_is_smi = ObjectIsSmi(node);
       __ GotoIf(value_is_smi, if_error);
 
+      bool allow_shared = uint8_t(arg_type.GetFlags()) &
+                          uint8_t(CTypeInfo::Flags::kAllowSharedBit);
       return AdaptFastCallTypedArrayArgument(
           node, fast_api_call::GetTypedArrayElementsKind(arg_type.GetType()),
-          if_error);
+          allow_shared, if_error);
     }
     default: {
       UNREACHABLE();
@@ -5412,11 +5420,13 @@ EffectControlLinearizer::AdaptOverloadedFastCallArgument(
       case CTypeInfo::SequenceType::kIsTypedArray: {
         // Check that the value is a TypedArray with a type that matches the
         // type declared in the c-function.
+        bool allow_shared = uint8_t(arg_type.GetFlags()) &
+                            uint8_t(CTypeInfo::Flags::kAllowSharedBit);
         Node* stack_slot = AdaptFastCallTypedArrayArgument(
             node,
             fast_api_call::GetTypedArrayElementsKind(
                 overloads_resolution_result.element_type),
-            &next);
+            allow_shared, &next);
         Node* target_address = __ ExternalConstant(ExternalReference::Create(
             c_functions[func_index].address, ref_type));
         __ Goto(&merge, target_address, stack_slot);
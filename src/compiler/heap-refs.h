@@ -703,6 +703,7 @@ class V8_EXPORT_PRIVATE MapRef : public HeapObjectRef {
   bool CanTransition() const;
   bool IsInobjectSlackTrackingInProgress() const;
   bool is_dictionary_map() const;
+  bool is_extensible() const;
   bool IsFixedCowArrayMap() const;
   bool IsPrimitiveMap() const;
   bool is_undetectable() const;
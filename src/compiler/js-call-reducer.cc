@@ -3036,12 +3036,53 @@ Reduction JSCallReducer::ReduceFunctionPrototypeBind(Node* node) {
     }
   }
 
-  // Choose the map for the resulting JSBoundFunction (but bail out in case of a
-  // custom prototype).
+  // Choose the map for the resulting JSBoundFunction.
   MapRef map = is_constructor
                    ? native_context().bound_function_with_constructor_map()
                    : native_context().bound_function_without_constructor_map();
-  if (!map.prototype().equals(prototype)) return inference.NoChange();
+  if (!map.prototype().equals(prototype)) {
+    // A custom prototype means the runtime would derive the map through a
+    // prototype transition of {map}. The one case worth tracking here is
+    // rebinding a bound function whose map still has the canonical layout:
+    // the result then receives the receiver's own map, mirroring
+    // Factory::NewJSBoundFunction.
+    if (receiver_maps.size() != 1) return inference.NoChange();
+    MapRef receiver_map = receiver_maps[0];
+    static constexpr int kDescriptorCount =
+        JSFunctionOrBoundFunctionOrWrappedFunction::kNameDescriptorIndex + 1;
+    if (receiver_map.instance_type() != JS_BOUND_FUNCTION_TYPE ||
+        !receiver_map.is_extensible() ||
+        receiver_map.elements_kind() != TERMINAL_FAST_ELEMENTS_KIND ||
+        receiver_map.NumberOfOwnDescriptors() != kDescriptorCount) {
+      return inference.NoChange();
+    }
+    const InternalIndex kLengthIndex(
+        JSFunctionOrBoundFunctionOrWrappedFunction::kLengthDescriptorIndex);
+    const InternalIndex kNameIndex(
+        JSFunctionOrBoundFunctionOrWrappedFunction::kNameDescriptorIndex);
+    base::Optional<ObjectRef> length_value(
+        receiver_map.GetStrongValue(kLengthIndex));
+    base::Optional<ObjectRef> name_value(
+        receiver_map.GetStrongValue(kNameIndex));
+    if (!length_value || !name_value ||
+        !length_value->equals(MakeRef(
+            broker(), factory()->bound_function_length_accessor())) ||
+        !name_value->equals(
+            MakeRef(broker(), factory()->bound_function_name_accessor()))) {
+      return inference.NoChange();
+    }
+    constexpr PropertyAttributes roc_attribs =
+        static_cast<PropertyAttributes>(DONT_ENUM | READ_ONLY);
+    for (InternalIndex i : {kLengthIndex, kNameIndex}) {
+      PropertyDetails details = receiver_map.GetPropertyDetails(i);
+      if (details.kind() != PropertyKind::kAccessor ||
+          details.location() != PropertyLocation::kDescriptor ||
+          details.attributes() != roc_attribs) {
+        return inference.NoChange();
+      }
+    }
+    map = receiver_map;
+  }
 
   inference.RelyOnMapsPreferStability(dependencies(), jsgraph(), &effect,
                                       control, p.feedback());
@@ -4,6 +4,8 @@
 
 #include "src/compiler/loop-peeling.h"
 
+#include <cmath>
+
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/graph.h"
@@ -12,6 +14,7 @@
 #include "src/compiler/node-origin-table.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 // Loop peeling is an optimization that copies the body of a loop, creating
@@ -123,6 +126,10 @@ Node* PeeledIteration::map(Node* node) {
 }
 
 PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop) {
+  return Peel(loop, false);
+}
+
+PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop, bool remark_exits) {
   if (!CanPeel(loop)) return nullptr;
 
   //============================================================================
@@ -190,24 +197,62 @@ PeeledIteration* LoopPeeler::Peel(LoopTree::Loop* loop) {
   //============================================================================
   // Change the exit and exit markers to merge/phi/effect-phi.
   //============================================================================
+  // If the remaining loop is supposed to stay peelable, create fresh exit
+  // markers for it up front; the old markers become the merges and phis that
+  // join the peeled iteration with the loop below.
+  ZoneMap<Node*, Node*> remarked_exits(tmp_zone_);
+  if (remark_exits) {
+    for (Node* exit : loop_tree_->ExitNodes(loop)) {
+      if (exit->opcode() != IrOpcode::kLoopExit) continue;
+      Node* new_exit =
+          graph_->NewNode(common_->LoopExit(), exit->InputAt(0), loop_node);
+      remarked_exits[exit] = new_exit;
+    }
+  }
   for (Node* exit : loop_tree_->ExitNodes(loop)) {
     switch (exit->opcode()) {
-      case IrOpcode::kLoopExit:
+      case IrOpcode::kLoopExit: {
         // Change the loop exit node to a merge node.
-        exit->ReplaceInput(1, copier.map(exit->InputAt(0)));
+        Node* copy = copier.map(exit->InputAt(0));
+        if (remark_exits) {
+          auto it = remarked_exits.find(exit);
+          DCHECK(remarked_exits.end() != it);
+          exit->ReplaceInput(0, it->second);
+        }
+        exit->ReplaceInput(1, copy);
         NodeProperties::ChangeOp(exit, common_->Merge(2));
         break;
-      case IrOpcode::kLoopExitValue:
+      }
+      case IrOpcode::kLoopExitValue: {
         // Change exit marker to phi.
-        exit->InsertInput(graph_->zone(), 1, copier.map(exit->InputAt(0)));
+        Node* copy = copier.map(exit->InputAt(0));
+        if (remark_exits) {
+          auto it = remarked_exits.find(exit->InputAt(1));
+          DCHECK(remarked_exits.end() != it);
+          Node* new_marker = graph_->NewNode(
+              common_->LoopExitValue(LoopExitValueRepresentationOf(exit->op())),
+              exit->InputAt(0), it->second);
+          exit->ReplaceInput(0, new_marker);
+        }
+        exit->InsertInput(graph_->zone(), 1, copy);
         NodeProperties::ChangeOp(
             exit, common_->Phi(LoopExitValueRepresentationOf(exit->op()), 2));
         break;
-      case IrOpcode::kLoopExitEffect:
+      }
+      case IrOpcode::kLoopExitEffect: {
         // Change effect exit marker to effect phi.
-        exit->InsertInput(graph_->zone(), 1, copier.map(exit->InputAt(0)));
+        Node* copy = copier.map(exit->InputAt(0));
+        if (remark_exits) {
+          auto it = remarked_exits.find(exit->InputAt(1));
+          DCHECK(remarked_exits.end() != it);
+          Node* new_marker = graph_->NewNode(common_->LoopExitEffect(),
+                                             exit->InputAt(0), it->second);
+          exit->ReplaceInput(0, new_marker);
+        }
+        exit->InsertInput(graph_->zone(), 1, copy);
         NodeProperties::ChangeOp(exit, common_->EffectPhi(2));
         break;
+      }
       default:
         break;
     }
@@ -266,6 +311,121 @@ void LoopPeeler::PeelInnerLoopsOfTree() {
   EliminateLoopExits(graph_, tmp_zone_);
 }
 
+namespace {
+
+// Interprets the type of {node} as a single finite number, if possible. With
+// the typer running, this also covers nodes that were copied off constant
+// inputs by a previous peeling round but not constant-folded yet.
+bool TryGetConstantValue(Node* node, double* value) {
+  if (!NodeProperties::IsTyped(node)) return false;
+  Type type = NodeProperties::GetType(node);
+  if (!type.Is(Type::PlainNumber())) return false;
+  if (type.Min() != type.Max()) return false;
+  if (!std::isfinite(type.Min())) return false;
+  *value = type.Min();
+  return true;
+}
+
+}  // namespace
+
+bool LoopPeeler::TryGetRemainingTripCount(LoopTree::Loop* loop,
+                                          uint32_t* trip_count) {
+  // Match the shape the bytecode graph builder produces for a counted
+  // for-loop: a single exit that leaves the loop when {phi < limit} (or
+  // {phi <= limit}) fails, where {phi} is a loop phi that starts at a known
+  // number and advances by a known positive step on the backedge.
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return false;
+  Node* exit = nullptr;
+  for (Node* node : loop_tree_->ExitNodes(loop)) {
+    if (node->opcode() != IrOpcode::kLoopExit) continue;
+    if (exit != nullptr) return false;
+    exit = node;
+  }
+  if (exit == nullptr) return false;
+  Node* exit_control = exit->InputAt(0);
+  if (exit_control->opcode() != IrOpcode::kIfFalse) return false;
+  Node* branch = NodeProperties::GetControlInput(exit_control);
+  DCHECK_EQ(IrOpcode::kBranch, branch->opcode());
+  Node* condition = branch->InputAt(0);
+  bool inclusive;
+  switch (condition->opcode()) {
+    case IrOpcode::kNumberLessThan:
+    case IrOpcode::kSpeculativeNumberLessThan:
+      inclusive = false;
+      break;
+    case IrOpcode::kNumberLessThanOrEqual:
+    case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+      inclusive = true;
+      break;
+    default:
+      return false;
+  }
+  Node* phi = condition->InputAt(0);
+  if (phi->opcode() != IrOpcode::kPhi) return false;
+  if (NodeProperties::GetControlInput(phi) != loop_node) return false;
+  double limit;
+  if (!TryGetConstantValue(condition->InputAt(1), &limit)) return false;
+  double start;
+  if (!TryGetConstantValue(phi->InputAt(0), &start)) return false;
+  Node* advance = phi->InputAt(1);
+  switch (advance->opcode()) {
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd:
+      break;
+    default:
+      return false;
+  }
+  if (advance->InputAt(0) != phi) return false;
+  double step;
+  if (!TryGetConstantValue(advance->InputAt(1), &step)) return false;
+  if (step <= 0) return false;
+  // Step through the iterations one by one; this sidesteps any floating-point
+  // rounding concerns and is bounded by the unroll limit anyway.
+  uint32_t count = 0;
+  for (double value = start; inclusive ? value <= limit : value < limit;
+       value += step) {
+    if (++count > kMaxFullyUnrolledIterations) return false;
+  }
+  *trip_count = count;
+  return true;
+}
+
+bool LoopPeeler::PeelCountedLoopIterations() {
+  bool peeled = false;
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    peeled |= PeelCountedLoopIterations(loop);
+  }
+  return peeled;
+}
+
+bool LoopPeeler::PeelCountedLoopIterations(LoopTree::Loop* loop) {
+  // Only innermost loops are unrolled; process nested loops inside.
+  if (!loop->children().empty()) {
+    bool peeled = false;
+    for (LoopTree::Loop* inner_loop : loop->children()) {
+      peeled |= PeelCountedLoopIterations(inner_loop);
+    }
+    return peeled;
+  }
+  if (!CanPeel(loop)) return false;
+  uint32_t trip_count;
+  if (!TryGetRemainingTripCount(loop, &trip_count)) return false;
+  if (trip_count == 0) return false;
+  // Budget the total number of copied nodes like regular peeling does.
+  if (loop->TotalSize() * trip_count > kMaxPeeledNodes) return false;
+  if (v8_flags.trace_turbo_loop) {
+    PrintF("Peeling counted loop (%u iterations left) with header: ",
+           trip_count);
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      PrintF("%i ", node->id());
+    }
+    PrintF("\n");
+  }
+  return Peel(loop, true) != nullptr;
+}
+
 // static
 void LoopPeeler::EliminateLoopExits(Graph* graph, Zone* tmp_zone) {
   ZoneQueue<Node*> queue(tmp_zone);
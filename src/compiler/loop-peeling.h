@@ -49,9 +49,20 @@ class V8_EXPORT_PRIVATE LoopPeeler {
   PeeledIteration* Peel(LoopTree::Loop* loop);
   void PeelInnerLoopsOfTree();
 
+  // Peels one iteration off every innermost counted loop whose remaining trip
+  // count is a small known constant, keeping the loop exits marked so that
+  // the same loop can be peeled again on a rebuilt loop tree. Repeating this
+  // until it returns false fully unrolls such loops: the loop-closing checks
+  // of the peeled iterations have constant inputs and fold away, leaving the
+  // remaining loop dead. Returns whether any iteration was peeled.
+  bool PeelCountedLoopIterations();
+
   static void EliminateLoopExits(Graph* graph, Zone* tmp_zone);
   static void EliminateLoopExit(Node* loop);
   static const size_t kMaxPeeledNodes = 1000;
+  // An upper bound on the trip count of loops that are fully unrolled, which
+  // also bounds the number of peeling rounds a caller has to run.
+  static const uint32_t kMaxFullyUnrolledIterations = 8;
 
  private:
   Graph* const graph_;
@@ -61,7 +72,10 @@ class V8_EXPORT_PRIVATE LoopPeeler {
   SourcePositionTable* const source_positions_;
   NodeOriginTable* const node_origins_;
 
+  PeeledIteration* Peel(LoopTree::Loop* loop, bool remark_exits);
   void PeelInnerLoops(LoopTree::Loop* loop);
+  bool PeelCountedLoopIterations(LoopTree::Loop* loop);
+  bool TryGetRemainingTripCount(LoopTree::Loop* loop, uint32_t* trip_count);
 };
 
 
@@ -0,0 +1,360 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+
+#include "src/codegen/cpu-features.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/machine-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Returns true if {index} computes the (uintptr) memory index for the
+// induction variable {iv}, i.e. is {iv} itself or its zero-extension as
+// introduced by {WasmGraphBuilder::BoundsCheckMem}.
+bool IsIvIndex(Node* index, Node* iv) {
+  return index == iv || (index->opcode() == IrOpcode::kChangeUint32ToUint64 &&
+                         index->InputAt(0) == iv);
+}
+
+// Strips a constant offset as added by {WasmGraphBuilder::MemBuffer} off the
+// base address of a memory access, so that accesses relative to the same
+// memory start can be compared statically.
+Node* DecomposeBase(Node* base, int64_t* offset) {
+  *offset = 0;
+  if (base->opcode() == IrOpcode::kInt64Add ||
+      base->opcode() == IrOpcode::kInt32Add) {
+    Node* right = base->InputAt(1);
+    if (right->opcode() == IrOpcode::kInt64Constant) {
+      *offset = OpParameter<int64_t>(right->op());
+      return base->InputAt(0);
+    }
+    if (right->opcode() == IrOpcode::kInt32Constant) {
+      *offset = OpParameter<int32_t>(right->op());
+      return base->InputAt(0);
+    }
+  }
+  return base;
+}
+
+// Returns true if the effect chain between the loop's effect phi {ephi} and
+// {entry_effect} is exactly the stack check emitted by
+// {WasmGraphBuilder::StackCheck} at the loop header. The stack check is the
+// only effectful prefix we tolerate before the vectorized access: executing
+// it once per 16-byte block instead of once per scalar iteration only
+// coarsens the interrupt check, like loop unrolling does.
+bool IsStackCheckPrefix(Node* entry_effect, Node* ephi, Node* control) {
+  if (entry_effect->opcode() != IrOpcode::kEffectPhi) return false;
+  if (entry_effect->InputCount() != 3) return false;
+  if (NodeProperties::GetControlInput(entry_effect) != control) return false;
+  if (control->opcode() != IrOpcode::kMerge || control->InputCount() != 2) {
+    return false;
+  }
+  Node* check = entry_effect->InputAt(0);
+  Node* call = entry_effect->InputAt(1);
+  if (check->opcode() != IrOpcode::kStackPointerGreaterThan) return false;
+  if (call->opcode() != IrOpcode::kCall ||
+      !call->op()->HasProperty(Operator::kNoWrite)) {
+    return false;
+  }
+  // The limit loads between the effect phi and the check must not write.
+  Node* current = NodeProperties::GetEffectInput(check);
+  for (int depth = 0; current != ephi; depth++) {
+    if (depth > 4) return false;
+    if (!current->op()->HasProperty(Operator::kNoWrite)) return false;
+    current = NodeProperties::GetEffectInput(current);
+  }
+  return true;
+}
+
+const Operator* SplatOpFor(MachineOperatorBuilder* machine,
+                           MachineRepresentation rep) {
+  switch (rep) {
+    case MachineRepresentation::kWord8:
+      return machine->I8x16Splat();
+    case MachineRepresentation::kWord16:
+      return machine->I16x8Splat();
+    case MachineRepresentation::kWord32:
+      return machine->I32x4Splat();
+    case MachineRepresentation::kWord64:
+      return machine->I64x2Splat();
+    case MachineRepresentation::kFloat32:
+      return machine->F32x4Splat();
+    case MachineRepresentation::kFloat64:
+      return machine->F64x2Splat();
+    default:
+      UNREACHABLE();
+  }
+}
+
+}  // namespace
+
+bool TryVectorizeLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop,
+                      MachineGraph* mcgraph,
+                      SourcePositionTable* source_positions,
+                      NodeOriginTable* node_origins) {
+  DCHECK_EQ(loop_node->opcode(), IrOpcode::kLoop);
+  DCHECK_NOT_NULL(loop);
+#if V8_TARGET_BIG_ENDIAN
+  // The byte layout of a Simd128 block does not match 16 consecutive scalar
+  // stores on big-endian targets.
+  return false;
+#else
+  Graph* graph = mcgraph->graph();
+  MachineOperatorBuilder* machine = mcgraph->machine();
+  CommonOperatorBuilder* common = mcgraph->common();
+
+  if (!CpuFeatures::SupportsWasmSimd128()) return false;
+  if (!machine->UnalignedStoreSupported(MachineRepresentation::kSimd128)) {
+    return false;
+  }
+
+  // No back-jump to the loop header means this is not really a loop.
+  if (loop_node->InputCount() != 2) return false;
+
+  // Find the loop's single induction phi and effect phi.
+  Node* iv = nullptr;
+  Node* ephi = nullptr;
+  for (Node* use : loop_node->uses()) {
+    if (use->opcode() == IrOpcode::kPhi &&
+        NodeProperties::GetControlInput(use) == loop_node) {
+      if (iv != nullptr) return false;
+      iv = use;
+    } else if (use->opcode() == IrOpcode::kEffectPhi &&
+               NodeProperties::GetControlInput(use) == loop_node) {
+      if (ephi != nullptr) return false;
+      ephi = use;
+    }
+  }
+  if (iv == nullptr || ephi == nullptr) return false;
+  if (PhiRepresentationOf(iv->op()) != MachineRepresentation::kWord32) {
+    return false;
+  }
+
+  // The induction variable must advance by a constant stride.
+  Node* iv_next = iv->InputAt(1);
+  if (iv_next->opcode() != IrOpcode::kInt32Add) return false;
+  Node* stride_node = iv_next->InputAt(1);
+  if (iv_next->InputAt(0) != iv ||
+      stride_node->opcode() != IrOpcode::kInt32Constant) {
+    return false;
+  }
+  int32_t stride = OpParameter<int32_t>(stride_node->op());
+
+  // The back edge must be a projection of a conditional branch comparing the
+  // advanced induction variable against a loop-invariant limit. Normalize to
+  // "continue iff iv_next <u limit" (strict) or "iv_next <=u limit".
+  Node* backedge = loop_node->InputAt(1);
+  if (backedge->opcode() != IrOpcode::kIfTrue &&
+      backedge->opcode() != IrOpcode::kIfFalse) {
+    return false;
+  }
+  Node* branch = NodeProperties::GetControlInput(backedge);
+  if (branch->opcode() != IrOpcode::kBranch) return false;
+  Node* cond = branch->InputAt(0);
+  const bool continue_on_true = backedge->opcode() == IrOpcode::kIfTrue;
+  bool strict;
+  Node* limit;
+  if (cond->opcode() == IrOpcode::kUint32LessThan) {
+    // continue: iv_next <u limit; exit: limit <u iv_next.
+    strict = continue_on_true;
+    limit = continue_on_true ? cond->InputAt(1) : cond->InputAt(0);
+    if (cond->InputAt(continue_on_true ? 0 : 1) != iv_next) return false;
+  } else if (cond->opcode() == IrOpcode::kUint32LessThanOrEqual) {
+    // continue: iv_next <=u limit; exit: limit <=u iv_next.
+    strict = !continue_on_true;
+    limit = continue_on_true ? cond->InputAt(1) : cond->InputAt(0);
+    if (cond->InputAt(continue_on_true ? 0 : 1) != iv_next) return false;
+  } else {
+    return false;
+  }
+  if (loop->count(limit)) return false;
+  for (Node* use : cond->uses()) {
+    if (use != branch) return false;
+  }
+
+  // The last effect in the loop body must be a trap-handler-checked store of
+  // stride-sized elements at the induction variable. Explicitly bounds-checked
+  // accesses are not eligible: the vector path would skip the per-iteration
+  // checks.
+  Node* store = ephi->InputAt(1);
+  if (store->opcode() != IrOpcode::kProtectedStore) return false;
+  MachineRepresentation rep = StoreRepresentationOf(store->op()).representation();
+  switch (rep) {
+    case MachineRepresentation::kWord8:
+    case MachineRepresentation::kWord16:
+    case MachineRepresentation::kWord32:
+    case MachineRepresentation::kWord64:
+    case MachineRepresentation::kFloat32:
+    case MachineRepresentation::kFloat64:
+      break;
+    default:
+      return false;
+  }
+  if (stride != ElementSizeInBytes(rep)) return false;
+  Node* store_base = store->InputAt(0);
+  Node* store_index = store->InputAt(1);
+  Node* value = store->InputAt(2);
+  if (!IsIvIndex(store_index, iv)) return false;
+  if (loop->count(store_base)) return false;
+  Node* body_control = NodeProperties::GetControlInput(store);
+  if (NodeProperties::GetControlInput(branch) != body_control) return false;
+
+  // Distinguish the fill idiom (loop-invariant value) from the copy idiom
+  // (value loaded from linear memory at the same index).
+  Node* load = nullptr;
+  Node* entry_effect;
+  if (value->opcode() == IrOpcode::kProtectedLoad && loop->count(value)) {
+    load = value;
+    if (LoadRepresentationOf(load->op()).representation() != rep) return false;
+    Node* load_base = load->InputAt(0);
+    Node* load_index = load->InputAt(1);
+    if (!IsIvIndex(load_index, iv)) return false;
+    if (loop->count(load_base)) return false;
+    if (NodeProperties::GetControlInput(load) != body_control) return false;
+    if (NodeProperties::GetEffectInput(store) != load) return false;
+    for (Node* use : load->uses()) {
+      if (use != store) return false;
+    }
+    // A 16-byte block must not read bytes written by the same or a previous
+    // iteration of the block, or the copy would diverge from the scalar
+    // element-wise copy. Since both accesses use the same index, the distance
+    // is the static difference of the constant base offsets.
+    int64_t store_offset;
+    int64_t load_offset;
+    if (DecomposeBase(store_base, &store_offset) !=
+        DecomposeBase(load_base, &load_offset)) {
+      return false;
+    }
+    int64_t distance = store_offset - load_offset;
+    if (distance > 0 && distance < kSimd128Size) return false;
+    entry_effect = NodeProperties::GetEffectInput(load);
+  } else {
+    if (loop->count(value)) return false;
+    // I64x2Splat is not available on 32-bit targets.
+    if (rep == MachineRepresentation::kWord64 && !machine->Is64()) {
+      return false;
+    }
+    entry_effect = NodeProperties::GetEffectInput(store);
+  }
+
+  // The accesses must either start the loop body or directly follow the
+  // header stack check.
+  if (entry_effect == ephi) {
+    if (body_control != loop_node) return false;
+  } else if (!IsStackCheckPrefix(entry_effect, ephi, body_control)) {
+    return false;
+  }
+
+  // The induction variable and its derived index computations must have no
+  // other uses, in particular no uses past a loop exit; the vectorized loop
+  // leaves them at a different final value.
+  for (Node* use : iv->uses()) {
+    if (use == iv_next || use == store || use == load ||
+        use == store_index || (load && use == load->InputAt(1))) {
+      continue;
+    }
+    return false;
+  }
+  if (store_index != iv) {
+    for (Node* use : store_index->uses()) {
+      if (use != store && use != load) return false;
+    }
+  }
+  if (load != nullptr && load->InputAt(1) != iv &&
+      load->InputAt(1) != store_index) {
+    for (Node* use : load->InputAt(1)->uses()) {
+      if (use != load) return false;
+    }
+  }
+  for (Node* use : iv_next->uses()) {
+    if (use != iv && use != cond) return false;
+  }
+
+  // The loop matches. Strip-mine it in place: guard the body with a check
+  // that a full 16-byte block of iterations remains (and that the block does
+  // not wrap around the 32-bit index space), and execute either one Simd128
+  // access or the original scalar access.
+  Node* last_index =
+      graph->NewNode(machine->Int32Add(), iv,
+                     mcgraph->Int32Constant(kSimd128Size - stride));
+  Node* in_range =
+      graph->NewNode(strict ? machine->Uint32LessThan()
+                            : machine->Uint32LessThanOrEqual(),
+                     last_index, limit);
+  // iv <=u 2^32 - 16, so that the block covers 16 consecutive byte indices.
+  Node* no_wrap = graph->NewNode(machine->Uint32LessThanOrEqual(), iv,
+                                 mcgraph->Int32Constant(-kSimd128Size));
+  Node* guard_cond = graph->NewNode(machine->Word32And(), in_range, no_wrap);
+  Node* guard_branch = graph->NewNode(common->Branch(BranchHint::kTrue),
+                                      guard_cond, body_control);
+  Node* if_simd = graph->NewNode(common->IfTrue(), guard_branch);
+  Node* if_scalar = graph->NewNode(common->IfFalse(), guard_branch);
+
+  Node* simd_value;
+  Node* simd_effect = entry_effect;
+  if (load != nullptr) {
+    simd_value =
+        graph->NewNode(machine->ProtectedLoad(MachineType::Simd128()),
+                       load->InputAt(0), load->InputAt(1), entry_effect,
+                       if_simd);
+    simd_effect = simd_value;
+    source_positions->SetSourcePosition(
+        simd_value, source_positions->GetSourcePosition(load));
+    if (node_origins) node_origins->SetNodeOrigin(simd_value->id(), load->id());
+  } else {
+    simd_value = graph->NewNode(SplatOpFor(machine, rep), value);
+  }
+  Node* simd_store = graph->NewNode(
+      machine->ProtectedStore(MachineRepresentation::kSimd128), store_base,
+      store_index, simd_value, simd_effect, if_simd);
+  source_positions->SetSourcePosition(
+      simd_store, source_positions->GetSourcePosition(store));
+  if (node_origins) node_origins->SetNodeOrigin(simd_store->id(), store->id());
+  Node* simd_next = graph->NewNode(machine->Int32Add(), iv,
+                                   mcgraph->Int32Constant(kSimd128Size));
+
+  // Move the scalar accesses under the guard.
+  if (load != nullptr) NodeProperties::ReplaceControlInput(load, if_scalar);
+  NodeProperties::ReplaceControlInput(store, if_scalar);
+
+  Node* merge = graph->NewNode(common->Merge(2), if_simd, if_scalar);
+  Node* next_phi =
+      graph->NewNode(common->Phi(MachineRepresentation::kWord32, 2), simd_next,
+                     iv_next, merge);
+  Node* effect_phi =
+      graph->NewNode(common->EffectPhi(2), simd_store, store, merge);
+
+  // Rewire the loop: the exit branch now tests the merged next index, and the
+  // back edges carry the merged index and effect.
+  Node* continue_cond =
+      graph->NewNode(strict ? machine->Uint32LessThan()
+                            : machine->Uint32LessThanOrEqual(),
+                     next_phi, limit);
+  if (!continue_on_true) {
+    continue_cond = graph->NewNode(machine->Word32Equal(), continue_cond,
+                                   mcgraph->Int32Constant(0));
+  }
+  NodeProperties::ReplaceValueInput(branch, continue_cond, 0);
+  NodeProperties::ReplaceControlInput(branch, merge);
+  iv->ReplaceInput(1, next_phi);
+  // Loop exits and the loop effect phi observed the scalar store as the last
+  // effect in the body; they must now observe the merged effect.
+  for (Edge edge : store->use_edges()) {
+    if (edge.from() == effect_phi) continue;
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect_phi);
+  }
+  return true;
+#endif  // V8_TARGET_BIG_ENDIAN
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
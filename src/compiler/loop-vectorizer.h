@@ -0,0 +1,51 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZER_H_
+#define V8_COMPILER_LOOP_VECTORIZER_H_
+
+// Loop vectorization rewrites simple counted wasm loops over linear memory so
+// that most iterations are executed with a single 16-byte Simd128 access
+// instead of one scalar access per iteration. This recovers SIMD performance
+// for modules whose toolchain did not vectorize (e.g. was compiled without
+// the wasm SIMD proposal).
+//
+// Only two idioms are recognized, and only in their bottom-tested form as
+// produced by the wasm graph builder:
+//   - fill:  mem[i] = invariant_value; i += size; while (i < limit)
+//   - copy:  mem[i + c1] = mem[i + c2]; i += size; while (i < limit)
+// The loop is strip-mined in place: a guard branch in the loop body takes a
+// Simd128 fast path whenever at least 16 bytes remain, and falls back to the
+// original scalar body for the remaining tail iterations.
+//
+// Note on trap semantics: a partially out-of-bounds 16-byte access traps
+// without writing the in-bounds prefix, whereas the scalar loop would have
+// committed the stores preceding the trap. The set of accessed bytes (and
+// hence whether a trap occurs at all) is unchanged. This relaxation is why
+// the transformation is only enabled by --wasm-loop-vectorization.
+
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class MachineGraph;
+
+// The loop body must fit this size to be considered; large enough for the
+// in-loop stack check plus the access idioms above.
+static constexpr uint32_t kMaximumVectorizableSize = 40;
+
+// Tries to rewrite the given innermost loop as described above. Returns true
+// if the loop was vectorized.
+bool TryVectorizeLoop(Node* loop_node, ZoneUnorderedSet<Node*>* loop,
+                      MachineGraph* mcgraph,
+                      SourcePositionTable* source_positions,
+                      NodeOriginTable* node_origins);
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZER_H_
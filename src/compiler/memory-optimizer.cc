@@ -4,8 +4,12 @@
 
 #include "src/compiler/memory-optimizer.h"
 
+#include <algorithm>
+
 #include "src/base/logging.h"
+#include "src/base/small-vector.h"
 #include "src/codegen/tick-counter.h"
+#include "src/compiler/common-operator.h"
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
@@ -386,7 +390,7 @@ void MemoryOptimizer::VisitOtherEffect(Node* node,
 }
 
 MemoryOptimizer::AllocationState const* MemoryOptimizer::MergeStates(
-    AllocationStates const& states) {
+    Node* effect_phi, AllocationStates const& states) {
   // Check if all states are the same; or at least if all allocation
   // states belong to the same allocation group.
   AllocationState const* state = states.front();
@@ -397,12 +401,45 @@ MemoryOptimizer::AllocationState const* MemoryOptimizer::MergeStates(
   }
   if (state == nullptr) {
     if (group != nullptr) {
-      // We cannot fold any more allocations into this group, but we can still
-      // eliminate write barriers on stores to this group.
-      // TODO(bmeurer): We could potentially just create a Phi here to merge
-      // the various tops; but we need to pay special attention not to create
-      // an unschedulable graph.
-      state = AllocationState::Closed(group, nullptr, zone());
+      // All incoming states belong to the same allocation group, but they
+      // diverged, e.g. at a diamond where one branch folded an allocation
+      // into the group. If the group is still open on all incoming paths, we
+      // can merge the tops with a Phi and keep folding allocations into the
+      // group after the merge. The maximum size over all incoming paths is a
+      // conservative bound for the space consumed from the reservation; the
+      // folded allocations write back the actual top on each path, so the
+      // merged top is always accurate. The tops were computed on the effect
+      // paths leading into the respective merge inputs, so the Phi is
+      // schedulable.
+      bool all_open = true;
+      intptr_t size = 0;
+      for (AllocationState const* incoming : states) {
+        if (incoming->top() == nullptr) {
+          all_open = false;
+          break;
+        }
+        size = std::max(size, incoming->size());
+      }
+      if (all_open) {
+        DCHECK_LE(size, kMaxRegularHeapObjectSize);
+        Node* const control = NodeProperties::GetControlInput(effect_phi);
+        DCHECK_EQ(IrOpcode::kMerge, control->opcode());
+        int const input_count = static_cast<int>(states.size());
+        base::SmallVector<Node*, 8> inputs;
+        for (AllocationState const* incoming : states) {
+          inputs.push_back(incoming->top());
+        }
+        inputs.push_back(control);
+        Node* top = graph()->NewNode(
+            jsgraph()->common()->Phi(MachineType::PointerRepresentation(),
+                                     input_count),
+            input_count + 1, inputs.data());
+        state = AllocationState::Open(group, size, top, effect_phi, zone());
+      } else {
+        // We cannot fold any more allocations into this group, but we can
+        // still eliminate write barriers on stores to this group.
+        state = AllocationState::Closed(group, nullptr, zone());
+      }
     } else {
       // The states are from different allocation groups.
       state = empty_state();
@@ -438,16 +475,22 @@ void MemoryOptimizer::EnqueueMerge(Node* node, int index,
     auto it = pending_.find(id);
     if (it == pending_.end()) {
       // Insert a new pending merge.
-      it = pending_.insert(std::make_pair(id, AllocationStates(zone()))).first;
+      it = pending_
+               .insert(std::make_pair(
+                   id, AllocationStates(input_count, nullptr, zone())))
+               .first;
     }
-    // Add the next input state.
-    it->second.push_back(state);
+    // Add the next input state. Keep the states in input order, so that they
+    // line up with the control inputs of the merge when the tops are merged
+    // with a Phi in {MergeStates}.
+    DCHECK_NULL(it->second[index]);
+    it->second[index] = state;
     // Check if states for all inputs are available by now.
-    if (it->second.size() == static_cast<size_t>(input_count)) {
+    if (std::count(it->second.begin(), it->second.end(), nullptr) == 0) {
       // All inputs to this effect merge are done, merge the states given all
       // input constraints, drop the pending merge and enqueue uses of the
       // EffectPhi {node}.
-      state = MergeStates(it->second);
+      state = MergeStates(node, it->second);
       EnqueueUses(node, state);
       pending_.erase(it);
     }
@@ -61,7 +61,8 @@ class MemoryOptimizer final {
   void VisitStore(Node*, AllocationState const*);
   void VisitOtherEffect(Node*, AllocationState const*);
 
-  AllocationState const* MergeStates(AllocationStates const& states);
+  AllocationState const* MergeStates(Node* effect_phi,
+                                     AllocationStates const& states);
 
   void EnqueueMerge(Node*, int, AllocationState const*);
   void EnqueueUses(Node*, AllocationState const*);
@@ -32,6 +32,12 @@ class PipelineStatistics : public Malloced {
   void BeginPhaseKind(const char* phase_kind_name);
   void EndPhaseKind();
 
+  void RecordRegisterAllocationStats(bool used_mid_tier, uint64_t move_count,
+                                     uint64_t spill_move_count) {
+    compilation_stats_->RecordRegisterAllocationStats(used_mid_tier, move_count,
+                                                      spill_move_count);
+  }
+
   // We log detailed phase information about the pipeline
   // in both the v8.turbofan and the v8.wasm.turbofan categories.
   static constexpr char kTraceCategory[] =
@@ -64,6 +64,7 @@
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/loop-vectorizer.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -606,6 +607,15 @@ class PipelineData {
     profile_data_ = profile_data;
   }
 
+  // The pre-scheduling graph hash, used to match basic block counters to
+  // later compilations of the same function under --turbo-profiling-feedback.
+  int graph_hash_before_scheduling() const {
+    return graph_hash_before_scheduling_;
+  }
+  void set_graph_hash_before_scheduling(int hash) {
+    graph_hash_before_scheduling_ = hash;
+  }
+
   // RuntimeCallStats that is only available during job execution but not
   // finalization.
   // TODO(delphick): Currently even during execution this can be nullptr, due to
@@ -697,6 +707,7 @@ class PipelineData {
 
   RuntimeCallStats* runtime_call_stats_ = nullptr;
   const ProfileDataFromFile* profile_data_ = nullptr;
+  int graph_hash_before_scheduling_ = 0;
 
   bool has_js_wasm_calls_ = false;
 };
@@ -1645,11 +1656,23 @@ struct LoopPeelingPhase {
       trimmer.TrimGraph(roots.begin(), roots.end());
     }
 
-    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
-        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
     // We call the typer inside of PeelInnerLoopsOfTree which inspects heap
     // objects, so we need to unpark the local heap.
     UnparkedScopeIfNeeded scope(data->broker());
+    if (v8_flags.turbo_loop_full_unrolling) {
+      // Fully unroll small counted loops by repeatedly peeling one iteration
+      // off each of them; every round runs on a freshly built loop tree, since
+      // peeling invalidates the previous one.
+      for (uint32_t i = 0; i < LoopPeeler::kMaxFullyUnrolledIterations; i++) {
+        LoopTree* unroll_tree = LoopFinder::BuildLoopTree(
+            data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+        LoopPeeler peeler(data->graph(), data->common(), unroll_tree, temp_zone,
+                          data->source_positions(), data->node_origins());
+        if (!peeler.PeelCountedLoopIterations()) break;
+      }
+    }
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
     LoopPeeler(data->graph(), data->common(), loop_tree, temp_zone,
                data->source_positions(), data->node_origins())
         .PeelInnerLoopsOfTree();
@@ -1726,6 +1749,27 @@ struct WasmLoopUnrollingPhase {
   }
 };
 
+struct WasmLoopVectorizationPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(WasmLoopVectorization)
+
+  void Run(PipelineData* data, Zone* temp_zone,
+           std::vector<compiler::WasmLoopInfo>* loop_infos) {
+    if (loop_infos->empty()) return;
+    AllNodes all_nodes(temp_zone, data->graph(), data->graph()->end());
+    for (WasmLoopInfo& loop_info : *loop_infos) {
+      if (!loop_info.can_be_innermost) continue;
+      if (!all_nodes.IsReachable(loop_info.header)) continue;
+      ZoneUnorderedSet<Node*>* loop =
+          LoopFinder::FindSmallInnermostLoopFromHeader(
+              loop_info.header, all_nodes, temp_zone,
+              kMaximumVectorizableSize, true);
+      if (loop == nullptr) continue;
+      TryVectorizeLoop(loop_info.header, loop, data->mcgraph(),
+                       data->source_positions(), data->node_origins());
+    }
+  }
+};
+
 struct WasmLoopPeelingPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(WasmLoopPeeling)
 
@@ -2900,6 +2944,10 @@ bool PipelineImpl::CreateGraph() {
   return true;
 }
 
+namespace {
+int HashGraphForPGO(Graph* graph);
+}  // namespace
+
 bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   PipelineData* data = this->data_;
 
@@ -3019,6 +3067,19 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     data->node_origins()->RemoveDecorator();
   }
 
+  if (v8_flags.turbo_profiling_feedback) {
+    // Look for basic block counters collected from an earlier instrumented
+    // compilation of this function, and consume them as branch hints for
+    // block layout, the same way builtins consume profiles loaded via
+    // --turbo-profiling-input. The pre-scheduling graph hash guards against
+    // stale counters, e.g. when the function was recompiled with different
+    // speculation choices.
+    int graph_hash = HashGraphForPGO(data->graph());
+    data->set_graph_hash_before_scheduling(graph_hash);
+    data->set_profile_data(ProfileDataFromFile::TryReadFromProfiler(
+        data->debug_name(), graph_hash));
+  }
+
   ComputeScheduledGraph();
 
   if (v8_flags.turboshaft) {
@@ -3389,6 +3450,10 @@ void Pipeline::GenerateCodeForWasmFunction(
                                     loop_info);
     pipeline.RunPrintAndVerify(WasmInliningPhase::phase_name(), true);
   }
+  if (v8_flags.wasm_loop_vectorization) {
+    pipeline.Run<WasmLoopVectorizationPhase>(loop_info);
+    pipeline.RunPrintAndVerify(WasmLoopVectorizationPhase::phase_name(), true);
+  }
   if (v8_flags.wasm_loop_peeling) {
     pipeline.Run<WasmLoopPeelingPhase>(loop_info);
     pipeline.RunPrintAndVerify(WasmLoopPeelingPhase::phase_name(), true);
@@ -3685,6 +3750,47 @@ void PipelineImpl::ComputeScheduledGraph() {
   TraceScheduleAndVerify(data->info(), data, data->schedule(), "schedule");
 }
 
+namespace {
+
+// Returns the maximum loop nesting depth in the instruction sequence.
+int MaxLoopDepth(InstructionSequence* sequence) {
+  int max_depth = 0;
+  for (const InstructionBlock* block : sequence->instruction_blocks()) {
+    if (!block->IsLoopHeader()) continue;
+    int depth = 1;
+    RpoNumber header = block->loop_header();
+    while (header.IsValid()) {
+      ++depth;
+      header = sequence->InstructionBlockAt(header)->loop_header();
+    }
+    max_depth = std::max(max_depth, depth);
+  }
+  return max_depth;
+}
+
+// Counts the parallel moves the register allocator inserted and how many of
+// them write to stack slots, as a proxy for the quality of the emitted code.
+void CountAllocatedMoves(InstructionSequence* sequence, uint64_t* move_count,
+                         uint64_t* spill_move_count) {
+  *move_count = 0;
+  *spill_move_count = 0;
+  for (const Instruction* instr : sequence->instructions()) {
+    for (int i = Instruction::FIRST_GAP_POSITION;
+         i <= Instruction::LAST_GAP_POSITION; i++) {
+      const ParallelMove* moves =
+          instr->GetParallelMove(static_cast<Instruction::GapPosition>(i));
+      if (moves == nullptr) continue;
+      for (const MoveOperands* move : *moves) {
+        if (move->IsRedundant()) continue;
+        ++*move_count;
+        if (move->destination().IsAnyStackSlot()) ++*spill_move_count;
+      }
+    }
+  }
+}
+
+}  // namespace
+
 bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   auto call_descriptor = linkage->GetIncomingDescriptor();
   PipelineData* data = this->data_;
@@ -3697,6 +3803,12 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     UnparkedScopeIfNeeded unparked_scope(data->broker());
     data->info()->set_profiler_data(BasicBlockInstrumentor::Instrument(
         info(), data->graph(), data->schedule(), data->isolate()));
+    if (data->graph_hash_before_scheduling() != 0) {
+      // Record the graph hash with the counters, so that later compilations
+      // of this function can find them (--turbo-profiling-feedback).
+      data->info()->profiler_data()->SetHash(
+          data->graph_hash_before_scheduling());
+    }
   }
 
   bool verify_stub_graph =
@@ -3790,9 +3902,20 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   // WebAssembly programs, and chosing the limit such that functions that take
   // >100ms in register allocation are switched to mid-tier.
   static int kTopTierVirtualRegistersLimit = 8192;
+  // Functions with shallow or no loop nesting gain little from top-tier
+  // allocation quality, so they are handed to the mid-tier allocator at a
+  // quarter of the limit already. This primarily cuts the compile latency of
+  // huge, flat generated functions.
+  static int kTopTierVirtualRegistersShallowLoopLimit = 2048;
+  static int kShallowLoopDepthLimit = 1;
 
   const RegisterConfiguration* config = RegisterConfiguration::Default();
   std::unique_ptr<const RegisterConfiguration> restricted_config;
+  int virtual_registers = data->sequence()->VirtualRegisterCount();
+  bool huge_function =
+      virtual_registers > kTopTierVirtualRegistersLimit ||
+      (virtual_registers > kTopTierVirtualRegistersShallowLoopLimit &&
+       MaxLoopDepth(data->sequence()) <= kShallowLoopDepthLimit);
   // The mid-tier register allocator keeps values in stack slots for too long.
   // This is incompatible with left-trimming, therefore we cannot enable it for
   // JS functions.
@@ -3800,8 +3923,7 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
       data->info()->code_kind() == CodeKind::WASM_FUNCTION &&
       (v8_flags.turbo_force_mid_tier_regalloc ||
        (v8_flags.turbo_use_mid_tier_regalloc_for_huge_functions &&
-        data->sequence()->VirtualRegisterCount() >
-            kTopTierVirtualRegistersLimit));
+        huge_function));
 
   if (call_descriptor->HasRestrictedAllocatableRegisters()) {
     RegList registers = call_descriptor->AllocatableRegisters();
@@ -3817,6 +3939,14 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
     AllocateRegistersForTopTier(config, call_descriptor, run_verifier);
   }
 
+  if (data->pipeline_statistics() != nullptr) {
+    uint64_t move_count;
+    uint64_t spill_move_count;
+    CountAllocatedMoves(data->sequence(), &move_count, &spill_move_count);
+    data->pipeline_statistics()->RecordRegisterAllocationStats(
+        use_mid_tier_register_allocator, move_count, spill_move_count);
+  }
+
   // Verify the instruction sequence has the same hash in two stages.
   VerifyGeneratedCodeIsIdempotent();
 
@@ -543,6 +543,31 @@ class CFGBuilder : public ZoneObject {
         successor_blocks[index]->set_deferred(true);
       }
     }
+
+    // Branch hints from a profile are pairwise and cannot describe multi-way
+    // control flow; use raw block execution counts, if the profile carries
+    // them, to consider never-executed cases deferred.
+    const ProfileDataFromFile* profile_data = scheduler_->profile_data();
+    if (profile_data != nullptr && profile_data->has_block_counts()) {
+      bool any_case_executed = false;
+      for (size_t index = 0; index < successor_count; ++index) {
+        if (profile_data
+                ->GetExecutedCount(successor_blocks[index]->id().ToSize())
+                .value_or(0) > 0) {
+          any_case_executed = true;
+          break;
+        }
+      }
+      if (any_case_executed) {
+        for (size_t index = 0; index < successor_count; ++index) {
+          if (profile_data
+                  ->GetExecutedCount(successor_blocks[index]->id().ToSize())
+                  .value_or(0) == 0) {
+            successor_blocks[index]->set_deferred(true);
+          }
+        }
+      }
+    }
   }
 
   void ConnectMerge(Node* merge) {
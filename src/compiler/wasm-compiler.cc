@@ -2704,7 +2704,10 @@ Node* WasmGraphBuilder::BuildImportCall(const wasm::FunctionSig* sig,
       LOAD_INSTANCE_FIELD(ImportedFunctionRefs, MachineType::TaggedPointer());
   // Access fixed array at {header_size - tag + func_index * kTaggedSize}.
   Node* func_index_intptr = gasm_->BuildChangeUint32ToUintPtr(func_index);
-  Node* ref_node = gasm_->LoadFixedArrayElement(
+  // Imported function entries are only written during instantiation, before
+  // any code of the instance can run; loading them as immutable (like the
+  // target below) lets repeated calls to the same import share one lookup.
+  Node* ref_node = gasm_->LoadImmutableFixedArrayElement(
       imported_function_refs, func_index_intptr, MachineType::TaggedPointer());
 
   // Load the target from the imported_targets array at the offset of
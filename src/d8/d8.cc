@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
@@ -32,10 +33,12 @@
 #include "include/v8-profiler.h"
 #include "include/v8-wasm.h"
 #include "src/api/api-inl.h"
+#include "src/base/bits.h"
 #include "src/base/cpu.h"
 #include "src/base/logging.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
 #include "src/base/sanitizer/msan.h"
@@ -88,7 +91,10 @@
 #endif  // V8_INTL_SUPPORT
 
 #ifdef V8_OS_LINUX
+#include <linux/perf_event.h>  // For the --benchmark hardware counters.
+#include <sys/ioctl.h>
 #include <sys/mman.h>  // For MultiMappedAllocator.
+#include <sys/syscall.h>
 #endif
 
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -1515,6 +1521,25 @@ bool Shell::ExecuteWebSnapshot(Isolate* isolate, const char* file_name) {
     CHECK(try_catch.HasCaught());
     ReportException(isolate, &try_catch);
     return false;
+  } else if (i::v8_flags.web_snapshot_lazy_exports) {
+    // The snapshot buffer has to stay alive until the exports are accessed;
+    // hand its ownership over to a Managed<WebSnapshotData>.
+    auto snapshot_data_shared = std::make_shared<i::WebSnapshotData>();
+    snapshot_data_shared->buffer = snapshot_data.release();
+    snapshot_data_shared->buffer_size = static_cast<size_t>(length);
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+    i::Handle<i::Managed<i::WebSnapshotData>> snapshot_data_managed =
+        i::Managed<i::WebSnapshotData>::FromSharedPtr(
+            i_isolate, snapshot_data_shared->buffer_size, snapshot_data_shared);
+    i::WebSnapshotDeserializer deserializer(
+        isolate, snapshot_data_shared->buffer,
+        snapshot_data_shared->buffer_size);
+    if (!deserializer.DeserializeLazily(snapshot_data_managed)) {
+      if (i_isolate->has_pending_exception()) {
+        i_isolate->ReportPendingMessages();
+      }
+      return false;
+    }
   } else {
     for (int r = 0; r < DeserializationRunCount(); ++r) {
       bool skip_exports = r > 0;
@@ -2253,7 +2278,10 @@ void Shell::RealmUseWebSnapshot(
     i::WebSnapshotDeserializer deserializer(isolate,
                                             snapshot_data_shared->buffer,
                                             snapshot_data_shared->buffer_size);
-    bool success = deserializer.Deserialize();
+    bool success =
+        i::v8_flags.web_snapshot_lazy_exports
+            ? deserializer.DeserializeLazily(snapshot_data_managed)
+            : deserializer.Deserialize();
     args.GetReturnValue().Set(success);
   }
 }
@@ -4852,6 +4880,35 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       i::v8_flags.slow_histograms = true;
       options.dump_counters = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--benchmark") == 0) {
+      options.benchmark = true;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--benchmark-min-runs=", 21) == 0) {
+      options.benchmark_min_runs = atoi(argv[i] + 21);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--benchmark-max-runs=", 21) == 0) {
+      options.benchmark_max_runs = atoi(argv[i] + 21);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--benchmark-target-cv=", 22) == 0) {
+      // Target coefficient of variation of the wall time, in percent.
+      options.benchmark_target_cv = atoi(argv[i] + 22);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-test-script=", 19) == 0) {
+      options.load_test_script = argv[i] + 19;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-test-threads=", 20) == 0) {
+      options.load_test_threads = atoi(argv[i] + 20);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-test-isolates=", 21) == 0) {
+      // Defaults to --load-test-threads when unset or zero.
+      options.load_test_isolates = atoi(argv[i] + 21);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--load-test-requests=", 21) == 0) {
+      options.load_test_requests = atoi(argv[i] + 21);
+      argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--load-test-reuse-context") == 0) {
+      options.load_test_reuse_context = true;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--dump-counters-nvp") == 0) {
       i::v8_flags.slow_histograms = true;
       options.dump_counters_nvp = true;
@@ -5149,6 +5206,438 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
   return (success == Shell::options.expected_to_throw ? 1 : 0);
 }
 
+namespace {
+
+// Hardware performance counters read around each --benchmark run. They are
+// only implemented on Linux via perf_event_open; elsewhere, and when the perf
+// subsystem is unavailable (e.g. a restrictive perf_event_paranoid setting),
+// no counters are reported.
+class BenchmarkPerfCounters {
+ public:
+  static constexpr int kMaxCounters = 4;
+
+  BenchmarkPerfCounters() {
+#ifdef V8_OS_LINUX
+    Open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions");
+    Open(PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+             (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+         "l1d_read_misses");
+    Open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "llc_misses");
+    Open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch_misses");
+#endif  // V8_OS_LINUX
+  }
+
+  ~BenchmarkPerfCounters() {
+#ifdef V8_OS_LINUX
+    for (int i = 0; i < num_counters_; i++) close(fds_[i]);
+#endif  // V8_OS_LINUX
+  }
+
+  void Start() {
+#ifdef V8_OS_LINUX
+    for (int i = 0; i < num_counters_; i++) {
+      ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+      ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif  // V8_OS_LINUX
+  }
+
+  void Stop() {
+#ifdef V8_OS_LINUX
+    for (int i = 0; i < num_counters_; i++) {
+      ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+      uint64_t value = 0;
+      if (read(fds_[i], &value, sizeof(value)) == sizeof(value)) {
+        samples_[i].push_back(static_cast<double>(value));
+      }
+    }
+#endif  // V8_OS_LINUX
+  }
+
+  int num_counters() const { return num_counters_; }
+  const char* name(int i) const { return names_[i]; }
+  const std::vector<double>& samples(int i) const { return samples_[i]; }
+
+ private:
+#ifdef V8_OS_LINUX
+  void Open(uint32_t type, uint64_t config, const char* name) {
+    DCHECK_LT(num_counters_, kMaxCounters);
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // Follow the worker and compiler threads spawned during a run.
+    attr.inherit = 1;
+    int fd =
+        static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd < 0) return;
+    fds_[num_counters_] = fd;
+    names_[num_counters_] = name;
+    num_counters_++;
+  }
+
+  int fds_[kMaxCounters];
+#endif  // V8_OS_LINUX
+  const char* names_[kMaxCounters];
+  std::vector<double> samples_[kMaxCounters];
+  int num_counters_ = 0;
+};
+
+double SampleMean(const std::vector<double>& samples) {
+  double sum = 0;
+  for (double sample : samples) sum += sample;
+  return sum / samples.size();
+}
+
+double SampleStandardDeviation(const std::vector<double>& samples) {
+  if (samples.size() < 2) return 0;
+  const double mean = SampleMean(samples);
+  double sum_of_squares = 0;
+  for (double sample : samples) {
+    sum_of_squares += (sample - mean) * (sample - mean);
+  }
+  return std::sqrt(sum_of_squares / (samples.size() - 1));
+}
+
+double CoefficientOfVariation(const std::vector<double>& samples) {
+  const double mean = SampleMean(samples);
+  if (mean == 0) return 0;
+  return SampleStandardDeviation(samples) / mean;
+}
+
+void PrintBenchmarkMetric(const char* name, const std::vector<double>& samples,
+                          int precision, bool first) {
+  if (!first) printf(", ");
+  printf("\"%s\": {\"mean\": %.*f, \"stddev\": %.*f, \"cv\": %.4f, "
+         "\"samples\": [",
+         name, precision, SampleMean(samples), precision,
+         SampleStandardDeviation(samples), CoefficientOfVariation(samples));
+  for (size_t i = 0; i < samples.size(); i++) {
+    printf("%s%.*f", i == 0 ? "" : ", ", precision, samples[i]);
+  }
+  printf("]}");
+}
+
+}  // namespace
+
+int Shell::RunBenchmark(Isolate* isolate) {
+  const int min_runs = std::max(2, options.benchmark_min_runs.get());
+  const int max_runs = std::max(min_runs, options.benchmark_max_runs.get());
+  const double target_cv = options.benchmark_target_cv / 100.0;
+
+  BenchmarkPerfCounters counters;
+  std::vector<double> wall_times_ms;
+  for (int run = 0; run < max_runs; run++) {
+    // Each run gets a fresh evaluation context from RunMain, so state cannot
+    // leak between repetitions.
+    counters.Start();
+    base::TimeTicks start = base::TimeTicks::Now();
+    int result = RunMain(isolate, false);
+    base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+    counters.Stop();
+    if (result != 0) return result;
+    wall_times_ms.push_back(elapsed.InMillisecondsF());
+    // Stop early once the measurement is statistically stable: at least
+    // --benchmark-min-runs repetitions with the coefficient of variation of
+    // the wall time at or below the target.
+    if (run + 1 >= min_runs &&
+        CoefficientOfVariation(wall_times_ms) <= target_cv) {
+      break;
+    }
+  }
+
+  printf("{\"benchmark\": {\"runs\": %d, \"metrics\": {",
+         static_cast<int>(wall_times_ms.size()));
+  PrintBenchmarkMetric("wall_time_ms", wall_times_ms, 3, true);
+  for (int i = 0; i < counters.num_counters(); i++) {
+    PrintBenchmarkMetric(counters.name(i), counters.samples(i), 0, false);
+  }
+  printf("}}}\n");
+  return 0;
+}
+
+namespace {
+
+// Latency histogram in the spirit of HDR histograms: values below kPrecision
+// microseconds are recorded exactly, larger values fall into power-of-two
+// ranges subdivided into kPrecision/2 linear sub-buckets each, which bounds
+// the relative quantile error to 2/kPrecision independently of the recorded
+// range.
+class LatencyHistogram {
+ public:
+  void Record(base::TimeDelta latency) {
+    int64_t micros = std::max(int64_t{0}, latency.InMicroseconds());
+    counts_[BucketFor(static_cast<uint64_t>(micros))]++;
+    total_count_++;
+    max_micros_ = std::max(max_micros_, micros);
+  }
+
+  void Merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kNumBuckets; i++) counts_[i] += other.counts_[i];
+    total_count_ += other.total_count_;
+    max_micros_ = std::max(max_micros_, other.max_micros_);
+  }
+
+  // Returns an upper bound of the latency of the given quantile, in
+  // microseconds.
+  int64_t Quantile(double quantile) const {
+    if (total_count_ == 0) return 0;
+    uint64_t rank = static_cast<uint64_t>(quantile * (total_count_ - 1));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; i++) {
+      seen += counts_[i];
+      if (seen > rank) return std::min(BucketUpperBound(i), max_micros_);
+    }
+    return max_micros_;
+  }
+
+  uint64_t total_count() const { return total_count_; }
+  int64_t max_micros() const { return max_micros_; }
+
+ private:
+  static constexpr int kPrecisionBits = 5;
+  static constexpr uint64_t kPrecision = uint64_t{1} << kPrecisionBits;
+  static constexpr size_t kNumBuckets =
+      kPrecision + (64 - kPrecisionBits) * (kPrecision / 2);
+
+  static size_t BucketFor(uint64_t value) {
+    if (value < kPrecision) return static_cast<size_t>(value);
+    int msb = 63 - base::bits::CountLeadingZeros(value);
+    int range = msb - kPrecisionBits + 1;
+    uint64_t sub_bucket = (value >> range) - kPrecision / 2;
+    return kPrecision + (range - 1) * (kPrecision / 2) +
+           static_cast<size_t>(sub_bucket);
+  }
+
+  static int64_t BucketUpperBound(size_t index) {
+    if (index < kPrecision) return static_cast<int64_t>(index);
+    size_t range = (index - kPrecision) / (kPrecision / 2) + 1;
+    uint64_t sub_bucket = (index - kPrecision) % (kPrecision / 2) +
+                          kPrecision / 2;
+    return static_cast<int64_t>(((sub_bucket + 1) << range) - 1);
+  }
+
+  uint64_t counts_[kNumBuckets] = {};
+  uint64_t total_count_ = 0;
+  int64_t max_micros_ = 0;
+};
+
+// Runs the load test script once per simulated request on a pool of isolates
+// shared by several worker threads, mimicking a multi-tenant server: each
+// request checks out an idle isolate, executes the script in it and returns
+// the isolate to the pool.
+class LoadTestDriver {
+ public:
+  LoadTestDriver(const char* script_source, int script_length)
+      : script_source_(script_source), script_length_(script_length) {}
+
+  int Run(Isolate* main_isolate);
+
+ private:
+  class WorkerThread : public base::Thread {
+   public:
+    explicit WorkerThread(LoadTestDriver* driver)
+        : base::Thread(base::Thread::Options("LoadTestWorker")),
+          driver_(driver) {}
+
+    void Run() override { driver_->RunWorker(); }
+
+   private:
+    LoadTestDriver* const driver_;
+  };
+
+  // One simulated tenant: an isolate plus the per-isolate state d8 needs.
+  // Isolates migrate between worker threads but are only ever entered by
+  // the single thread that checked them out.
+  struct PoolIsolate {
+    Isolate* isolate = nullptr;
+    std::unique_ptr<D8Console> console;
+    std::unique_ptr<PerIsolateData> data;
+    Global<Context> context;
+    base::TimeTicks gc_start;
+    base::TimeDelta gc_time;
+    int gc_count = 0;
+  };
+
+  static void GCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    static_cast<PoolIsolate*>(data)->gc_start = base::TimeTicks::Now();
+  }
+
+  static void GCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    auto* pool_isolate = static_cast<PoolIsolate*>(data);
+    pool_isolate->gc_time += base::TimeTicks::Now() - pool_isolate->gc_start;
+    pool_isolate->gc_count++;
+  }
+
+  PoolIsolate* AcquireIsolate() {
+    available_.Wait();
+    base::MutexGuard guard(&pool_mutex_);
+    PoolIsolate* result = free_isolates_.back();
+    free_isolates_.pop_back();
+    return result;
+  }
+
+  void ReleaseIsolate(PoolIsolate* pool_isolate) {
+    {
+      base::MutexGuard guard(&pool_mutex_);
+      free_isolates_.push_back(pool_isolate);
+    }
+    available_.Signal();
+  }
+
+  bool RunRequest(PoolIsolate* pool_isolate);
+  void RunWorker();
+
+  const char* const script_source_;
+  const int script_length_;
+  std::vector<std::unique_ptr<PoolIsolate>> isolates_;
+  base::Mutex pool_mutex_;
+  std::vector<PoolIsolate*> free_isolates_;
+  base::Semaphore available_{0};
+  std::atomic<int> next_request_{0};
+  base::Mutex stats_mutex_;
+  LatencyHistogram latencies_;
+  int failures_ = 0;
+};
+
+bool LoadTestDriver::RunRequest(PoolIsolate* pool_isolate) {
+  Isolate* isolate = pool_isolate->isolate;
+  Isolate::Scope isolate_scope(isolate);
+  HandleScope handle_scope(isolate);
+  Local<Context> context;
+  if (Shell::options.load_test_reuse_context &&
+      !pool_isolate->context.IsEmpty()) {
+    context = pool_isolate->context.Get(isolate);
+  } else {
+    context = Shell::CreateEvaluationContext(isolate);
+    if (Shell::options.load_test_reuse_context) {
+      pool_isolate->context.Reset(isolate, context);
+    }
+  }
+  Context::Scope context_scope(context);
+  PerIsolateData::RealmScope realm_scope(PerIsolateData::Get(isolate));
+  Local<String> source;
+  if (!String::NewFromUtf8(isolate, script_source_, NewStringType::kNormal,
+                           script_length_)
+           .ToLocal(&source)) {
+    return false;
+  }
+  Local<String> name = String::NewFromUtf8Literal(isolate, "<load-test>");
+  bool success = Shell::ExecuteString(
+      isolate, source, name, Shell::kNoPrintResult, Shell::kReportExceptions,
+      Shell::kProcessMessageQueue);
+  if (!Shell::options.load_test_reuse_context) {
+    isolate->ContextDisposedNotification(false);
+  }
+  return success;
+}
+
+void LoadTestDriver::RunWorker() {
+  LatencyHistogram local_latencies;
+  int local_failures = 0;
+  while (next_request_.fetch_add(1, std::memory_order_relaxed) <
+         Shell::options.load_test_requests) {
+    PoolIsolate* pool_isolate = AcquireIsolate();
+    base::TimeTicks start = base::TimeTicks::Now();
+    if (!RunRequest(pool_isolate)) local_failures++;
+    local_latencies.Record(base::TimeTicks::Now() - start);
+    ReleaseIsolate(pool_isolate);
+  }
+  base::MutexGuard guard(&stats_mutex_);
+  latencies_.Merge(local_latencies);
+  failures_ += local_failures;
+}
+
+int LoadTestDriver::Run(Isolate* main_isolate) {
+  const int num_threads = std::max(1, Shell::options.load_test_threads.get());
+  const int num_isolates = Shell::options.load_test_isolates > 0
+                               ? Shell::options.load_test_isolates.get()
+                               : num_threads;
+
+  for (int i = 0; i < num_isolates; i++) {
+    auto pool_isolate = std::make_unique<PoolIsolate>();
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    pool_isolate->isolate = isolate;
+    Shell::SetWaitUntilDone(isolate, false);
+    pool_isolate->console = std::make_unique<D8Console>(isolate);
+    Shell::Initialize(isolate, pool_isolate->console.get(), false);
+    {
+      Isolate::Scope isolate_scope(isolate);
+      pool_isolate->data = std::make_unique<PerIsolateData>(isolate);
+    }
+    isolate->AddGCPrologueCallback(GCPrologue, pool_isolate.get());
+    isolate->AddGCEpilogueCallback(GCEpilogue, pool_isolate.get());
+    free_isolates_.push_back(pool_isolate.get());
+    isolates_.push_back(std::move(pool_isolate));
+    available_.Signal();
+  }
+
+  base::TimeTicks start = base::TimeTicks::Now();
+  std::vector<std::unique_ptr<WorkerThread>> threads;
+  for (int i = 0; i < num_threads; i++) {
+    threads.push_back(std::make_unique<WorkerThread>(this));
+    CHECK(threads.back()->Start());
+  }
+  {
+    // Park the main thread while waiting: the pool isolates may trigger a
+    // shared GC that would otherwise deadlock on the idle main isolate.
+    i::ParkedScope parked(reinterpret_cast<i::Isolate*>(main_isolate)
+                              ->main_thread_local_isolate());
+    for (auto& thread : threads) thread->Join();
+  }
+  base::TimeDelta wall_time = base::TimeTicks::Now() - start;
+
+  int gc_count = 0;
+  base::TimeDelta gc_time;
+  for (auto& pool_isolate : isolates_) {
+    gc_count += pool_isolate->gc_count;
+    gc_time += pool_isolate->gc_time;
+    pool_isolate->context.Reset();
+    pool_isolate->data.reset();
+    pool_isolate->isolate->Dispose();
+  }
+
+  const double wall_ms = wall_time.InMillisecondsF();
+  printf(
+      "{\"load_test\": {\"requests\": %d, \"failures\": %d, \"threads\": %d, "
+      "\"isolates\": %d, \"wall_time_ms\": %.3f, \"throughput_rps\": %.1f, "
+      "\"latency_ms\": {\"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, "
+      "\"p999\": %.3f, \"max\": %.3f}, "
+      "\"gc\": {\"count\": %d, \"time_ms\": %.3f}}}\n",
+      static_cast<int>(latencies_.total_count()), failures_, num_threads,
+      num_isolates, wall_ms,
+      wall_ms > 0 ? latencies_.total_count() * 1000.0 / wall_ms : 0.0,
+      latencies_.Quantile(0.5) / 1000.0, latencies_.Quantile(0.9) / 1000.0,
+      latencies_.Quantile(0.99) / 1000.0, latencies_.Quantile(0.999) / 1000.0,
+      latencies_.max_micros() / 1000.0, gc_count, gc_time.InMillisecondsF());
+  return failures_ == 0 ? 0 : 1;
+}
+
+}  // namespace
+
+int Shell::RunLoadTest(Isolate* isolate) {
+  int length = 0;
+  std::unique_ptr<char[]> script(ReadChars(options.load_test_script, &length));
+  if (!script) {
+    fprintf(stderr, "Error reading '%s'\n", options.load_test_script.get());
+    return 1;
+  }
+  // The driver consumes the script itself; don't fall through to the
+  // interactive shell afterwards.
+  set_script_executed();
+  LoadTestDriver driver(script.get(), length);
+  return driver.Run(isolate);
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -5833,7 +6322,11 @@ int Shell::Main(int argc, char* argv[]) {
                                      CpuProfilingOptions{});
       }
 
-      if (i::v8_flags.stress_runs > 0) {
+      if (options.load_test_script != nullptr) {
+        result = RunLoadTest(isolate);
+      } else if (options.benchmark) {
+        result = RunBenchmark(isolate);
+      } else if (i::v8_flags.stress_runs > 0) {
         options.stress_runs = i::v8_flags.stress_runs;
         for (int i = 0; i < options.stress_runs && result == 0; i++) {
           printf("============ Run %d/%d ============\n", i + 1,
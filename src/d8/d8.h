@@ -421,6 +421,17 @@ class ShellOptions {
   DisallowReassignment<bool> no_fail = {"no-fail", false};
   DisallowReassignment<bool> dump_counters = {"dump-counters", false};
   DisallowReassignment<bool> dump_counters_nvp = {"dump-counters-nvp", false};
+  DisallowReassignment<bool> benchmark = {"benchmark", false};
+  DisallowReassignment<int> benchmark_min_runs = {"benchmark-min-runs", 5};
+  DisallowReassignment<int> benchmark_max_runs = {"benchmark-max-runs", 30};
+  DisallowReassignment<int> benchmark_target_cv = {"benchmark-target-cv", 2};
+  DisallowReassignment<const char*> load_test_script = {"load-test-script",
+                                                        nullptr};
+  DisallowReassignment<int> load_test_threads = {"load-test-threads", 1};
+  DisallowReassignment<int> load_test_isolates = {"load-test-isolates", 0};
+  DisallowReassignment<int> load_test_requests = {"load-test-requests", 1000};
+  DisallowReassignment<bool> load_test_reuse_context = {
+      "load-test-reuse-context", false};
   DisallowReassignment<bool> ignore_unhandled_promises = {
       "ignore-unhandled-promises", false};
   DisallowReassignment<bool> mock_arraybuffer_allocator = {
@@ -518,6 +529,15 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  // Repeatedly runs the given sources in fresh contexts until the wall time
+  // measurement is statistically stable, and reports timing and hardware
+  // counter statistics as JSON. See the --benchmark family of d8 flags.
+  static int RunBenchmark(Isolate* isolate);
+  // Runs the --load-test-script once per simulated request on a pool of
+  // isolates shared by several worker threads, and reports request latency
+  // quantiles and GC interference as JSON. See the --load-test family of d8
+  // flags.
+  static int RunLoadTest(Isolate* isolate);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
@@ -4,6 +4,8 @@
 
 #include "src/date/date.h"
 
+#include <algorithm>
+
 #include "src/base/overflowing-math.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/objects-inl.h"
@@ -51,6 +53,7 @@ void DateCache::ResetDateCache(
   dst_usage_counter_ = 0;
   before_ = &dst_[0];
   after_ = &dst_[1];
+  transitions_.clear();
   ymd_valid_ = false;
 #ifdef V8_INTL_SUPPORT
   if (!v8_flags.icu_timezone_data) {
@@ -299,6 +302,75 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
                      ? static_cast<int>(time_ms / 1000)
                      : static_cast<int>(EquivalentTime(time_ms) / 1000);
 
+  // Fast path: look the time up in the sorted transition table. Intervals
+  // recorded there have been verified and, unlike the segment cache, are
+  // never evicted, so workloads spanning many epochs keep hitting here.
+  auto it = std::upper_bound(transitions_.begin(), transitions_.end(),
+                             time_sec,
+                             [](int sec, const TransitionInterval& interval) {
+                               return sec < interval.start_sec;
+                             });
+  if (it != transitions_.begin()) {
+    --it;
+    if (time_sec <= it->end_sec) return it->offset_ms;
+  }
+
+  int offset_ms = DaylightSavingsOffsetFromSegments(time_sec);
+
+  // If the segment cache ended up with a verified segment containing the
+  // time, record it in the transition table for subsequent lookups.
+  if (!InvalidSegment(before_) && before_->start_sec <= time_sec &&
+      time_sec <= before_->end_sec && before_->offset_ms == offset_ms) {
+    AddTransitionInterval(before_->start_sec, before_->end_sec, offset_ms);
+  }
+  return offset_ms;
+}
+
+void DateCache::AddTransitionInterval(int start_sec, int end_sec,
+                                      int offset_ms) {
+  TransitionInterval interval{start_sec, end_sec, offset_ms};
+  // Find the first entry that starts after the new interval and check
+  // whether its predecessor can be merged.
+  auto pos = std::upper_bound(transitions_.begin(), transitions_.end(),
+                              interval.start_sec,
+                              [](int sec, const TransitionInterval& entry) {
+                                return sec < entry.start_sec;
+                              });
+  if (pos != transitions_.begin()) {
+    auto prev = pos - 1;
+    if (prev->offset_ms == offset_ms &&
+        prev->end_sec >= interval.start_sec - 1) {
+      interval.start_sec = prev->start_sec;
+      interval.end_sec = std::max(interval.end_sec, prev->end_sec);
+      pos = prev;
+    } else if (prev->end_sec >= interval.start_sec) {
+      // Conflicting overlap; this means the OS gave inconsistent answers.
+      // Keep the table unchanged, the segment cache still works.
+      return;
+    }
+  }
+  // Absorb all subsequent entries of the same offset that overlap or are
+  // adjacent. An entry with a different offset can legitimately be adjacent
+  // (that is where the transition happens) but must not overlap.
+  auto last = pos;
+  while (last != transitions_.end()) {
+    // Guard against overflow: end_sec may be kMaxEpochTimeInSec == kMaxInt.
+    const int end_successor_sec = interval.end_sec < kMaxEpochTimeInSec
+                                      ? interval.end_sec + 1
+                                      : kMaxEpochTimeInSec;
+    if (last->start_sec > end_successor_sec) break;
+    if (last->offset_ms != offset_ms) {
+      if (last->start_sec <= interval.end_sec) return;
+      break;
+    }
+    interval.end_sec = std::max(interval.end_sec, last->end_sec);
+    ++last;
+  }
+  pos = transitions_.erase(pos, last);
+  transitions_.insert(pos, interval);
+}
+
+int DateCache::DaylightSavingsOffsetFromSegments(int time_sec) {
   // Invalidate cache if the usage counter is close to overflow.
   // Note that dst_usage_counter is incremented less than ten times
   // in this function.
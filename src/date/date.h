@@ -5,6 +5,8 @@
 #ifndef V8_DATE_DATE_H_
 #define V8_DATE_DATE_H_
 
+#include <vector>
+
 #include "src/base/small-vector.h"
 #include "src/base/timezone-cache.h"
 #include "src/common/globals.h"
@@ -187,10 +189,27 @@ class V8_EXPORT_PRIVATE DateCache {
     int last_used;
   };
 
+  // An interval of time with a constant daylight savings offset, verified
+  // through the DST segment machinery below. Intervals are kept sorted by
+  // start_sec and non-overlapping in the transition table.
+  struct TransitionInterval {
+    int start_sec;
+    int end_sec;
+    int offset_ms;
+  };
+
   // Computes the daylight savings offset for the given time.
   // ECMA 262 - 15.9.1.8
   int DaylightSavingsOffsetInMs(int64_t time_ms);
 
+  // Computes the daylight savings offset using the DST segment cache,
+  // querying the OS on misses.
+  int DaylightSavingsOffsetFromSegments(int time_sec);
+
+  // Records a verified constant-offset interval in the transition table,
+  // merging it with overlapping and adjacent intervals of the same offset.
+  void AddTransitionInterval(int start_sec, int end_sec, int offset_ms);
+
   // Sets the before_ and the after_ segments from the DST cache such that
   // the before_ segment starts earlier than the given time and
   // the after_ segment start later than the given time.
@@ -221,6 +240,13 @@ class V8_EXPORT_PRIVATE DateCache {
   DST* before_;
   DST* after_;
 
+  // Sorted table of verified constant-offset intervals, separated by time
+  // zone transitions. Unlike the segment cache above it is unbounded, so
+  // intervals learned once are never evicted until the time zone changes;
+  // lookups are a binary search. The table grows by at most one entry per
+  // actual transition covered by the workload.
+  std::vector<TransitionInterval> transitions_;
+
   int local_offset_ms_;
 
   // Year/Month/Day cache.
@@ -878,7 +878,12 @@ void Deoptimizer::DoComputeOutputFrames() {
   }
   output_count_ = static_cast<int>(count);
 
-  // Translate each output frame.
+  // Translate each output frame. All output frames have to be materialized
+  // eagerly: they are written contiguously to the stack before execution
+  // resumes, and each frame's return address points into the next one, so
+  // outer frames cannot be reconstructed lazily when the interpreter unwinds
+  // into them. The exceptions above (frame restart and deoptimizing throw)
+  // already cap the number of frames to the ones actually resumed into.
   int frame_index = 0;
   size_t total_output_frame_size = 0;
   for (size_t i = 0; i < count; ++i, ++frame_index) {
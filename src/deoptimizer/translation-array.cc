@@ -4,6 +4,9 @@
 
 #include "src/deoptimizer/translation-array.h"
 
+#include <algorithm>
+
+#include "src/base/functional.h"
 #include "src/base/vlq.h"
 #include "src/deoptimizer/translated-state.h"
 #include "src/objects/fixed-array-inl.h"
@@ -127,6 +130,34 @@ void TranslationArrayBuilder::AddDoubleRegister(DoubleRegister reg) {
   }
 }
 
+int TranslationArrayBuilder::DedupeLastTranslation(int start_index) {
+  // With compression enabled the whole array is compressed at the end, which
+  // already squeezes out duplicated translations.
+  if (V8_UNLIKELY(v8_flags.turbo_compress_translation_arrays)) {
+    return start_index;
+  }
+  const int length = static_cast<int>(contents_.size()) - start_index;
+  DCHECK_GT(length, 0);
+  const uint8_t* begin = contents_.data() + start_index;
+  const size_t hash = base::hash_range(begin, begin + length);
+  auto it = finished_translations_.find(hash);
+  if (it == finished_translations_.end()) {
+    it = finished_translations_
+             .emplace(hash, ZoneVector<std::pair<int, int>>(zone()))
+             .first;
+  } else {
+    for (const auto& [other_start, other_length] : it->second) {
+      if (other_length == length &&
+          std::equal(begin, begin + length, contents_.data() + other_start)) {
+        contents_.resize(start_index);
+        return other_start;
+      }
+    }
+  }
+  it->second.emplace_back(start_index, length);
+  return start_index;
+}
+
 Handle<TranslationArray> TranslationArrayBuilder::ToTranslationArray(
     Factory* factory) {
 #ifdef V8_USE_ZLIB
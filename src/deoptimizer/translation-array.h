@@ -49,10 +49,19 @@ class TranslationArrayIterator {
 class TranslationArrayBuilder {
  public:
   explicit TranslationArrayBuilder(Zone* zone)
-      : contents_(zone), contents_for_compression_(zone), zone_(zone) {}
+      : contents_(zone),
+        contents_for_compression_(zone),
+        finished_translations_(zone),
+        zone_(zone) {}
 
   Handle<TranslationArray> ToTranslationArray(Factory* factory);
 
+  // Must be called directly after the last instruction of a translation has
+  // been added. If an identical translation was finished earlier, the new one
+  // is dropped again and the index of the earlier translation is returned;
+  // otherwise the translation is registered and start_index is returned.
+  int DedupeLastTranslation(int start_index);
+
   int BeginTranslation(int frame_count, int jsframe_count,
                        int update_feedback_count) {
     int start_index = Size();
@@ -131,6 +140,9 @@ class TranslationArrayBuilder {
 
   ZoneVector<uint8_t> contents_;
   ZoneVector<int32_t> contents_for_compression_;
+  // Maps a hash of translation contents to the start indices and lengths of
+  // finished translations, for use by DedupeLastTranslation.
+  ZoneMap<size_t, ZoneVector<std::pair<int, int>>> finished_translations_;
   Zone* const zone_;
 };
 
@@ -62,6 +62,20 @@ BasicBlockProfilerData* BasicBlockProfiler::NewData(size_t n_blocks) {
   return data_ptr;
 }
 
+BasicBlockProfilerData* BasicBlockProfiler::GetData(const char* function_name,
+                                                    int hash) {
+  base::MutexGuard lock(&data_list_mutex_);
+  // Walk backwards so that the counters from the most recent instrumented
+  // compilation of the function win.
+  for (auto it = data_list_.rbegin(); it != data_list_.rend(); ++it) {
+    BasicBlockProfilerData* data = it->get();
+    if (data->hash() == hash && data->function_name() == function_name) {
+      return data;
+    }
+  }
+  return nullptr;
+}
+
 namespace {
 Handle<String> CopyStringToJSHeap(const std::string& source, Isolate* isolate) {
   return isolate->factory()->NewStringFromAsciiChecked(source.c_str(),
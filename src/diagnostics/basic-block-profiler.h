@@ -37,6 +37,12 @@ class BasicBlockProfilerData {
     return block_ids_.size();
   }
   const uint32_t* counts() const { return &counts_[0]; }
+  const std::vector<int32_t>& block_ids() const { return block_ids_; }
+  const std::vector<std::pair<int32_t, int32_t>>& branches() const {
+    return branches_;
+  }
+  const std::string& function_name() const { return function_name_; }
+  int hash() const { return hash_; }
 
   void SetCode(const std::ostringstream& os);
   void SetFunctionName(std::unique_ptr<char[]> name);
@@ -82,6 +88,11 @@ class BasicBlockProfiler {
 
   V8_EXPORT_PRIVATE static BasicBlockProfiler* Get();
   BasicBlockProfilerData* NewData(size_t n_blocks);
+  // Returns the most recently created data for an instrumented function with
+  // the given name and pre-scheduling graph hash, or nullptr if no matching
+  // counters have been collected. Used by --turbo-profiling-feedback.
+  V8_EXPORT_PRIVATE BasicBlockProfilerData* GetData(const char* function_name,
+                                                    int hash);
   V8_EXPORT_PRIVATE void ResetCounts(Isolate* isolate);
   V8_EXPORT_PRIVATE bool HasData(Isolate* isolate);
   V8_EXPORT_PRIVATE void Print(Isolate* isolate, std::ostream& os);
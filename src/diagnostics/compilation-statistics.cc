@@ -4,6 +4,7 @@
 
 #include "src/diagnostics/compilation-statistics.h"
 
+#include <cinttypes>
 #include <ostream>
 #include <vector>
 
@@ -46,6 +47,20 @@ void CompilationStatistics::RecordTotalStats(const BasicStats& stats) {
   total_stats_.Accumulate(stats);
 }
 
+void CompilationStatistics::RecordRegisterAllocationStats(
+    bool used_mid_tier, uint64_t move_count, uint64_t spill_move_count) {
+  base::MutexGuard guard(&record_mutex_);
+  if (used_mid_tier) {
+    register_allocation_stats_.mid_tier_functions++;
+    register_allocation_stats_.mid_tier_moves += move_count;
+    register_allocation_stats_.mid_tier_spill_moves += spill_move_count;
+  } else {
+    register_allocation_stats_.top_tier_functions++;
+    register_allocation_stats_.top_tier_moves += move_count;
+    register_allocation_stats_.top_tier_spill_moves += spill_move_count;
+  }
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -171,6 +186,36 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  const CompilationStatistics::RegisterAllocationStats& ra =
+      s.register_allocation_stats_;
+  if (ra.top_tier_functions + ra.mid_tier_functions > 0) {
+    if (ps.machine_output) {
+      os << "\"regalloc_top_tier_functions\"=" << ra.top_tier_functions << "\n"
+         << "\"regalloc_top_tier_moves\"=" << ra.top_tier_moves << "\n"
+         << "\"regalloc_top_tier_spill_moves\"=" << ra.top_tier_spill_moves
+         << "\n"
+         << "\"regalloc_mid_tier_functions\"=" << ra.mid_tier_functions << "\n"
+         << "\"regalloc_mid_tier_moves\"=" << ra.mid_tier_moves << "\n"
+         << "\"regalloc_mid_tier_spill_moves\"=" << ra.mid_tier_spill_moves
+         << "\n";
+    } else {
+      os << "\n         Register allocator    Functions          Moves"
+            "    Spill moves\n";
+      const size_t kBufferSize = 128;
+      char buffer[kBufferSize];
+      base::OS::SNPrintF(buffer, kBufferSize,
+                         "%27s %12" PRIu64 " %14" PRIu64 " %14" PRIu64 "\n",
+                         "top-tier", ra.top_tier_functions, ra.top_tier_moves,
+                         ra.top_tier_spill_moves);
+      os << buffer;
+      base::OS::SNPrintF(buffer, kBufferSize,
+                         "%27s %12" PRIu64 " %14" PRIu64 " %14" PRIu64 "\n",
+                         "mid-tier", ra.mid_tier_functions, ra.mid_tier_moves,
+                         ra.mid_tier_spill_moves);
+      os << buffer;
+    }
+  }
+
   return os;
 }
 
@@ -47,6 +47,17 @@ class CompilationStatistics final : public Malloced {
     std::string function_name_;
   };
 
+  // Emitted-code quality counters for register allocation, broken down by
+  // which allocator handled the function.
+  struct RegisterAllocationStats {
+    uint64_t top_tier_functions = 0;
+    uint64_t top_tier_moves = 0;
+    uint64_t top_tier_spill_moves = 0;
+    uint64_t mid_tier_functions = 0;
+    uint64_t mid_tier_moves = 0;
+    uint64_t mid_tier_spill_moves = 0;
+  };
+
   void RecordPhaseStats(const char* phase_kind_name, const char* phase_name,
                         const BasicStats& stats);
 
@@ -55,6 +66,12 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(const BasicStats& stats);
 
+  // Accumulates the counters for one register-allocated function:
+  // |move_count| is the number of parallel moves the allocator inserted and
+  // |spill_move_count| how many of them write to stack slots.
+  void RecordRegisterAllocationStats(bool used_mid_tier, uint64_t move_count,
+                                     uint64_t spill_move_count);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -85,6 +102,7 @@ class CompilationStatistics final : public Malloced {
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  RegisterAllocationStats register_allocation_stats_;
   base::Mutex record_mutex_;
 };
 
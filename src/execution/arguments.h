@@ -5,6 +5,7 @@
 #ifndef V8_EXECUTION_ARGUMENTS_H_
 #define V8_EXECUTION_ARGUMENTS_H_
 
+#include "src/common/assert-scope.h"
 #include "src/execution/clobber-registers.h"
 #include "src/handles/handles.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -149,6 +150,38 @@ Handle<S> Arguments<T>::at(int index) const {
   RUNTIME_FUNCTION_RETURNS_TYPE(ObjectPair, ObjectPair, \
                                 BUILTIN_CONVERT_RESULT_PAIR, Name)
 
+// In debug builds, entering a leaf runtime function installs guards that turn
+// a violation of the leaf constraints into an immediate failure.
+#ifdef DEBUG
+#define LEAF_RUNTIME_GUARDS(isolate)     \
+  DisallowGarbageCollection no_gc;       \
+  DisallowHandleAllocation no_handles;   \
+  DisallowJavascriptExecution no_js(isolate);
+#else
+#define LEAF_RUNTIME_GUARDS(isolate)
+#endif
+
+// Variant of RUNTIME_FUNCTION for leaf runtime functions: helpers that never
+// allocate on the V8 heap, never open a HandleScope and never call back into
+// JavaScript. Arguments may still be accessed through handles as those point
+// directly into the argument slots. Leaf functions should also return false
+// from Runtime::MayAllocate so that optimized code uses the cheaper call
+// descriptor.
+#define RUNTIME_FUNCTION_LEAF(Name)                                         \
+  static V8_INLINE Object __RT_impl_##Name(RuntimeArguments args,           \
+                                           Isolate* isolate);               \
+  RUNTIME_ENTRY_WITH_RCS(Address, Object, BUILTIN_CONVERT_RESULT, Name)     \
+  Address Name(int args_length, Address* args_object, Isolate* isolate) {   \
+    DCHECK(isolate->context().is_null() || isolate->context().IsContext()); \
+    CLOBBER_DOUBLE_REGISTERS();                                             \
+    TEST_AND_CALL_RCS(Name)                                                 \
+    LEAF_RUNTIME_GUARDS(isolate)                                            \
+    RuntimeArguments args(args_length, args_object);                        \
+    return BUILTIN_CONVERT_RESULT(__RT_impl_##Name(args, isolate));         \
+  }                                                                         \
+                                                                            \
+  static Object __RT_impl_##Name(RuntimeArguments args, Isolate* isolate)
+
 }  // namespace internal
 }  // namespace v8
 
@@ -7,6 +7,7 @@
 #include <limits>
 
 #include "src/api/api-inl.h"
+#include "src/base/functional.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
 #include "src/execution/isolate.h"
@@ -38,6 +39,38 @@ class FutexWaitList {
     return static_cast<int8_t*>(backing_store->buffer_start()) + addr;
   }
 
+  struct HeadAndTail {
+    FutexWaitListNode* head;
+    FutexWaitListNode* tail;
+  };
+
+  // The wait locations are sharded by address hash, with a mutex per shard,
+  // so that waiters and wakers on unrelated locations don't serialize on a
+  // single process-wide lock.
+  struct Shard {
+    // `mutex` protects the composition of `location_lists` (i.e. no elements
+    // may be added or removed without holding it), as well as the `waiting_`
+    // field of the async nodes on those lists. Sync nodes guard `waiting_`
+    // and `interrupted_` with their own `mutex_`, which also pairs with
+    // their condition variable.
+    base::Mutex mutex;
+    // Location inside a shared buffer -> linked list of Nodes waiting on that
+    // location.
+    std::map<int8_t*, HeadAndTail> location_lists;
+  };
+
+  static constexpr size_t kShardCount = 64;
+
+  static size_t ShardIndex(int8_t* wait_location) {
+    uintptr_t addr = reinterpret_cast<uintptr_t>(wait_location);
+    // Wait locations are at least 4-byte aligned; drop the always-zero bits.
+    return base::hash_value(addr >> 2) & (kShardCount - 1);
+  }
+
+  Shard& GetShard(int8_t* wait_location) {
+    return shards_[ShardIndex(wait_location)];
+  }
+
   // Deletes "node" and returns the next node of its list.
   static FutexWaitListNode* DeleteAsyncWaiterNode(FutexWaitListNode* node) {
     DCHECK_NOT_NULL(node->isolate_for_async_waiters_);
@@ -74,8 +107,11 @@ class FutexWaitList {
     *tail = new_tail;
   }
 
-  // For checking the internal consistency of the FutexWaitList.
-  void Verify();
+  // For checking the internal consistency of a shard. The shard's mutex must
+  // be held.
+  void Verify(Shard& shard);
+  // Ditto for the promises-to-resolve lists; `promises_mutex_` must be held.
+  void VerifyPromises();
   // Verifies the local consistency of |node|. If it's the first node of its
   // list, it must be |head|, and if it's the last node, it must be |tail|.
   void VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
@@ -86,26 +122,18 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  struct HeadAndTail {
-    FutexWaitListNode* head;
-    FutexWaitListNode* tail;
-  };
-  // Location inside a shared buffer -> linked list of Nodes waiting on that
-  // location.
-  std::map<int8_t*, HeadAndTail> location_lists_;
+  Shard shards_[kShardCount];
 
+  // `promises_mutex_` protects `isolate_promises_to_resolve_`. Lock ordering:
+  // a shard mutex may be held when acquiring `promises_mutex_`, never the
+  // other way around.
+  base::Mutex promises_mutex_;
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
   std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
 };
 
 namespace {
-// `g_mutex` protects the composition of `g_wait_list` (i.e. no elements may be
-// added or removed without holding this mutex), as well as the `waiting_`
-// and `interrupted_` fields for each individual list node that is currently
-// part of the list. It must be the mutex used together with the `cond_`
-// condition variable of such nodes.
-base::LazyMutex g_mutex = LAZY_MUTEX_INITIALIZER;
 base::LazyInstance<FutexWaitList>::type g_wait_list = LAZY_INSTANCE_INITIALIZER;
 }  // namespace
 
@@ -125,12 +153,12 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
-  // will have been unlocked if we are currently waiting on the condition
-  // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
-  // locked it yet. In that case, we set the interrupted_
-  // flag to true, which will be tested after the mutex locked by a future wait.
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  // Lock the node's mutex before notifying. We know that the mutex will have
+  // been unlocked if we are currently waiting on the condition variable. The
+  // mutex will not be locked if FutexEmulation::Wait hasn't locked it yet. In
+  // that case, we set the interrupted_ flag to true, which will be tested
+  // after the mutex is locked by a future wait.
+  NoGarbageCollectionMutexGuard lock_guard(&mutex_);
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
@@ -166,20 +194,22 @@ class AsyncWaiterTimeoutTask : public CancelableTask {
 };
 
 void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
-  // This function can run in any thread.
-
-  g_mutex.Pointer()->AssertHeld();
+  // This function can run in any thread. The shard mutex of the node's wait
+  // location must be held.
+  auto wait_list = g_wait_list.Pointer();
+  wait_list->GetShard(node->wait_location_).mutex.AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
   // woken up ones.
   node->async_timeout_time_ = base::TimeTicks();
 
-  g_wait_list.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
 
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  NoGarbageCollectionMutexGuard promises_guard(&wait_list->promises_mutex_);
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->isolate_for_async_waiters_);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -194,14 +224,17 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
     it->second.tail->next_ = node;
     it->second.tail = node;
   }
+  wait_list->VerifyPromises();
 }
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  auto it = location_lists_.find(node->wait_location_);
-  if (it == location_lists_.end()) {
-    location_lists_.insert(
+  Shard& shard = GetShard(node->wait_location_);
+  shard.mutex.AssertHeld();
+  auto it = shard.location_lists.find(node->wait_location_);
+  if (it == shard.location_lists.end()) {
+    shard.location_lists.insert(
         std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
     it->second.tail->next_ = node;
@@ -209,12 +242,14 @@ void FutexWaitList::AddNode(FutexWaitListNode* node) {
     it->second.tail = node;
   }
 
-  Verify();
+  Verify(shard);
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  auto it = location_lists_.find(node->wait_location_);
-  DCHECK_NE(location_lists_.end(), it);
+  Shard& shard = GetShard(node->wait_location_);
+  shard.mutex.AssertHeld();
+  auto it = shard.location_lists.find(node->wait_location_);
+  DCHECK_NE(shard.location_lists.end(), it);
   DCHECK(NodeIsOnList(node, it->second.head));
 
   if (node->prev_) {
@@ -233,12 +268,12 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 
   // If the node was the last one on its list, delete the whole list.
   if (node->prev_ == nullptr && node->next_ == nullptr) {
-    location_lists_.erase(it);
+    shard.location_lists.erase(it);
   }
 
   node->prev_ = node->next_ = nullptr;
 
-  Verify();
+  Verify(shard);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
@@ -246,11 +281,12 @@ void AtomicsWaitWakeHandle::Wake() {
   // itself would likely just add unnecessary complexity..
   // The split lock by itself isn’t an issue, as long as the caller properly
   // synchronizes this with the closing `AtomicsWaitCallback`.
+  FutexWaitListNode* node = isolate_->futex_wait_list_node();
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    NoGarbageCollectionMutexGuard lock_guard(&node->mutex_);
     stopped_ = true;
   }
-  isolate_->futex_wait_list_node()->NotifyWake();
+  node->NotifyWake();
 }
 
 enum WaitReturnValue : int { kOk = 0, kNotEqual = 1, kTimedOut = 2 };
@@ -381,117 +417,135 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
   AtomicsWaitEvent callback_result = AtomicsWaitEvent::kWokenUp;
 
   do {  // Not really a loop, just makes it easier to break out early.
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
     DCHECK(backing_store);
     FutexWaitListNode* node = isolate->futex_wait_list_node();
-    node->backing_store_ = backing_store;
-    node->wait_addr_ = addr;
     auto wait_location =
         FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-    node->wait_location_ = wait_location;
-    node->waiting_ = true;
+    FutexWaitList::Shard& shard =
+        g_wait_list.Pointer()->GetShard(wait_location);
 
-    // Reset node->waiting_ = false when leaving this scope (but while
-    // still holding the lock).
-    FutexWaitListNode::ResetWaitingOnScopeExit reset_waiting(node);
+    base::TimeTicks timeout_time;
 
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
-    T loaded_value = p->load();
+    {
+      NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+
+      node->backing_store_ = backing_store;
+      node->wait_addr_ = addr;
+      node->wait_location_ = wait_location;
+
+      std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
+      T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
-    // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
-    if (call_type == CallType::kIsWasm) {
-      DCHECK(sizeof(T) == kInt32Size || sizeof(T) == kInt64Size);
-      loaded_value = ByteReverse(loaded_value);
-    }
+      // If loading a Wasm value, it needs to be reversed on Big Endian
+      // platforms.
+      if (call_type == CallType::kIsWasm) {
+        DCHECK(sizeof(T) == kInt32Size || sizeof(T) == kInt64Size);
+        loaded_value = ByteReverse(loaded_value);
+      }
 #endif
-    if (loaded_value != value) {
-      result = handle(Smi::FromInt(WaitReturnValue::kNotEqual), isolate);
-      callback_result = AtomicsWaitEvent::kNotEqual;
-      break;
-    }
+      if (loaded_value != value) {
+        result = handle(Smi::FromInt(WaitReturnValue::kNotEqual), isolate);
+        callback_result = AtomicsWaitEvent::kNotEqual;
+        break;
+      }
 
-    base::TimeTicks timeout_time;
-    base::TimeTicks current_time;
+      if (use_timeout) {
+        timeout_time = base::TimeTicks::Now() + rel_timeout;
+      }
 
-    if (use_timeout) {
-      current_time = base::TimeTicks::Now();
-      timeout_time = current_time + rel_timeout;
+      g_wait_list.Pointer()->AddNode(node);
+      // Mark the node as waiting while still holding the shard mutex, so that
+      // a Wake which found the node on the list cannot observe waiting_ ==
+      // false.
+      NoGarbageCollectionMutexGuard node_guard(&node->mutex_);
+      node->waiting_ = true;
     }
 
-    g_wait_list.Pointer()->AddNode(node);
-
-    while (true) {
-      bool interrupted = node->interrupted_;
-      node->interrupted_ = false;
-
-      // Unlock the mutex here to prevent deadlock from lock ordering between
-      // mutex and mutexes locked by HandleInterrupts.
-      lock_guard.Unlock();
-
-      // Because the mutex is unlocked, we have to be careful about not dropping
-      // an interrupt. The notification can happen in three different places:
-      // 1) Before Wait is called: the notification will be dropped, but
-      //    interrupted_ will be set to 1. This will be checked below.
-      // 2) After interrupted has been checked here, but before mutex is
-      //    acquired: interrupted is checked again below, with mutex locked.
-      //    Because the wakeup signal also acquires mutex, we know it will not
-      //    be able to notify until mutex is released below, when waiting on
-      //    the condition variable.
-      // 3) After the mutex is released in the call to WaitFor(): this
-      // notification will wake up the condition variable. node->waiting() will
-      // be false, so we'll loop and then check interrupts.
-      if (interrupted) {
-        Object interrupt_object = isolate->stack_guard()->HandleInterrupts();
-        if (interrupt_object.IsException(isolate)) {
-          result = handle(interrupt_object, isolate);
-          callback_result = AtomicsWaitEvent::kTerminatedExecution;
-          lock_guard.Lock();
-          break;
+    {
+      NoGarbageCollectionMutexGuard lock_guard(&node->mutex_);
+
+      while (true) {
+        bool interrupted = node->interrupted_;
+        node->interrupted_ = false;
+
+        // Unlock the mutex here to prevent deadlock from lock ordering between
+        // mutex and mutexes locked by HandleInterrupts.
+        lock_guard.Unlock();
+
+        // Because the mutex is unlocked, we have to be careful about not
+        // dropping an interrupt. The notification can happen in three
+        // different places:
+        // 1) Before Wait is called: the notification will be dropped, but
+        //    interrupted_ will be set to 1. This will be checked below.
+        // 2) After interrupted has been checked here, but before mutex is
+        //    acquired: interrupted is checked again below, with mutex locked.
+        //    Because the wakeup signal also acquires mutex, we know it will
+        //    not be able to notify until mutex is released below, when waiting
+        //    on the condition variable.
+        // 3) After the mutex is released in the call to WaitFor(): this
+        // notification will wake up the condition variable. node->waiting()
+        // will be false, so we'll loop and then check interrupts.
+        if (interrupted) {
+          Object interrupt_object = isolate->stack_guard()->HandleInterrupts();
+          if (interrupt_object.IsException(isolate)) {
+            result = handle(interrupt_object, isolate);
+            callback_result = AtomicsWaitEvent::kTerminatedExecution;
+            lock_guard.Lock();
+            node->waiting_ = false;
+            break;
+          }
         }
-      }
-
-      lock_guard.Lock();
 
-      if (node->interrupted_) {
-        // An interrupt occurred while the mutex was unlocked. Don't wait yet.
-        continue;
-      }
+        lock_guard.Lock();
 
-      if (stop_handle.has_stopped()) {
-        node->waiting_ = false;
-        callback_result = AtomicsWaitEvent::kAPIStopped;
-      }
+        if (node->interrupted_) {
+          // An interrupt occurred while the mutex was unlocked. Don't wait
+          // yet.
+          continue;
+        }
 
-      if (!node->waiting_) {
-        result = handle(Smi::FromInt(WaitReturnValue::kOk), isolate);
-        break;
-      }
+        if (stop_handle.has_stopped()) {
+          node->waiting_ = false;
+          callback_result = AtomicsWaitEvent::kAPIStopped;
+        }
 
-      // No interrupts, now wait.
-      if (use_timeout) {
-        current_time = base::TimeTicks::Now();
-        if (current_time >= timeout_time) {
-          result = handle(Smi::FromInt(WaitReturnValue::kTimedOut), isolate);
-          callback_result = AtomicsWaitEvent::kTimedOut;
+        if (!node->waiting_) {
+          result = handle(Smi::FromInt(WaitReturnValue::kOk), isolate);
           break;
         }
 
-        base::TimeDelta time_until_timeout = timeout_time - current_time;
-        DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
-        bool wait_for_result =
-            node->cond_.WaitFor(g_mutex.Pointer(), time_until_timeout);
-        USE(wait_for_result);
-      } else {
-        node->cond_.Wait(g_mutex.Pointer());
-      }
+        // No interrupts, now wait.
+        if (use_timeout) {
+          base::TimeTicks current_time = base::TimeTicks::Now();
+          if (current_time >= timeout_time) {
+            result = handle(Smi::FromInt(WaitReturnValue::kTimedOut), isolate);
+            callback_result = AtomicsWaitEvent::kTimedOut;
+            node->waiting_ = false;
+            break;
+          }
+
+          base::TimeDelta time_until_timeout = timeout_time - current_time;
+          DCHECK_GE(time_until_timeout.InMicroseconds(), 0);
+          bool wait_for_result =
+              node->cond_.WaitFor(&node->mutex_, time_until_timeout);
+          USE(wait_for_result);
+        } else {
+          node->cond_.Wait(&node->mutex_);
+        }
 
-      // Spurious wakeup, interrupt or timeout.
+        // Spurious wakeup, interrupt or timeout.
+      }
     }
 
-    g_wait_list.Pointer()->RemoveNode(node);
+    {
+      // The shard mutex is always acquired before the node's own mutex, so
+      // the node mutex must be released before removing the node from its
+      // list here.
+      NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+      g_wait_list.Pointer()->RemoveNode(node);
+    }
   } while (false);
 
   isolate->RunAtomicsWaitCallback(callback_result, array_buffer, addr, value,
@@ -543,15 +597,17 @@ Object FutexEmulation::WaitAsync(Isolate* isolate,
   enum class ResultKind { kNotEqual, kTimedOut, kAsync };
   ResultKind result_kind;
   {
-    // 16. Perform EnterCriticalSection(WL).
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
     std::shared_ptr<BackingStore> backing_store =
         array_buffer->GetBackingStore();
+    auto wait_location =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
+
+    // 16. Perform EnterCriticalSection(WL).
+    NoGarbageCollectionMutexGuard lock_guard(
+        &g_wait_list.Pointer()->GetShard(wait_location).mutex);
 
     // 17. Let w be ! AtomicLoad(typedArray, i).
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(wait_location);
     T loaded_value = p->load();
 #if defined(V8_TARGET_BIG_ENDIAN)
     // If loading a Wasm value, it needs to be reversed on Big Endian platforms.
@@ -659,11 +715,13 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  // Only the shard of the wait location is locked here; wakes on unrelated
+  // locations proceed in parallel on other shards.
+  FutexWaitList::Shard& shard = g_wait_list.Pointer()->GetShard(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
 
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
-  auto it = location_lists.find(wait_location);
-  if (it == location_lists.end()) {
+  auto it = shard.location_lists.find(wait_location);
+  if (it == shard.location_lists.end()) {
     return Smi::zero();
   }
   FutexWaitListNode* node = it->second.head;
@@ -672,7 +730,7 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     std::shared_ptr<BackingStore> node_backing_store =
         node->backing_store_.lock();
 
-    if (!node->waiting_) {
+    if (node->IsAsync() && !node->waiting_) {
       node = node->next_;
       continue;
     }
@@ -681,22 +739,33 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
     // a new BackingStore recreated in the same memory area.
     if (backing_store.get() == node_backing_store.get()) {
       DCHECK_EQ(addr, node->wait_addr_);
-      node->waiting_ = false;
 
-      // Retrieve the next node to iterate before calling NotifyAsyncWaiter,
+      // Retrieve the next node to iterate before waking the current one up,
       // since NotifyAsyncWaiter will take the node out of the linked list.
       auto old_node = node;
       node = node->next_;
+      bool woken = true;
       if (old_node->IsAsync()) {
+        old_node->waiting_ = false;
         NotifyAsyncWaiter(old_node);
       } else {
-        // WaitSync will remove the node from the list.
-        old_node->cond_.NotifyOne();
+        // Sync nodes guard `waiting_` and their condition variable with their
+        // own mutex. The node cannot leave WaitSync (and thus be reused or
+        // freed) until it has removed itself from the location list, which
+        // requires the shard mutex held here.
+        NoGarbageCollectionMutexGuard node_guard(&old_node->mutex_);
+        woken = old_node->waiting_;
+        if (woken) {
+          old_node->waiting_ = false;
+          old_node->cond_.NotifyOne();
+        }
       }
-      if (num_waiters_to_wake != kWakeAll) {
-        --num_waiters_to_wake;
+      if (woken) {
+        if (num_waiters_to_wake != kWakeAll) {
+          --num_waiters_to_wake;
+        }
+        waiters_woken++;
       }
-      waiters_woken++;
       continue;
     }
     DCHECK_EQ(nullptr, node_backing_store.get());
@@ -744,7 +813,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
 
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding g_mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any of
+  // the wait list mutexes.
 
   DCHECK(node->IsAsync());
 
@@ -818,11 +888,12 @@ void FutexEmulation::ResolveAsyncWaiterPromise(FutexWaitListNode* node) {
 void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   // This function must run in the main thread of isolate.
 
+  auto wait_list = g_wait_list.Pointer();
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
 
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -853,7 +924,10 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
 
   {
-    NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+    // An async node's wait location is set at construction time and never
+    // changes, so the right shard can be computed without a lock here.
+    NoGarbageCollectionMutexGuard lock_guard(
+        &g_wait_list.Pointer()->GetShard(node->wait_location_).mutex);
 
     node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
     if (!node->waiting_) {
@@ -874,31 +948,36 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  auto wait_list = g_wait_list.Pointer();
 
-  // Iterate all locations to find nodes belonging to "isolate" and delete them.
+  // Iterate all locations to find nodes belonging to "isolate" and delete
+  // them. The shards are locked one at a time; no node of "isolate" can be
+  // added concurrently since the Isolate is going away.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = g_wait_list.Pointer()->location_lists_;
-    auto it = location_lists.begin();
-    while (it != location_lists.end()) {
+  for (size_t i = 0; i < FutexWaitList::kShardCount; i++) {
+    FutexWaitList::Shard& shard = wait_list->shards_[i];
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    auto it = shard.location_lists.begin();
+    while (it != shard.location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
       FutexWaitListNode*& tail = it->second.tail;
       FutexWaitList::DeleteNodesForIsolate(isolate, &head, &tail);
       // head and tail are either both nullptr or both non-nullptr.
       DCHECK_EQ(head == nullptr, tail == nullptr);
       if (head == nullptr) {
-        location_lists.erase(it++);
+        shard.location_lists.erase(it++);
       } else {
         ++it;
       }
     }
+    wait_list->Verify(shard);
   }
 
   {
-    auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+    NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
+    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       auto node = it->second.head;
@@ -909,9 +988,8 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    wait_list->VerifyPromises();
   }
-
-  g_wait_list.Pointer()->Verify();
 }
 
 Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
@@ -919,12 +997,12 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   auto wait_location = FutexWaitList::ToWaitLocation(backing_store.get(), addr);
-  auto& location_lists = g_wait_list.Pointer()->location_lists_;
-  auto it = location_lists.find(wait_location);
-  if (it == location_lists.end()) {
+  FutexWaitList::Shard& shard = g_wait_list.Pointer()->GetShard(wait_location);
+  NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+
+  auto it = shard.location_lists.find(wait_location);
+  if (it == shard.location_lists.end()) {
     return Smi::zero();
   }
   int waiters = 0;
@@ -943,16 +1021,19 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
 }
 
 Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
-
   int waiters = 0;
-  for (const auto& it : g_wait_list.Pointer()->location_lists_) {
-    FutexWaitListNode* node = it.second.head;
-    while (node != nullptr) {
-      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-        waiters++;
+  auto wait_list = g_wait_list.Pointer();
+  for (size_t i = 0; i < FutexWaitList::kShardCount; i++) {
+    FutexWaitList::Shard& shard = wait_list->shards_[i];
+    NoGarbageCollectionMutexGuard lock_guard(&shard.mutex);
+    for (const auto& it : shard.location_lists) {
+      FutexWaitListNode* node = it.second.head;
+      while (node != nullptr) {
+        if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+          waiters++;
+        }
+        node = node->next_;
       }
-      node = node->next_;
     }
   }
 
@@ -964,10 +1045,11 @@ Object FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
   DCHECK_LT(addr, array_buffer->GetByteLength());
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
-  NoGarbageCollectionMutexGuard lock_guard(g_mutex.Pointer());
+  auto wait_list = g_wait_list.Pointer();
+  NoGarbageCollectionMutexGuard lock_guard(&wait_list->promises_mutex_);
 
   int waiters = 0;
-  auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
+  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
@@ -1009,16 +1091,23 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 #endif  // DEBUG
 }
 
-void FutexWaitList::Verify() {
+void FutexWaitList::Verify(Shard& shard) {
 #ifdef DEBUG
-  for (const auto& it : location_lists_) {
+  shard.mutex.AssertHeld();
+  for (const auto& it : shard.location_lists) {
     FutexWaitListNode* node = it.second.head;
     while (node != nullptr) {
       VerifyNode(node, it.second.head, it.second.tail);
+      DCHECK_EQ(&shard, &GetShard(node->wait_location_));
       node = node->next_;
     }
   }
+#endif  // DEBUG
+}
 
+void FutexWaitList::VerifyPromises() {
+#ifdef DEBUG
+  promises_mutex_.AssertHeld();
   for (const auto& it : isolate_promises_to_resolve_) {
     auto node = it.second.head;
     while (node != nullptr) {
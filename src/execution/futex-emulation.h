@@ -75,18 +75,8 @@ class FutexWaitListNode {
   // Returns false if the cancelling failed, true otherwise.
   bool CancelTimeoutTask();
 
-  class V8_NODISCARD ResetWaitingOnScopeExit {
-   public:
-    explicit ResetWaitingOnScopeExit(FutexWaitListNode* node) : node_(node) {}
-    ~ResetWaitingOnScopeExit() { node_->waiting_ = false; }
-    ResetWaitingOnScopeExit(const ResetWaitingOnScopeExit&) = delete;
-    ResetWaitingOnScopeExit& operator=(const ResetWaitingOnScopeExit&) = delete;
-
-   private:
-    FutexWaitListNode* node_;
-  };
-
  private:
+  friend class AtomicsWaitWakeHandle;
   friend class FutexEmulation;
   friend class FutexWaitList;
 
@@ -96,7 +86,12 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // For sync waiters, mutex_ pairs with cond_ and protects waiting_ and
+  // interrupted_. When both the mutex of the node's wait list shard and
+  // mutex_ are needed, the shard mutex must be acquired first.
+  base::Mutex mutex_;
+  // prev_ and next_ are protected by the mutex of the FutexWaitList shard the
+  // node is on.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -113,9 +108,11 @@ class FutexWaitListNode {
   // update the head and tail of the list).
   int8_t* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
-  // if this node is currently contained in FutexEmulation::wait_list_
-  // or an AtomicsWaitWakeHandle has access to it.
+  // For sync nodes, waiting_ and interrupted_ are protected by mutex_ if this
+  // node is currently contained in the FutexWaitList or an
+  // AtomicsWaitWakeHandle has access to it. For async nodes, waiting_ is
+  // protected by the mutex of the wait list shard the node is on, and
+  // interrupted_ is unused.
   bool waiting_ = false;
   bool interrupted_ = false;
 
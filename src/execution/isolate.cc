@@ -23,6 +23,7 @@
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/base/platform/wrappers.h"
 #include "src/base/sys-info.h"
 #include "src/base/utils/random-number-generator.h"
@@ -743,6 +744,22 @@ bool NoExtension(const v8::FunctionCallbackInfo<v8::Value>&) { return false; }
 
 namespace {
 
+// Layout of the compact frame records written by CallSiteBuilder when
+// --lazy-error-stack-frames is enabled. Each visited frame occupies
+// kCompactCallSiteSize consecutive slots in a flat FixedArray, holding the
+// raw inputs of Factory::NewCallSiteInfo; the CallSiteInfo objects
+// themselves are only materialized on first access via
+// Isolate::MaterializeCallSiteInfos. The flags slot comes first so that a
+// compact stack trace is recognizable by its leading Smi (materialized
+// stack traces hold only CallSiteInfo objects).
+constexpr int kCompactCallSiteFlagsIndex = 0;
+constexpr int kCompactCallSiteCodeOffsetIndex = 1;
+constexpr int kCompactCallSiteReceiverIndex = 2;
+constexpr int kCompactCallSiteFunctionIndex = 3;
+constexpr int kCompactCallSiteCodeIndex = 4;
+constexpr int kCompactCallSiteParametersIndex = 5;
+constexpr int kCompactCallSiteSize = 6;
+
 class CallSiteBuilder {
  public:
   CallSiteBuilder(Isolate* isolate, FrameSkipMode mode, int limit,
@@ -757,7 +774,8 @@ class CallSiteBuilder {
     // framework and library code, and stack depth tends to be more than
     // a dozen frames, so we over-allocate a bit here to avoid growing
     // the elements array in the common case.
-    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit));
+    elements_ = isolate->factory()->NewFixedArray(std::min(64, limit) *
+                                                  SlotsPerFrame());
   }
 
   bool Visit(FrameSummary const& summary) {
@@ -856,7 +874,8 @@ class CallSiteBuilder {
   bool Full() { return index_ >= limit_; }
 
   Handle<FixedArray> Build() {
-    return FixedArray::ShrinkOrEmpty(isolate_, elements_, index_);
+    return FixedArray::ShrinkOrEmpty(isolate_, elements_,
+                                     index_ * SlotsPerFrame());
   }
 
  private:
@@ -918,6 +937,10 @@ class CallSiteBuilder {
     return true;
   }
 
+  static int SlotsPerFrame() {
+    return v8_flags.lazy_error_stack_frames ? kCompactCallSiteSize : 1;
+  }
+
   void AppendFrame(Handle<Object> receiver_or_instance, Handle<Object> function,
                    Handle<HeapObject> code, int offset, int flags,
                    Handle<FixedArray> parameters) {
@@ -926,9 +949,28 @@ class CallSiteBuilder {
       // (e.g. the receiver in RegExp constructor frames).
       receiver_or_instance = isolate_->factory()->undefined_value();
     }
+    if (V8_LIKELY(v8_flags.lazy_error_stack_frames)) {
+      // Record only the raw inputs of the CallSiteInfo here; the objects
+      // are materialized on first access, which never happens for the
+      // many stack traces that are captured but never looked at.
+      int cursor = index_++ * kCompactCallSiteSize;
+      Set(cursor + kCompactCallSiteFlagsIndex,
+          handle(Smi::FromInt(flags), isolate_));
+      Set(cursor + kCompactCallSiteCodeOffsetIndex,
+          handle(Smi::FromInt(offset), isolate_));
+      Set(cursor + kCompactCallSiteReceiverIndex, receiver_or_instance);
+      Set(cursor + kCompactCallSiteFunctionIndex, function);
+      Set(cursor + kCompactCallSiteCodeIndex, code);
+      Set(cursor + kCompactCallSiteParametersIndex, parameters);
+      return;
+    }
     auto info = isolate_->factory()->NewCallSiteInfo(
         receiver_or_instance, function, code, offset, flags, parameters);
-    elements_ = FixedArray::SetAndGrow(isolate_, elements_, index_++, info);
+    Set(index_++, info);
+  }
+
+  void Set(int index, Handle<Object> value) {
+    elements_ = FixedArray::SetAndGrow(isolate_, elements_, index, value);
   }
 
   Isolate* isolate_;
@@ -1227,6 +1269,37 @@ Handle<FixedArray> CaptureSimpleStackTrace(Isolate* isolate, int limit,
 
 }  // namespace
 
+Handle<FixedArray> Isolate::MaterializeCallSiteInfos(
+    Handle<FixedArray> frames) {
+  // Compact stack traces start with the Smi-encoded flags of the first
+  // frame, whereas materialized ones hold only CallSiteInfo objects.
+  if (frames->length() == 0 || !frames->get(0).IsSmi()) return frames;
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"), __func__);
+  DCHECK_EQ(0, frames->length() % kCompactCallSiteSize);
+  int frame_count = frames->length() / kCompactCallSiteSize;
+  Handle<FixedArray> infos = factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    int cursor = i * kCompactCallSiteSize;
+    Handle<Object> receiver(frames->get(cursor + kCompactCallSiteReceiverIndex),
+                            this);
+    Handle<Object> function(frames->get(cursor + kCompactCallSiteFunctionIndex),
+                            this);
+    Handle<HeapObject> code(
+        HeapObject::cast(frames->get(cursor + kCompactCallSiteCodeIndex)),
+        this);
+    Handle<FixedArray> parameters(
+        FixedArray::cast(frames->get(cursor + kCompactCallSiteParametersIndex)),
+        this);
+    int offset =
+        Smi::ToInt(frames->get(cursor + kCompactCallSiteCodeOffsetIndex));
+    int flags = Smi::ToInt(frames->get(cursor + kCompactCallSiteFlagsIndex));
+    Handle<CallSiteInfo> info = factory()->NewCallSiteInfo(
+        receiver, function, code, offset, flags, parameters);
+    infos->set(i, *info);
+  }
+  return infos;
+}
+
 MaybeHandle<JSObject> Isolate::CaptureAndSetErrorStack(
     Handle<JSObject> error_object, FrameSkipMode mode, Handle<Object> caller) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.stack_trace"), __func__);
@@ -1313,7 +1386,7 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
   Handle<Object> error_stack = JSReceiver::GetDataProperty(
       this, error_object, factory()->error_stack_symbol());
   if (error_stack->IsFixedArray()) {
-    return Handle<FixedArray>::cast(error_stack);
+    return MaterializeCallSiteInfos(Handle<FixedArray>::cast(error_stack));
   }
   if (!error_stack->IsErrorStackData()) {
     return factory()->empty_fixed_array();
@@ -1323,7 +1396,12 @@ Handle<FixedArray> Isolate::GetSimpleStackTrace(
   if (!error_stack_data->HasCallSiteInfos()) {
     return factory()->empty_fixed_array();
   }
-  return handle(error_stack_data->call_site_infos(), this);
+  Handle<FixedArray> call_site_infos(error_stack_data->call_site_infos(), this);
+  Handle<FixedArray> materialized = MaterializeCallSiteInfos(call_site_infos);
+  if (!materialized.is_identical_to(call_site_infos)) {
+    error_stack_data->set_call_site_infos(*materialized);
+  }
+  return materialized;
 }
 
 Address Isolate::GetAbstractPC(int* line, int* column) {
@@ -1695,6 +1773,55 @@ void Isolate::InvokeApiInterruptCallbacks() {
 
 namespace {
 
+int64_t PreemptionClockNowMicros() {
+  // Prefer per-thread CPU time so that time the isolate spends parked does
+  // not count against its slice; fall back to wall-clock time on platforms
+  // without thread CPU clocks.
+  if (base::ThreadTicks::IsSupported()) {
+    return base::ThreadTicks::Now().ToInternalValue();
+  }
+  return base::TimeTicks::Now().ToInternalValue();
+}
+
+}  // namespace
+
+void Isolate::SetCpuTimeSlice(double slice_ms, InterruptCallback callback,
+                              void* data) {
+  const bool enabled = callback != nullptr && slice_ms > 0;
+  preemption_slice_us_ =
+      enabled ? static_cast<int64_t>(
+                    slice_ms * base::Time::kMicrosecondsPerMillisecond)
+              : 0;
+  preemption_callback_ = enabled ? callback : nullptr;
+  preemption_callback_data_ = data;
+  preemption_slice_start_us_ = PreemptionClockNowMicros();
+}
+
+void Isolate::MaybeRequestPreemption() {
+  if (preemption_slice_us_ == 0) return;
+  if (PreemptionClockNowMicros() - preemption_slice_start_us_ <
+      preemption_slice_us_) {
+    return;
+  }
+  stack_guard()->RequestPreempt();
+}
+
+void Isolate::InvokePreemptionCallback() {
+  InterruptCallback callback = preemption_callback_;
+  if (callback == nullptr) return;
+  {
+    // The callback may block until the scheduler grants this isolate a new
+    // slice; script state is fully preserved while parked.
+    VMState<EXTERNAL> state(this);
+    HandleScope handle_scope(this);
+    callback(reinterpret_cast<v8::Isolate*>(this), preemption_callback_data_);
+  }
+  // A new slice starts when the callback returns.
+  preemption_slice_start_us_ = PreemptionClockNowMicros();
+}
+
+namespace {
+
 void ReportBootstrappingException(Handle<Object> exception,
                                   MessageLocation* location) {
   base::OS::PrintError("Exception thrown during bootstrapping\n");
@@ -2472,8 +2599,8 @@ Object Isolate::PromoteScheduledException() {
 }
 
 void Isolate::PrintCurrentStackTrace(std::ostream& out) {
-  Handle<FixedArray> frames = CaptureSimpleStackTrace(
-      this, FixedArray::kMaxLength, SKIP_NONE, factory()->undefined_value());
+  Handle<FixedArray> frames = MaterializeCallSiteInfos(CaptureSimpleStackTrace(
+      this, FixedArray::kMaxLength, SKIP_NONE, factory()->undefined_value()));
 
   IncrementalStringBuilder builder(this);
   for (int i = 0; i < frames->length(); ++i) {
@@ -3536,6 +3663,24 @@ void Isolate::ClearSerializerData() {
   external_reference_map_ = nullptr;
 }
 
+void Isolate::ResetForReuse() {
+  // The embedder guarantees that no context is entered; contexts it has
+  // released its handles to become unreachable and are dropped by the GC
+  // below.
+  DCHECK(context().is_null());
+  // Drop optimization work and ICs that keep maps and code of dropped
+  // contexts alive.
+  AbortConcurrentOptimization(BlockingBehavior::kBlock);
+  load_stub_cache()->Clear();
+  store_stub_cache()->Clear();
+  descriptor_lookup_cache()->Clear();
+  // This clears the compilation cache and runs memory-reducing full GCs
+  // until no further memory is reclaimed, shrinking committed space back
+  // towards the post-deserialization footprint. The regexp result caches
+  // and the number-string cache are flushed in the mark-compact prologue.
+  heap()->CollectAllAvailableGarbage(GarbageCollectionReason::kIsolateReset);
+}
+
 // When profiling status changes, call this function to update the single bool
 // cache.
 void Isolate::UpdateLogObjectRelocation() {
@@ -3613,6 +3758,10 @@ void Isolate::Deinit() {
     cancelable_task_manager()->CancelAndWait();
   }
 
+  // The prep task has finished or was canceled at this point.
+  delete context_snapshot_prep();
+  set_context_snapshot_prep(nullptr);
+
   // Cancel all compiler tasks.
   delete baseline_batch_compiler_;
   baseline_batch_compiler_ = nullptr;
@@ -3676,6 +3825,12 @@ void Isolate::Deinit() {
 
   heap_.TearDown();
 
+  // The backing store pool may hold memory of this isolate's allocator; the
+  // embedder is free to delete the allocator once the isolate is disposed.
+  if (v8_flags.backing_store_pool && array_buffer_allocator() != nullptr) {
+    BackingStorePool::Get()->ReleaseForAllocator(array_buffer_allocator());
+  }
+
   delete inner_pointer_to_code_cache_;
   inner_pointer_to_code_cache_ = nullptr;
 
@@ -3759,6 +3914,9 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete negative_lookup_cache_;
+  negative_lookup_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -4180,6 +4338,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  negative_lookup_cache_ = new NegativeLookupCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
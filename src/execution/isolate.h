@@ -109,6 +109,7 @@ class CodeTracer;
 class CommonFrame;
 class CompilationCache;
 class CompilationStatistics;
+class ContextSnapshotPrep;
 class Counters;
 class Debug;
 class Deoptimizer;
@@ -127,6 +128,7 @@ class V8FileLogger;
 class MaterializedObjectStore;
 class Microtask;
 class MicrotaskQueue;
+class NegativeLookupCache;
 class OptimizingCompileDispatcher;
 class PersistentHandles;
 class PersistentHandlesList;
@@ -520,6 +522,8 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(CodeTracer*, code_tracer, nullptr)                                        \
   V(PromiseRejectCallback, promise_reject_callback, nullptr)                  \
   V(const v8::StartupData*, snapshot_blob, nullptr)                           \
+  /* Worker-thread context snapshot preparation, see ContextSnapshotPrep. */  \
+  V(ContextSnapshotPrep*, context_snapshot_prep, nullptr)                     \
   V(int, code_and_metadata_size, 0)                                           \
   V(int, bytecode_and_metadata_size, 0)                                       \
   V(int, external_script_source_size, 0)                                      \
@@ -684,6 +688,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void ClearSerializerData();
 
+  // Returns the isolate to a state close to the one right after snapshot
+  // deserialization so that embedders can reuse it instead of paying for
+  // Dispose() plus New(). The caller guarantees that no context is entered.
+  // Backs v8::Isolate::Reset().
+  void ResetForReuse();
+
   void UpdateLogObjectRelocation();
 
   // Initializes the current thread to run this Isolate.
@@ -955,6 +965,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
                                                 Handle<Object> caller);
   Handle<FixedArray> GetDetailedStackTrace(Handle<JSReceiver> error_object);
   Handle<FixedArray> GetSimpleStackTrace(Handle<JSReceiver> error_object);
+  // Turns a compact stack trace as captured by CaptureAndSetErrorStack
+  // with --lazy-error-stack-frames into an array of CallSiteInfo objects.
+  // Returns |frames| unchanged if it is already materialized.
+  Handle<FixedArray> MaterializeCallSiteInfos(Handle<FixedArray> frames);
   // Walks the JS stack to find the first frame with a script name or
   // source URL. The inspected frames are the same as for the detailed stack
   // trace.
@@ -1074,6 +1088,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void RequestInterrupt(InterruptCallback callback, void* data);
   void InvokeApiInterruptCallbacks();
 
+  // Cooperative preemption, see v8::Isolate::SetCpuTimeSliceBudget. Once the
+  // isolate has consumed the configured CPU slice, the callback is invoked at
+  // the next interrupt check and may block in order to park the isolate; a
+  // new slice starts when it returns.
+  void SetCpuTimeSlice(double slice_ms, InterruptCallback callback,
+                       void* data);
+  void MaybeRequestPreemption();
+  void InvokePreemptionCallback();
+
   // Administration
   void Iterate(RootVisitor* v);
   void Iterate(RootVisitor* v, ThreadLocalTop* t);
@@ -1287,6 +1310,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  NegativeLookupCache* negative_lookup_cache() const {
+    return negative_lookup_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() const {
@@ -2225,6 +2252,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  NegativeLookupCache* negative_lookup_cache_ = nullptr;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
@@ -2365,6 +2393,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   using InterruptEntry = std::pair<InterruptCallback, void*>;
   std::queue<InterruptEntry> api_interrupts_queue_;
 
+  // Cooperative preemption state, see SetCpuTimeSlice. Only accessed from the
+  // thread running the isolate.
+  InterruptCallback preemption_callback_ = nullptr;
+  void* preemption_callback_data_ = nullptr;
+  int64_t preemption_slice_us_ = 0;
+  int64_t preemption_slice_start_us_ = 0;
+
 #define GLOBAL_BACKING_STORE(type, name, initialvalue) type name##_;
   ISOLATE_INIT_LIST(GLOBAL_BACKING_STORE)
 #undef GLOBAL_BACKING_STORE
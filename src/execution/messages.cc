@@ -1021,12 +1021,12 @@ MaybeHandle<Object> ErrorUtils::GetFormattedStack(
   }
 
   if (error_stack->IsFixedArray()) {
+    Handle<FixedArray> call_site_infos = isolate->MaterializeCallSiteInfos(
+        Handle<FixedArray>::cast(error_stack));
     Handle<Object> formatted_stack;
     ASSIGN_RETURN_ON_EXCEPTION(
         isolate, formatted_stack,
-        FormatStackTrace(isolate, error_object,
-                         Handle<FixedArray>::cast(error_stack)),
-        Object);
+        FormatStackTrace(isolate, error_object, call_site_infos), Object);
     RETURN_ON_EXCEPTION(
         isolate,
         JSObject::SetProperty(isolate, error_object,
@@ -325,7 +325,8 @@ Object StackGuard::HandleInterrupts() {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.InstallOptimizedFunctions");
     DCHECK(isolate_->concurrent_recompilation_enabled());
-    isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions();
+    isolate_->optimizing_compile_dispatcher()->InstallOptimizedFunctions(
+        OptimizingCompileDispatcher::InstallMode::kBounded);
   }
 
   if (TestAndClear(&interrupt_flags, INSTALL_BASELINE_CODE)) {
@@ -348,6 +349,13 @@ Object StackGuard::HandleInterrupts() {
     isolate_->InvokeApiInterruptCallbacks();
   }
 
+  if (TestAndClear(&interrupt_flags, PREEMPT)) {
+    TRACE_EVENT0("v8.execute", "V8.InvokePreemptionCallback");
+    // The callback may block to park the isolate and must be invoked outside
+    // of ExecutionAccess lock.
+    isolate_->InvokePreemptionCallback();
+  }
+
   isolate_->counters()->stack_interrupts()->Increment();
 
   return ReadOnlyRoots(isolate_).undefined_value();
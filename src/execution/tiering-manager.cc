@@ -167,12 +167,27 @@ int InterruptBudgetFor(base::Optional<CodeKind> code_kind,
 // static
 int TieringManager::InterruptBudgetFor(Isolate* isolate, JSFunction function) {
   if (function.has_feedback_vector()) {
+    if (V8_UNLIKELY(v8_flags.maglev_tiering_hints) &&
+        TiersUpToMaglev(function.GetActiveTier()) &&
+        function.tiering_state() == TieringState::kNone &&
+        function.shared().maglev_compiled_before()) {
+      // The function had Maglev code in a previous isolate; skip most of the
+      // warm-up before re-tiering.
+      return v8_flags.interrupt_budget_for_hinted_maglev;
+    }
     return ::i::InterruptBudgetFor(function.GetActiveTier(),
                                    function.tiering_state());
   }
 
   DCHECK(!function.has_feedback_vector());
   DCHECK(function.shared().is_compiled());
+  if (V8_UNLIKELY(v8_flags.turbofan_tiering_hints) &&
+      function.shared().turbofan_compiled_before()) {
+    // A tiering hint is waiting on the feedback vector; allocate it after the
+    // smallest budget we'd use anywhere instead of scaling with bytecode
+    // size, so hinted functions get their first real tick almost immediately.
+    return v8_flags.interrupt_budget_for_feedback_allocation;
+  }
   return function.shared().GetBytecodeArray(isolate).length() *
          v8_flags.interrupt_budget_factor_for_feedback_allocation;
 }
@@ -291,6 +306,21 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
   if (V8_UNLIKELY(v8_flags.always_osr)) {
     TryRequestOsrAtNextOpportunity(isolate_, function);
     // Continue below and do a normal optimized compile as well.
+  } else if (V8_UNLIKELY(v8_flags.eager_osr) &&
+             CodeKindIsUnoptimizedJSFunction(calling_code_kind) &&
+             function.feedback_vector().profiler_ticks() >=
+                 v8_flags.eager_osr_ticks &&
+             !IsRequestTurbofan(tiering_state) &&
+             !function.HasAvailableCodeKind(CodeKind::TURBOFAN) &&
+             SmallEnoughForOSR(isolate_, function, calling_code_kind)) {
+    // Interrupt ticks from an unoptimized frame at this point mostly come
+    // from loop back edges, so don't wait for the regular tier-up decision:
+    // start the (concurrent) OSR compile right away. The loop pays nothing
+    // extra while the compile runs since the OSR request resets the urgency,
+    // and re-enters through the JumpLoop osr_state check once the finished
+    // code is installed in the OSR cache.
+    TryRequestOsrAtNextOpportunity(isolate_, function);
+    // Continue below and do a normal optimized compile as well.
   }
 
   // Baseline OSR uses a separate mechanism and must not be considered here,
@@ -332,6 +362,16 @@ void TieringManager::MaybeOptimizeFrame(JSFunction function,
 
 OptimizationDecision TieringManager::ShouldOptimize(
     JSFunction function, CodeKind calling_code_kind) {
+  if (V8_UNLIKELY(v8_flags.turbofan_tiering_hints) &&
+      calling_code_kind != CodeKind::TURBOFAN && v8_flags.turbofan &&
+      function.shared().turbofan_compiled_before() &&
+      function.shared().PassesFilter(v8_flags.turbo_filter)) {
+    // The function had Turbofan code in a previous isolate (the bit travels
+    // with the SharedFunctionInfo through the code cache and snapshots).
+    // Skip the warm-up, including any intermediate Maglev tier, and request
+    // the top tier right away.
+    return OptimizationDecision::TurbofanHotAndStable();
+  }
   if (TiersUpToMaglev(calling_code_kind) &&
       function.shared().PassesFilter(v8_flags.maglev_filter) &&
       !function.shared(isolate_).maglev_compilation_failed()) {
@@ -557,6 +557,9 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(pretenuring_prediction_cache, true,
+            "seed literal allocation sites with pretenuring decisions learned "
+            "in earlier isolates of this process")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -598,10 +601,19 @@ DEFINE_INT(interrupt_budget_factor_for_feedback_allocation, 8,
 // overall budget (including the multiple required ticks).
 DEFINE_INT(interrupt_budget_for_maglev, 7 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_BOOL(maglev_tiering_hints, false,
+            "tier up to maglev earlier for functions that the code cache "
+            "marks as having had maglev code in a previous isolate")
+DEFINE_INT(interrupt_budget_for_hinted_maglev, KB,
+           "interrupt budget for functions with a code-cache maglev hint")
 
 // Tiering: Turbofan.
 DEFINE_INT(interrupt_budget, 66 * KB,
            "interrupt budget which should be used for the profiler counter")
+DEFINE_BOOL(turbofan_tiering_hints, false,
+            "request turbofan on the first tick for functions that a code "
+            "cache or snapshot marks as having had turbofan code in a "
+            "previous isolate")
 DEFINE_INT(ticks_before_optimization, 3,
            "the number of times we have to go through the interrupt budget "
            "before considering this function for optimization")
@@ -619,12 +631,21 @@ DEFINE_BOOL(lazy_feedback_allocation, true, "Allocate feedback vectors lazily")
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
+DEFINE_BOOL(ignition_branch_bias, true,
+            "record approximate taken/not-taken counters in conditional jump "
+            "bytecode handlers and use them as branch hints when optimizing "
+            "(the recording side is baked into the snapshot)")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_reo_across_jumps, false,
+            "keep register equivalences on the fall-through path of jump "
+            "bytecodes instead of flushing them")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(ignition_share_constant_pools, true,
+            "share identical constant pools between functions of one script")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
@@ -746,6 +767,10 @@ DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
+DEFINE_INT(concurrent_recompilation_install_limit, 8,
+           "maximum number of finished concurrent recompilation jobs to "
+           "install per stack guard interrupt; remaining jobs are deferred "
+           "to the next interrupt (0 installs everything at once)")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -875,6 +900,12 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(concurrent_osr, true, "enable concurrent OSR")
 DEFINE_WEAK_IMPLICATION(future, concurrent_osr)
+DEFINE_BOOL(eager_osr, false,
+            "request OSR from long-running loops after only a few interrupt "
+            "ticks instead of waiting for the regular tier-up decision")
+DEFINE_INT(eager_osr_ticks, 1,
+           "number of profiler ticks before OSR is requested eagerly "
+           "(requires --eager-osr)")
 
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
 DEFINE_BOOL(log_or_trace_osr, false,
@@ -894,6 +925,10 @@ DEFINE_BOOL(turbo_profiling_verbose, false,
             "enable basic block profiling in TurboFan, and include each "
             "function's schedule and disassembly in the output")
 DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
+DEFINE_BOOL(turbo_profiling_feedback, false,
+            "use basic block counters collected from earlier compilations of "
+            "a function as branch hints for its block layout")
+DEFINE_IMPLICATION(turbo_profiling_feedback, turbo_profiling)
 DEFINE_STRING(
     turbo_profiling_output, nullptr,
     "emit data about basic block usage in builtins to this file "
@@ -907,6 +942,9 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
+DEFINE_BOOL(turbo_loop_full_unrolling, false,
+            "fully unroll small counted loops in TurboFan by repeated peeling "
+            "(experimental)")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
@@ -941,6 +979,8 @@ DEFINE_BOOL(turbo_compress_translation_arrays, false,
 DEFINE_BOOL_READONLY(turbo_compress_translation_arrays, false,
                      "compress translation arrays (experimental)")
 #endif  // V8_USE_ZLIB
+DEFINE_BOOL(turbo_dedupe_deopt_exits, true,
+            "share identical eager deoptimization exits in optimized code")
 DEFINE_BOOL(turbo_inline_js_wasm_calls, true, "inline JS->Wasm calls")
 DEFINE_BOOL(turbo_use_mid_tier_regalloc_for_huge_functions, true,
             "fall back to the mid-tier register allocator for huge functions")
@@ -1154,6 +1194,8 @@ DEFINE_BOOL(wasm_loop_unrolling, true,
             "enable loop unrolling for wasm functions")
 DEFINE_BOOL(wasm_loop_peeling, false, "enable loop peeling for wasm functions")
 DEFINE_SIZE_T(wasm_loop_peeling_max_size, 1000, "maximum size for peeling")
+DEFINE_BOOL(wasm_loop_vectorization, false,
+            "enable vectorization of simple wasm memory loops (experimental)")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
             "generate a test case when running a wasm fuzzer")
 DEFINE_IMPLICATION(wasm_fuzzer_gen_test, single_threaded)
@@ -1215,6 +1257,10 @@ DEFINE_INT(stress_sampling_allocation_profiler, 0,
 // Garbage collections flags.
 DEFINE_BOOL(lazy_new_space_shrinking, false,
             "Enables the lazy new space shrinking strategy")
+DEFINE_BOOL(committed_page_pool, false,
+            "Keep pooled pages committed so that paged-space expansion can "
+            "reuse them without a page-commit syscall, trading resident "
+            "memory between allocation bursts")
 DEFINE_SIZE_T(min_semi_space_size, 0,
               "min size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
@@ -1222,6 +1268,9 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_BOOL(adaptive_new_space, false,
+            "resize new space based on allocation throughput, with hysteresis "
+            "against shrinking during short idle phases")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -1299,6 +1348,12 @@ DEFINE_BOOL(trace_fragmentation_verbose, false,
 DEFINE_BOOL(minor_mc_trace_fragmentation, false,
             "trace fragmentation after marking")
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
+DEFINE_BOOL(gc_pause_breakdown, false,
+            "attribute GC pause time to root-set categories and evacuated "
+            "spaces and report the breakdown through the metrics recorder")
+DEFINE_BOOL(marking_type_stats, false,
+            "count live bytes and objects per instance type while marking and "
+            "report the histogram through the metrics recorder on full GCs")
 DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
@@ -1315,6 +1370,11 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_INT(minor_mc_task_trigger, 80,
            "minormc task trigger in percent of the current heap limit")
+DEFINE_UINT(minor_mc_max_pause, 0,
+            "target maximum pause for minor mark-compact GCs in milliseconds; "
+            "caps the young generation size and starts concurrent marking "
+            "early enough to keep the atomic pause below the target (0 "
+            "disables the pause target)")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
 DEFINE_INT(scavenge_task_trigger, 80,
@@ -1335,6 +1395,9 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
 DEFINE_INT(
     concurrent_marking_max_worker_num, 7,
     "max worker number of concurrent marking, 0 for NumberOfWorkerThreads")
+DEFINE_BOOL(concurrent_marking_early_publish, true,
+            "publish partial marking worklist segments from the write barrier "
+            "when concurrent markers run out of work")
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
 DEFINE_BOOL(stress_concurrent_allocation, false,
@@ -1349,6 +1412,8 @@ DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
+DEFINE_BOOL(parallel_weak_ref_clearing, true,
+            "use parallel threads to clear weak refs in the atomic pause")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -1405,11 +1470,17 @@ DEFINE_BOOL_READONLY(verify_heap, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_INT(finalization_registry_cleanup_budget, 4096,
+           "maximum number of FinalizationRegistry cells drained per cleanup "
+           "task through a native cleanup function (0 for unlimited)")
 DEFINE_BOOL(memory_reducer_for_small_heaps, true,
             "use memory reducer for small heaps")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(huge_code_range, false,
+            "advise the OS to back the code range with transparent huge "
+            "pages to reduce iTLB pressure (Linux only, best effort)")
 DEFINE_BOOL(allocation_buffer_parking, true, "allocation buffer parking")
 DEFINE_BOOL(compact, true,
             "Perform compaction on full GCs based on V8's default heuristics")
@@ -1417,6 +1488,13 @@ DEFINE_BOOL(compact_code_space, true,
             "Perform code space compaction on full collections.")
 DEFINE_BOOL(compact_on_every_full_gc, false,
             "Perform compaction on every full GC")
+DEFINE_INT(compact_target_fragmentation_percent, 0,
+           "override the target fragmentation percent used to select "
+           "evacuation candidates; 0 means use the built-in heuristics")
+DEFINE_INT(compaction_time_budget_ms, 0,
+           "bound the bytes evacuated during the atomic pause by the traced "
+           "compaction speed times this budget instead of the fixed byte "
+           "quota; 0 means use the fixed quota")
 DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_BOOL(
@@ -1435,6 +1513,11 @@ DEFINE_BOOL(flush_bytecode, true,
 DEFINE_INT(bytecode_old_age, 5, "number of gcs before we flush code")
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
+DEFINE_BOOL(background_recompile_flushed_bytecode, false,
+            "recompile flushed bytecode on the compiler dispatcher when the "
+            "function is likely to be re-invoked")
+DEFINE_IMPLICATION(background_recompile_flushed_bytecode,
+                   lazy_compile_dispatcher)
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -1641,6 +1724,8 @@ DEFINE_BOOL(lazy, true, "use lazy compilation")
 DEFINE_BOOL(lazy_eval, true, "use lazy compilation during eval")
 DEFINE_BOOL(lazy_streaming, true,
             "use lazy compilation during streaming compilation")
+DEFINE_BOOL(shared_preparse_data, true,
+            "share preparse data for identical function sources process-wide")
 DEFINE_BOOL(max_lazy, false, "ignore eager compilation hints")
 DEFINE_IMPLICATION(max_lazy, lazy)
 DEFINE_BOOL(trace_opt, false, "trace optimized compilation")
@@ -1669,6 +1754,9 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_BOOL(relaxed_eval_cache, false,
+            "share eval compilation cache entries across call sites for evals "
+            "that parse at global scope")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1679,7 +1767,7 @@ DEFINE_UINT(lazy_compile_dispatcher_max_threads, 0,
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 DEFINE_BOOL(
-    parallel_compile_tasks_for_eager_toplevel, false,
+    parallel_compile_tasks_for_eager_toplevel, true,
     "spawn parallel compile tasks for eagerly compiled, top-level functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_eager_toplevel,
                    lazy_compile_dispatcher)
@@ -1739,6 +1827,9 @@ DEFINE_BOOL(heap_profiler_use_embedder_graph, true,
             "Use the new EmbedderGraph API to get embedder nodes")
 DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
+DEFINE_UINT(heap_snapshot_slice_budget_ms, 0,
+            "report progress to the embedder at least every N ms while taking "
+            "a heap snapshot (0 reports every 10000 objects instead)")
 DEFINE_BOOL(heap_profiler_show_hidden_objects, false,
             "use 'native' rather than 'hidden' node type in snapshot")
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
@@ -1824,6 +1915,9 @@ DEFINE_BOOL(sim_abort_on_bad_auth, true,
 // isolate.cc
 DEFINE_BOOL(async_stack_traces, true,
             "include async stack traces in Error.stack")
+DEFINE_BOOL(lazy_error_stack_frames, true,
+            "capture Error stack traces as compact frame records and "
+            "materialize CallSiteInfo objects on first access")
 DEFINE_BOOL(stack_trace_on_illegal, false,
             "print stack trace when an illegal exception is thrown")
 DEFINE_BOOL(abort_on_uncaught_exception, false,
@@ -1888,6 +1982,32 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(serialize_ic_feedback, false,
+            "Retain portable monomorphic IC feedback (a map serialized into "
+            "the same snapshot plus a Smi-encoded handler) when serializing "
+            "a context, so that isolates deserialized from a warmed snapshot "
+            "start with prewarmed inline caches.")
+DEFINE_BOOL(shared_code_cache, false,
+            "Process-wide in-memory code cache: scripts compiled by one "
+            "isolate are serialized into a shared table keyed by source hash "
+            "and deserialized by other isolates instead of recompiling.")
+DEFINE_BOOL(concurrent_context_snapshot_prep, false,
+            "Decompress context snapshot sections on a worker thread during "
+            "isolate initialization so that context creation does not pay "
+            "decompression latency. Only effective for compressed snapshots.")
+DEFINE_BOOL(prefault_snapshot, false,
+            "Prefault the snapshot blob's pages on a worker thread during "
+            "isolate deserialization so that page-fault latency overlaps with "
+            "deserialization work instead of stalling it.")
+DEFINE_BOOL(page_aligned_snapshot, false,
+            "Align the read-only, shared heap and context sections of the "
+            "snapshot blob to OS page boundaries so that an mmapped blob "
+            "file can be shared copy-on-write across processes.")
+DEFINE_BOOL(mergeable_snapshot_pages, false,
+            "Advise the OS that non-executable heap pages deserialized from "
+            "the snapshot may be deduplicated with identical pages of other "
+            "isolates and shared copy-on-write until written. Requires OS "
+            "support (Linux kernel samepage merging).")
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
@@ -1903,6 +2023,9 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_bytecode_cache, true,
+            "reuse compiled regexp bytecode and tier-up decisions across "
+            "isolates, keyed on pattern and flags")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1980,6 +2103,11 @@ DEFINE_BOOL(target_is_simulator, false,
 DEFINE_STRING(turbo_profiling_input, nullptr,
               "Path of the input file containing basic block counters for "
               "builtins. (mksnapshot only)")
+DEFINE_STRING(builtins_ordering_file, nullptr,
+              "Path of a file with one builtin name per line, e.g. derived "
+              "from production profiles. Embedded builtins are laid out in "
+              "this order; unlisted builtins and bytecode handlers follow in "
+              "default order. (mksnapshot only)")
 
 // On some platforms, the .text section only has execute permissions.
 DEFINE_BOOL(text_is_readable, true,
@@ -2013,6 +2141,9 @@ DEFINE_BOOL(use_external_strings, false, "Use external strings for source code")
 DEFINE_STRING(map_counters, "", "Map counters to a file")
 DEFINE_BOOL(mock_arraybuffer_allocator, false,
             "Use a mock ArrayBuffer allocator for testing.")
+DEFINE_BOOL(backing_store_pool, false,
+            "Pool freed array buffer backing memory for reuse, discarding the "
+            "underlying pages while pooled.")
 DEFINE_SIZE_T(mock_arraybuffer_allocator_limit, 0,
               "Memory limit for mock ArrayBuffer allocator used to simulate "
               "OOM for testing.")
@@ -2162,6 +2293,9 @@ DEFINE_IMPLICATION(prof, prof_cpp)
 DEFINE_IMPLICATION(prof, log_code)
 
 DEFINE_BOOL(ll_prof, false, "Enable low-level linux profiler.")
+DEFINE_BOOL(ring_prof, false,
+            "Log code events as binary records to a lock-free ring buffer "
+            "drained by a background thread (see tools/ring-prof-to-log.py).")
 
 #if V8_OS_LINUX
 #define DEFINE_PERF_PROF_BOOL(nam, cmt) DEFINE_BOOL(nam, false, cmt)
@@ -2332,6 +2466,7 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_weak_ref_clearing)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_array_buffer_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, stress_concurrent_allocation)
@@ -2342,6 +2477,8 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, cppheap_concurrent_marking)
 // TODO(v8:11525): Remove this flag once proper embedder integration is done.
 DEFINE_BOOL(experimental_web_snapshots, false, "enable Web Snapshots")
 DEFINE_NEG_IMPLICATION(experimental_web_snapshots, script_streaming)
+DEFINE_BOOL(web_snapshot_lazy_exports, false,
+            "defer web snapshot materialization until an export is accessed")
 
 #undef FLAG
 
@@ -8,10 +8,13 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <map>
+#include <memory>
 
 #include "include/v8-traced-handle.h"
 #include "src/api/api-inl.h"
+#include "src/base/bits.h"
 #include "src/base/compiler-specific.h"
 #include "src/base/logging.h"
 #include "src/base/sanitizer/asan.h"
@@ -87,6 +90,28 @@ class GlobalHandles::NodeBlock final {
   NodeBlock* next() const { return next_; }
   NodeBlock* next_used() const { return next_used_; }
 
+  // Young bitmap: bit i is set iff nodes_[i] is tracked in the young list.
+  // Minor GC iterates the bitmap words of blocks on the young block list
+  // instead of touching individual nodes.
+  static constexpr size_t kBitsPerYoungWord = 64;
+  static constexpr size_t kYoungWords = kBlockSize / kBitsPerYoungWord;
+
+  // Sets the young bit for the node at |index|. Returns true if the block
+  // previously contained no young nodes and thus needs to be added to the
+  // young block list.
+  V8_INLINE bool SetYoungBit(size_t index);
+  bool HasYoungBit(size_t index) const {
+    return (young_bits_[index / kBitsPerYoungWord] >>
+            (index % kBitsPerYoungWord)) &
+           1;
+  }
+  uint64_t young_bits(size_t word) const { return young_bits_[word]; }
+  void set_young_bits(size_t word, uint64_t bits) { young_bits_[word] = bits; }
+  void ClearYoungBits() { memset(young_bits_, 0, sizeof(young_bits_)); }
+
+  NodeBlock* next_young() const { return next_young_; }
+  void set_next_young(NodeBlock* block) { next_young_ = block; }
+
   const void* begin_address() const { return nodes_; }
   const void* end_address() const { return &nodes_[kBlockSize]; }
 
@@ -97,6 +122,8 @@ class GlobalHandles::NodeBlock final {
   GlobalHandles::NodeSpace<NodeType>* const space_;
   NodeBlock* next_used_ = nullptr;
   NodeBlock* prev_used_ = nullptr;
+  NodeBlock* next_young_ = nullptr;
+  uint64_t young_bits_[kYoungWords] = {0};
   uint32_t used_nodes_ = 0;
 };
 
@@ -118,6 +145,21 @@ GlobalHandles::NodeBlock<NodeType>* GlobalHandles::NodeBlock<NodeType>::From(
   return block;
 }
 
+template <class NodeType>
+bool GlobalHandles::NodeBlock<NodeType>::SetYoungBit(size_t index) {
+  DCHECK_LT(index, kBlockSize);
+  bool was_empty = true;
+  for (size_t word = 0; word < kYoungWords; ++word) {
+    if (young_bits_[word] != 0) {
+      was_empty = false;
+      break;
+    }
+  }
+  young_bits_[index / kBitsPerYoungWord] |= uint64_t{1}
+                                            << (index % kBitsPerYoungWord);
+  return was_empty;
+}
+
 template <class NodeType>
 bool GlobalHandles::NodeBlock<NodeType>::IncreaseUsage() {
   DCHECK_LT(used_nodes_, kBlockSize);
@@ -206,6 +248,7 @@ class GlobalHandles::NodeSpace final {
   ~NodeSpace();
 
   V8_INLINE NodeType* Allocate();
+  void AllocateBatch(NodeType** out, size_t count);
 
   iterator begin() { return iterator(first_used_block_); }
   iterator end() { return iterator(nullptr); }
@@ -216,6 +259,7 @@ class GlobalHandles::NodeSpace final {
   NodeBounds GetNodeBlockBounds() const;
 
  private:
+  V8_INLINE NodeType* AllocateNode();
   void PutNodesOnFreeList(BlockType* block);
   V8_INLINE void Free(NodeType* node);
 
@@ -238,7 +282,7 @@ GlobalHandles::NodeSpace<NodeType>::~NodeSpace() {
 }
 
 template <class NodeType>
-NodeType* GlobalHandles::NodeSpace<NodeType>::Allocate() {
+NodeType* GlobalHandles::NodeSpace<NodeType>::AllocateNode() {
   if (first_free_ == nullptr) {
     first_block_ = new BlockType(global_handles_, this, first_block_);
     blocks_++;
@@ -251,12 +295,29 @@ NodeType* GlobalHandles::NodeSpace<NodeType>::Allocate() {
   if (block->IncreaseUsage()) {
     block->ListAdd(&first_used_block_);
   }
+  node->CheckNodeIsFreeNode();
+  return node;
+}
+
+template <class NodeType>
+NodeType* GlobalHandles::NodeSpace<NodeType>::Allocate() {
+  NodeType* node = AllocateNode();
   global_handles_->isolate()->counters()->global_handles()->Increment();
   handles_count_++;
-  node->CheckNodeIsFreeNode();
   return node;
 }
 
+template <class NodeType>
+void GlobalHandles::NodeSpace<NodeType>::AllocateBatch(NodeType** out,
+                                                       size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = AllocateNode();
+  }
+  global_handles_->isolate()->counters()->global_handles()->Increment(
+      static_cast<int>(count));
+  handles_count_ += count;
+}
+
 template <class NodeType>
 typename GlobalHandles::NodeSpace<NodeType>::NodeBounds
 GlobalHandles::NodeSpace<NodeType>::GetNodeBlockBounds() const {
@@ -754,9 +815,7 @@ void GlobalHandles::TracedNode::Verify(const Address* const* slot) {
   DCHECK_IMPLIES(ObjectInYoungGeneration(node->object()),
                  node->is_in_young_list());
   const bool in_young_list =
-      std::find(global_handles->traced_young_nodes_.begin(),
-                global_handles->traced_young_nodes_.end(),
-                node) != global_handles->traced_young_nodes_.end();
+      NodeBlock<TracedNode>::From(node)->HasYoungBit(node->index());
   DCHECK_EQ(in_young_list, node->is_in_young_list());
 #endif  // DEBUG
 }
@@ -804,12 +863,59 @@ Handle<Object> GlobalHandles::Create(Address value) {
   return Create(Object(value));
 }
 
+void GlobalHandles::CreateBatch(Address* const* values,
+                                Address** out_locations, size_t count) {
+  // Allocate nodes in chunks to keep the stack footprint bounded.
+  static constexpr size_t kMaxChunkSize = 64;
+  Node* nodes[kMaxChunkSize];
+  while (count > 0) {
+    const size_t chunk_size = std::min(count, kMaxChunkSize);
+    regular_nodes_->AllocateBatch(nodes, chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+      Node* node = nodes[i];
+      Object value(*values[i]);
+      if (NeedsTrackingInYoungNodes(value, node)) {
+        young_nodes_.push_back(node);
+        node->set_in_young_list(true);
+      }
+      out_locations[i] = node->Publish(value).location();
+    }
+    values += chunk_size;
+    out_locations += chunk_size;
+    count -= chunk_size;
+  }
+}
+
+void GlobalHandles::TrackYoungTracedNode(TracedNode* node) {
+  DCHECK(!node->is_in_young_list());
+  NodeBlock<TracedNode>* block = NodeBlock<TracedNode>::From(node);
+  if (block->SetYoungBit(node->index())) {
+    block->set_next_young(traced_young_blocks_);
+    traced_young_blocks_ = block;
+  }
+  node->set_in_young_list(true);
+}
+
+template <typename F>
+void GlobalHandles::IterateTracedYoungNodes(F f) {
+  for (NodeBlock<TracedNode>* block = traced_young_blocks_; block != nullptr;
+       block = block->next_young()) {
+    for (size_t word = 0; word < NodeBlock<TracedNode>::kYoungWords; ++word) {
+      uint64_t bits = block->young_bits(word);
+      while (bits != 0) {
+        const int bit = base::bits::CountTrailingZeros64(bits);
+        bits &= bits - 1;
+        f(block->at(word * NodeBlock<TracedNode>::kBitsPerYoungWord + bit));
+      }
+    }
+  }
+}
+
 Handle<Object> GlobalHandles::CreateTraced(Object value, Address* slot,
                                            GlobalHandleStoreMode store_mode) {
   GlobalHandles::TracedNode* node = traced_nodes_->Allocate();
   if (NeedsTrackingInYoungNodes(value, node)) {
-    traced_young_nodes_.push_back(node);
-    node->set_in_young_list(true);
+    TrackYoungTracedNode(node);
   }
   if (is_marking_ && store_mode != GlobalHandleStoreMode::kInitializingStore) {
     node->set_markbit();
@@ -823,6 +929,30 @@ Handle<Object> GlobalHandles::CreateTraced(Address value, Address* slot,
   return CreateTraced(Object(value), slot, store_mode);
 }
 
+void GlobalHandles::CreateTracedBatch(Address* const* values,
+                                      Address** out_slots, size_t count) {
+  // Batch creation always initializes the slots, so as with
+  // GlobalHandleStoreMode::kInitializingStore no write barrier is required
+  // even while marking is active.
+  static constexpr size_t kMaxChunkSize = 64;
+  TracedNode* nodes[kMaxChunkSize];
+  while (count > 0) {
+    const size_t chunk_size = std::min(count, kMaxChunkSize);
+    traced_nodes_->AllocateBatch(nodes, chunk_size);
+    for (size_t i = 0; i < chunk_size; ++i) {
+      TracedNode* node = nodes[i];
+      Object value(*values[i]);
+      if (NeedsTrackingInYoungNodes(value, node)) {
+        TrackYoungTracedNode(node);
+      }
+      out_slots[i] = node->Publish(value).location();
+    }
+    values += chunk_size;
+    out_slots += chunk_size;
+    count -= chunk_size;
+  }
+}
+
 Handle<Object> GlobalHandles::CopyGlobal(Address* location) {
   DCHECK_NOT_NULL(location);
   GlobalHandles* global_handles =
@@ -1057,7 +1187,7 @@ void GlobalHandles::ComputeWeaknessForYoungObjects(
   if (isolate()->heap()->incremental_marking()->IsMarking()) return;
 
   auto* const handler = isolate()->heap()->GetEmbedderRootsHandler();
-  for (TracedNode* node : traced_young_nodes_) {
+  IterateTracedYoungNodes([&](TracedNode* node) {
     if (node->IsInUse()) {
       DCHECK(node->is_root());
       if (is_unmodified(node->location())) {
@@ -1066,7 +1196,7 @@ void GlobalHandles::ComputeWeaknessForYoungObjects(
             *reinterpret_cast<v8::TracedReference<v8::Value>*>(&value)));
       }
     }
-  }
+  });
 }
 
 void GlobalHandles::IterateYoungStrongAndDependentRoots(RootVisitor* v) {
@@ -1076,11 +1206,11 @@ void GlobalHandles::IterateYoungStrongAndDependentRoots(RootVisitor* v) {
                           node->location());
     }
   }
-  for (TracedNode* node : traced_young_nodes_) {
+  IterateTracedYoungNodes([v](TracedNode* node) {
     if (node->IsInUse() && node->is_root()) {
       v->VisitRootPointer(Root::kGlobalHandles, nullptr, node->location());
     }
-  }
+  });
 }
 
 void GlobalHandles::ProcessWeakYoungObjects(
@@ -1099,8 +1229,8 @@ void GlobalHandles::ProcessWeakYoungObjects(
   if (!v8_flags.reclaim_unmodified_wrappers) return;
 
   auto* const handler = isolate()->heap()->GetEmbedderRootsHandler();
-  for (TracedNode* node : traced_young_nodes_) {
-    if (!node->IsInUse()) continue;
+  IterateTracedYoungNodes([&](TracedNode* node) {
+    if (!node->IsInUse()) return;
 
     DCHECK_IMPLIES(node->is_root(),
                    !should_reset_handle(isolate_->heap(), node->location()));
@@ -1117,7 +1247,7 @@ void GlobalHandles::ProcessWeakYoungObjects(
         v->VisitRootPointer(Root::kGlobalHandles, nullptr, node->location());
       }
     }
-  }
+  });
 }
 
 void GlobalHandles::InvokeSecondPassPhantomCallbacks() {
@@ -1145,6 +1275,37 @@ void GlobalHandles::InvokeSecondPassPhantomCallbacks() {
   }
 }
 
+void GlobalHandles::PostThreadSafeSecondPassCallbacks() {
+  if (thread_safe_second_pass_callbacks_.empty()) return;
+
+  auto batch = std::make_shared<std::vector<PendingPhantomCallback>>();
+  batch->swap(thread_safe_second_pass_callbacks_);
+  thread_safe_callback_batches_in_flight_.fetch_add(1,
+                                                    std::memory_order_relaxed);
+  // The task is cancelable so that isolate teardown either waits for a
+  // running batch or drops one that has not started yet.
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      MakeCancelableTask(isolate(), [this, batch] {
+        TRACE_EVENT0("v8", "V8.GCPhantomHandleProcessingBackground");
+        // The callbacks were registered as thread-safe and must not touch
+        // the isolate, so none of the main-thread GC callback scaffolding
+        // applies here.
+        for (auto& callback : *batch) {
+          callback.Invoke(isolate(), PendingPhantomCallback::kSecondPass);
+        }
+        // Release so that a thread observing the fence as clear also
+        // observes all memory freed by the callbacks above.
+        thread_safe_callback_batches_in_flight_.fetch_sub(
+            1, std::memory_order_release);
+      }));
+}
+
+bool GlobalHandles::HasPendingThreadSafeSecondPassCallbacks() const {
+  return thread_safe_callback_batches_in_flight_.load(
+             std::memory_order_acquire) > 0 ||
+         !thread_safe_second_pass_callbacks_.empty();
+}
+
 namespace {
 
 template <typename T>
@@ -1188,12 +1349,80 @@ void ClearListOfYoungNodesImpl(Isolate* isolate, std::vector<T*>* node_list) {
 
 void GlobalHandles::UpdateListOfYoungNodes() {
   UpdateListOfYoungNodesImpl(isolate_, &young_nodes_);
-  UpdateListOfYoungNodesImpl(isolate_, &traced_young_nodes_);
+
+  // Recompute the young bitmaps of the listed traced node blocks, dropping
+  // blocks whose bitmaps become empty from the young block list.
+  NodeBlock<TracedNode>* prev = nullptr;
+  NodeBlock<TracedNode>* block = traced_young_blocks_;
+  while (block != nullptr) {
+    NodeBlock<TracedNode>* next = block->next_young();
+    bool block_has_young_nodes = false;
+    for (size_t word = 0; word < NodeBlock<TracedNode>::kYoungWords; ++word) {
+      uint64_t bits = block->young_bits(word);
+      uint64_t surviving_bits = 0;
+      while (bits != 0) {
+        const int bit = base::bits::CountTrailingZeros64(bits);
+        bits &= bits - 1;
+        TracedNode* node =
+            block->at(word * NodeBlock<TracedNode>::kBitsPerYoungWord + bit);
+        DCHECK(node->is_in_young_list());
+        if (node->IsInUse() && node->state() != TracedNode::NEAR_DEATH) {
+          if (ObjectInYoungGeneration(node->object())) {
+            surviving_bits |= uint64_t{1} << bit;
+            isolate_->heap()->IncrementNodesCopiedInNewSpace();
+          } else {
+            node->set_in_young_list(false);
+            isolate_->heap()->IncrementNodesPromoted();
+          }
+        } else {
+          node->set_in_young_list(false);
+          isolate_->heap()->IncrementNodesDiedInNewSpace(1);
+        }
+      }
+      block->set_young_bits(word, surviving_bits);
+      block_has_young_nodes = block_has_young_nodes || surviving_bits != 0;
+    }
+    if (block_has_young_nodes) {
+      prev = block;
+    } else {
+      if (prev == nullptr) {
+        traced_young_blocks_ = next;
+      } else {
+        prev->set_next_young(next);
+      }
+      block->set_next_young(nullptr);
+    }
+    block = next;
+  }
 }
 
 void GlobalHandles::ClearListOfYoungNodes() {
   ClearListOfYoungNodesImpl(isolate_, &young_nodes_);
-  ClearListOfYoungNodesImpl(isolate_, &traced_young_nodes_);
+
+  // Bulk young-reset for traced nodes: wipe the bitmap of each listed block
+  // and unlink it.
+  int died = 0;
+  while (traced_young_blocks_ != nullptr) {
+    NodeBlock<TracedNode>* block = traced_young_blocks_;
+    for (size_t word = 0; word < NodeBlock<TracedNode>::kYoungWords; ++word) {
+      uint64_t bits = block->young_bits(word);
+      while (bits != 0) {
+        const int bit = base::bits::CountTrailingZeros64(bits);
+        bits &= bits - 1;
+        TracedNode* node =
+            block->at(word * NodeBlock<TracedNode>::kBitsPerYoungWord + bit);
+        DCHECK(node->is_in_young_list());
+        node->set_in_young_list(false);
+        DCHECK_IMPLIES(node->IsInUse() && node->state() != TracedNode::NEAR_DEATH,
+                       !ObjectInYoungGeneration(node->object()));
+        died++;
+      }
+    }
+    block->ClearYoungBits();
+    traced_young_blocks_ = block->next_young();
+    block->set_next_young(nullptr);
+  }
+  isolate_->heap()->IncrementNodesDiedInNewSpace(died);
 }
 
 template <typename T>
@@ -1216,7 +1445,13 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks(
                      "Handle not reset in first callback. See comments on "
                      "|v8::WeakCallbackInfo|.");
 
-      if (pair.second.callback()) second_pass_callbacks_.push_back(pair.second);
+      if (pair.second.callback()) {
+        if (pair.second.second_pass_thread_safe()) {
+          thread_safe_second_pass_callbacks_.push_back(pair.second);
+        } else {
+          second_pass_callbacks_.push_back(pair.second);
+        }
+      }
       freed_nodes++;
     }
   }
@@ -1230,11 +1465,13 @@ size_t GlobalHandles::InvokeFirstPassWeakCallbacks() {
 void GlobalHandles::PendingPhantomCallback::Invoke(Isolate* isolate,
                                                    InvocationType type) {
   Data::Callback* callback_addr = nullptr;
+  bool* second_pass_thread_safe_addr = nullptr;
   if (type == kFirstPass) {
     callback_addr = &callback_;
+    second_pass_thread_safe_addr = &second_pass_thread_safe_;
   }
   Data data(reinterpret_cast<v8::Isolate*>(isolate), parameter_,
-            embedder_fields_, callback_addr);
+            embedder_fields_, callback_addr, second_pass_thread_safe_addr);
   Data::Callback callback = callback_;
   callback_ = nullptr;
   callback(data);
@@ -1255,10 +1492,20 @@ void GlobalHandles::PostGarbageCollectionProcessing(
         kGCCallbackFlagSynchronousPhantomCallbackProcessing)) != 0;
 
   if (synchronous_second_pass) {
+    // Synchronous processing also covers callbacks that were marked as
+    // thread-safe; this keeps --predictable runs and isolate teardown
+    // deterministic.
+    second_pass_callbacks_.insert(
+        second_pass_callbacks_.end(),
+        std::make_move_iterator(thread_safe_second_pass_callbacks_.begin()),
+        std::make_move_iterator(thread_safe_second_pass_callbacks_.end()));
+    thread_safe_second_pass_callbacks_.clear();
     InvokeSecondPassPhantomCallbacks();
     return;
   }
 
+  PostThreadSafeSecondPassCallbacks();
+
   if (second_pass_callbacks_.empty() || second_pass_callbacks_task_posted_)
     return;
 
@@ -1318,11 +1565,11 @@ void GlobalHandles::IterateAllYoungRoots(RootVisitor* v) {
                           node->location());
     }
   }
-  for (TracedNode* node : traced_young_nodes_) {
+  IterateTracedYoungNodes([v](TracedNode* node) {
     if (node->IsRetainer()) {
       v->VisitRootPointer(Root::kGlobalHandles, nullptr, node->location());
     }
-  }
+  });
 }
 
 DISABLE_CFI_PERF
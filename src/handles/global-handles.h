@@ -5,6 +5,7 @@
 #ifndef V8_HANDLES_GLOBAL_HANDLES_H_
 #define V8_HANDLES_GLOBAL_HANDLES_H_
 
+#include <atomic>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -94,11 +95,25 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   template <typename T>
   inline Handle<T> Create(T value);
 
+  // Creates |count| global handles for the objects referenced by the handles
+  // in |values|, storing the resulting locations into |out_locations|. All
+  // entries of |values| must be non-null. Block management and counter
+  // updates are amortized over the whole batch, which makes this
+  // considerably cheaper than |count| individual Create calls.
+  void CreateBatch(Address* const* values, Address** out_locations,
+                   size_t count);
+
   Handle<Object> CreateTraced(Object value, Address* slot,
                               GlobalHandleStoreMode store_mode);
   Handle<Object> CreateTraced(Address value, Address* slot,
                               GlobalHandleStoreMode store_mode);
 
+  // Batched equivalent of CreateTraced for freshly initialized slots, with
+  // the same contract as CreateBatch. The node locations are stored into
+  // |out_slots|, which also serve as the traced reference slots.
+  void CreateTracedBatch(Address* const* values, Address** out_slots,
+                         size_t count);
+
   void RecordStats(HeapStats* stats);
 
   size_t InvokeFirstPassWeakCallbacks();
@@ -108,6 +123,11 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   void PostGarbageCollectionProcessing(
       GarbageCollector collector, const v8::GCCallbackFlags gc_callback_flags);
 
+  // Returns true while second pass callbacks that were marked as thread-safe
+  // are queued or running on a worker thread; see
+  // v8::WeakCallbackInfo::SetThreadSafeSecondPassCallback.
+  bool HasPendingThreadSafeSecondPassCallbacks() const;
+
   void IterateStrongRoots(RootVisitor* v);
   void IterateWeakRoots(RootVisitor* v);
   void IterateAllRoots(RootVisitor* v);
@@ -196,6 +216,10 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   void ApplyPersistentHandleVisitor(v8::PersistentHandleVisitor* visitor,
                                     Node* node);
 
+  // Hands the pending thread-safe second pass callbacks, if any, to a worker
+  // thread as a single batch.
+  void PostThreadSafeSecondPassCallbacks();
+
   // Clears a weak `node` for which `should_reset_node()` returns true.
   //
   // Returns false if a node is weak and alive which requires further
@@ -203,6 +227,15 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   bool ResetWeakNodeIfDead(Node* node,
                            WeakSlotCallbackWithHeap should_reset_node);
 
+  // Starts tracking a traced node as young by setting its bit in the young
+  // bitmap of its node block, registering the block if it had no young nodes.
+  void TrackYoungTracedNode(TracedNode* node);
+
+  // Calls |f| for each traced node currently tracked as young. Only blocks
+  // on the young block list are visited, via their bitmaps.
+  template <typename F>
+  void IterateTracedYoungNodes(F f);
+
   Isolate* const isolate_;
   bool is_marking_ = false;
   bool is_sweeping_on_mutator_thread_ = false;
@@ -213,12 +246,21 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   std::vector<Node*> young_nodes_;
 
   std::unique_ptr<NodeSpace<TracedNode>> traced_nodes_;
-  std::vector<TracedNode*> traced_young_nodes_;
+  // Head of the list of traced node blocks that contain nodes holding young
+  // objects. Which nodes of a listed block are young is recorded in a
+  // block-local bitmap; see NodeBlock.
+  NodeBlock<TracedNode>* traced_young_blocks_ = nullptr;
 
   std::vector<std::pair<Node*, PendingPhantomCallback>>
       regular_pending_phantom_callbacks_;
   std::vector<PendingPhantomCallback> second_pass_callbacks_;
   bool second_pass_callbacks_task_posted_ = false;
+  // Callbacks whose first pass marked the second pass as thread-safe; they
+  // are batched onto a worker thread instead of running on the main thread.
+  std::vector<PendingPhantomCallback> thread_safe_second_pass_callbacks_;
+  // The number of worker-thread batches that have been posted but have not
+  // finished running yet.
+  std::atomic<size_t> thread_safe_callback_batches_in_flight_{0};
 };
 
 class GlobalHandles::PendingPhantomCallback final {
@@ -239,11 +281,13 @@ class GlobalHandles::PendingPhantomCallback final {
   void Invoke(Isolate* isolate, InvocationType type);
 
   Data::Callback callback() const { return callback_; }
+  bool second_pass_thread_safe() const { return second_pass_thread_safe_; }
 
  private:
   Data::Callback callback_;
   void* parameter_;
   void* embedder_fields_[v8::kEmbedderFieldsInWeakCallback];
+  bool second_pass_thread_safe_ = false;
 };
 
 class EternalHandles final {
@@ -11,9 +11,8 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
+#include "src/init/v8.h"
 #include "src/objects/js-array-buffer.h"
-#include "src/tasks/cancelable-task.h"
-#include "src/tasks/task-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -75,29 +74,144 @@ bool ArrayBufferList::IsEmpty() const {
   return head_ == nullptr;
 }
 
-struct ArrayBufferSweeper::SweepingJob final {
-  SweepingJob(ArrayBufferList young, ArrayBufferList old, SweepingType type)
-      : state_(SweepingState::kInProgress),
-        young_(std::move(young)),
-        old_(std::move(old)),
-        type_(type) {}
+// Sweeps a shared work list of ArrayBufferExtensions. Several workers pop
+// extensions off the list concurrently with CAS and collect survivors into
+// local lists, which they publish under the sweeper's mutex so the main
+// thread can merge partial results before the whole list is processed.
+class ArrayBufferSweeper::SweepingJob final {
+ public:
+  SweepingJob(ArrayBufferSweeper* sweeper, ArrayBufferList work,
+              SweepingType type)
+      : sweeper_(sweeper), work_list_(work.head_), type_(type) {}
+
+  // Sweeps until the work list is empty, or until |delegate| (if any) asks
+  // the worker to yield.
+  void Sweep(JobDelegate* delegate);
+
+  bool IsDone() const {
+    return work_list_.load(std::memory_order_acquire) == nullptr &&
+           active_sweepers_.load(std::memory_order_acquire) == 0;
+  }
 
-  void Sweep();
-  void SweepYoung();
-  void SweepFull();
-  ArrayBufferList SweepListFull(ArrayBufferList* list);
+  size_t MaxConcurrency() const {
+    return work_list_.load(std::memory_order_relaxed) == nullptr
+               ? 0
+               : kMaxSweepingTasks;
+  }
 
  private:
-  CancelableTaskManager::Id id_ = CancelableTaskManager::kInvalidTaskId;
-  std::atomic<SweepingState> state_;
+  static constexpr size_t kMaxSweepingTasks = 4;
+  // Publish local survivors every so often so the main thread can merge them
+  // while sweeping is still running.
+  static constexpr size_t kPublishInterval = 1024;
+
+  ArrayBufferExtension* PopWork();
+  void SweepExtension(ArrayBufferExtension* extension, ArrayBufferList* young,
+                      ArrayBufferList* old);
+  void Publish(ArrayBufferList* young, ArrayBufferList* old);
+
+  ArrayBufferSweeper* const sweeper_;
+  std::atomic<ArrayBufferExtension*> work_list_;
+  std::atomic<size_t> active_sweepers_{0};
+  const SweepingType type_;
+  // Survivors published by workers; guarded by sweeper_->sweeping_mutex_.
   ArrayBufferList young_;
   ArrayBufferList old_;
-  const SweepingType type_;
   std::atomic<size_t> freed_bytes_{0};
 
   friend class ArrayBufferSweeper;
 };
 
+class ArrayBufferSweeper::SweepingTask final : public JobTask {
+ public:
+  SweepingTask(Heap* heap, SweepingJob* job, SweepingType type)
+      : heap_(heap), job_(job), type_(type) {}
+
+  void Run(JobDelegate* delegate) final {
+    const GCTracer::Scope::ScopeId scope_id =
+        type_ == SweepingType::kYoung
+            ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
+            : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
+    TRACE_GC_EPOCH(heap_->tracer(), scope_id,
+                   delegate->IsJoiningThread() ? ThreadKind::kMain
+                                               : ThreadKind::kBackground);
+    job_->Sweep(delegate);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return job_->MaxConcurrency();
+  }
+
+ private:
+  Heap* const heap_;
+  SweepingJob* const job_;
+  const SweepingType type_;
+};
+
+ArrayBufferExtension* ArrayBufferSweeper::SweepingJob::PopWork() {
+  ArrayBufferExtension* top = work_list_.load(std::memory_order_acquire);
+  while (top != nullptr &&
+         !work_list_.compare_exchange_weak(top, top->next(),
+                                           std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+    // |top| was updated by the failed compare-exchange; retry.
+  }
+  return top;
+}
+
+void ArrayBufferSweeper::SweepingJob::SweepExtension(
+    ArrayBufferExtension* current, ArrayBufferList* young,
+    ArrayBufferList* old) {
+  if (type_ == SweepingType::kYoung) {
+    if (!current->IsYoungMarked()) {
+      const size_t bytes = current->accounting_length();
+      delete current;
+      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    } else if (current->IsYoungPromoted()) {
+      current->YoungUnmark();
+      old->Append(current);
+    } else {
+      current->YoungUnmark();
+      young->Append(current);
+    }
+  } else {
+    DCHECK_EQ(SweepingType::kFull, type_);
+    if (!current->IsMarked()) {
+      const size_t bytes = current->accounting_length();
+      delete current;
+      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    } else {
+      current->Unmark();
+      old->Append(current);
+    }
+  }
+}
+
+void ArrayBufferSweeper::SweepingJob::Publish(ArrayBufferList* young,
+                                              ArrayBufferList* old) {
+  if (young->IsEmpty() && old->IsEmpty()) return;
+  base::MutexGuard guard(&sweeper_->sweeping_mutex_);
+  young_.Append(young);
+  old_.Append(old);
+}
+
+void ArrayBufferSweeper::SweepingJob::Sweep(JobDelegate* delegate) {
+  active_sweepers_.fetch_add(1, std::memory_order_acq_rel);
+  ArrayBufferList young;
+  ArrayBufferList old;
+  size_t processed = 0;
+  while (ArrayBufferExtension* current = PopWork()) {
+    SweepExtension(current, &young, &old);
+    if (++processed == kPublishInterval) {
+      Publish(&young, &old);
+      processed = 0;
+    }
+    if (delegate && delegate->ShouldYield()) break;
+  }
+  Publish(&young, &old);
+  active_sweepers_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
 ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
@@ -109,27 +223,12 @@ ArrayBufferSweeper::~ArrayBufferSweeper() {
 void ArrayBufferSweeper::EnsureFinished() {
   if (!sweeping_in_progress()) return;
 
-  TryAbortResult abort_result =
-      heap_->isolate()->cancelable_task_manager()->TryAbort(job_->id_);
-
-  switch (abort_result) {
-    case TryAbortResult::kTaskAborted:
-      // Task has not run, so we need to run it synchronously here.
-      job_->Sweep();
-      break;
-    case TryAbortResult::kTaskRemoved:
-      // Task was removed, but did actually run, just ensure we are in the right
-      // state.
-      CHECK_EQ(SweepingState::kDone, job_->state_);
-      break;
-    case TryAbortResult::kTaskRunning: {
-      // Task is running. Wait until task is finished with its work.
-      base::MutexGuard guard(&sweeping_mutex_);
-      while (job_->state_ != SweepingState::kDone) {
-        job_finished_.Wait(&sweeping_mutex_);
-      }
-      break;
-    }
+  if (job_handle_ && job_handle_->IsValid()) {
+    // The joining thread participates in sweeping whatever is left of the
+    // work list instead of idly waiting for the background workers.
+    job_handle_->Join();
+  } else {
+    job_->Sweep(nullptr);
   }
 
   Finalize();
@@ -138,11 +237,14 @@ void ArrayBufferSweeper::EnsureFinished() {
 }
 
 void ArrayBufferSweeper::FinishIfDone() {
-  if (sweeping_in_progress()) {
-    DCHECK(job_);
-    if (job_->state_ == SweepingState::kDone) {
-      Finalize();
-    }
+  if (!sweeping_in_progress()) return;
+  if (job_->IsDone()) {
+    Finalize();
+  } else {
+    // Fold in whatever the background sweepers have published so far, so
+    // external memory counters and heap limits do not have to wait for the
+    // whole list to be swept.
+    MergeResults();
   }
 }
 
@@ -155,52 +257,52 @@ void ArrayBufferSweeper::RequestSweep(SweepingType type) {
   Prepare(type);
   if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
       v8_flags.concurrent_array_buffer_sweeping) {
-    auto task = MakeCancelableTask(heap_->isolate(), [this, type] {
-      GCTracer::Scope::ScopeId scope_id =
-          type == SweepingType::kYoung
-              ? GCTracer::Scope::BACKGROUND_YOUNG_ARRAY_BUFFER_SWEEP
-              : GCTracer::Scope::BACKGROUND_FULL_ARRAY_BUFFER_SWEEP;
-      TRACE_GC_EPOCH(heap_->tracer(), scope_id, ThreadKind::kBackground);
-      base::MutexGuard guard(&sweeping_mutex_);
-      job_->Sweep();
-      job_finished_.NotifyAll();
-    });
-    job_->id_ = task->id();
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    job_handle_ = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserVisible,
+        std::make_unique<SweepingTask>(heap_, job_.get(), type));
   } else {
-    job_->Sweep();
+    job_->Sweep(nullptr);
     Finalize();
   }
 }
 
 void ArrayBufferSweeper::Prepare(SweepingType type) {
   DCHECK(!sweeping_in_progress());
-  switch (type) {
-    case SweepingType::kYoung: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), ArrayBufferList(),
-                                           type);
-      young_ = ArrayBufferList();
-    } break;
-    case SweepingType::kFull: {
-      job_ = std::make_unique<SweepingJob>(std::move(young_), std::move(old_),
-                                           type);
-      young_ = ArrayBufferList();
-      old_ = ArrayBufferList();
-    } break;
+  // Survivor routing does not depend on which list an extension came from:
+  // a full sweep moves all survivors to the old list and a young sweep only
+  // receives the young list. The donated lists can therefore be swept as one
+  // shared work list.
+  ArrayBufferList work = std::move(young_);
+  young_ = ArrayBufferList();
+  if (type == SweepingType::kFull) {
+    work.Append(&old_);
   }
+  job_ = std::make_unique<SweepingJob>(this, std::move(work), type);
   DCHECK(sweeping_in_progress());
 }
 
 void ArrayBufferSweeper::Finalize() {
   DCHECK(sweeping_in_progress());
-  CHECK_EQ(job_->state_, SweepingState::kDone);
-  young_.Append(&job_->young_);
-  old_.Append(&job_->old_);
+  CHECK(job_->IsDone());
+  if (job_handle_) {
+    DCHECK(job_handle_->IsValid());
+    job_handle_->Join();
+    job_handle_.reset();
+  }
+  MergeResults();
+  job_.reset();
+  DCHECK(!sweeping_in_progress());
+}
+
+void ArrayBufferSweeper::MergeResults() {
+  {
+    base::MutexGuard guard(&sweeping_mutex_);
+    young_.Append(&job_->young_);
+    old_.Append(&job_->old_);
+  }
   const size_t freed_bytes =
       job_->freed_bytes_.exchange(0, std::memory_order_relaxed);
   DecrementExternalMemoryCounters(freed_bytes);
-  job_.reset();
-  DCHECK(!sweeping_in_progress());
 }
 
 void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
@@ -270,80 +372,5 @@ void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
   heap_->update_external_memory(-static_cast<int64_t>(bytes));
 }
 
-void ArrayBufferSweeper::SweepingJob::Sweep() {
-  CHECK_EQ(state_, SweepingState::kInProgress);
-  switch (type_) {
-    case SweepingType::kYoung:
-      SweepYoung();
-      break;
-    case SweepingType::kFull:
-      SweepFull();
-      break;
-  }
-  state_ = SweepingState::kDone;
-}
-
-void ArrayBufferSweeper::SweepingJob::SweepFull() {
-  DCHECK_EQ(SweepingType::kFull, type_);
-  ArrayBufferList promoted = SweepListFull(&young_);
-  ArrayBufferList survived = SweepListFull(&old_);
-
-  old_ = std::move(promoted);
-  old_.Append(&survived);
-}
-
-ArrayBufferList ArrayBufferSweeper::SweepingJob::SweepListFull(
-    ArrayBufferList* list) {
-  ArrayBufferExtension* current = list->head_;
-  ArrayBufferList survivor_list;
-
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-
-    if (!current->IsMarked()) {
-      const size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
-    } else {
-      current->Unmark();
-      survivor_list.Append(current);
-    }
-
-    current = next;
-  }
-
-  *list = ArrayBufferList();
-  return survivor_list;
-}
-
-void ArrayBufferSweeper::SweepingJob::SweepYoung() {
-  DCHECK_EQ(SweepingType::kYoung, type_);
-  ArrayBufferExtension* current = young_.head_;
-
-  ArrayBufferList new_young;
-  ArrayBufferList new_old;
-
-  while (current) {
-    ArrayBufferExtension* next = current->next();
-
-    if (!current->IsYoungMarked()) {
-      size_t bytes = current->accounting_length();
-      delete current;
-      if (bytes) freed_bytes_.fetch_add(bytes, std::memory_order_relaxed);
-    } else if (current->IsYoungPromoted()) {
-      current->YoungUnmark();
-      new_old.Append(current);
-    } else {
-      current->YoungUnmark();
-      new_young.Append(current);
-    }
-
-    current = next;
-  }
-
-  old_ = new_old;
-  young_ = new_young;
-}
-
 }  // namespace internal
 }  // namespace v8
@@ -7,10 +7,10 @@
 
 #include <memory>
 
+#include "include/v8-platform.h"
 #include "src/base/logging.h"
 #include "src/base/platform/mutex.h"
 #include "src/objects/js-array-buffer.h"
-#include "src/tasks/cancelable-task.h"
 
 namespace v8 {
 namespace internal {
@@ -68,13 +68,13 @@ class ArrayBufferSweeper final {
   size_t OldBytes() const { return old().ApproximateBytes(); }
 
  private:
-  struct SweepingJob;
-
-  enum class SweepingState { kInProgress, kDone };
+  class SweepingJob;
+  class SweepingTask;
 
   bool sweeping_in_progress() const { return job_.get(); }
 
-  // Finishes sweeping if it is already done.
+  // Finishes sweeping if it is already done, and otherwise folds in results
+  // that background sweepers have published so far.
   void FinishIfDone();
 
   // Increments external memory counters outside of ArrayBufferSweeper.
@@ -85,12 +85,17 @@ class ArrayBufferSweeper final {
   void Prepare(SweepingType type);
   void Finalize();
 
+  // Merges survivor lists published by the sweeping job into young_/old_ and
+  // folds freed bytes into the external memory counters. Safe to call while
+  // sweeping is still running.
+  void MergeResults();
+
   void ReleaseAll(ArrayBufferList* extension);
 
   Heap* const heap_;
   std::unique_ptr<SweepingJob> job_;
+  std::unique_ptr<JobHandle> job_handle_;
   base::Mutex sweeping_mutex_;
-  base::ConditionVariable job_finished_;
   ArrayBufferList young_;
   ArrayBufferList old_;
 };
@@ -308,6 +308,12 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
 
   void Publish();
 
+  // Publishes the push segment early if the global worklist has run empty
+  // and the local push segment holds at least `min_entries`. Allows
+  // producers to feed starving concurrent consumers without waiting for a
+  // full segment.
+  V8_INLINE void PublishIfConsumersStarving(uint16_t min_entries);
+
   void Merge(Worklist<EntryType, MinSegmentSize>::Local& other);
 
   void Clear();
@@ -408,6 +414,15 @@ void Worklist<EntryType, MinSegmentSize>::Local::Publish() {
   if (!pop_segment_->IsEmpty()) PublishPopSegment();
 }
 
+template <typename EntryType, uint16_t MinSegmentSize>
+void Worklist<EntryType, MinSegmentSize>::Local::PublishIfConsumersStarving(
+    uint16_t min_entries) {
+  DCHECK_LE(min_entries, MinSegmentSize);
+  if (push_segment_->Size() < min_entries) return;
+  if (!worklist_.IsEmpty()) return;
+  PublishPushSegment();
+}
+
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::Merge(
     Worklist<EntryType, MinSegmentSize>::Local& other) {
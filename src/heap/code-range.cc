@@ -6,6 +6,7 @@
 
 #include "src/base/bits.h"
 #include "src/base/lazy-instance.h"
+#include "src/base/platform/platform.h"
 #include "src/codegen/constants-arch.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
@@ -176,6 +177,15 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
         base, size, PageAllocator::kReadWriteExecute));
     CHECK(params.page_allocator->DiscardSystemPages(base, size));
   }
+
+  if (V8_UNLIKELY(v8_flags.huge_code_range)) {
+    // Hinting the whole reservation up front is sufficient: the advice sticks
+    // to the address range, so pages committed later for code objects are
+    // eligible for (transparent) huge-page backing as well.
+    base::OS::AdviseHugePages(
+        reinterpret_cast<void*>(page_allocator_->begin()),
+        page_allocator_->size());
+  }
   return true;
 }
 
@@ -121,6 +121,17 @@ class CodeRange final : public VirtualMemoryCage {
   // method can be used uniformly regardless of having a per-Isolate or a shared
   // pointer cage. Returns the address of the copy.
   //
+  // The copy is made at most once per CodeRange, so its process-wide cost is
+  // bounded by the number of distinct code ranges: with a shared pointer cage
+  // all Isolates use the process-wide CodeRange (see
+  // EnsureProcessWideCodeRange) and thus one copy, kept alive by the Isolates'
+  // shared_ptr references. Where the OS supports remapping pages
+  // (base::OS::RemapPages), the "copy" is the file-backed embedded blob
+  // aliased into the code range and stays clean shared memory; only platforms
+  // without remap support pay private RSS for it, once per code range. Copies
+  // belonging to distinct code ranges cannot alias a single mapping because
+  // each must be PC-relative-reachable from its own range.
+  //
   // The builtins code region will be freed with the code range at tear down.
   //
   // When ENABLE_SLOW_DCHECKS is on, the contents of the embedded_blob_code are
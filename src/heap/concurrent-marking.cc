@@ -747,6 +747,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
   NativeContextInferrer& native_context_inferrer =
       task_state->native_context_inferrer;
   NativeContextStats& native_context_stats = task_state->native_context_stats;
+  InstanceTypeStats& instance_type_stats = task_state->instance_type_stats;
   double time_ms;
   size_t marked_bytes = 0;
   Isolate* isolate = heap_->isolate();
@@ -768,6 +769,7 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
       }
     }
     bool is_per_context_mode = local_marking_worklists.IsPerContextMode();
+    bool collect_type_stats = v8_flags.marking_type_stats;
     bool done = false;
     CodePageHeaderModificationScope rwx_write_scope(
         "Marking a Code object requires write access to the Code page header");
@@ -815,6 +817,10 @@ void ConcurrentMarking::RunMajor(JobDelegate* delegate,
             native_context_stats.IncrementSize(
                 local_marking_worklists.Context(), map, object, visited_size);
           }
+          if (V8_UNLIKELY(collect_type_stats)) {
+            instance_type_stats.IncrementSize(map.instance_type(),
+                                              visited_size);
+          }
           current_marked_bytes += visited_size;
         }
       }
@@ -1035,6 +1041,14 @@ void ConcurrentMarking::FlushNativeContexts(NativeContextStats* main_stats) {
   }
 }
 
+void ConcurrentMarking::FlushInstanceTypeStats(InstanceTypeStats* main_stats) {
+  DCHECK(!job_handle_ || !job_handle_->IsValid());
+  for (size_t i = 1; i < task_state_.size(); i++) {
+    main_stats->Merge(task_state_[i]->instance_type_stats);
+    task_state_[i]->instance_type_stats.Clear();
+  }
+}
+
 void ConcurrentMarking::FlushMemoryChunkData(
     NonAtomicMarkingState* marking_state) {
   DCHECK(!job_handle_ || !job_handle_->IsValid());
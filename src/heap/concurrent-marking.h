@@ -15,6 +15,7 @@
 #include "src/heap/marking-visitor.h"
 #include "src/heap/marking-worklist.h"
 #include "src/heap/memory-measurement.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/slot-set.h"
 #include "src/heap/spaces.h"
 #include "src/init/v8.h"
@@ -77,6 +78,8 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
       TaskPriority priority = TaskPriority::kUserVisible);
   // Flushes native context sizes to the given table of the main thread.
   void FlushNativeContexts(NativeContextStats* main_stats);
+  // Flushes per-instance-type counts to the given stats of the main thread.
+  void FlushInstanceTypeStats(InstanceTypeStats* main_stats);
   // Flushes memory chunk data using the given marking state.
   void FlushMemoryChunkData(NonAtomicMarkingState* marking_state);
   // This function is called for a new space page that was cleared after
@@ -104,6 +107,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     MemoryChunkDataMap memory_chunk_data;
     NativeContextInferrer native_context_inferrer;
     NativeContextStats native_context_stats;
+    InstanceTypeStats instance_type_stats;
     char cache_line_padding[64];
   };
   class JobTaskMinor;
@@ -8,6 +8,12 @@
 #include "src/heap/mark-compact.h"
 #include "src/objects/visitors.h"
 
+#ifdef V8_ENABLE_INNER_POINTER_RESOLUTION_OSB
+#include "src/heap/memory-allocator.h"
+#include "src/heap/object-start-bitmap-inl.h"
+#include "src/heap/spaces.h"
+#endif  // V8_ENABLE_INNER_POINTER_RESOLUTION_OSB
+
 #ifdef V8_COMPRESS_POINTERS
 #include "src/common/ptr-compr-inl.h"
 #endif  // V8_COMPRESS_POINTERS
@@ -29,9 +35,48 @@ void ConservativeStackVisitor::VisitPointer(const void* pointer) {
 #endif  // V8_COMPRESS_POINTERS
 }
 
+#ifdef V8_ENABLE_INNER_POINTER_RESOLUTION_OSB
+namespace {
+
+// Resolves a possibly-inner pointer to the base pointer of the containing
+// object, using the object start bitmap maintained on every page. On a fully
+// populated bitmap this is a couple of bit operations, in contrast to the
+// linear walk required when only the marking bitmap is available.
+Address FindBasePtrUsingObjectStartBitmap(Heap* heap, Address maybe_inner_ptr) {
+  // Check if the pointer is contained by a normal or large page owned by this
+  // heap. Bail out if it is not.
+  const MemoryChunk* chunk =
+      heap->memory_allocator()->LookupChunkContainingAddress(maybe_inner_ptr);
+  if (chunk == nullptr) return kNullAddress;
+  DCHECK(chunk->Contains(maybe_inner_ptr));
+  // If it is contained in a large page, it points to the only object on it.
+  if (chunk->IsLargePage()) return chunk->area_start();
+  // Otherwise, we have a pointer inside a normal page.
+  Page* page = const_cast<Page*>(static_cast<const Page*>(chunk));
+  // If it is in the young generation "from" semispace, it is not used and we
+  // must ignore it.
+  if (page->IsFromPage()) return kNullAddress;
+  Address base_ptr =
+      page->object_start_bitmap()->FindBasePtr(maybe_inner_ptr);
+  if (base_ptr == kNullAddress) return kNullAddress;
+  DCHECK_LE(base_ptr, maybe_inner_ptr);
+  // The pointer may be past the end of the last object on the page or point
+  // into a free-list entry; such pointers must be ignored.
+  HeapObject obj = HeapObject::FromAddress(base_ptr);
+  PtrComprCageBase cage_base{page->heap()->isolate()};
+  if (obj.IsFreeSpaceOrFiller(cage_base)) return kNullAddress;
+  if (maybe_inner_ptr >= base_ptr + obj.Size(cage_base)) return kNullAddress;
+  return base_ptr;
+}
+
+}  // namespace
+#endif  // V8_ENABLE_INNER_POINTER_RESOLUTION_OSB
+
 void ConservativeStackVisitor::VisitConservativelyIfPointer(Address address) {
   Address base_ptr;
-#ifdef V8_ENABLE_INNER_POINTER_RESOLUTION_MB
+#if defined(V8_ENABLE_INNER_POINTER_RESOLUTION_OSB)
+  base_ptr = FindBasePtrUsingObjectStartBitmap(isolate_->heap(), address);
+#elif defined(V8_ENABLE_INNER_POINTER_RESOLUTION_MB)
   base_ptr = isolate_->heap()->mark_compact_collector()->FindBasePtrForMarking(
       address);
 #else
@@ -919,6 +919,18 @@ Handle<String> FactoryBase<Impl>::HeapNumberToString(Handle<HeapNumber> number,
 template <typename Impl>
 inline Handle<String> FactoryBase<Impl>::SmiToString(Smi number,
                                                      NumberCacheMode mode) {
+  // Strings of small non-negative integers are pre-allocated in the read-only
+  // space, already internalized and carrying an array index hash. This table
+  // is shared across isolates, unlike the number-string cache below.
+  {
+    DisallowGarbageCollection no_gc;
+    FixedArray table = *smi_string_table();
+    if (static_cast<uint32_t>(number.value()) <
+        static_cast<uint32_t>(table.length())) {
+      return handle(String::cast(table.get(number.value())), isolate());
+    }
+  }
+
   int hash = mode == NumberCacheMode::kIgnore
                  ? 0
                  : impl()->NumberToStringCacheHash(number);
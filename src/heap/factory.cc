@@ -338,6 +338,33 @@ Handle<Code> Factory::CodeBuilder::Build() {
   return BuildInternal(true).ToHandleChecked();
 }
 
+Factory::Batch::Batch(Isolate* isolate, int total_size_in_bytes,
+                      AllocationType allocation)
+    : isolate_(isolate) {
+  DCHECK_GT(total_size_in_bytes, 0);
+  if (v8_flags.single_generation && allocation == AllocationType::kYoung) {
+    allocation = AllocationType::kOld;
+  }
+  Heap* heap = isolate->heap();
+  const int reserved = ALIGN_TO_ALLOCATION_ALIGNMENT(total_size_in_bytes);
+  DCHECK_LE(reserved, heap->MaxRegularHeapObjectSize(allocation));
+  // One retry-or-fail allocation up front performs the limit checks and any
+  // garbage collection needed for the whole batch.
+  HeapObject reservation =
+      heap->allocator()->AllocateRawWith<HeapAllocator::kRetryOrFail>(
+          reserved, allocation);
+  Address top = reservation.address();
+  // The not-yet-carved part of the reservation always holds a filler to keep
+  // the heap iterable.
+  heap->CreateFillerObjectAt(top, reserved);
+  heap->allocator()->BeginAllocationBatch(top, top + reserved, allocation);
+}
+
+Factory::Batch::~Batch() {
+  // Whatever was not carved out of the reservation stays behind as a filler.
+  isolate_->heap()->allocator()->EndAllocationBatch();
+}
+
 HeapObject Factory::AllocateRaw(int size, AllocationType allocation,
                                 AllocationAlignment alignment) {
   return allocator()->AllocateRawWith<HeapAllocator::kRetryOrFail>(
@@ -509,6 +536,11 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   DCHECK_LE(0, length);
   int size = FeedbackVector::SizeFor(length);
 
+  Handle<ByteArray> branch_bias_table =
+      NewByteArray(FeedbackVector::kBranchBiasTableSize, AllocationType::kOld);
+  memset(reinterpret_cast<void*>(branch_bias_table->GetDataStartAddress()), 0,
+         FeedbackVector::kBranchBiasTableSize);
+
   FeedbackVector vector = FeedbackVector::cast(AllocateRawWithImmortalMap(
       size, AllocationType::kOld, *feedback_vector_map()));
   DisallowGarbageCollection no_gc;
@@ -523,6 +555,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector.reset_flags();
   vector.set_log_next_execution(v8_flags.log_function_events);
   vector.set_closure_feedback_cell_array(*closure_feedback_cell_array);
+  vector.set_branch_bias_table(*branch_bias_table);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetTagged(ObjectSlot(vector.slots_start()), *undefined_value(), length);
@@ -3205,6 +3238,49 @@ Handle<JSDataView> Factory::NewJSDataView(Handle<JSArrayBuffer> buffer,
   return obj;
 }
 
+namespace {
+
+// Whether a JSBoundFunction map still has the canonical bound-function
+// layout, i.e. it was reached from the context's bound function map purely by
+// prototype transition: exactly the length and name AccessorInfos with their
+// original attributes, fast elements, and still extensible. Binding such a
+// bound function again yields a bound function with the very same map, since
+// both the [[Prototype]] and [[Construct]]-ability carry over from the
+// target, so long bind chains share one map per prototype.
+bool IsCanonicalBoundFunctionMap(Isolate* isolate, Map map) {
+  DCHECK_EQ(JS_BOUND_FUNCTION_TYPE, map.instance_type());
+  if (map.is_dictionary_map()) return false;
+  if (!map.is_extensible()) return false;
+  if (map.elements_kind() != TERMINAL_FAST_ELEMENTS_KIND) return false;
+  static constexpr int kDescriptorCount =
+      JSFunctionOrBoundFunctionOrWrappedFunction::kNameDescriptorIndex + 1;
+  if (map.NumberOfOwnDescriptors() != kDescriptorCount) return false;
+  DescriptorArray descriptors = map.instance_descriptors(isolate);
+  ReadOnlyRoots roots(isolate);
+  const Name expected_keys[kDescriptorCount] = {roots.length_string(),
+                                                roots.name_string()};
+  const AccessorInfo expected_values[kDescriptorCount] = {
+      *isolate->factory()->bound_function_length_accessor(),
+      *isolate->factory()->bound_function_name_accessor()};
+  constexpr PropertyAttributes roc_attribs =
+      static_cast<PropertyAttributes>(DONT_ENUM | READ_ONLY);
+  for (InternalIndex i : InternalIndex::Range(kDescriptorCount)) {
+    if (descriptors.GetKey(i) != expected_keys[i.as_int()]) return false;
+    if (descriptors.GetStrongValue(i) != expected_values[i.as_int()]) {
+      return false;
+    }
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (details.kind() != PropertyKind::kAccessor ||
+        details.location() != PropertyLocation::kDescriptor ||
+        details.attributes() != roc_attribs) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 MaybeHandle<JSBoundFunction> Factory::NewJSBoundFunction(
     Handle<JSReceiver> target_function, Handle<Object> bound_this,
     base::Vector<Handle<Object>> bound_args) {
@@ -3236,14 +3312,24 @@ MaybeHandle<JSBoundFunction> Factory::NewJSBoundFunction(
     }
   }
 
-  // Setup the map for the JSBoundFunction instance.
-  Handle<Map> map = target_function->IsConstructor()
-                        ? isolate()->bound_function_with_constructor_map()
-                        : isolate()->bound_function_without_constructor_map();
-  if (map->prototype() != *prototype) {
-    map = Map::TransitionToPrototype(isolate(), map, prototype);
+  // Setup the map for the JSBoundFunction instance. When rebinding a bound
+  // function whose map still has the canonical layout, the target's map can
+  // be reused directly; otherwise derive the map from the context's bound
+  // function map via the prototype transition cache.
+  Handle<Map> map;
+  if (target_function->IsJSBoundFunction() &&
+      IsCanonicalBoundFunctionMap(isolate(), target_function->map())) {
+    map = handle(target_function->map(), isolate());
+  } else {
+    map = target_function->IsConstructor()
+              ? isolate()->bound_function_with_constructor_map()
+              : isolate()->bound_function_without_constructor_map();
+    if (map->prototype() != *prototype) {
+      map = Map::TransitionToPrototype(isolate(), map, prototype);
+    }
   }
   DCHECK_EQ(target_function->IsConstructor(), map->is_constructor());
+  DCHECK_EQ(map->prototype(), *prototype);
 
   // Setup the JSBoundFunction instance.
   Handle<JSBoundFunction> result = Handle<JSBoundFunction>::cast(
@@ -3382,11 +3468,13 @@ Handle<SharedFunctionInfo> Factory::NewSharedFunctionInfoForBuiltin(
   return shared;
 }
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
 Handle<SharedFunctionInfo> Factory::NewSharedFunctionInfoForWebSnapshot() {
   return NewSharedFunctionInfo(empty_string(), MaybeHandle<Code>(),
                                Builtin::kNoBuiltinId,
                                FunctionKind::kNormalFunction);
 }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
 int Factory::NumberToStringCacheHash(Smi number) {
   int mask = (number_string_cache()->length() >> 1) - 1;
@@ -800,7 +800,9 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
       MaybeHandle<String> name, Builtin builtin,
       FunctionKind kind = FunctionKind::kNormalFunction);
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   Handle<SharedFunctionInfo> NewSharedFunctionInfoForWebSnapshot();
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   static bool IsFunctionModeWithPrototype(FunctionMode function_mode) {
     return (function_mode & kWithPrototypeBits) != 0;
@@ -921,6 +923,30 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
     friend class Factory;
   };
 
+  // Pre-reserves one block of |total_size_in_bytes| in the given space and
+  // carves subsequent factory allocations of that AllocationType out of it,
+  // skipping the per-object limit checks and safepoint polls. All
+  // GC-triggering work happens up front when the scope is entered, so runtime
+  // paths that build a known cluster of dependent objects pay for at most one
+  // allocation slow path instead of one per object. Allocations that do not
+  // fit the remaining reservation (or request a different space) fall through
+  // to the regular allocator and may then trigger a garbage collection, which
+  // drops the rest of the reservation; callers should size the reservation to
+  // cover every allocation made within the scope. The reservation must not
+  // exceed the regular object size limit of the target space, and batches do
+  // not nest.
+  class V8_EXPORT_PRIVATE V8_NODISCARD Batch final {
+   public:
+    Batch(Isolate* isolate, int total_size_in_bytes,
+          AllocationType allocation = AllocationType::kYoung);
+    ~Batch();
+    Batch(const Batch&) = delete;
+    Batch& operator=(const Batch&) = delete;
+
+   private:
+    Isolate* const isolate_;
+  };
+
   // Allows creation of Code objects. It provides two build methods, one of
   // which tries to gracefully handle allocation failure.
   class V8_EXPORT_PRIVATE CodeBuilder final {
@@ -4,11 +4,14 @@
 
 #include "src/heap/finalization-registry-cleanup-task.h"
 
+#include "src/api/api-inl.h"
 #include "src/execution/frames.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/execution/stack-guard.h"
 #include "src/execution/v8threads.h"
+#include "src/execution/vm-state-inl.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/foreign-inl.h"
 #include "src/objects/js-weak-refs-inl.h"
 #include "src/tracing/trace-event.h"
 
@@ -35,23 +38,9 @@ void FinalizationRegistryCleanupTask::SlowAssertNoActiveJavaScript() {
 #endif  // ENABLE_SLOW_DCHECKS
 }
 
-void FinalizationRegistryCleanupTask::RunInternal() {
+void FinalizationRegistryCleanupTask::RunJSCleanup(
+    Handle<JSFinalizationRegistry> finalization_registry) {
   Isolate* isolate = heap_->isolate();
-  SlowAssertNoActiveJavaScript();
-
-  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
-                                "V8.FinalizationRegistryCleanupTask");
-
-  HandleScope handle_scope(isolate);
-  Handle<JSFinalizationRegistry> finalization_registry;
-  // There could be no dirty FinalizationRegistries. When a context is disposed
-  // by the embedder, its FinalizationRegistries are removed from the dirty
-  // list.
-  if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
-          &finalization_registry)) {
-    return;
-  }
-  finalization_registry->set_scheduled_for_cleanup(false);
 
   // Since FinalizationRegistry cleanup callbacks are scheduled by V8, enter the
   // FinalizationRegistry's context.
@@ -92,6 +81,77 @@ void FinalizationRegistryCleanupTask::RunInternal() {
     auto nop = [](HeapObject, ObjectSlot, Object) {};
     heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
   }
+}
+
+bool FinalizationRegistryCleanupTask::RunNativeCleanup(
+    Handle<JSFinalizationRegistry> finalization_registry, int* budget) {
+  Isolate* isolate = heap_->isolate();
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
+  const bool unlimited = v8_flags.finalization_registry_cleanup_budget <= 0;
+  auto callback =
+      reinterpret_cast<v8::FinalizationRegistryNativeCleanupCallback>(
+          Foreign::cast(finalization_registry->native_cleanup())
+              .foreign_address());
+  void* data = reinterpret_cast<void*>(
+      Foreign::cast(finalization_registry->native_cleanup_data())
+          .foreign_address());
+
+  while (finalization_registry->NeedsCleanup()) {
+    if (!unlimited && *budget <= 0) return false;
+    HandleScope scope(isolate);
+    Handle<Object> holdings = JSFinalizationRegistry::PopClearedCellHoldings(
+        finalization_registry, isolate);
+    --*budget;
+    ExternalCallbackScope call_scope(isolate,
+                                     reinterpret_cast<Address>(callback));
+    callback(v8_isolate, v8::Utils::ToLocal(holdings), data);
+  }
+
+  // RemoveCellFromUnregisterTokenMap does not shrink the key map, so do it
+  // once after draining, like the Torque cleanup loop does.
+  if (!finalization_registry->key_map().IsUndefined(isolate)) {
+    Handle<SimpleNumberDictionary> key_map =
+        handle(SimpleNumberDictionary::cast(finalization_registry->key_map()),
+               isolate);
+    key_map = SimpleNumberDictionary::Shrink(isolate, key_map);
+    finalization_registry->set_key_map(*key_map);
+  }
+  return true;
+}
+
+void FinalizationRegistryCleanupTask::RunInternal() {
+  Isolate* isolate = heap_->isolate();
+  SlowAssertNoActiveJavaScript();
+
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
+                                "V8.FinalizationRegistryCleanupTask");
+
+  HandleScope handle_scope(isolate);
+  // Registries with a native cleanup function are drained here without
+  // entering JavaScript, batching as many of them as the per-task cell budget
+  // allows. The first registry with a JavaScript cleanup callback ends the
+  // task, as before, so that the host can perform a microtask checkpoint
+  // after the task.
+  int budget = v8_flags.finalization_registry_cleanup_budget;
+  Handle<JSFinalizationRegistry> finalization_registry;
+  // There could be no dirty FinalizationRegistries. When a context is disposed
+  // by the embedder, its FinalizationRegistries are removed from the dirty
+  // list.
+  while (heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
+      &finalization_registry)) {
+    finalization_registry->set_scheduled_for_cleanup(false);
+    if (!finalization_registry->has_native_cleanup()) {
+      RunJSCleanup(finalization_registry);
+      break;
+    }
+    bool drained = RunNativeCleanup(finalization_registry, &budget);
+    if (finalization_registry->NeedsCleanup() &&
+        !finalization_registry->scheduled_for_cleanup()) {
+      auto nop = [](HeapObject, ObjectSlot, Object) {};
+      heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
+    }
+    if (!drained) break;
+  }
 
   // Repost if there are remaining dirty FinalizationRegistries.
   heap_->set_is_finalization_registry_cleanup_task_posted(false);
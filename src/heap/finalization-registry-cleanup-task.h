@@ -24,6 +24,12 @@ class FinalizationRegistryCleanupTask : public CancelableTask {
 
  private:
   void RunInternal() override;
+  void RunJSCleanup(Handle<JSFinalizationRegistry> finalization_registry);
+  // Drains |finalization_registry| through its native cleanup function,
+  // decrementing |*budget| per cell. Returns false if the budget was
+  // exhausted before the registry was fully drained.
+  bool RunNativeCleanup(Handle<JSFinalizationRegistry> finalization_registry,
+                        int* budget);
   void SlowAssertNoActiveJavaScript();
 
   Heap* heap_;
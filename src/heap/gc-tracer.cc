@@ -457,6 +457,9 @@ void GCTracer::StopCycle(GarbageCollector collector) {
 
   if (Heap::IsYoungGenerationCollector(collector)) {
     ReportYoungCycleToRecorder();
+    if (V8_UNLIKELY(v8_flags.gc_pause_breakdown)) {
+      ReportPauseBreakdownToRecorder();
+    }
 
     // If a young generation GC interrupted an unfinished full GC cycle, restore
     // the event corresponding to the full GC cycle.
@@ -472,6 +475,9 @@ void GCTracer::StopCycle(GarbageCollector collector) {
     }
   } else {
     ReportFullCycleToRecorder();
+    if (V8_UNLIKELY(v8_flags.gc_pause_breakdown)) {
+      ReportPauseBreakdownToRecorder();
+    }
 
     heap_->isolate()->counters()->mark_compact_reason()->AddSample(
         static_cast<int>(current_.gc_reason));
@@ -650,6 +656,19 @@ void GCTracer::AddCompactionEvent(double duration,
       MakeBytesAndDuration(live_bytes_compacted, duration));
 }
 
+void GCTracer::AddRootCategoryTime(VisitorSynchronization::SyncTag tag,
+                                   double duration) {
+  DCHECK(v8_flags.gc_pause_breakdown);
+  DCHECK_LT(tag, VisitorSynchronization::kNumberOfSyncTags);
+  root_category_time_ms_[tag] += duration;
+}
+
+void GCTracer::AddEvacuatedBytes(AllocationSpace space, size_t bytes) {
+  if (V8_LIKELY(!v8_flags.gc_pause_breakdown)) return;
+  DCHECK_LE(space, LAST_SPACE);
+  evacuated_bytes_by_space_[space] += bytes;
+}
+
 void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
@@ -1797,5 +1816,44 @@ void GCTracer::ReportYoungCycleToRecorder() {
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
 }
 
+void GCTracer::ReportPauseBreakdownToRecorder() {
+  DCHECK(v8_flags.gc_pause_breakdown);
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (recorder->HasEmbedderRecorder()) {
+    v8::metrics::GarbageCollectionPauseBreakdown event;
+    event.reason = static_cast<int>(current_.gc_reason);
+    event.time_to_safepoint_wall_clock_duration_in_us =
+        static_cast<int64_t>(current_.scopes[Scope::TIME_TO_SAFEPOINT] *
+                             base::Time::kMicrosecondsPerMillisecond);
+    for (int i = 0; i < VisitorSynchronization::kNumberOfSyncTags; i++) {
+      if (root_category_time_ms_[i] == 0.0) continue;
+      event.root_categories.emplace_back();
+      auto& category = event.root_categories.back();
+      // SyncTag and Root are both generated from ROOT_ID_LIST and share
+      // their numbering.
+      category.name = RootVisitor::RootName(static_cast<Root>(i));
+      category.wall_clock_duration_in_us =
+          static_cast<int64_t>(root_category_time_ms_[i] *
+                               base::Time::kMicrosecondsPerMillisecond);
+    }
+    for (int space = FIRST_SPACE; space <= LAST_SPACE; space++) {
+      if (evacuated_bytes_by_space_[space] == 0) continue;
+      event.evacuated_spaces.emplace_back();
+      auto& evacuated = event.evacuated_spaces.back();
+      evacuated.name =
+          BaseSpace::GetSpaceName(static_cast<AllocationSpace>(space));
+      evacuated.bytes_moved =
+          static_cast<int64_t>(evacuated_bytes_by_space_[space]);
+    }
+    recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+  }
+  // The attribution data covers a single cycle; clear it even if there was no
+  // embedder recorder to report it to.
+  for (double& time : root_category_time_ms_) time = 0.0;
+  for (size_t& bytes : evacuated_bytes_by_space_) bytes = 0;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -13,6 +13,7 @@
 #include "src/common/globals.h"
 #include "src/init/heap-symbols.h"
 #include "src/logging/counters.h"
+#include "src/objects/visitors.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
@@ -297,6 +298,16 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddCompactionEvent(double duration, size_t live_bytes_compacted);
 
+  // Attribute |duration| (in ms) of root visitation in the current cycle to
+  // the root-set category ending at |tag|. Only used with
+  // --gc-pause-breakdown.
+  void AddRootCategoryTime(VisitorSynchronization::SyncTag tag,
+                           double duration);
+
+  // Attribute |bytes| of live objects moved off pages of |space| during
+  // evacuation in the current cycle. Only used with --gc-pause-breakdown.
+  void AddEvacuatedBytes(AllocationSpace space, size_t bytes);
+
   void AddSurvivalRatio(double survival_ratio);
 
   // Log an incremental marking step.
@@ -486,6 +497,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ReportIncrementalMarkingStepToRecorder(double v8_duration);
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
   void ReportYoungCycleToRecorder();
+  void ReportPauseBreakdownToRecorder();
 
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
@@ -577,6 +589,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   // that corresponded to the full GC cycle, and this field is set to true.
   bool young_gc_while_full_gc_ = false;
 
+  // Per-cycle pause attribution data, cleared when the cycle is reported.
+  // Only populated with --gc-pause-breakdown.
+  double root_category_time_ms_[VisitorSynchronization::kNumberOfSyncTags] = {
+      0.0};
+  size_t evacuated_bytes_by_space_[LAST_SPACE + 1] = {0};
+
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalMark
       incremental_mark_batched_events_;
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalSweep
@@ -69,6 +69,12 @@ V8_WARN_UNUSED_RESULT V8_INLINE AllocationResult HeapAllocator::AllocateRaw(
     return AllocateRaw(size_in_bytes, AllocationType::kOld, origin, alignment);
   }
 
+  if (V8_UNLIKELY(batch_top_ != kNullAddress)) {
+    AllocationResult result =
+        TryAllocateRawFromBatch(size_in_bytes, type, alignment);
+    if (!result.IsFailure()) return result;
+  }
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   if (v8_flags.random_gc_interval > 0 || v8_flags.gc_interval >= 0) {
     if (!heap_->always_allocate() && allocation_timeout_-- <= 0) {
@@ -159,6 +165,33 @@ V8_WARN_UNUSED_RESULT V8_INLINE AllocationResult HeapAllocator::AllocateRaw(
   return allocation;
 }
 
+AllocationResult HeapAllocator::TryAllocateRawFromBatch(
+    int size_in_bytes, AllocationType type, AllocationAlignment alignment) {
+  DCHECK(batch_active_);
+  DCHECK_NE(batch_top_, kNullAddress);
+  if (type != batch_allocation_) return AllocationResult::Failure();
+  if (USE_ALLOCATION_ALIGNMENT_BOOL && alignment != kTaggedAligned) {
+    return AllocationResult::Failure();
+  }
+  // The allocation trackers expect one event per object; let the regular path
+  // report those while profiling.
+  if (V8_UNLIKELY(!heap_->allocation_trackers_.empty())) {
+    return AllocationResult::Failure();
+  }
+  const int aligned_size = ALIGN_TO_ALLOCATION_ALIGNMENT(size_in_bytes);
+  if (static_cast<size_t>(aligned_size) > batch_limit_ - batch_top_) {
+    return AllocationResult::Failure();
+  }
+  Address address = batch_top_;
+  batch_top_ += aligned_size;
+  if (batch_top_ != batch_limit_) {
+    // Keep the remainder of the reservation iterable.
+    heap_->CreateFillerObjectAt(batch_top_,
+                                static_cast<int>(batch_limit_ - batch_top_));
+  }
+  return AllocationResult::FromObject(HeapObject::FromAddress(address));
+}
+
 AllocationResult HeapAllocator::AllocateRaw(int size_in_bytes,
                                             AllocationType type,
                                             AllocationOrigin origin,
@@ -31,6 +31,35 @@ void HeapAllocator::SetReadOnlySpace(ReadOnlySpace* read_only_space) {
   read_only_space_ = read_only_space;
 }
 
+void HeapAllocator::BeginAllocationBatch(Address top, Address limit,
+                                         AllocationType allocation) {
+  // Batches do not nest.
+  DCHECK(!batch_active_);
+  DCHECK_LT(top, limit);
+  DCHECK(allocation == AllocationType::kYoung ||
+         allocation == AllocationType::kOld);
+  batch_active_ = true;
+  batch_top_ = top;
+  batch_limit_ = limit;
+  batch_allocation_ = allocation;
+}
+
+void HeapAllocator::EndAllocationBatch() {
+  DCHECK(batch_active_);
+  // The not-yet-carved part of the reservation stays behind as a filler, or
+  // was already dropped by InvalidateAllocationBatch.
+  batch_active_ = false;
+  batch_top_ = kNullAddress;
+  batch_limit_ = kNullAddress;
+}
+
+void HeapAllocator::InvalidateAllocationBatch() {
+  // The reservation is not a root and does not survive evacuation, so later
+  // allocations in the scope have to go through the regular paths again.
+  batch_top_ = kNullAddress;
+  batch_limit_ = kNullAddress;
+}
+
 AllocationResult HeapAllocator::AllocateRawLargeInternal(
     int size_in_bytes, AllocationType allocation, AllocationOrigin origin,
     AllocationAlignment alignment) {
@@ -67,6 +67,16 @@ class V8_EXPORT_PRIVATE HeapAllocator final {
 
   V8_INLINE bool CanAllocateInReadOnlySpace() const;
 
+  // Support for Factory::Batch: while a batch is active, allocations of the
+  // matching AllocationType are carved out of a single pre-reserved block and
+  // skip the per-object limit checks and safepoint polls. The heap drops the
+  // remaining reservation when a garbage collection starts, since the
+  // reservation is not a root and does not survive evacuation.
+  void BeginAllocationBatch(Address top, Address limit,
+                            AllocationType allocation);
+  void EndAllocationBatch();
+  void InvalidateAllocationBatch();
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   void UpdateAllocationTimeout();
   // See `allocation_timeout_`.
@@ -86,6 +96,12 @@ class V8_EXPORT_PRIVATE HeapAllocator final {
   V8_INLINE PagedSpace* old_space() const;
   V8_INLINE ReadOnlySpace* read_only_space() const;
 
+  // Carves |size_in_bytes| out of the active batch reservation, or returns a
+  // failed result if the allocation does not belong to the batch's space or
+  // does not fit the remaining reservation.
+  V8_WARN_UNUSED_RESULT V8_INLINE AllocationResult TryAllocateRawFromBatch(
+      int size_in_bytes, AllocationType type, AllocationAlignment alignment);
+
   V8_WARN_UNUSED_RESULT AllocationResult AllocateRawLargeInternal(
       int size_in_bytes, AllocationType allocation, AllocationOrigin origin,
       AllocationAlignment alignment);
@@ -109,6 +125,13 @@ class V8_EXPORT_PRIVATE HeapAllocator final {
   ConcurrentAllocator* shared_old_allocator_;
   OldLargeObjectSpace* shared_lo_space_;
 
+  // State of the active Factory::Batch, if any. The not-yet-carved part of
+  // the reservation [batch_top_, batch_limit_) always holds a filler.
+  bool batch_active_ = false;
+  Address batch_top_ = kNullAddress;
+  Address batch_limit_ = kNullAddress;
+  AllocationType batch_allocation_ = AllocationType::kYoung;
+
 #ifdef V8_ENABLE_ALLOCATION_TIMEOUT
   // Specifies how many allocations should be performed until returning
   // allocation failure (which will eventually lead to garbage collection).
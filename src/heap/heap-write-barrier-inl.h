@@ -103,12 +103,19 @@ inline void CombinedWriteBarrierInternal(HeapObject host, HeapObjectSlot slot,
   heap_internals::MemoryChunk* host_chunk =
       heap_internals::MemoryChunk::FromHeapObject(host);
 
-  heap_internals::MemoryChunk* value_chunk =
-      heap_internals::MemoryChunk::FromHeapObject(value);
-
   const bool host_in_young_gen = host_chunk->InYoungGeneration();
   const bool is_marking = host_chunk->IsMarking();
 
+  // Fast path: freshly allocated objects live in the young generation. When
+  // no incremental marking is in progress, stores into them need neither the
+  // generational/shared barrier (which only applies to old hosts) nor the
+  // marking barrier, so we can return after testing only the host's page
+  // flags, without touching the value's page header at all.
+  if (V8_LIKELY(host_in_young_gen && !is_marking)) return;
+
+  heap_internals::MemoryChunk* value_chunk =
+      heap_internals::MemoryChunk::FromHeapObject(value);
+
   if (!host_in_young_gen && value_chunk->IsYoungOrSharedChunk()) {
     // Generational or shared heap write barrier (old-to-new or old-to-shared).
     Heap_CombinedGenerationalAndSharedBarrierSlow(host, slot.address(), value);
@@ -191,13 +198,17 @@ inline void CombinedEphemeronWriteBarrier(EphemeronHashTable host,
   heap_internals::MemoryChunk* host_chunk =
       heap_internals::MemoryChunk::FromHeapObject(host);
 
+  const bool host_in_young_gen = host_chunk->InYoungGeneration();
+  const bool is_marking = host_chunk->IsMarking();
+
+  // See CombinedWriteBarrierInternal: young hosts need no barrier outside of
+  // incremental marking, so avoid loading the value's page flags.
+  if (V8_LIKELY(host_in_young_gen && !is_marking)) return;
+
   HeapObject heap_object_value = HeapObject::cast(value);
   heap_internals::MemoryChunk* value_chunk =
       heap_internals::MemoryChunk::FromHeapObject(heap_object_value);
 
-  const bool host_in_young_gen = host_chunk->InYoungGeneration();
-  const bool is_marking = host_chunk->IsMarking();
-
   if (!host_in_young_gen && value_chunk->IsYoungOrSharedChunk()) {
     Heap_CombinedGenerationalAndSharedEphemeronBarrierSlow(host, slot.address(),
                                                            heap_object_value);
@@ -20,12 +20,14 @@
 #include "src/base/once.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
+#include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer/deoptimizer.h"
@@ -79,6 +81,7 @@
 #include "src/heap/parked-scope.h"
 #include "src/heap/pretenuring-handler.h"
 #include "src/heap/read-only-heap.h"
+#include "src/heap/read-only-spaces.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/scavenge-job.h"
@@ -88,6 +91,7 @@
 #include "src/heap/sweeper.h"
 #include "src/init/bootstrapper.h"
 #include "src/init/v8.h"
+#include "src/interpreter/constant-array-builder.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -104,6 +108,8 @@
 #include "src/objects/slots-atomic-inl.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/scanner.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -1065,6 +1071,10 @@ void Heap::GarbageCollectionPrologue(
   // with a filler.
   if (new_space()) new_space()->MakeLinearAllocationAreaIterable();
 
+  // The negative lookup cache dereferences its validity cells on hits, so it
+  // must not survive any gc that can move or free objects.
+  isolate_->negative_lookup_cache()->Clear();
+
   // Reset GC statistics.
   promoted_objects_size_ = 0;
   previous_new_space_surviving_object_size_ = new_space_surviving_object_size_;
@@ -1364,7 +1374,21 @@ void Heap::ScheduleScavengeTaskIfNeeded() {
 }
 
 size_t Heap::MinorMCTaskTriggerSize() const {
-  return new_space()->Capacity() * v8_flags.minor_mc_task_trigger / 100;
+  size_t trigger =
+      new_space()->Capacity() * v8_flags.minor_mc_task_trigger / 100;
+  if (v8_flags.minor_mc_max_pause > 0) {
+    // With a pause target, start concurrent marking once the young generation
+    // holds more bytes than the configured pause can process, based on the
+    // observed minor GC speed.
+    double young_gc_speed = tracer()->ScavengeSpeedInBytesPerMillisecond();
+    if (young_gc_speed == 0) {
+      young_gc_speed = GCTracer::kConservativeSpeedInBytesPerMillisecond;
+    }
+    const size_t pause_budget =
+        static_cast<size_t>(young_gc_speed * v8_flags.minor_mc_max_pause);
+    trigger = std::min(trigger, pause_budget);
+  }
+  return trigger;
 }
 
 void Heap::StartMinorMCIncrementalMarkingIfNeeded() {
@@ -1470,8 +1494,10 @@ void Heap::CollectAllAvailableGarbage(GarbageCollectionReason gc_reason) {
   isolate()->ClearSerializerData();
   set_current_gc_flags(
       kReduceMemoryFootprintMask |
-      (gc_reason == GarbageCollectionReason::kLowMemoryNotification ? kForcedGC
-                                                                    : 0));
+      (gc_reason == GarbageCollectionReason::kLowMemoryNotification ||
+               gc_reason == GarbageCollectionReason::kIsolateReset
+           ? kForcedGC
+           : 0));
   isolate_->compilation_cache()->Clear();
   const int kMaxNumberOfAttempts = 7;
   const int kMinNumberOfAttempts = 2;
@@ -1765,6 +1791,12 @@ bool Heap::CollectGarbage(AllocationSpace space,
     }
   }
 
+  if (v8_flags.background_recompile_flushed_bytecode &&
+      !flushed_recompile_candidates_.empty()) {
+    AllowGarbageCollection allow_gc;
+    EnqueueFlushedRecompileCandidates();
+  }
+
   if (collector == GarbageCollector::MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -2108,6 +2140,10 @@ size_t Heap::PerformGarbageCollection(
     const char* collector_reason, const v8::GCCallbackFlags gc_callback_flags) {
   DisallowJavascriptExecution no_js(isolate());
 
+  // An active batch reservation does not survive the collection; see
+  // Factory::Batch.
+  heap_allocator_.InvalidateAllocationBatch();
+
   if (IsYoungGenerationCollector(collector)) {
     CompleteSweepingYoung(collector);
     if (v8_flags.verify_heap) {
@@ -2503,6 +2539,44 @@ void Heap::CallGCEpilogueCallbacks(GCType gc_type, GCCallbackFlags flags) {
   gc_epilogue_callbacks_.Invoke(gc_type, flags);
 }
 
+void Heap::AddFlushedRecompileCandidate(SharedFunctionInfo shared) {
+  DCHECK(v8_flags.background_recompile_flushed_bytecode);
+  flushed_recompile_candidates_.push_back(
+      isolate()->global_handles()->Create(shared));
+}
+
+void Heap::EnqueueFlushedRecompileCandidates() {
+  DCHECK(v8_flags.background_recompile_flushed_bytecode);
+  // Enqueuing may allocate and thus trigger another GC, which would record new
+  // candidates. Move the current batch out of the member first.
+  std::vector<Handle<SharedFunctionInfo>> candidates;
+  std::swap(candidates, flushed_recompile_candidates_);
+  LazyCompileDispatcher* dispatcher = isolate()->lazy_compile_dispatcher();
+  HandleScope scope(isolate());
+  for (Handle<SharedFunctionInfo> shared : candidates) {
+    // The candidate may have been recompiled or enqueued in the meantime, and
+    // top-level functions cannot be compiled on the dispatcher.
+    if (dispatcher != nullptr && !shared->is_compiled() &&
+        !shared->is_toplevel() && shared->HasUncompiledData() &&
+        !dispatcher->IsEnqueued(shared) && shared->script().IsScript()) {
+      Script script = Script::cast(shared->script());
+      if (script.source().IsString()) {
+        Handle<String> source(String::cast(script.source()), isolate());
+        std::unique_ptr<Utf16CharacterStream> stream(
+            ScannerStream::For(isolate(), source));
+        // Only external sources can be read off the main thread. Speculative
+        // recompiles are pure opportunism, so queue them behind regular lazy
+        // compile jobs.
+        if (stream->can_be_cloned_for_parallel_access()) {
+          dispatcher->Enqueue(isolate()->main_thread_local_isolate(), shared,
+                              std::move(stream), TaskPriority::kBestEffort);
+        }
+      }
+    }
+    GlobalHandles::Destroy(shared.location());
+  }
+}
+
 void Heap::MarkCompact() {
   PauseAllocationObserversScope pause_observers(this);
 
@@ -2579,6 +2653,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  interpreter::SharedConstantPoolCache::Clear(shared_constant_pool_cache());
 
   FlushNumberStringCache();
 }
@@ -3748,6 +3823,8 @@ bool Heap::ShouldReduceNewSpaceSize() const {
 }
 
 void Heap::ReduceNewSpaceSize() {
+  if (v8_flags.adaptive_new_space) return AdaptNewSpaceSize();
+
   if (!ShouldReduceNewSpaceSize()) return;
 
   // MinorMC shrinks new space as part of sweeping.
@@ -3755,6 +3832,34 @@ void Heap::ReduceNewSpaceSize() {
   new_lo_space_->SetCapacity(new_space_->Capacity());
 }
 
+void Heap::AdaptNewSpaceSize() {
+  DCHECK(v8_flags.adaptive_new_space);
+  // Growing remains driven by CheckNewSpaceExpansionCriteria; this only
+  // decides when a quiet phase justifies giving semispace memory back.
+  if (!ShouldReduceNewSpaceSize()) {
+    consecutive_idle_young_gcs_ = 0;
+    return;
+  }
+
+  // In the latency-oriented default policy, require several consecutive
+  // low-throughput epilogues before shrinking, so that a single quiet GC in
+  // a bursty workload does not throw away a hot semispace the next burst
+  // would immediately have to grow back. Footprint-oriented isolates
+  // (memory savings mode, memory pressure, reduce-memory GCs) shrink right
+  // away.
+  static const int kIdleEpochsBeforeShrink = 3;
+  ++consecutive_idle_young_gcs_;
+  if (!ShouldOptimizeForMemoryUsage() && !ShouldReduceMemory() &&
+      consecutive_idle_young_gcs_ < kIdleEpochsBeforeShrink) {
+    return;
+  }
+  consecutive_idle_young_gcs_ = 0;
+
+  // MinorMC shrinks new space as part of sweeping.
+  if (!v8_flags.minor_mc) new_space_->Shrink();
+  new_lo_space_->SetCapacity(new_space_->Capacity());
+}
+
 size_t Heap::NewSpaceSize() { return new_space() ? new_space()->Size() : 0; }
 
 size_t Heap::NewSpaceCapacity() {
@@ -4088,6 +4193,7 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
 void Heap::EagerlyFreeExternalMemory() {
   array_buffer_sweeper()->EnsureFinished();
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
+  FlushAssemblerBufferPool();
 }
 
 void Heap::AddNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
@@ -4264,6 +4370,8 @@ const char* Heap::GarbageCollectionReasonToString(
       return "finalize MinorMC";
     case GarbageCollectionReason::kCppHeapAllocationFailure:
       return "CppHeap allocation failure";
+    case GarbageCollectionReason::kIsolateReset:
+      return "isolate reset";
   }
 }
 
@@ -4573,7 +4681,56 @@ class ClearStaleLeftTrimmedHandlesVisitor : public RootVisitor {
 #endif  // V8_COMPRESS_POINTERS
 };
 
+// Forwards all visits to a wrapped visitor and attributes the wall-clock time
+// between consecutive Synchronize() calls to the corresponding root-set
+// category. Used by Heap::IterateRoots with --gc-pause-breakdown to tell
+// which root category made a pause long.
+class RootCategoryTimingVisitor final : public RootVisitor {
+ public:
+  RootCategoryTimingVisitor(Heap* heap, RootVisitor* delegate)
+      : heap_(heap),
+        delegate_(delegate),
+        last_sync_time_ms_(heap->MonotonicallyIncreasingTimeInMs()) {}
+
+  void VisitRootPointer(Root root, const char* description,
+                        FullObjectSlot p) final {
+    delegate_->VisitRootPointer(root, description, p);
+  }
+
+  void VisitRootPointers(Root root, const char* description,
+                         FullObjectSlot start, FullObjectSlot end) final {
+    delegate_->VisitRootPointers(root, description, start, end);
+  }
+
+  void VisitRootPointers(Root root, const char* description,
+                         OffHeapObjectSlot start, OffHeapObjectSlot end) final {
+    delegate_->VisitRootPointers(root, description, start, end);
+  }
+
+  void VisitRunningCode(FullObjectSlot p) final {
+    delegate_->VisitRunningCode(p);
+  }
+
+  void Synchronize(VisitorSynchronization::SyncTag tag) final {
+    const double now_ms = heap_->MonotonicallyIncreasingTimeInMs();
+    heap_->tracer()->AddRootCategoryTime(tag, now_ms - last_sync_time_ms_);
+    last_sync_time_ms_ = now_ms;
+    delegate_->Synchronize(tag);
+  }
+
+ private:
+  Heap* heap_;
+  RootVisitor* delegate_;
+  double last_sync_time_ms_;
+};
+
 void Heap::IterateRoots(RootVisitor* v, base::EnumSet<SkipRoot> options) {
+  base::Optional<RootCategoryTimingVisitor> timing_visitor;
+  if (V8_UNLIKELY(v8_flags.gc_pause_breakdown) && gc_state() != NOT_IN_GC) {
+    timing_visitor.emplace(this, v);
+    v = &timing_visitor.value();
+  }
+
   v->VisitRootPointers(Root::kStrongRootList, nullptr,
                        roots_table().strong_roots_begin(),
                        roots_table().strong_roots_end());
@@ -4839,6 +4996,16 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints) {
       // This will cause more frequent GCs when stressing.
       max_semi_space_size_ = MB;
     }
+    if (v8_flags.minor_mc && v8_flags.minor_mc_max_pause > 0) {
+      // Cap the young generation such that even a full evacuation at a
+      // conservative processing speed fits into the configured pause target.
+      // The concurrent marking trigger (see MinorMCTaskTriggerSize) refines
+      // this estimate with observed minor GC speeds at runtime.
+      const size_t pause_based_limit = static_cast<size_t>(
+          GCTracer::kConservativeSpeedInBytesPerMillisecond *
+          v8_flags.minor_mc_max_pause);
+      max_semi_space_size_ = std::min(max_semi_space_size_, pause_based_limit);
+    }
     // TODO(dinfuehr): Rounding to a power of 2 is not longer needed. Remove it.
     max_semi_space_size_ =
         static_cast<size_t>(base::bits::RoundUpToPowerOfTwo64(
@@ -5650,6 +5817,15 @@ void Heap::NotifyDeserializationComplete() {
   PagedSpaceIterator spaces(this);
   for (PagedSpace* s = spaces.Next(); s != nullptr; s = spaces.Next()) {
     if (isolate()->snapshot_available()) s->ShrinkImmortalImmovablePages();
+    if (v8_flags.mergeable_snapshot_pages && s->identity() != CODE_SPACE) {
+      // Isolates deserialized from the same snapshot start out with largely
+      // identical old-generation pages; letting the OS merge them keeps the
+      // content shared copy-on-write until an isolate actually writes to it.
+      for (Page* p : *s) {
+        base::OS::AdviseMergeable(reinterpret_cast<void*>(p->address()),
+                                  p->size());
+      }
+    }
 #ifdef DEBUG
     // All pages right after bootstrapping must be marked as never-evacuate.
     for (Page* p : *s) {
@@ -5657,6 +5833,12 @@ void Heap::NotifyDeserializationComplete() {
     }
 #endif  // DEBUG
   }
+  if (v8_flags.mergeable_snapshot_pages) {
+    for (BasicMemoryChunk* chunk : read_only_space()->pages()) {
+      base::OS::AdviseMergeable(reinterpret_cast<void*>(chunk->address()),
+                                chunk->size());
+    }
+  }
 
   if (v8_flags.stress_concurrent_allocation) {
     stress_concurrent_allocation_observer_.reset(
@@ -5835,6 +6017,11 @@ void Heap::TearDown() {
   // It's too late for Heap::Verify() here, as parts of the Isolate are
   // already gone by the time this is called.
 
+  for (Handle<SharedFunctionInfo> shared : flushed_recompile_candidates_) {
+    GlobalHandles::Destroy(shared.location());
+  }
+  flushed_recompile_candidates_.clear();
+
   UpdateMaximumCommitted();
 
   if (v8_flags.fuzzer_gc_analysis) {
@@ -6150,7 +6337,7 @@ void Heap::ClearRecordedSlot(HeapObject object, ObjectSlot slot) {
 
 // static
 int Heap::InsertIntoRememberedSetFromCode(MemoryChunk* chunk, Address slot) {
-  RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot);
+  RememberedSet<OLD_TO_NEW>::Insert<AccessMode::ATOMIC>(chunk, slot);
   return 0;
 }
 
@@ -7018,7 +7205,6 @@ void Heap::CombinedGenerationalAndSharedBarrierSlow(HeapObject object,
   MemoryChunk* value_chunk = MemoryChunk::FromHeapObject(value);
 
   if (value_chunk->InYoungGeneration()) {
-    DCHECK_NULL(LocalHeap::Current());
     Heap::GenerationalBarrierSlow(object, slot, value);
 
   } else {
@@ -7053,7 +7239,10 @@ void Heap::CombinedGenerationalAndSharedEphemeronBarrierSlow(
 void Heap::GenerationalBarrierSlow(HeapObject object, Address slot,
                                    HeapObject value) {
   MemoryChunk* chunk = MemoryChunk::FromHeapObject(object);
-  RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot);
+  // Insertion is lock-free: the slot set and its buckets are installed with
+  // compare-and-swap and slot bits are set atomically, so concurrent writers
+  // (e.g. background threads with a LocalHeap) may record slots in parallel.
+  RememberedSet<OLD_TO_NEW>::Insert<AccessMode::ATOMIC>(chunk, slot);
 }
 
 void Heap::SharedHeapBarrierSlow(HeapObject object, Address slot) {
@@ -7068,7 +7257,7 @@ void Heap::RecordEphemeronKeyWrite(EphemeronHashTable table, Address slot) {
     // Minor MC lacks support for specialized generational ephemeron barriers.
     // The regular write barrier works as well but keeps more memory alive.
     MemoryChunk* chunk = MemoryChunk::FromHeapObject(table);
-    RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(chunk, slot);
+    RememberedSet<OLD_TO_NEW>::Insert<AccessMode::ATOMIC>(chunk, slot);
   } else {
     int slot_index = EphemeronHashTable::SlotToIndex(table.address(), slot);
     InternalIndex entry = EphemeronHashTable::IndexToEntry(slot_index);
@@ -7087,6 +7276,16 @@ void Heap::EphemeronKeyWriteBarrierFromCode(Address raw_object,
                                 UPDATE_WRITE_BARRIER);
 }
 
+// static
+void Heap::WriteBarrierForRangeFromCode(Address raw_object,
+                                        Address start_slot_address,
+                                        Address end_slot_address,
+                                        Isolate* isolate) {
+  HeapObject object = HeapObject::cast(Object(raw_object));
+  isolate->heap()->WriteBarrierForRange(object, ObjectSlot(start_slot_address),
+                                        ObjectSlot(end_slot_address));
+}
+
 enum RangeWriteBarrierMode {
   kDoGenerationalOrShared = 1 << 0,
   kDoMarking = 1 << 1,
@@ -7116,7 +7315,7 @@ void Heap::WriteBarrierForRangeImpl(MemoryChunk* source_page, HeapObject object,
 
     if (kModeMask & kDoGenerationalOrShared) {
       if (Heap::InYoungGeneration(value_heap_object)) {
-        RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
+        RememberedSet<OLD_TO_NEW>::Insert<AccessMode::ATOMIC>(
             source_page, slot.address());
       } else if (value_heap_object.InSharedWritableHeap()) {
         RememberedSet<OLD_TO_SHARED>::Insert<AccessMode::ATOMIC>(
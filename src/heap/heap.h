@@ -128,6 +128,7 @@ class SafepointScope;
 class ScavengeJob;
 class Scavenger;
 class ScavengerCollector;
+class SharedFunctionInfo;
 class SharedLargeObjectSpace;
 class SharedReadOnlySpace;
 class SharedSpace;
@@ -480,6 +481,12 @@ class Heap {
       EphemeronHashTable table, Address key_slot);
   V8_EXPORT_PRIVATE static void EphemeronKeyWriteBarrierFromCode(
       Address raw_object, Address address, Isolate* isolate);
+  // Executes the range write barrier for [start_slot, end_slot) inside
+  // |raw_object| on behalf of generated code, covering the whole range with
+  // one remembered-set pass instead of a per-slot barrier.
+  V8_EXPORT_PRIVATE static void WriteBarrierForRangeFromCode(
+      Address raw_object, Address start_slot, Address end_slot,
+      Isolate* isolate);
   V8_EXPORT_PRIVATE static void GenerationalBarrierForCodeSlow(
       Code host, RelocInfo* rinfo, HeapObject value);
   V8_EXPORT_PRIVATE static bool PageFlagsAreConsistent(HeapObject object);
@@ -739,6 +746,12 @@ class Heap {
   V8_EXPORT_PRIVATE void AddRetainedMap(Handle<NativeContext> context,
                                         Handle<Map> map);
 
+  // Records a SharedFunctionInfo whose bytecode was flushed during the current
+  // GC but which is still referenced by a live closure, making re-invocation
+  // likely. Called during the atomic pause; the candidates are enqueued for
+  // background recompilation once the pause is over.
+  void AddFlushedRecompileCandidate(SharedFunctionInfo shared);
+
   // This event is triggered after object is moved to a new place.
   void OnMoveEvent(HeapObject source, HeapObject target, int size_in_bytes);
 
@@ -1854,6 +1867,9 @@ class Heap {
 
   bool ShouldReduceNewSpaceSize() const;
   void ReduceNewSpaceSize();
+  // Hysteresis-based variant of ReduceNewSpaceSize, used when
+  // --adaptive-new-space is on.
+  void AdaptNewSpaceSize();
 
   GCIdleTimeHeapState ComputeHeapState();
 
@@ -1896,6 +1912,11 @@ class Heap {
   void GarbageCollectionEpilogue(GarbageCollector collector);
   void GarbageCollectionEpilogueInSafepoint(GarbageCollector collector);
 
+  // Enqueues flushed-bytecode recompile candidates collected during the last
+  // mark-compact on the lazy compile dispatcher. Runs on the main thread
+  // after the atomic pause; may allocate.
+  void EnqueueFlushedRecompileCandidates();
+
   // Performs a major collection in the whole heap.
   void MarkCompact();
   // Performs a minor collection of just the young generation.
@@ -2145,6 +2166,11 @@ class Heap {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  // Number of consecutive GC epilogues that saw low allocation throughput;
+  // used by AdaptNewSpaceSize() to delay shrinking the semispaces of bursty
+  // workloads.
+  int consecutive_idle_young_gcs_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -2392,6 +2418,11 @@ class Heap {
 
   std::vector<HeapObjectAllocationTracker*> allocation_trackers_;
 
+  // Global handles to SharedFunctionInfos whose bytecode was flushed during
+  // the current GC and which should be recompiled in the background. Filled
+  // during the atomic pause and drained in the epilogue.
+  std::vector<Handle<SharedFunctionInfo>> flushed_recompile_candidates_;
+
   bool is_finalization_registry_cleanup_task_posted_ = false;
 
   bool evacuation_ = false;
@@ -2432,6 +2463,7 @@ class Heap {
   friend class MarkingVisitorBase;
   friend class MarkCompactCollector;
   friend class MarkCompactCollectorBase;
+  friend class MemoryReducer;
   friend class MinorMarkCompactCollector;
   friend class MinorMCTaskObserver;
   friend class NewLargeObjectSpace;
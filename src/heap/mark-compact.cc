@@ -595,6 +595,9 @@ void MarkCompactCollector::CollectGarbage() {
   VerifyMarking();
   heap()->memory_measurement()->FinishProcessing(native_context_stats_);
   RecordObjectStats();
+  if (V8_UNLIKELY(v8_flags.marking_type_stats)) {
+    instance_type_stats_.ReportAndClear(heap()->isolate());
+  }
 
   Sweep();
   Evacuate();
@@ -672,7 +675,15 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   // exist enough compaction speed samples.
   const float kTargetMsPerArea = .5;
 
-  if (heap()->ShouldReduceMemory()) {
+  if (v8_flags.compact_target_fragmentation_percent > 0) {
+    // The embedder pinned the target; pages recover at least this share of
+    // their area when evacuated, bounding the copy cost per recovered byte.
+    *target_fragmentation_percent =
+        std::min(v8_flags.compact_target_fragmentation_percent, 100);
+    *max_evacuated_bytes = heap()->ShouldReduceMemory()
+                               ? kMaxEvacuatedBytesForReduceMemory
+                               : kMaxEvacuatedBytes;
+  } else if (heap()->ShouldReduceMemory()) {
     *target_fragmentation_percent = kTargetFragmentationPercentForReduceMemory;
     *max_evacuated_bytes = kMaxEvacuatedBytesForReduceMemory;
   } else if (heap()->ShouldOptimizeForMemoryUsage()) {
@@ -698,6 +709,14 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (v8_flags.compaction_time_budget_ms > 0 &&
+        estimated_compaction_speed != 0) {
+      // The embedder bounded the evacuation share of the pause by time;
+      // derive the byte quota from the traced compaction speed instead of
+      // using the fixed default.
+      *max_evacuated_bytes = static_cast<size_t>(
+          estimated_compaction_speed * v8_flags.compaction_time_budget_ms);
+    }
   }
 }
 
@@ -930,6 +949,10 @@ void MarkCompactCollector::FinishConcurrentMarking() {
     heap()->concurrent_marking()->FlushMemoryChunkData(
         non_atomic_marking_state());
     heap()->concurrent_marking()->FlushNativeContexts(&native_context_stats_);
+    if (V8_UNLIKELY(v8_flags.marking_type_stats)) {
+      heap()->concurrent_marking()->FlushInstanceTypeStats(
+          &instance_type_stats_);
+    }
   }
   if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap())) {
     cpp_heap->FinishConcurrentMarkingIfNeeded();
@@ -2254,6 +2277,20 @@ bool MarkCompactCollector::MarkTransitiveClosureUntilFixpoint() {
   int iterations = 0;
   int max_iterations = v8_flags.ephemeron_fixpoint_iterations;
 
+  // Unresolved ephemerons the main thread encounters are kept out of the
+  // worklists and bucketed by key in here; concurrent markers keep feeding
+  // their share through next_ephemerons. The buckets are flushed back to
+  // next_ephemerons on exit for the linear fallback and for verification.
+  EphemeronKeyToValues key_to_values;
+  auto flush_key_to_values = [&]() {
+    for (const auto& pair : key_to_values) {
+      local_weak_objects()->next_ephemerons_local.Push(
+          Ephemeron{pair.first, pair.second});
+    }
+    local_weak_objects()->next_ephemerons_local.Publish();
+    key_to_values.clear();
+  };
+
   bool another_ephemeron_iteration_main_thread;
 
   do {
@@ -2261,6 +2298,7 @@ bool MarkCompactCollector::MarkTransitiveClosureUntilFixpoint() {
 
     if (iterations >= max_iterations) {
       // Give up fixpoint iteration and switch to linear algorithm.
+      flush_key_to_values();
       return false;
     }
 
@@ -2274,7 +2312,8 @@ bool MarkCompactCollector::MarkTransitiveClosureUntilFixpoint() {
     {
       TRACE_GC(heap()->tracer(),
                GCTracer::Scope::MC_MARK_WEAK_CLOSURE_EPHEMERON_MARKING);
-      another_ephemeron_iteration_main_thread = ProcessEphemerons();
+      another_ephemeron_iteration_main_thread =
+          ProcessEphemerons(&key_to_values);
     }
 
     // Can only check for local emptiness here as parallel marking tasks may
@@ -2289,21 +2328,50 @@ bool MarkCompactCollector::MarkTransitiveClosureUntilFixpoint() {
            !local_marking_worklists()->IsWrapperEmpty() ||
            !heap()->local_embedder_heap_tracer()->IsRemoteTracingDone());
 
+  flush_key_to_values();
   return true;
 }
 
-bool MarkCompactCollector::ProcessEphemerons() {
+bool MarkCompactCollector::ProcessEphemerons(
+    EphemeronKeyToValues* key_to_values) {
   Ephemeron ephemeron;
   bool another_ephemeron_iteration = false;
 
-  // Drain current_ephemerons and push ephemerons where key and value are still
-  // unreachable into next_ephemerons.
-  while (local_weak_objects()->current_ephemerons_local.Pop(&ephemeron)) {
-    if (ProcessEphemeron(ephemeron.key, ephemeron.value)) {
-      another_ephemeron_iteration = true;
+  // Like ProcessEphemeron, but ephemerons whose key and value are still
+  // unreachable go into the main thread's key buckets instead of back into
+  // next_ephemerons.
+  auto process_ephemeron = [&](const Ephemeron& candidate) {
+    if (marking_state()->IsBlackOrGrey(candidate.key)) {
+      if (marking_state()->WhiteToGrey(candidate.value)) {
+        local_marking_worklists()->Push(candidate.value);
+        another_ephemeron_iteration = true;
+      }
+    } else if (marking_state()->IsWhite(candidate.value)) {
+      key_to_values->insert({candidate.key, candidate.value});
+    }
+  };
+
+  // Resolve buckets whose key was marked since the previous iteration. This
+  // only reads mark bits and drops resolved entries, so iterations after the
+  // first no longer shuffle every unresolved ephemeron through the worklists.
+  for (auto it = key_to_values->begin(); it != key_to_values->end();) {
+    if (marking_state()->IsBlackOrGrey(it->first)) {
+      if (marking_state()->WhiteToGrey(it->second)) {
+        local_marking_worklists()->Push(it->second);
+        another_ephemeron_iteration = true;
+      }
+      it = key_to_values->erase(it);
+    } else {
+      ++it;
     }
   }
 
+  // Drain current_ephemerons and bucket ephemerons where key and value are
+  // still unreachable.
+  while (local_weak_objects()->current_ephemerons_local.Pop(&ephemeron)) {
+    process_ephemeron(ephemeron);
+  }
+
   // Drain marking worklist and push discovered ephemerons into
   // discovered_ephemerons.
   size_t objects_processed;
@@ -2315,12 +2383,9 @@ bool MarkCompactCollector::ProcessEphemerons() {
   if (objects_processed > 0) another_ephemeron_iteration = true;
 
   // Drain discovered_ephemerons (filled in the drain MarkingWorklist-phase
-  // before) and push ephemerons where key and value are still unreachable into
-  // next_ephemerons.
+  // before) and bucket ephemerons where key and value are still unreachable.
   while (local_weak_objects()->discovered_ephemerons_local.Pop(&ephemeron)) {
-    if (ProcessEphemeron(ephemeron.key, ephemeron.value)) {
-      another_ephemeron_iteration = true;
-    }
+    process_ephemeron(ephemeron);
   }
 
   // Flush local ephemerons for main task to global pool.
@@ -2454,6 +2519,7 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
   size_t bytes_processed = 0;
   size_t objects_processed = 0;
   bool is_per_context_mode = local_marking_worklists()->IsPerContextMode();
+  bool collect_type_stats = v8_flags.marking_type_stats;
   Isolate* isolate = heap()->isolate();
   PtrComprCageBase cage_base(isolate);
   CodePageHeaderModificationScope rwx_write_scope(
@@ -2498,6 +2564,9 @@ std::pair<size_t, size_t> MarkCompactCollector::ProcessMarkingWorklist(
       native_context_stats_.IncrementSize(local_marking_worklists()->Context(),
                                           map, object, visited_size);
     }
+    if (V8_UNLIKELY(collect_type_stats)) {
+      instance_type_stats_.IncrementSize(map.instance_type(), visited_size);
+    }
     bytes_processed += visited_size;
     objects_processed++;
     if (bytes_to_process && bytes_processed >= bytes_to_process) {
@@ -2812,6 +2881,34 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
   Isolate* const isolate_;
 };
 
+#ifdef V8_ENABLE_SANDBOX
+class SweepExternalPointerTableJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit SweepExternalPointerTableJobItem(Isolate* isolate)
+      : isolate_(isolate) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1(isolate_->heap()->tracer(),
+              GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE,
+              delegate->IsJoiningThread() ? ThreadKind::kMain
+                                          : ThreadKind::kBackground);
+    // The sweep must run while the mutator is stopped, as no table entries
+    // may be allocated concurrently, and before live objects are evacuated,
+    // as compaction writes through the handle locations recorded during
+    // marking. Both hold here: the atomic pause covers the whole clearing
+    // job, and the job is joined before evacuation starts.
+    isolate_->external_pointer_table().SweepAndCompact(isolate_);
+    if (isolate_->owns_shareable_data()) {
+      isolate_->shared_external_pointer_table().SweepAndCompact(isolate_);
+    }
+  }
+
+ private:
+  Isolate* const isolate_;
+};
+#endif  // V8_ENABLE_SANDBOX
+
 class StringForwardingTableCleaner final {
  public:
   explicit StringForwardingTableCleaner(Heap* heap)
@@ -2902,6 +2999,44 @@ class StringForwardingTableCleaner final {
 
 }  // namespace
 
+// Not in the anonymous namespace so that MarkCompactCollector can befriend
+// the items and grant access to the private clearing methods.
+class ClearTrivialWeakRefJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearTrivialWeakRefJobItem(MarkCompactCollector* collector)
+      : collector_(collector) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1(collector_->heap()->tracer(),
+              GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES,
+              delegate->IsJoiningThread() ? ThreadKind::kMain
+                                          : ThreadKind::kBackground);
+    collector_->ClearTrivialWeakReferences();
+  }
+
+ private:
+  MarkCompactCollector* const collector_;
+};
+
+class ClearWeakCollectionsJobItem final
+    : public ParallelClearingJob::ClearingItem {
+ public:
+  explicit ClearWeakCollectionsJobItem(MarkCompactCollector* collector)
+      : collector_(collector) {}
+
+  void Run(JobDelegate* delegate) final {
+    TRACE_GC1(collector_->heap()->tracer(),
+              GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS,
+              delegate->IsJoiningThread() ? ThreadKind::kMain
+                                          : ThreadKind::kBackground);
+    collector_->ClearWeakCollections();
+  }
+
+ private:
+  MarkCompactCollector* const collector_;
+};
+
 void MarkCompactCollector::ClearNonLiveReferences() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR);
 
@@ -2919,6 +3054,13 @@ void MarkCompactCollector::ClearNonLiveReferences() {
 
   auto clearing_job = std::make_unique<ParallelClearingJob>();
   clearing_job->Add(std::make_unique<ClearStringTableJobItem>(isolate()));
+#ifdef V8_ENABLE_SANDBOX
+  // Note that this must be posted after the string forwarding table was
+  // cleared, as transitioning strings to external representation allocates
+  // external pointer table entries.
+  clearing_job->Add(
+      std::make_unique<SweepExternalPointerTableJobItem>(isolate()));
+#endif  // V8_ENABLE_SANDBOX
   auto clearing_job_handle = V8::GetCurrentPlatform()->PostJob(
       TaskPriority::kUserBlocking, std::move(clearing_job));
 
@@ -2965,31 +3107,57 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // cleared.
     ClearFullMapTransitions();
   }
+
+  // Publish the deferred weak objects of the main thread so that the clearing
+  // tasks below can distribute the entries among themselves.
+  local_weak_objects()->weak_references_local.Publish();
+  local_weak_objects()->ephemeron_hash_tables_local.Publish();
+
+  if (v8_flags.parallel_weak_ref_clearing) {
+    // Per-entry decisions only depend on the mark bits of the values (or
+    // keys, for ephemeron tables), so trivial weak references and weak
+    // collections can be processed from any number of threads. Entries that
+    // require re-linking data structures - dead map values and
+    // JSWeakRef/WeakCell processing - stay on the main thread below.
+    auto weak_clearing_job = std::make_unique<ParallelClearingJob>();
+    const size_t num_trivial_items = std::min<size_t>(
+        4, V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+    for (size_t i = 0; i < num_trivial_items; ++i) {
+      weak_clearing_job->Add(
+          std::make_unique<ClearTrivialWeakRefJobItem>(this));
+    }
+    weak_clearing_job->Add(
+        std::make_unique<ClearWeakCollectionsJobItem>(this));
+    auto weak_clearing_job_handle = V8::GetCurrentPlatform()->PostJob(
+        TaskPriority::kUserBlocking, std::move(weak_clearing_job));
+    // Join immediately: the main thread contributes as well, and the
+    // remaining clearing below depends on the deferred non-trivial entries.
+    weak_clearing_job_handle->Join();
+  } else {
+    {
+      TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
+      ClearTrivialWeakReferences();
+    }
+    {
+      TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+      ClearWeakCollections();
+    }
+  }
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
-    ClearWeakReferences();
-    ClearWeakCollections();
+    ClearNonTrivialWeakReferences();
     ClearJSWeakRefs();
   }
+  {
+    TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+    PruneEphemeronRememberedSet();
+  }
 
   PROFILE(heap()->isolate(), WeakCodeClearEvent());
 
   MarkDependentCodeForDeoptimization();
 
-#ifdef V8_ENABLE_SANDBOX
-  {
-    TRACE_GC(heap()->tracer(),
-             GCTracer::Scope::MC_SWEEP_EXTERNAL_POINTER_TABLE);
-    // External pointer table sweeping needs to happen before evacuating live
-    // objects as it may perform table compaction, which requires objects to
-    // still be at the same location as during marking.
-    isolate()->external_pointer_table().SweepAndCompact(isolate());
-    if (isolate()->owns_shareable_data()) {
-      isolate()->shared_external_pointer_table().SweepAndCompact(isolate());
-    }
-  }
-#endif  // V8_ENABLE_SANDBOX
-
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_JOIN_JOB);
     clearing_job_handle->Join();
@@ -2997,6 +3165,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
 
   DCHECK(weak_objects_.transition_arrays.IsEmpty());
   DCHECK(weak_objects_.weak_references.IsEmpty());
+  DCHECK(weak_objects_.weak_references_non_trivial.IsEmpty());
   DCHECK(weak_objects_.weak_objects_in_code.IsEmpty());
   DCHECK(weak_objects_.js_weak_refs.IsEmpty());
   DCHECK(weak_objects_.weak_cells.IsEmpty());
@@ -3204,6 +3373,16 @@ void MarkCompactCollector::ClearFlushedJsFunctions() {
       RecordSlot(object, slot, HeapObject::cast(target));
     };
     flushed_js_function.ResetIfCodeFlushed(gc_notify_updated_slot);
+
+    // The closure survived the GC even though its code was flushed, so the
+    // function is likely to be re-invoked. Schedule a background recompile to
+    // hide the lazy-compile latency of the next call.
+    if (v8_flags.background_recompile_flushed_bytecode) {
+      SharedFunctionInfo shared = flushed_js_function.shared();
+      if (!shared.is_compiled()) {
+        heap()->AddFlushedRecompileCandidate(shared);
+      }
+    }
   }
 }
 
@@ -3418,9 +3597,13 @@ void MarkCompactCollector::TrimEnumCache(Map map, DescriptorArray descriptors) {
 }
 
 void MarkCompactCollector::ClearWeakCollections() {
-  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+  // Construct a local worklist view instead of using local_weak_objects():
+  // this method may run on several threads in parallel and each invocation
+  // needs its own view to pop tables from.
+  WeakObjects::WeakObjectWorklist<EphemeronHashTable>::Local
+      ephemeron_hash_tables_local(weak_objects_.ephemeron_hash_tables);
   EphemeronHashTable table;
-  while (local_weak_objects()->ephemeron_hash_tables_local.Pop(&table)) {
+  while (ephemeron_hash_tables_local.Pop(&table)) {
     for (InternalIndex i : table.IterateEntries()) {
       HeapObject key = HeapObject::cast(table.KeyAt(i));
 #ifdef VERIFY_HEAP
@@ -3442,6 +3625,9 @@ void MarkCompactCollector::ClearWeakCollections() {
       }
     }
   }
+}
+
+void MarkCompactCollector::PruneEphemeronRememberedSet() {
   for (auto it = heap_->ephemeron_remembered_set_.begin();
        it != heap_->ephemeron_remembered_set_.end();) {
     if (!non_atomic_marking_state()->IsBlackOrGrey(it->first)) {
@@ -3452,12 +3638,19 @@ void MarkCompactCollector::ClearWeakCollections() {
   }
 }
 
-void MarkCompactCollector::ClearWeakReferences() {
-  TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
+void MarkCompactCollector::ClearTrivialWeakReferences() {
   std::pair<HeapObject, HeapObjectSlot> slot;
   HeapObjectReference cleared_weak_ref =
       HeapObjectReference::ClearedValue(isolate());
-  while (local_weak_objects()->weak_references_local.Pop(&slot)) {
+  // Construct local worklist views instead of using local_weak_objects():
+  // this method may run on several threads in parallel and each invocation
+  // needs its own views to pop from and push to.
+  WeakObjects::WeakObjectWorklist<HeapObjectAndSlot>::Local
+      weak_references_local(weak_objects_.weak_references);
+  WeakObjects::WeakObjectWorklist<HeapObjectAndSlot>::Local
+      weak_references_non_trivial_local(
+          weak_objects_.weak_references_non_trivial);
+  while (weak_references_local.Pop(&slot)) {
     HeapObject value;
     // The slot could have been overwritten, so we have to treat it
     // as MaybeObjectSlot.
@@ -3467,15 +3660,37 @@ void MarkCompactCollector::ClearWeakReferences() {
       if (non_atomic_marking_state()->IsBlackOrGrey(value)) {
         // The value of the weak reference is alive.
         RecordSlot(slot.first, HeapObjectSlot(location), value);
+      } else if (value.IsMap()) {
+        // The value is a dead map. Clearing it may also clear a simple
+        // transition on the parent map, which mutates shared state; defer
+        // the entry to the main thread.
+        weak_references_non_trivial_local.Push(slot);
       } else {
-        if (value.IsMap()) {
-          // The map is non-live.
-          ClearPotentialSimpleMapTransition(Map::cast(value));
-        }
         location.store(cleared_weak_ref);
       }
     }
   }
+  weak_references_non_trivial_local.Publish();
+}
+
+void MarkCompactCollector::ClearNonTrivialWeakReferences() {
+  std::pair<HeapObject, HeapObjectSlot> slot;
+  HeapObjectReference cleared_weak_ref =
+      HeapObjectReference::ClearedValue(isolate());
+  while (local_weak_objects()->weak_references_non_trivial_local.Pop(&slot)) {
+    // The slot could have been recorded multiple times during marking, in
+    // which case an earlier iteration already cleared it; re-check the slot
+    // as MaybeObjectSlot like above.
+    MaybeObjectSlot location(slot.second);
+    HeapObject value;
+    if ((*location)->GetHeapObjectIfWeak(&value)) {
+      DCHECK(value.IsMap());
+      DCHECK(!non_atomic_marking_state()->IsBlackOrGrey(value));
+      // The map is non-live.
+      ClearPotentialSimpleMapTransition(Map::cast(value));
+      location.store(cleared_weak_ref);
+    }
+  }
 }
 
 void MarkCompactCollector::ClearJSWeakRefs() {
@@ -4406,6 +4621,8 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
       // going to sweep the page and add page->live_byte_count.
       heap()->old_space()->DecreaseAllocatedBytes(page->allocated_bytes(),
                                                   page);
+    } else {
+      heap()->tracer()->AddEvacuatedBytes(NEW_SPACE, live_bytes_on_page);
     }
     evacuation_items.emplace_back(ParallelWorkItem{}, page);
   }
@@ -4439,7 +4656,10 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
   for (Page* page : old_space_evacuation_pages_) {
     if (page->IsFlagSet(Page::COMPACTION_WAS_ABORTED)) continue;
 
-    live_bytes += non_atomic_marking_state()->live_bytes(page);
+    intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
+    live_bytes += live_bytes_on_page;
+    heap()->tracer()->AddEvacuatedBytes(page->owner_identity(),
+                                        live_bytes_on_page);
     evacuation_items.emplace_back(ParallelWorkItem{}, page);
   }
 
@@ -6387,11 +6607,16 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     DCHECK_LT(0, live_bytes_on_page);
     live_bytes += live_bytes_on_page;
+    // With a pause target configured, batch-promote pages that were not used
+    // for allocation as well: moving them wholesale is cheaper than sweeping
+    // them again on every minor GC.
+    const bool promote_unusable_pages =
+        heap()->tracer()->IsCurrentGCDueToAllocationFailure() ||
+        v8_flags.minor_mc_max_pause > 0;
     if (ShouldMovePage(page, live_bytes_on_page, page->wasted_memory(),
                        MemoryReductionMode::kNone, AlwaysPromoteYoung::kNo,
-                       heap()->tracer()->IsCurrentGCDueToAllocationFailure()
-                           ? PromoteUnusablePages::kYes
-                           : PromoteUnusablePages::kNo)) {
+                       promote_unusable_pages ? PromoteUnusablePages::kYes
+                                              : PromoteUnusablePages::kNo)) {
       EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
       evacuation_items.emplace_back(ParallelWorkItem{}, page);
     } else {
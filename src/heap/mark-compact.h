@@ -6,6 +6,7 @@
 #define V8_HEAP_MARK_COMPACT_H_
 
 #include <atomic>
+#include <unordered_map>
 #include <vector>
 
 #include "include/v8-internal.h"
@@ -16,6 +17,7 @@
 #include "src/heap/marking-worklist.h"
 #include "src/heap/marking.h"
 #include "src/heap/memory-measurement.h"
+#include "src/heap/object-stats.h"
 #include "src/heap/parallel-work-item.h"
 #include "src/heap/spaces.h"
 #include "src/heap/sweeper.h"
@@ -523,9 +525,15 @@ class MarkCompactCollector final : public CollectorBase {
   // fixpoint iteration doesn't finish within a few iterations.
   void MarkTransitiveClosureLinear();
 
+  // Unresolved ephemerons the main thread has taken out of the worklists,
+  // bucketed by key so that later fixpoint iterations check each distinct
+  // key once instead of rescanning every unresolved ephemeron.
+  using EphemeronKeyToValues =
+      std::unordered_multimap<HeapObject, HeapObject, Object::Hasher>;
+
   // Drains ephemeron and marking worklists. Single iteration of the
   // fixpoint iteration.
-  bool ProcessEphemerons();
+  bool ProcessEphemerons(EphemeronKeyToValues* key_to_values);
 
   // Perform Wrapper Tracing if in use.
   void PerformWrapperTracing();
@@ -571,14 +579,26 @@ class MarkCompactCollector final : public CollectorBase {
 
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
-  // The linked list of all encountered weak maps is destroyed.
+  // Only requires the mark bits of the keys and per-table mutation, so it is
+  // safe to run from several threads in parallel.
   void ClearWeakCollections();
 
+  // Removes dead entries of the ephemeron remembered set. Must run on the
+  // main thread after all encountered weak maps have been processed.
+  void PruneEphemeronRememberedSet();
+
   // Goes through the list of encountered weak references and clears those with
-  // dead values. If the value is a dead map and the parent map transitions to
-  // the dead map via weak cell, then this function also clears the map
-  // transition.
-  void ClearWeakReferences();
+  // dead values, except for references to dead maps: those may require
+  // clearing a simple transition on the parent map and are deferred to the
+  // weak_references_non_trivial worklist. Only requires the mark bit of the
+  // value and a store to the (unique) slot, so it is safe to run from several
+  // threads in parallel.
+  void ClearTrivialWeakReferences();
+
+  // Goes through the list of weak references with dead map values deferred by
+  // ClearTrivialWeakReferences and clears them together with any simple map
+  // transition to the dead map. Must run on the main thread.
+  void ClearNonTrivialWeakReferences();
 
   // Goes through the list of encountered JSWeakRefs and WeakCells and clears
   // those with dead values.
@@ -643,6 +663,9 @@ class MarkCompactCollector final : public CollectorBase {
   std::unique_ptr<WeakObjects::Local> local_weak_objects_;
   NativeContextInferrer native_context_inferrer_;
   NativeContextStats native_context_stats_;
+  // Live bytes and counts per instance type, filled while marking when
+  // --marking-type-stats is enabled.
+  InstanceTypeStats instance_type_stats_;
 
   // Candidates for pages that should be evacuated.
   std::vector<Page*> evacuation_candidates_;
@@ -670,6 +693,8 @@ class MarkCompactCollector final : public CollectorBase {
   // the start of each GC.
   base::EnumSet<CodeFlushMode> code_flush_mode_;
 
+  friend class ClearTrivialWeakRefJobItem;
+  friend class ClearWeakCollectionsJobItem;
   friend class FullEvacuator;
   friend class RecordMigratedSlotVisitor;
 };
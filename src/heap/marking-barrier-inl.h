@@ -76,6 +76,13 @@ inline void MarkingBarrier::MarkRange(HeapObject host, TSlot start, TSlot end) {
 bool MarkingBarrier::WhiteToGreyAndPush(HeapObject obj) {
   if (marking_state_.WhiteToGrey(obj)) {
     current_worklist_->Push(obj);
+    if (V8_UNLIKELY(v8_flags.concurrent_marking_early_publish)) {
+      // Barrier pushes normally become visible to concurrent markers only
+      // once a full segment is published. If the markers have drained the
+      // shared worklist, publish a partial segment to keep them fed.
+      current_worklist_->PublishIfConsumersStarving(
+          kEarlyPublishMinSegmentSize);
+    }
     return true;
   }
   return false;
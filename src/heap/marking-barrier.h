@@ -50,6 +50,10 @@ class MarkingBarrier {
   }
 
  private:
+  // Minimum number of barrier pushes accumulated locally before a partial
+  // segment is published to starving concurrent markers.
+  static constexpr uint16_t kEarlyPublishMinSegmentSize = 8;
+
   inline bool ShouldMarkObject(HeapObject value) const;
   inline bool WhiteToGreyAndPush(HeapObject value);
 
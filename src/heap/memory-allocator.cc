@@ -206,8 +206,13 @@ size_t MemoryAllocator::Unmapper::CommittedBufferedMemory() {
   base::MutexGuard guard(&mutex_);
 
   size_t sum = 0;
-  // kPooled chunks are already uncommited. We only have to account for
-  // kRegular and kNonRegular chunks.
+  // kPooled chunks are already uncommited, unless the pool keeps its pages
+  // committed. We always have to account for kRegular and kNonRegular chunks.
+  if (v8_flags.committed_page_pool) {
+    for (auto& chunk : chunks_[ChunkQueueType::kPooled]) {
+      sum += chunk->size();
+    }
+  }
   for (auto& chunk : chunks_[ChunkQueueType::kRegular]) {
     sum += chunk->size();
   }
@@ -517,7 +522,9 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
 
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
-    UncommitMemory(reservation);
+    // With a committed pool the page stays resident and the next allocation
+    // from the pool skips the commit syscall.
+    if (!v8_flags.committed_page_pool) UncommitMemory(reservation);
   } else {
     DCHECK(reservation->IsReserved());
     reservation->Free();
@@ -639,7 +646,12 @@ MemoryAllocator::AllocateUninitializedPageFromPool(Space* space) {
   // Pooled pages are always regular data pages.
   DCHECK_NE(CODE_SPACE, space->identity());
   VirtualMemory reservation(data_page_allocator(), start, size);
-  if (!CommitMemory(&reservation)) return {};
+  if (v8_flags.committed_page_pool) {
+    // Pooled pages were kept committed, so no permission change is needed.
+    UpdateAllocatedSpaceLimits(start, start + size);
+  } else if (!CommitMemory(&reservation)) {
+    return {};
+  }
   if (Heap::ShouldZapGarbage()) {
     ZapBlock(start, size, kZapValue);
   }
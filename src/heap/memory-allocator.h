@@ -103,7 +103,9 @@ class MemoryAllocator {
       // Disables any access on pooled pages before adding them to the pool.
       kUncommitPooled,
 
-      // Free pooled pages. Only used on tear down and last-resort GCs.
+      // Free pooled pages. Used on tear down, last-resort GCs, and when the
+      // heap is expected to stay idle, e.g. after the memory reducer finished
+      // its sequence of memory reducing GCs.
       kFreePooled,
     };
 
@@ -111,6 +111,14 @@ void MemoryReducer::NotifyMarkCompact(const Event& event) {
           "Memory reducer: finished GC #%d (%s)\n", state_.started_gcs,
           state_.action == kWait ? "will do more" : "done");
     }
+    if (state_.action == kDone) {
+      // The isolate finished its sequence of memory reducing GCs and is
+      // expected to stay idle for a while. Return as much committed memory
+      // as possible to the OS: complete any in-flight unmapping work and
+      // release the page pool, which is otherwise only kept around to make
+      // the next page allocation cheap.
+      heap()->EagerlyFreeExternalMemory();
+    }
   }
 }
 
@@ -19,6 +19,7 @@
 #include "src/logging/counters.h"
 #include "src/objects/compilation-cache-table-inl.h"
 #include "src/objects/heap-object.h"
+#include "src/objects/instance-type-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-collection-inl.h"
 #include "src/objects/literal-objects-inl.h"
@@ -1136,5 +1137,61 @@ void ObjectStatsCollector::Collect() {
   }
 }
 
+void InstanceTypeStats::Merge(const InstanceTypeStats& other) {
+  for (size_t i = 0; i < kNumberOfTypes; i++) {
+    live_bytes_[i] += other.live_bytes_[i];
+    live_count_[i] += other.live_count_[i];
+  }
+}
+
+void InstanceTypeStats::Clear() {
+  memset(live_bytes_, 0, sizeof(live_bytes_));
+  memset(live_count_, 0, sizeof(live_count_));
+}
+
+namespace {
+
+const char* InstanceTypeName(InstanceType type) {
+  // JS API object types are allocated dynamically and have no enumerator of
+  // their own; fold them into a single histogram label.
+  if (InstanceTypeChecker::IsJSApiObject(type)) return "JS_API_OBJECT_TYPE";
+  switch (type) {
+#define TYPE_NAME(TYPE) \
+  case TYPE:            \
+    return #TYPE;
+    INSTANCE_TYPE_LIST(TYPE_NAME)
+#undef TYPE_NAME
+  }
+  return "UNKNOWN_INSTANCE_TYPE";
+}
+
+}  // namespace
+
+void InstanceTypeStats::ReportAndClear(Isolate* isolate) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  DCHECK_NOT_NULL(recorder);
+  if (recorder->HasEmbedderRecorder()) {
+    v8::metrics::GarbageCollectionObjectTypeHistogram event;
+    for (size_t i = 0; i < kNumberOfTypes; i++) {
+      if (live_count_[i] == 0) continue;
+      event.entries.emplace_back();
+      auto& entry = event.entries.back();
+      entry.instance_type_name = InstanceTypeName(static_cast<InstanceType>(i));
+      entry.instance_type = static_cast<int>(i);
+      entry.live_bytes = live_bytes_[i];
+      entry.live_count = live_count_[i];
+    }
+    v8::metrics::Recorder::ContextId id =
+        v8::metrics::Recorder::ContextId::Empty();
+    if (!isolate->context().is_null()) {
+      HandleScope scope(isolate);
+      id = isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+    }
+    recorder->AddMainThreadEvent(event, id);
+  }
+  Clear();
+}
+
 }  // namespace internal
 }  // namespace v8
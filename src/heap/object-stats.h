@@ -192,6 +192,38 @@ class ObjectStatsCollector {
   ObjectStats* const dead_;
 };
 
+// Accumulates live bytes and object counts per InstanceType as a side effect
+// of marking (--marking-type-stats). Unlike ObjectStats this needs no
+// separate heap iteration: the marking visitors already touch every live
+// object, so each full GC yields a complete histogram for free. Marking
+// threads fill disjoint instances which are merged on the main thread.
+class V8_EXPORT_PRIVATE InstanceTypeStats {
+ public:
+  InstanceTypeStats() = default;
+  InstanceTypeStats(const InstanceTypeStats&) = delete;
+  InstanceTypeStats& operator=(const InstanceTypeStats&) = delete;
+
+  void IncrementSize(InstanceType type, size_t size) {
+    size_t index = static_cast<size_t>(type);
+    DCHECK_LT(index, kNumberOfTypes);
+    live_bytes_[index] += size;
+    live_count_[index]++;
+  }
+
+  void Merge(const InstanceTypeStats& other);
+  void Clear();
+
+  // Emits a GarbageCollectionObjectTypeHistogram event covering all instance
+  // types with live objects and clears the accumulated counts.
+  void ReportAndClear(Isolate* isolate);
+
+ private:
+  static constexpr size_t kNumberOfTypes = LAST_TYPE + 1;
+
+  size_t live_bytes_[kNumberOfTypes] = {0};
+  size_t live_count_[kNumberOfTypes] = {0};
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -391,8 +391,14 @@ void PagedSpaceBase::ShrinkImmortalImmovablePages() {
 }
 
 Page* PagedSpaceBase::TryExpandImpl() {
-  Page* page = heap()->memory_allocator()->AllocatePage(
-      MemoryAllocator::AllocationMode::kRegular, this, executable());
+  // Non-executable pages can reuse a pooled reservation and save the
+  // mmap/munmap cycle of setting up a fresh mapping.
+  const MemoryAllocator::AllocationMode alloc_mode =
+      executable() == NOT_EXECUTABLE
+          ? MemoryAllocator::AllocationMode::kUsePool
+          : MemoryAllocator::AllocationMode::kRegular;
+  Page* page =
+      heap()->memory_allocator()->AllocatePage(alloc_mode, this, executable());
   if (page == nullptr) return nullptr;
   ConcurrentAllocationMutex guard(this);
   AddPage(page);
@@ -404,8 +410,12 @@ Page* PagedSpaceBase::TryExpandImpl() {
 base::Optional<std::pair<Address, size_t>> PagedSpaceBase::TryExpandBackground(
     size_t size_in_bytes) {
   DCHECK_NE(NEW_SPACE, identity());
-  Page* page = heap()->memory_allocator()->AllocatePage(
-      MemoryAllocator::AllocationMode::kRegular, this, executable());
+  const MemoryAllocator::AllocationMode alloc_mode =
+      executable() == NOT_EXECUTABLE
+          ? MemoryAllocator::AllocationMode::kUsePool
+          : MemoryAllocator::AllocationMode::kRegular;
+  Page* page =
+      heap()->memory_allocator()->AllocatePage(alloc_mode, this, executable());
   if (page == nullptr) return {};
   base::MutexGuard lock(&space_mutex_);
   AddPage(page);
@@ -573,8 +583,17 @@ void PagedSpaceBase::ReleasePage(Page* page) {
   AccountUncommitted(page->size());
   DecrementCommittedPhysicalMemory(page->CommittedPhysicalMemory());
   accounting_stats_.DecreaseCapacity(page->area_size());
-  heap()->memory_allocator()->Free(MemoryAllocator::FreeMode::kConcurrently,
-                                   page);
+  if (identity() != CODE_SPACE &&
+      page->size() == static_cast<size_t>(MemoryChunk::kPageSize)) {
+    // Keep the reservation of regular data pages in the page pool so that the
+    // next expansion of a paged space can reuse it instead of setting up a
+    // fresh mapping.
+    heap()->memory_allocator()->Free(
+        MemoryAllocator::FreeMode::kConcurrentlyAndPool, page);
+  } else {
+    heap()->memory_allocator()->Free(MemoryAllocator::FreeMode::kConcurrently,
+                                     page);
+  }
 }
 
 void PagedSpaceBase::SetReadable() {
@@ -4,14 +4,58 @@
 
 #include "src/heap/pretenuring-handler.h"
 
+#include <unordered_set>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/new-spaces.h"
 #include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+base::LazyMutex prediction_cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(std::unordered_set<uint64_t>,
+                                GetPredictionCache)
+
+}  // namespace
+
+// static
+bool PretenuringPredictionCache::ComputeSiteKey(Isolate* isolate,
+                                                Handle<FeedbackVector> vector,
+                                                int slot, uint64_t* key_out) {
+  SharedFunctionInfo shared = vector->shared_function_info();
+  Object maybe_script = shared.script();
+  if (!maybe_script.IsScript()) return false;
+  Object name = Script::cast(maybe_script).name();
+  // Unnamed scripts (e.g. eval) have no stable identity across isolates.
+  if (!name.IsString()) return false;
+  *key_out = base::hash_combine(String::cast(name).EnsureHash(),
+                                shared.StartPosition(), slot);
+  return true;
+}
+
+// static
+bool PretenuringPredictionCache::ShouldPretenure(uint64_t site_key) {
+  base::MutexGuard guard(prediction_cache_mutex.Pointer());
+  return GetPredictionCache()->count(site_key) > 0;
+}
+
+// static
+void PretenuringPredictionCache::RecordTenureDecision(uint64_t site_key) {
+  base::MutexGuard guard(prediction_cache_mutex.Pointer());
+  GetPredictionCache()->insert(site_key);
+}
+
 PretenturingHandler::PretenturingHandler(Heap* heap)
     : heap_(heap), global_pretenuring_feedback_(kInitialFeedbackCapacity) {}
 
@@ -193,7 +237,12 @@ void PretenturingHandler::ProcessPretenuringFeedback() {
       allocation_sites_to_pretenure_.reset();
     }
 
-    // Step 3: Deopt maybe tenured allocation sites if necessary.
+    // Step 3: Publish decisions for sites tracked for the prediction cache.
+    if (v8_flags.pretenuring_prediction_cache) {
+      PublishPredictionDecisions();
+    }
+
+    // Step 4: Deopt maybe tenured allocation sites if necessary.
     bool deopt_maybe_tenured = DeoptMaybeTenuredAllocationSites();
     if (deopt_maybe_tenured) {
       heap_->ForeachAllocationSite(
@@ -238,7 +287,57 @@ void PretenturingHandler::PretenureAllocationSiteOnNextCollection(
   allocation_sites_to_pretenure_->Push(site);
 }
 
-void PretenturingHandler::reset() { allocation_sites_to_pretenure_.reset(); }
+void PretenturingHandler::TrackSiteForPrediction(AllocationSite site,
+                                                 uint64_t site_key) {
+  if (!prediction_tracked_sites_) {
+    prediction_tracked_sites_.reset(
+        new GlobalHandleVector<AllocationSite>(heap_));
+  }
+  if (prediction_tracked_sites_->size() >=
+      static_cast<size_t>(kMaxPredictionTrackedSites)) {
+    return;
+  }
+  prediction_tracked_sites_->Push(site);
+  prediction_tracked_keys_.push_back(site_key);
+}
+
+void PretenturingHandler::PublishPredictionDecisions() {
+  if (!prediction_tracked_sites_) return;
+  DCHECK_EQ(prediction_tracked_sites_->size(), prediction_tracked_keys_.size());
+  // Sites that have reached a final decision are published (tenure) or dropped
+  // (don't tenure, zombie); the rest stay tracked. Survivors are compacted to
+  // the front so the tail handles can be released.
+  size_t surviving = 0;
+  for (size_t i = 0; i < prediction_tracked_sites_->size(); i++) {
+    AllocationSite site = *(*prediction_tracked_sites_)[i];
+    switch (site.pretenure_decision()) {
+      case AllocationSite::kUndecided:
+      case AllocationSite::kMaybeTenure:
+        (*prediction_tracked_sites_)[surviving].PatchValue(site);
+        prediction_tracked_keys_[surviving] = prediction_tracked_keys_[i];
+        surviving++;
+        break;
+      case AllocationSite::kTenure:
+        PretenuringPredictionCache::RecordTenureDecision(
+            prediction_tracked_keys_[i]);
+        break;
+      case AllocationSite::kDontTenure:
+      case AllocationSite::kZombie:
+        break;
+    }
+  }
+  while (prediction_tracked_sites_->size() > surviving) {
+    prediction_tracked_sites_->Pop();
+  }
+  prediction_tracked_keys_.resize(surviving);
+  if (surviving == 0) prediction_tracked_sites_.reset();
+}
+
+void PretenturingHandler::reset() {
+  allocation_sites_to_pretenure_.reset();
+  prediction_tracked_sites_.reset();
+  prediction_tracked_keys_.clear();
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,7 @@
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
 #include <memory>
+#include <vector>
 
 #include "src/objects/allocation-site.h"
 #include "src/objects/heap-object.h"
@@ -14,10 +15,28 @@
 namespace v8 {
 namespace internal {
 
+class FeedbackVector;
 template <typename T>
 class GlobalHandleVector;
 class Heap;
 
+// Remembers, process-wide, which literal allocation sites ended up being
+// pretenured. A fresh isolate running the same scripts consults the cache
+// when it creates a literal site and starts the site out tenured instead of
+// re-learning the decision over several scavenges. Sites are keyed by script
+// name, function start position and feedback slot, so only sites in named
+// scripts participate. Controlled by --pretenuring-prediction-cache.
+class V8_EXPORT_PRIVATE PretenuringPredictionCache final : public AllStatic {
+ public:
+  // Computes a stable cross-isolate key for the literal site stored in
+  // |vector| at |slot|. Returns false if the enclosing script has no name to
+  // key by.
+  static bool ComputeSiteKey(Isolate* isolate, Handle<FeedbackVector> vector,
+                             int slot, uint64_t* key_out);
+  static bool ShouldPretenure(uint64_t site_key);
+  static void RecordTenureDecision(uint64_t site_key);
+};
+
 class PretenturingHandler final {
  public:
   static const int kInitialFeedbackCapacity = 256;
@@ -56,6 +75,12 @@ class PretenturingHandler final {
   V8_EXPORT_PRIVATE void PretenureAllocationSiteOnNextCollection(
       AllocationSite site);
 
+  // Starts tracking a newly created literal allocation site so that its
+  // eventual pretenuring decision can be published to the
+  // PretenuringPredictionCache under |site_key|.
+  V8_EXPORT_PRIVATE void TrackSiteForPrediction(AllocationSite site,
+                                                uint64_t site_key);
+
   // ===========================================================================
   // Pretenuring. ==============================================================
   // ===========================================================================
@@ -69,7 +94,12 @@ class PretenturingHandler final {
   void RemoveAllocationSitePretenuringFeedback(AllocationSite site);
 
  private:
+  // The strong handles used for tracking keep sites alive until a decision is
+  // published; the cap bounds that retention.
+  static const int kMaxPredictionTrackedSites = 512;
+
   bool DeoptMaybeTenuredAllocationSites() const;
+  void PublishPredictionDecisions();
 
   Heap* const heap_;
 
@@ -82,6 +112,12 @@ class PretenturingHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  // Sites tracked for the PretenuringPredictionCache and their keys, in
+  // registration order.
+  std::unique_ptr<GlobalHandleVector<AllocationSite>>
+      prediction_tracked_sites_;
+  std::vector<uint64_t> prediction_tracked_keys_;
 };
 
 }  // namespace internal
@@ -245,6 +245,8 @@ void IsolateSafepoint::Barrier::NotifyPark() {
 }
 
 void IsolateSafepoint::Barrier::WaitInSafepoint() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+               "IsolateSafepoint::WaitInSafepoint");
   base::MutexGuard guard(&mutex_);
   CHECK(IsArmed());
   stopped_++;
@@ -256,6 +258,8 @@ void IsolateSafepoint::Barrier::WaitInSafepoint() {
 }
 
 void IsolateSafepoint::Barrier::WaitInUnpark() {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+               "IsolateSafepoint::WaitInUnpark");
   base::MutexGuard guard(&mutex_);
 
   while (IsArmed()) {
@@ -574,11 +574,18 @@ void ScavengerCollector::MergeSurvivingNewLargeObjects(
 
 int ScavengerCollector::NumberOfScavengeTasks() {
   if (!v8_flags.parallel_scavenge) return 1;
-  const int num_scavenge_tasks =
-      static_cast<int>(
-          SemiSpaceNewSpace::From(heap_->new_space())->TotalCapacity()) /
-          MB +
-      1;
+  // Predict the amount of copy work from the bytes currently in new space and
+  // the survival ratio of recent scavenges. Sizing the task count from the
+  // semispace capacity alone overcommits workers for mostly-dead young
+  // generations, where task setup dominates the actual copying.
+  size_t expected_work = SemiSpaceNewSpace::From(heap_->new_space())->Size();
+  GCTracer* tracer = heap_->tracer();
+  if (tracer->SurvivalEventsRecorded()) {
+    expected_work = static_cast<size_t>(
+        expected_work * std::min(tracer->AverageSurvivalRatio(), 100.0) / 100);
+  }
+  if (expected_work < kSingleThreadedScavengeWorkThreshold) return 1;
+  const int num_scavenge_tasks = static_cast<int>(expected_work / MB) + 1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
   int tasks = std::max(
       1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
@@ -241,6 +241,9 @@ class ScavengerCollector {
  public:
   static const int kMaxScavengerTasks = 8;
   static const int kMainThreadId = 0;
+  // Expected surviving bytes below which scavenging runs single-threaded on
+  // the main thread; spawning worker tasks costs more than the copy work.
+  static const size_t kSingleThreadedScavengeWorkThreshold = 256 * KB;
 
   explicit ScavengerCollector(Heap* heap);
 
@@ -12,7 +12,9 @@
 #include "src/ic/handler-configuration.h"
 #include "src/init/heap-symbols.h"
 #include "src/init/setup-isolate.h"
+#include "src/interpreter/constant-array-builder.h"
 #include "src/interpreter/interpreter.h"
+#include "src/numbers/conversions.h"
 #include "src/objects/arguments.h"
 #include "src/objects/call-site-info.h"
 #include "src/objects/cell-inl.h"
@@ -707,6 +709,23 @@ void Heap::CreateInitialObjects() {
     single_character_string_table().set(i, *str);
   }
 
+  // Allocate and initialize table for strings of small non-negative integers,
+  // so that converting common indices and counters to strings neither
+  // allocates nor goes through the per-isolate number-string cache. Since the
+  // table lives in the read-only space, it is shared by all isolates in the
+  // process when the read-only heap is shared.
+  constexpr int kSmiStringTableSize = 1024;
+  set_smi_string_table(
+      *factory->NewFixedArray(kSmiStringTableSize, AllocationType::kReadOnly));
+  for (int i = 0; i < kSmiStringTableSize; ++i) {
+    char arr[16];
+    base::Vector<char> buffer(arr, arraysize(arr));
+    Handle<String> str =
+        factory->InternalizeUtf8String(IntToCString(i, buffer));
+    DCHECK(ReadOnlyHeap::Contains(*str));
+    smi_string_table().set(i, *str);
+  }
+
   for (unsigned i = 0; i < arraysize(constant_string_table); i++) {
     Handle<String> str =
         factory->InternalizeUtf8String(constant_string_table[i].contents);
@@ -867,6 +886,11 @@ void Heap::CreateInitialObjects() {
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
+  // Allocate cache for sharing constant pools between functions of a script.
+  set_shared_constant_pool_cache(*factory->NewFixedArray(
+      interpreter::SharedConstantPoolCache::kSharedConstantPoolCacheSize,
+      AllocationType::kOld));
+
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
       factory->NewManyClosuresCell(factory->undefined_value());
@@ -999,8 +1023,9 @@ void Heap::CreateInitialObjects() {
   // Initialize builtins constants table.
   set_builtins_constants_table(roots.empty_fixed_array());
 
-  // Initialize descriptor cache.
+  // Initialize lookup caches.
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->negative_lookup_cache()->Clear();
 
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
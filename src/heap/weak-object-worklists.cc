@@ -121,6 +121,12 @@ void WeakObjects::UpdateWeakReferences(
       });
 }
 
+// static
+void WeakObjects::UpdateWeakReferencesNonTrivial(
+    WeakObjectWorklist<HeapObjectAndSlot>& weak_references) {
+  UpdateWeakReferences(weak_references);
+}
+
 // static
 void WeakObjects::UpdateWeakObjectsInCode(
     WeakObjectWorklist<HeapObjectAndCode>& weak_objects_in_code) {
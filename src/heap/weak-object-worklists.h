@@ -54,6 +54,12 @@ class TransitionArray;
   /* TODO(marja): For old space, we only need the slot, not the host object. \
      Optimize this by adding a different storage for old space. */           \
   F(HeapObjectAndSlot, weak_references, WeakReferences)                      \
+  /* Weak references whose value is a dead map. Clearing such a reference    \
+     may also clear a simple transition on the parent map and is therefore   \
+     deferred to the main thread, while all other weak references can be     \
+     cleared in parallel. */                                                 \
+  F(HeapObjectAndSlot, weak_references_non_trivial,                          \
+    WeakReferencesNonTrivial)                                                \
   F(HeapObjectAndCode, weak_objects_in_code, WeakObjectsInCode)              \
   F(JSWeakRef, js_weak_refs, JSWeakRefs)                                     \
   F(WeakCell, weak_cells, WeakCells)                                         \
@@ -724,6 +724,10 @@ void AccessorAssembler::HandleLoadICSmiHandlerLoadNamedCase(
   BIND(&normal);
   {
     Comment("load_normal");
+    // Probes the holder's property dictionary inline. With
+    // V8_ENABLE_SWISS_NAME_DICTIONARY, PropertyDictionary aliases
+    // SwissNameDictionary and the lookup uses SIMD group probing
+    // (see swiss-name-dictionary.tq).
     TNode<PropertyDictionary> properties =
         CAST(LoadSlowProperties(CAST(holder)));
     TVARIABLE(IntPtrT, var_name_index);
@@ -75,7 +75,11 @@ class LoadHandler final : public DataHandler {
   // Defines whether a lookup should be done on lookup start object before
   // proceeding to the prototype chain. Applicable to named property kinds only
   // when loading value from prototype chain. Ignored when loading from lookup
-  // start object.
+  // start object. This bit is set for dictionary-mode lookup start objects,
+  // whose own properties can change without a map transition, so the handler
+  // re-probes the receiver's property dictionary inline on every access. In
+  // particular, this makes cached negative lookups (kNonExistent) sound for
+  // dictionary-mode receivers.
   using LookupOnLookupStartObjectBits =
       DoAccessCheckOnLookupStartObjectBits::Next<bool, 1>;
 
@@ -1097,7 +1097,8 @@ void KeyedStoreGenericAssembler::KeyedStoreGeneric(
   TVARIABLE(IntPtrT, var_index);
   TVARIABLE(Name, var_unique);
   Label if_index(this, &var_index), if_unique_name(this),
-      not_internalized(this), slow(this);
+      not_internalized(this), internalize_string(this, Label::kDeferred),
+      slow(this);
 
   GotoIf(TaggedIsSmi(receiver_maybe_smi), &slow);
   TNode<HeapObject> receiver = CAST(receiver_maybe_smi);
@@ -1131,12 +1132,23 @@ void KeyedStoreGenericAssembler::KeyedStoreGeneric(
   {
     if (v8_flags.internalize_on_the_fly) {
       TryInternalizeString(CAST(key), &if_index, &var_index, &if_unique_name,
-                           &var_unique, &slow, &slow);
+                           &var_unique, &internalize_string, &slow);
     } else {
       Goto(&slow);
     }
   }
 
+  BIND(&internalize_string);
+  {
+    // The key is a non-index string that is not in the string table yet.
+    // Internalizing it here is much cheaper than the generic runtime store
+    // and lets the store itself (including dictionary-mode adds) stay in this
+    // stub; the hash computed during internalization is cached on the name
+    // and reused by the dictionary lookup.
+    var_unique = CAST(CallRuntime(Runtime::kInternalizeString, context, key));
+    Goto(&if_unique_name);
+  }
+
   BIND(&slow);
   {
     if (IsSet() || IsDefineNamedOwn()) {
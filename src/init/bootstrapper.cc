@@ -5569,6 +5569,7 @@ void Genesis::InitializeGlobal_harmony_intl_number_format_v3() {
 #endif  // V8_INTL_SUPPORT
 
 void Genesis::InitializeGlobal_experimental_web_snapshots() {
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   if (!v8_flags.experimental_web_snapshots) return;
 
   Handle<JSGlobalObject> global(native_context()->global_object(), isolate());
@@ -5581,6 +5582,7 @@ void Genesis::InitializeGlobal_experimental_web_snapshots() {
                         Builtin::kWebSnapshotSerialize, 2, false);
   SimpleInstallFunction(isolate_, web_snapshot_object, "deserialize",
                         Builtin::kWebSnapshotDeserialize, 2, false);
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 }
 
 #ifdef V8_INTL_SUPPORT
@@ -4,6 +4,8 @@
 
 #include "src/inspector/v8-heap-profiler-agent-impl.h"
 
+#include "../../third_party/inspector_protocol/crdtp/cbor.h"
+#include "../../third_party/inspector_protocol/crdtp/serializable.h"
 #include "include/v8-context.h"
 #include "include/v8-inspector.h"
 #include "include/v8-platform.h"
@@ -84,6 +86,38 @@ class GlobalObjectNameResolver final
   V8InspectorSessionImpl* m_session;
 };
 
+// Builds the HeapProfiler.addHeapSnapshotChunk notification directly as
+// CBOR from the 8-bit snapshot chunk. The generated Frontend method would
+// widen each chunk to a String16 and convert it back to UTF-8 during
+// serialization; snapshot chunks are pure ASCII JSON, so both conversions
+// are avoidable per-chunk work on a stream that can be hundreds of MB.
+std::unique_ptr<v8_crdtp::Serializable> SerializeHeapSnapshotChunk(
+    const char* data, int size) {
+  namespace cbor = v8_crdtp::cbor;
+  std::vector<uint8_t> bytes;
+  bytes.reserve(size + 64);
+  cbor::EnvelopeEncoder envelope;
+  envelope.EncodeStart(&bytes);
+  bytes.push_back(cbor::EncodeIndefiniteLengthMapStart());
+  cbor::EncodeString8(v8_crdtp::SpanFrom("method"), &bytes);
+  cbor::EncodeString8(v8_crdtp::SpanFrom("HeapProfiler.addHeapSnapshotChunk"),
+                      &bytes);
+  cbor::EncodeString8(v8_crdtp::SpanFrom("params"), &bytes);
+  cbor::EnvelopeEncoder params_envelope;
+  params_envelope.EncodeStart(&bytes);
+  bytes.push_back(cbor::EncodeIndefiniteLengthMapStart());
+  cbor::EncodeString8(v8_crdtp::SpanFrom("chunk"), &bytes);
+  cbor::EncodeFromLatin1(
+      v8_crdtp::span<uint8_t>(reinterpret_cast<const uint8_t*>(data), size),
+      &bytes);
+  bytes.push_back(cbor::EncodeStop());
+  params_envelope.EncodeStop(&bytes);
+  bytes.push_back(cbor::EncodeStop());
+  envelope.EncodeStop(&bytes);
+  DCHECK(cbor::CheckCBORMessage(v8_crdtp::SpanFrom(bytes)).ok());
+  return v8_crdtp::Serializable::From(std::move(bytes));
+}
+
 class HeapSnapshotOutputStream final : public v8::OutputStream {
  public:
   explicit HeapSnapshotOutputStream(protocol::HeapProfiler::Frontend* frontend)
@@ -91,7 +125,7 @@ class HeapSnapshotOutputStream final : public v8::OutputStream {
   void EndOfStream() override {}
   int GetChunkSize() override { return 102400; }
   WriteResult WriteAsciiChunk(char* data, int size) override {
-    m_frontend->addHeapSnapshotChunk(String16(data, size));
+    m_frontend->sendRawNotification(SerializeHeapSnapshotChunk(data, size));
     m_frontend->flush();
     return kContinue;
   }
@@ -1127,9 +1127,11 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::Bind(BytecodeJumpTable* jump_table,
 BytecodeArrayBuilder& BytecodeArrayBuilder::MarkHandler(
     int handler_id, HandlerTable::CatchPrediction catch_prediction) {
   // The handler starts a new basic block, and any reasonable try block won't
-  // let control fall through into it.
-  DCHECK_IMPLIES(register_optimizer_,
-                 register_optimizer_->EnsureAllRegistersAreFlushed());
+  // let control fall through into it. Registers were materialized by the
+  // jump or return that ended the try block, but equivalences recorded on
+  // that (dead) path do not hold on the exceptional edge and must be
+  // dropped.
+  if (register_optimizer_) register_optimizer_->Flush();
   bytecode_array_writer_.BindHandlerTarget(handler_table_builder(), handler_id);
   handler_table_builder()->SetPrediction(handler_id, catch_prediction);
   return *this;
@@ -25,11 +25,13 @@
 #include "src/interpreter/bytecode-register-allocator.h"
 #include "src/interpreter/bytecode-register-optimizer.h"
 #include "src/interpreter/bytecode-register.h"
+#include "src/interpreter/constant-array-builder.h"
 #include "src/interpreter/control-flow-builders.h"
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/debug-objects.h"
+#include "src/objects/script-inl.h"
 #include "src/objects/smi.h"
 #include "src/objects/template-objects.h"
 #include "src/parsing/parse-info.h"
@@ -1195,6 +1197,23 @@ struct NullContextScopeHelper<LocalIsolate> {
 template <typename Isolate>
 using NullContextScopeFor = typename NullContextScopeHelper<Isolate>::Type;
 
+// Replaces |bytecode_array|'s freshly allocated constant pool with an
+// identical one finalized earlier for the same script, if the cache holds
+// one. The duplicate pool is dropped while still young.
+void MaybeShareConstantPool(Isolate* isolate, Handle<Script> script,
+                            Handle<BytecodeArray> bytecode_array) {
+  if (!v8_flags.ignition_share_constant_pools) return;
+  Handle<FixedArray> pool(bytecode_array->constant_pool(), isolate);
+  Handle<FixedArray> shared =
+      SharedConstantPoolCache::Deduplicate(isolate, script->id(), pool);
+  if (*shared != *pool) bytecode_array->set_constant_pool(*shared);
+}
+
+// Background finalization runs on a LocalIsolate and must not touch the
+// main isolate's cache; such functions keep their own pool.
+void MaybeShareConstantPool(LocalIsolate*, Handle<Script>,
+                            Handle<BytecodeArray>) {}
+
 }  // namespace
 
 template <typename IsolateT>
@@ -1227,6 +1246,8 @@ Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(
         incoming_new_target_or_generator_);
   }
 
+  MaybeShareConstantPool(isolate, script, bytecode_array);
+
   return bytecode_array;
 }
 
@@ -341,6 +341,33 @@ void BytecodeRegisterOptimizer::Flush() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::MaterializeAllRegisters() {
+  if (!flush_required_) {
+    return;
+  }
+
+  // Emit the same transfers as Flush() but keep the equivalence sets alive:
+  // they remain valid on the fall-through path after a jump. Registers stay
+  // on the needing-flush list so equivalences are still broken when a label
+  // is eventually bound.
+  for (RegisterInfo* reg_info : registers_needing_flushed_) {
+    if (!reg_info->needs_flush()) continue;
+
+    RegisterInfo* materialized = reg_info->materialized()
+                                     ? reg_info
+                                     : reg_info->GetMaterializedEquivalent();
+    if (materialized == nullptr) continue;
+
+    for (RegisterInfo* equivalent = materialized->GetEquivalent();
+         equivalent != materialized;
+         equivalent = equivalent->GetEquivalent()) {
+      if (equivalent->allocated() && !equivalent->materialized()) {
+        OutputRegisterTransfer(materialized, equivalent);
+      }
+    }
+  }
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info) {
   Register input = input_info->register_value();
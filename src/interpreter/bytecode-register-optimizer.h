@@ -8,6 +8,7 @@
 #include "src/ast/variables.h"
 #include "src/base/compiler-specific.h"
 #include "src/common/globals.h"
+#include "src/flags/flags.h"
 #include "src/interpreter/bytecode-register-allocator.h"
 #include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
@@ -67,18 +68,27 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   void Flush();
   bool EnsureAllRegistersAreFlushed() const;
 
+  // Materialize all live registers without breaking their equivalence sets.
+  void MaterializeAllRegisters();
+
   // Prepares for |bytecode|.
   template <Bytecode bytecode, ImplicitRegisterUse implicit_register_use>
   V8_INLINE void PrepareForBytecode() {
-    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode) ||
-        bytecode == Bytecode::kDebugger ||
-        bytecode == Bytecode::kSuspendGenerator ||
-        bytecode == Bytecode::kResumeGenerator) {
+    if (Bytecodes::IsJump(bytecode) || Bytecodes::IsSwitch(bytecode)) {
+      // All registers must be materialized before emitting a jump or switch
+      // bytecode since the register equivalents at the target aren't known.
+      // The equivalence sets themselves remain valid on the fall-through
+      // path, though, and can be kept; targets are still flushed when their
+      // label is bound.
+      if (v8_flags.ignition_reo_across_jumps) {
+        MaterializeAllRegisters();
+      } else {
+        Flush();
+      }
+    } else if (bytecode == Bytecode::kDebugger ||
+               bytecode == Bytecode::kSuspendGenerator ||
+               bytecode == Bytecode::kResumeGenerator) {
       // All state must be flushed before emitting
-      // - a jump bytecode (as the register equivalents at the jump target
-      //   aren't known)
-      // - a switch bytecode (as the register equivalents at the switch targets
-      //   aren't known)
       // - a call to the debugger (as it can manipulate locals and parameters),
       // - a generator suspend (as this involves saving all registers).
       // - a generator register restore.
@@ -13,6 +13,7 @@
 #include "src/base/functional.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles.h"
+#include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/objects/objects-inl.h"
 
@@ -411,6 +412,81 @@ template Handle<Object> ConstantArrayBuilder::Entry::ToHandle(
 template Handle<Object> ConstantArrayBuilder::Entry::ToHandle(
     LocalIsolate* isolate) const;
 
+namespace {
+
+// Pools match when every slot holds the identical object, or when both slots
+// hold HeapNumbers with identical bits. Strings in constant pools are
+// internalized, so equal source literals compare equal by pointer; HeapNumbers
+// are allocated fresh per pool and need a by-value comparison. Per-function
+// entries (SharedFunctionInfos, ScopeInfos, boilerplates) never compare equal
+// between functions and correctly keep such pools unshared.
+bool PoolsMatch(FixedArray a, FixedArray b) {
+  if (a.length() != b.length()) return false;
+  for (int i = 0; i < a.length(); i++) {
+    Object entry_a = a.get(i);
+    Object entry_b = b.get(i);
+    if (entry_a == entry_b) continue;
+    if (!entry_a.IsHeapNumber() || !entry_b.IsHeapNumber()) return false;
+    if (base::bit_cast<uint64_t>(HeapNumber::cast(entry_a).value()) !=
+        base::bit_cast<uint64_t>(HeapNumber::cast(entry_b).value())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// static
+uint32_t SharedConstantPoolCache::Hash(int script_id, FixedArray pool) {
+  DisallowGarbageCollection no_gc;
+  size_t hash = base::hash_combine(script_id, pool.length());
+  for (int i = 0; i < pool.length(); i++) {
+    Object entry = pool.get(i);
+    if (entry.IsSmi()) {
+      hash = base::hash_combine(hash, Smi::ToInt(entry));
+    } else if (entry.IsHeapNumber()) {
+      hash = base::hash_combine(
+          hash, base::bit_cast<uint64_t>(HeapNumber::cast(entry).value()));
+    } else if (entry.IsString()) {
+      hash = base::hash_combine(hash, String::cast(entry).EnsureHash());
+    }
+    // Other entries are per-function objects that do not contribute to the
+    // hash; PoolsMatch rejects pools that differ in them.
+  }
+  return static_cast<uint32_t>(hash);
+}
+
+// static
+Handle<FixedArray> SharedConstantPoolCache::Deduplicate(
+    Isolate* isolate, int script_id, Handle<FixedArray> pool) {
+  if (pool->length() == 0) return pool;
+  FixedArray cache = isolate->heap()->shared_constant_pool_cache();
+  uint32_t hash = Hash(script_id, *pool);
+  uint32_t index = ((hash & (kSharedConstantPoolCacheSize - 1)) &
+                    ~(kArrayEntriesPerCacheEntry - 1));
+  {
+    DisallowGarbageCollection no_gc;
+    if (cache.get(index + kScriptIdOffset) == Smi::FromInt(script_id)) {
+      Object candidate = cache.get(index + kPoolOffset);
+      if (candidate.IsFixedArray() &&
+          PoolsMatch(FixedArray::cast(candidate), *pool)) {
+        return handle(FixedArray::cast(candidate), isolate);
+      }
+    }
+  }
+  cache.set(index + kScriptIdOffset, Smi::FromInt(script_id));
+  cache.set(index + kPoolOffset, *pool);
+  return pool;
+}
+
+// static
+void SharedConstantPoolCache::Clear(FixedArray cache) {
+  for (int i = 0; i < kSharedConstantPoolCacheSize; i++) {
+    cache.set(i, Smi::zero());
+  }
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -243,6 +243,31 @@ class V8_EXPORT_PRIVATE ConstantArrayBuilder final {
 #undef SINGLETON_ENTRY_FIELD
 };
 
+// Caches finalized constant pools per script so that functions whose pools
+// turn out element-wise identical share a single FixedArray. Bundles with
+// thousands of small, similar functions otherwise repeat the same pool of
+// interned strings and Smis once per function. The cache is a heap root
+// (shared_constant_pool_cache) and is cleared on each full GC, like the
+// regexp results caches.
+class V8_EXPORT_PRIVATE SharedConstantPoolCache final : public AllStatic {
+ public:
+  // Returns a previously finalized pool for |script_id| with the same
+  // contents as |pool| if the cache holds one; otherwise enters |pool|
+  // into the cache and returns it unchanged.
+  static Handle<FixedArray> Deduplicate(Isolate* isolate, int script_id,
+                                        Handle<FixedArray> pool);
+  static void Clear(FixedArray cache);
+
+  static constexpr int kSharedConstantPoolCacheSize = 0x100;
+
+ private:
+  static uint32_t Hash(int script_id, FixedArray pool);
+
+  static constexpr int kScriptIdOffset = 0;
+  static constexpr int kPoolOffset = 1;
+  static constexpr int kArrayEntriesPerCacheEntry = 2;
+};
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -1096,10 +1096,42 @@ void InterpreterAssembler::JumpBackward(TNode<IntPtrT> jump_offset) {
   Jump(jump_offset, true);
 }
 
+void InterpreterAssembler::RecordBranchBias(TNode<BoolT> jump_taken) {
+  if (!v8_flags.ignition_branch_bias) return;
+  Label done(this);
+  TNode<HeapObject> maybe_vector = LoadFeedbackVector();
+  GotoIf(IsUndefined(maybe_vector), &done);
+  TNode<ByteArray> table = LoadObjectField<ByteArray>(
+      CAST(maybe_vector), FeedbackVector::kBranchBiasTableOffset);
+  TNode<IntPtrT> bytecode_offset = BytecodeOffset();
+  if (operand_scale() != OperandScale::kSingle) {
+    // Bucket by the offset of the Wide / ExtraWide prefix bytecode, which is
+    // the offset the compilers see.
+    bytecode_offset = IntPtrSub(bytecode_offset, IntPtrConstant(1));
+  }
+  TNode<IntPtrT> bucket = WordAnd(
+      IntPtrSub(bytecode_offset, IntPtrConstant(kFirstBytecodeOffset)),
+      IntPtrConstant(FeedbackVector::kBranchBiasTableSize - 1));
+  TNode<IntPtrT> offset = IntPtrAdd(
+      IntPtrConstant(ByteArray::kHeaderSize - kHeapObjectTag), bucket);
+  TNode<Int32T> counter =
+      UncheckedCast<Int32T>(Load(MachineType::Int8(), table, offset));
+  TNode<Int32T> updated =
+      Int32Add(counter, SelectInt32Constant(jump_taken, 1, -1));
+  // Saturate by skipping the store once the int8 range is exhausted.
+  GotoIf(Int32GreaterThan(updated, Int32Constant(127)), &done);
+  GotoIf(Int32LessThan(updated, Int32Constant(-128)), &done);
+  StoreNoWriteBarrier(MachineRepresentation::kWord8, table, offset, updated);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 void InterpreterAssembler::JumpConditional(TNode<BoolT> condition,
                                            TNode<IntPtrT> jump_offset) {
   Label match(this), no_match(this);
 
+  RecordBranchBias(condition);
   Branch(condition, &match, &no_match);
   BIND(&match);
   Jump(jump_offset);
@@ -1111,6 +1143,7 @@ void InterpreterAssembler::JumpConditionalByImmediateOperand(
     TNode<BoolT> condition, int operand_index) {
   Label match(this), no_match(this);
 
+  RecordBranchBias(condition);
   Branch(condition, &match, &no_match);
   BIND(&match);
   TNode<IntPtrT> jump_offset = Signed(BytecodeOperandUImmWord(operand_index));
@@ -1123,6 +1156,7 @@ void InterpreterAssembler::JumpConditionalByConstantOperand(
     TNode<BoolT> condition, int operand_index) {
   Label match(this), no_match(this);
 
+  RecordBranchBias(condition);
   Branch(condition, &match, &no_match);
   BIND(&match);
   TNode<IntPtrT> jump_offset =
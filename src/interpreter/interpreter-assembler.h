@@ -234,6 +234,11 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   void JumpIfTaggedNotEqualConstant(TNode<Object> lhs, TNode<Object> rhs,
                                     int operand_index);
 
+  // Bumps the saturating branch-bias counter for the current conditional
+  // jump bytecode: up if |jump_taken| is true, down otherwise. No-op when the
+  // closure has no feedback vector. See FeedbackVector::branch_bias.
+  void RecordBranchBias(TNode<BoolT> jump_taken);
+
   // Updates the profiler interrupt budget for a return.
   void UpdateInterruptBudgetOnReturn();
 
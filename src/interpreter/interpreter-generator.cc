@@ -1946,9 +1946,11 @@ IGNITION_HANDLER(JumpIfToBooleanTrue, InterpreterAssembler) {
   Label if_true(this), if_false(this);
   BranchIfToBooleanIsTrue(value, &if_true, &if_false);
   BIND(&if_true);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
   Jump(relative_jump);
   BIND(&if_false);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 }
 
@@ -1962,9 +1964,11 @@ IGNITION_HANDLER(JumpIfToBooleanTrueConstant, InterpreterAssembler) {
   Label if_true(this), if_false(this);
   BranchIfToBooleanIsTrue(value, &if_true, &if_false);
   BIND(&if_true);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = LoadAndUntagConstantPoolEntryAtOperandIndex(0);
   Jump(relative_jump);
   BIND(&if_false);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 }
 
@@ -1977,8 +1981,10 @@ IGNITION_HANDLER(JumpIfToBooleanFalse, InterpreterAssembler) {
   Label if_true(this), if_false(this);
   BranchIfToBooleanIsTrue(value, &if_true, &if_false);
   BIND(&if_true);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
   BIND(&if_false);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
   Jump(relative_jump);
 }
@@ -1993,8 +1999,10 @@ IGNITION_HANDLER(JumpIfToBooleanFalseConstant, InterpreterAssembler) {
   Label if_true(this), if_false(this);
   BranchIfToBooleanIsTrue(value, &if_true, &if_false);
   BIND(&if_true);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
   BIND(&if_false);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = LoadAndUntagConstantPoolEntryAtOperandIndex(0);
   Jump(relative_jump);
 }
@@ -2082,9 +2090,11 @@ IGNITION_HANDLER(JumpIfUndefinedOrNull, InterpreterAssembler) {
   Label do_jump(this);
   GotoIf(IsUndefined(accumulator), &do_jump);
   GotoIf(IsNull(accumulator), &do_jump);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 
   BIND(&do_jump);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
   Jump(relative_jump);
 }
@@ -2100,9 +2110,11 @@ IGNITION_HANDLER(JumpIfUndefinedOrNullConstant, InterpreterAssembler) {
   Label do_jump(this);
   GotoIf(IsUndefined(accumulator), &do_jump);
   GotoIf(IsNull(accumulator), &do_jump);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 
   BIND(&do_jump);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = LoadAndUntagConstantPoolEntryAtOperandIndex(0);
   Jump(relative_jump);
 }
@@ -2120,10 +2132,12 @@ IGNITION_HANDLER(JumpIfJSReceiver, InterpreterAssembler) {
   BIND(&if_notsmi);
   Branch(IsJSReceiver(CAST(accumulator)), &if_object, &if_notobject);
   BIND(&if_object);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = Signed(BytecodeOperandUImmWord(0));
   Jump(relative_jump);
 
   BIND(&if_notobject);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 }
 
@@ -2141,10 +2155,12 @@ IGNITION_HANDLER(JumpIfJSReceiverConstant, InterpreterAssembler) {
   Branch(IsJSReceiver(CAST(accumulator)), &if_object, &if_notobject);
 
   BIND(&if_object);
+  RecordBranchBias(Int32TrueConstant());
   TNode<IntPtrT> relative_jump = LoadAndUntagConstantPoolEntryAtOperandIndex(0);
   Jump(relative_jump);
 
   BIND(&if_notobject);
+  RecordBranchBias(Int32FalseConstant());
   Dispatch();
 }
 
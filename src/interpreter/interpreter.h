@@ -108,6 +108,16 @@ class Interpreter {
   static const int kNumberOfBytecodes = static_cast<int>(Bytecode::kLast) + 1;
 
   Isolate* isolate_;
+  // Per-isolate table of bytecode handler entry points. The handlers it
+  // points at are already free of runtime instrumentation checks in
+  // production builds: bytecode tracing and dispatch counting are
+  // compile-time options (V8_TRACE_UNOPTIMIZED and
+  // V8_IGNITION_DISPATCH_COUNTING), block coverage is emitted as a dedicated
+  // IncBlockCounter bytecode, and the debugger rewrites the bytecode of
+  // functions it is interested in with DebugBreak variants instead of
+  // hooking every handler. There is therefore no instrumented/bare handler
+  // set to swap between; an undebugged isolate never pays a per-bytecode
+  // check.
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
   Address interpreter_entry_trampoline_instruction_start_;
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
@@ -19,6 +20,26 @@
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define JSON_NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -119,6 +140,90 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Returns the number of leading characters of |chars| that are neither a
+// closing quote, a backslash nor a control character, i.e. the plain body of
+// a one-byte JSON string literal. Scans 16 bytes at a time where vector
+// instructions are available.
+V8_INLINE size_t PlainJsonStringChunkLength(const uint8_t* chars,
+                                            size_t length) {
+  size_t index = 0;
+#ifdef __SSE3__
+  while (index + 16 <= length) {
+    __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + index));
+    __m128i quote = _mm_cmpeq_epi8(in, _mm_set1_epi8('"'));
+    __m128i backslash = _mm_cmpeq_epi8(in, _mm_set1_epi8('\\'));
+    // c < 0x20 exactly when min(c, 0x1F) == c, for unsigned bytes.
+    __m128i control =
+        _mm_cmpeq_epi8(_mm_min_epu8(in, _mm_set1_epi8(0x1F)), in);
+    __m128i terminate =
+        _mm_or_si128(_mm_or_si128(quote, backslash), control);
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(terminate));
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros32(mask);
+  }
+#elif defined(JSON_NEON64)
+  while (index + 16 <= length) {
+    uint8x16_t in = vld1q_u8(chars + index);
+    uint8x16_t terminate =
+        vorrq_u8(vorrq_u8(vceqq_u8(in, vdupq_n_u8('"')),
+                          vceqq_u8(in, vdupq_n_u8('\\'))),
+                 vcltq_u8(in, vdupq_n_u8(0x20)));
+    // Narrow the 16 byte lanes to one nibble each.
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(terminate), 4)),
+        0);
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+#endif
+  while (index < length &&
+         !MayTerminateJsonString(character_json_scan_flags[chars[index]])) {
+    index++;
+  }
+  return index;
+}
+
+// Returns the length of the run of decimal digits at the start of |chars|.
+V8_INLINE size_t DecimalDigitChunkLength(const uint8_t* chars, size_t length) {
+  size_t index = 0;
+#ifdef __SSE3__
+  while (index + 16 <= length) {
+    __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + index));
+    __m128i value = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    // Digit exactly when the biased value is unsigned-less-equal 9.
+    __m128i digit = _mm_cmpeq_epi8(_mm_min_epu8(value, _mm_set1_epi8(9)), value);
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(digit)) ^ 0xFFFF;
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros32(mask);
+  }
+#elif defined(JSON_NEON64)
+  while (index + 16 <= length) {
+    uint8x16_t value = vsubq_u8(vld1q_u8(chars + index), vdupq_n_u8('0'));
+    uint8x16_t digit = vcleq_u8(value, vdupq_n_u8(9));
+    uint64_t mask = ~vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(digit), 4)), 0);
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+#endif
+  while (index < length && IsDecimalDigit(chars[index])) index++;
+  return index;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -1224,6 +1329,10 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
 
 template <typename Char>
 void JsonParser<Char>::AdvanceToNonDecimal() {
+  if (sizeof(Char) == 1) {
+    cursor_ += DecimalDigitChunkLength(reinterpret_cast<const uint8_t*>(cursor_),
+                                       end_ - cursor_);
+  }
   cursor_ =
       std::find_if(cursor_, end_, [](Char c) { return !IsDecimalDigit(c); });
 }
@@ -1463,6 +1572,12 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    if (sizeof(Char) == 1) {
+      // One-byte input: skip the plain body of the literal a vector at a
+      // time. The find_if below then lands directly on the terminator.
+      cursor_ += PlainJsonStringChunkLength(
+          reinterpret_cast<const uint8_t*>(cursor_), end_ - cursor_);
+    }
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
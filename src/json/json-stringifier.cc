@@ -646,7 +646,8 @@ JsonStringifier::Result JsonStringifier::SerializeSmi(Smi object) {
   static const int kBufferSize = 100;
   char chars[kBufferSize];
   base::Vector<char> buffer(chars, kBufferSize);
-  builder_.AppendCString(IntToCString(object.value(), buffer));
+  const char* string = IntToCString(object.value(), buffer);
+  builder_.AppendCString(string, static_cast<int>(strlen(string)));
   return SUCCESS;
 }
 
@@ -658,7 +659,8 @@ JsonStringifier::Result JsonStringifier::SerializeDouble(double number) {
   static const int kBufferSize = 100;
   char chars[kBufferSize];
   base::Vector<char> buffer(chars, kBufferSize);
-  builder_.AppendCString(DoubleToCString(number, buffer));
+  const char* string = DoubleToCString(number, buffer);
+  builder_.AppendCString(string, static_cast<int>(strlen(string)));
   return SUCCESS;
 }
 
@@ -4,16 +4,24 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
-#include "src/libplatform/delayed-task-queue.h"
+#include <algorithm>
+
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    : time_function_(time_function) {
+  // Keep at least one shard so that tasks posted to a pool of size zero are
+  // still stored (and dropped at termination), as before.
+  uint32_t num_shards = std::max(1u, thread_pool_size);
+  for (uint32_t i = 0; i < num_shards; ++i) {
+    shards_.push_back(std::make_unique<TaskShard>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(this, i));
   }
 }
 
@@ -24,24 +32,50 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 }
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
-  base::MutexGuard guard(&lock_);
-  terminated_ = true;
-  queue_.Terminate();
-  // Clearing the thread pool lets all worker threads join.
+  {
+    base::MutexGuard guard(&lock_);
+    terminated_.store(true, std::memory_order_relaxed);
+    delayed_tasks_.clear();
+    idle_workers_cv_.NotifyAll();
+  }
+  // Clearing the thread pool lets all worker threads join; they keep draining
+  // the shards until those are empty.
   thread_pool_.clear();
+  // Drop whatever is left (only non-empty for a pool of size zero).
+  for (auto& shard : shards_) {
+    base::MutexGuard guard(&shard->mutex);
+    while (!shard->tasks.empty()) shard->tasks.pop();
+  }
 }
 
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  uint32_t shard_index = next_post_shard_.fetch_add(
+                             1, std::memory_order_relaxed) %
+                         shards_.size();
+  {
+    TaskShard& shard = *shards_[shard_index];
+    base::MutexGuard guard(&shard.mutex);
+    shard.tasks.push(std::move(task));
+  }
+  // Wake a worker if any is (about to go) idle. Sequentially consistent
+  // ordering makes sure that either this load observes the worker's
+  // registration, or the worker's final shard re-check observes the push
+  // above.
+  if (idle_workers_.load(std::memory_order_seq_cst) > 0) {
+    base::MutexGuard guard(&lock_);
+    idle_workers_cv_.NotifyOne();
+  }
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
+  DCHECK_GE(delay_in_seconds, 0.0);
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  delayed_tasks_.emplace(deadline, std::move(task));
+  idle_workers_cv_.NotifyOne();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -55,21 +89,84 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
-  return queue_.GetNext();
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryPopFromShards(
+    uint32_t thread_index) {
+  const size_t num_shards = shards_.size();
+  for (size_t i = 0; i < num_shards; i++) {
+    TaskShard& shard = *shards_[(thread_index + i) % num_shards];
+    base::MutexGuard guard(&shard.mutex);
+    if (!shard.tasks.empty()) {
+      std::unique_ptr<Task> result = std::move(shard.tasks.front());
+      shard.tasks.pop();
+      return result;
+    }
+  }
+  return nullptr;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(
+    uint32_t thread_index) {
+  for (;;) {
+    // Fast path: pop from our own shard, stealing from the others when it is
+    // empty. No global lock is taken.
+    if (std::unique_ptr<Task> task = TryPopFromShards(thread_index)) {
+      return task;
+    }
+
+    base::MutexGuard guard(&lock_);
+    // Move a delayed task that has hit its deadline straight to execution.
+    double now = MonotonicallyIncreasingTime();
+    if (!delayed_tasks_.empty() && delayed_tasks_.begin()->first <= now) {
+      std::unique_ptr<Task> result =
+          std::move(delayed_tasks_.begin()->second);
+      delayed_tasks_.erase(delayed_tasks_.begin());
+      return result;
+    }
+
+    if (terminated_.load(std::memory_order_relaxed)) {
+      idle_workers_cv_.NotifyAll();
+      return nullptr;
+    }
+
+    // Register as idle, then re-check the shards once: a task posted after
+    // the scan above is either seen now, or its poster sees our registration
+    // and issues a wakeup.
+    idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+    if (std::unique_ptr<Task> task = TryPopFromShards(thread_index)) {
+      idle_workers_.fetch_sub(1, std::memory_order_seq_cst);
+      return task;
+    }
+
+    if (!delayed_tasks_.empty()) {
+      // Wait for the next delayed task or a newly posted task.
+      double wait_in_seconds = delayed_tasks_.begin()->first - now;
+      base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
+          base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
+
+      // WaitFor unfortunately doesn't care about our fake time and will wait
+      // the 'real' amount of time, based on whatever clock the system call
+      // uses.
+      bool notified = idle_workers_cv_.WaitFor(&lock_, wait_delta);
+      USE(notified);
+    } else {
+      idle_workers_cv_.Wait(&lock_);
+    }
+    idle_workers_.fetch_sub(1, std::memory_order_seq_cst);
+  }
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, uint32_t thread_index)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      thread_index_(thread_index) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  while (std::unique_ptr<Task> task = runner_->GetNext(thread_index_)) {
     task->Run();
   }
 }
@@ -5,14 +5,17 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <queue>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
-#include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
@@ -44,7 +47,8 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
  private:
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
+                 uint32_t thread_index);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -55,18 +59,41 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    uint32_t thread_index_;
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // A locked FIFO of immediate tasks. Each worker thread owns one shard;
+  // posting round-robins across shards and workers that run dry steal from
+  // the other shards, so no single lock is contended by all threads at once.
+  struct TaskShard {
+    base::Mutex mutex;
+    std::queue<std::unique_ptr<Task>> tasks;
+  };
+
+  // Called by the WorkerThread. Gets the next task (delayed or immediate) to
+  // be executed. Blocks if no task is available.
+  std::unique_ptr<Task> GetNext(uint32_t thread_index);
+
+  // Pops a task from the shard owned by |thread_index|, stealing from the
+  // other shards when it is empty. Returns nullptr if all shards are empty.
+  std::unique_ptr<Task> TryPopFromShards(uint32_t thread_index);
 
-  bool terminated_ = false;
+  std::atomic<bool> terminated_{false};
+  // Guards the delayed task queue and sleeping workers; shards have their own
+  // locks. Threads never wait on |lock_| while holding a shard mutex; workers
+  // going idle take |lock_| first and shard mutexes second.
   base::Mutex lock_;
+  base::ConditionVariable idle_workers_cv_;
+  // Number of workers that are sleeping or about to re-check the shards one
+  // last time before sleeping. Posting threads only take |lock_| to issue a
+  // wakeup when this is non-zero.
+  std::atomic<uint32_t> idle_workers_{0};
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
-  // Worker threads access this queue, so we can only destroy it after all
+  // Worker threads access the shards, so they can only be destroyed after all
   // workers stopped.
-  DelayedTaskQueue queue_;
+  std::vector<std::unique_ptr<TaskShard>> shards_;
+  std::atomic<uint32_t> next_post_shard_{0};
+  std::multimap<double, std::unique_ptr<Task>> delayed_tasks_;
   TimeFunction time_function_;
 };
 
@@ -4,6 +4,7 @@
 
 #include "src/logging/log.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdarg>
 #include <memory>
@@ -14,6 +15,7 @@
 #include "src/base/functional.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/base/platform/wrappers.h"
 #include "src/builtins/profile-data-reader.h"
 #include "src/codegen/bailout-reason.h"
@@ -758,6 +760,227 @@ void LowLevelLogger::CodeMovingGCEvent() {
   LogWriteBytes(&tag, sizeof(tag));
 }
 
+// Logs code events as length-prefixed binary records. Records are written
+// into a fixed-size ring buffer that a background thread drains to a file,
+// so the logging fast path performs no I/O and takes no locks. If the drain
+// thread falls behind, records are dropped rather than blocking the mutator.
+// Use tools/ring-prof-to-log.py to convert the output to the textual log
+// format.
+class RingBufferLogger : public CodeEventLogger {
+ public:
+  RingBufferLogger(Isolate* isolate, const char* file_name);
+  ~RingBufferLogger() override;
+
+  void CodeMoveEvent(AbstractCode from, AbstractCode to) override;
+  void CodeDisableOptEvent(Handle<AbstractCode> code,
+                           Handle<SharedFunctionInfo> shared) override {}
+  void CodeMovingGCEvent() override {}
+
+ private:
+  void LogRecordedBuffer(Handle<AbstractCode> code,
+                         MaybeHandle<SharedFunctionInfo> maybe_shared,
+                         const char* name, int length) override;
+#if V8_ENABLE_WEBASSEMBLY
+  void LogRecordedBuffer(const wasm::WasmCode* code, const char* name,
+                         int length) override;
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+  // Binary record structures. On the wire every record consists of a
+  // one-byte tag, a uint32_t payload size and the payload itself.
+  struct CodeInfoRecord {
+    static const char kTag = 'I';
+
+    uint8_t pointer_size;
+  };
+
+  struct CodeCreateRecord {
+    static const char kTag = 'C';
+
+    Address code_address;
+    int32_t code_size;
+    // Followed by the name bytes.
+  };
+
+  struct CodeMoveRecord {
+    static const char kTag = 'M';
+
+    Address from_address;
+    Address to_address;
+  };
+
+  struct DroppedRecord {
+    static const char kTag = 'D';
+
+    uint64_t count;
+  };
+
+  class DrainThread : public base::Thread {
+   public:
+    explicit DrainThread(RingBufferLogger* logger)
+        : base::Thread(Options("v8:RingLog")), logger_(logger) {}
+
+    void Run() override;
+
+   private:
+    RingBufferLogger* logger_;
+  };
+
+  void LogCodeInfo();
+  template <typename T>
+  void WriteRecord(const T& record, const char* extra, uint32_t extra_size);
+  void CopyIn(size_t pos, const char* bytes, uint32_t size);
+  void Drain();
+
+  // Extension added to V8 log file name to get the ring-buffer log name.
+  static const char kLogExt[];
+
+  // Must be a power of two.
+  static constexpr size_t kCapacity = size_t{1} << 20;
+
+  FILE* output_handle_;
+  std::unique_ptr<char[]> buffer_;
+  // Monotonically increasing byte positions; the buffer index is the
+  // position modulo kCapacity. |head_| is advanced only by the producer and
+  // |tail_| only by the drain thread, which makes the buffer lock-free for
+  // the single-producer, single-consumer accesses performed here. Code
+  // events for an isolate are emitted while its thread holds the isolate,
+  // so there is a single producer.
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<bool> stopping_{false};
+  base::Semaphore records_available_{0};
+  DrainThread drain_thread_;
+};
+
+const char RingBufferLogger::kLogExt[] = ".ring";
+
+RingBufferLogger::RingBufferLogger(Isolate* isolate, const char* name)
+    : CodeEventLogger(isolate),
+      output_handle_(nullptr),
+      buffer_(new char[kCapacity]),
+      drain_thread_(this) {
+  // Open the ring-buffer log file.
+  size_t len = strlen(name);
+  base::ScopedVector<char> ring_name(static_cast<int>(len + sizeof(kLogExt)));
+  MemCopy(ring_name.begin(), name, len);
+  MemCopy(ring_name.begin() + len, kLogExt, sizeof(kLogExt));
+  output_handle_ =
+      base::OS::FOpen(ring_name.begin(), base::OS::LogFileOpenMode);
+
+  LogCodeInfo();
+  CHECK(drain_thread_.Start());
+}
+
+RingBufferLogger::~RingBufferLogger() {
+  uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+  if (dropped > 0) {
+    DroppedRecord record;
+    record.count = dropped;
+    WriteRecord(record, nullptr, 0);
+  }
+  stopping_.store(true, std::memory_order_release);
+  records_available_.Signal();
+  drain_thread_.Join();
+  // The drain thread may have exited before the last records were published;
+  // flush whatever is left.
+  Drain();
+  base::Fclose(output_handle_);
+  output_handle_ = nullptr;
+}
+
+void RingBufferLogger::LogCodeInfo() {
+  CodeInfoRecord record;
+  record.pointer_size = kSystemPointerSize;
+  WriteRecord(record, nullptr, 0);
+}
+
+template <typename T>
+void RingBufferLogger::WriteRecord(const T& record, const char* extra,
+                                   uint32_t extra_size) {
+  uint32_t payload_size = static_cast<uint32_t>(sizeof(T)) + extra_size;
+  uint32_t total_size = 1 + sizeof(payload_size) + payload_size;
+  size_t head = head_.load(std::memory_order_relaxed);
+  size_t tail = tail_.load(std::memory_order_acquire);
+  if (kCapacity - (head - tail) < total_size) {
+    // The drain thread is behind; dropping the record is preferable to
+    // blocking the mutator.
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  const char tag = T::kTag;
+  CopyIn(head, &tag, sizeof(tag));
+  CopyIn(head + sizeof(tag), reinterpret_cast<const char*>(&payload_size),
+         sizeof(payload_size));
+  CopyIn(head + sizeof(tag) + sizeof(payload_size),
+         reinterpret_cast<const char*>(&record), sizeof(T));
+  if (extra_size > 0) {
+    CopyIn(head + sizeof(tag) + sizeof(payload_size) + sizeof(T), extra,
+           extra_size);
+  }
+  head_.store(head + total_size, std::memory_order_release);
+  records_available_.Signal();
+}
+
+void RingBufferLogger::CopyIn(size_t pos, const char* bytes, uint32_t size) {
+  size_t index = pos & (kCapacity - 1);
+  size_t contiguous = std::min(static_cast<size_t>(size), kCapacity - index);
+  MemCopy(buffer_.get() + index, bytes, contiguous);
+  if (contiguous < size) {
+    MemCopy(buffer_.get(), bytes + contiguous, size - contiguous);
+  }
+}
+
+void RingBufferLogger::Drain() {
+  size_t tail = tail_.load(std::memory_order_relaxed);
+  size_t head = head_.load(std::memory_order_acquire);
+  while (tail != head) {
+    size_t index = tail & (kCapacity - 1);
+    size_t contiguous = std::min(head - tail, kCapacity - index);
+    size_t rv = fwrite(buffer_.get() + index, 1, contiguous, output_handle_);
+    DCHECK_EQ(contiguous, rv);
+    USE(rv);
+    tail += contiguous;
+  }
+  tail_.store(tail, std::memory_order_release);
+}
+
+void RingBufferLogger::DrainThread::Run() {
+  while (true) {
+    logger_->records_available_.Wait();
+    logger_->Drain();
+    if (logger_->stopping_.load(std::memory_order_acquire)) return;
+  }
+}
+
+void RingBufferLogger::LogRecordedBuffer(Handle<AbstractCode> code,
+                                         MaybeHandle<SharedFunctionInfo>,
+                                         const char* name, int length) {
+  PtrComprCageBase cage_base(isolate_);
+  CodeCreateRecord record;
+  record.code_address = code->InstructionStart(cage_base);
+  record.code_size = code->InstructionSize(cage_base);
+  WriteRecord(record, name, static_cast<uint32_t>(length));
+}
+
+#if V8_ENABLE_WEBASSEMBLY
+void RingBufferLogger::LogRecordedBuffer(const wasm::WasmCode* code,
+                                         const char* name, int length) {
+  CodeCreateRecord record;
+  record.code_address = code->instruction_start();
+  record.code_size = code->instructions().length();
+  WriteRecord(record, name, static_cast<uint32_t>(length));
+}
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+void RingBufferLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
+  PtrComprCageBase cage_base(isolate_);
+  CodeMoveRecord record;
+  record.from_address = from.InstructionStart(cage_base);
+  record.to_address = to.InstructionStart(cage_base);
+  WriteRecord(record, nullptr, 0);
+}
+
 class JitLogger : public CodeEventLogger {
  public:
   JitLogger(Isolate* isolate, JitCodeEventHandler code_event_handler);
@@ -2119,6 +2342,11 @@ bool V8FileLogger::SetUp(Isolate* isolate) {
         std::make_unique<LowLevelLogger>(isolate, log_file_name.str().c_str());
     AddLogEventListener(ll_logger_.get());
   }
+  if (v8_flags.ring_prof) {
+    ring_buffer_logger_ = std::make_unique<RingBufferLogger>(
+        isolate, log_file_name.str().c_str());
+    AddLogEventListener(ring_buffer_logger_.get());
+  }
   ticker_ = std::make_unique<Ticker>(isolate, v8_flags.prof_sampling_interval);
   if (v8_flags.log) UpdateIsLogging(true);
   timer_.Start();
@@ -2238,6 +2466,11 @@ FILE* V8FileLogger::TearDownAndGetLogFile() {
     ll_logger_.reset();
   }
 
+  if (ring_buffer_logger_) {
+    RemoveLogEventListener(ring_buffer_logger_.get());
+    ring_buffer_logger_.reset();
+  }
+
   if (jit_logger_) {
     RemoveLogEventListener(jit_logger_.get());
     jit_logger_.reset();
@@ -66,6 +66,7 @@ class LowLevelLogger;
 class LinuxPerfBasicLogger;
 class LinuxPerfJitLogger;
 class Profiler;
+class RingBufferLogger;
 class SourcePosition;
 class Ticker;
 
@@ -353,6 +354,7 @@ class V8FileLogger : public LogEventListener {
   std::unique_ptr<LinuxPerfJitLogger> perf_jit_logger_;
 #endif
   std::unique_ptr<LowLevelLogger> ll_logger_;
+  std::unique_ptr<RingBufferLogger> ring_buffer_logger_;
   std::unique_ptr<JitLogger> jit_logger_;
 #ifdef ENABLE_GDB_JIT_INTERFACE
   std::unique_ptr<JitLogger> gdb_jit_logger_;
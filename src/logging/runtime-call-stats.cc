@@ -260,6 +260,35 @@ void RuntimeCallStats::Print(std::ostream& os) {
   entries.Print(os);
 }
 
+namespace {
+
+template <typename T>
+void WriteBinaryValue(std::ostream& os, T value) {
+  os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+void RuntimeCallStats::DumpBinary(std::ostream& os) {
+  if (current_timer_.Value() != nullptr) {
+    current_timer_.Value()->Snapshot();
+  }
+  uint32_t num_entries = 0;
+  for (int i = 0; i < kNumberOfCounters; i++) {
+    if (GetCounter(i)->count() > 0) num_entries++;
+  }
+  WriteBinaryValue(os, kBinaryDumpMagic);
+  WriteBinaryValue(os, kBinaryDumpVersion);
+  WriteBinaryValue(os, num_entries);
+  for (int i = 0; i < kNumberOfCounters; i++) {
+    RuntimeCallCounter* counter = GetCounter(i);
+    if (counter->count() == 0) continue;
+    WriteBinaryValue(os, static_cast<uint32_t>(i));
+    WriteBinaryValue(os, counter->count());
+    WriteBinaryValue(os, counter->time().InMicroseconds());
+  }
+}
+
 void RuntimeCallStats::Reset() {
   if (V8_LIKELY(!TracingFlags::is_runtime_stats_enabled())) return;
 
@@ -189,13 +189,16 @@ class RuntimeCallTimer final {
   V(NumberObject_NumberValue)                              \
   V(Object_CallAsConstructor)                              \
   V(Object_CallAsFunction)                                 \
+  V(Object_CreateDataProperties)                           \
   V(Object_CreateDataProperty)                             \
+  V(Object_DeclareShape)                                   \
   V(Object_DefineOwnProperty)                              \
   V(Object_DefineProperty)                                 \
   V(Object_Delete)                                         \
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMany)                                        \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -258,10 +261,12 @@ class RuntimeCallTimer final {
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
+  V(String_NewExternalOneByteFromBackingStore)             \
   V(String_NewExternalTwoByte)                             \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
+  V(String_NewFromUtf8Batch)                               \
   V(String_NewFromUtf8Literal)                             \
   V(StringObject_New)                                      \
   V(StringObject_StringValue)                              \
@@ -280,6 +285,7 @@ class RuntimeCallTimer final {
   V(Uint8ClampedArray_New)                                 \
   V(UnboundModuleScript_GetSourceMappingURL)               \
   V(UnboundModuleScript_GetSourceURL)                      \
+  V(UnboundScript_CompileAllFunctionsWithBaseline)         \
   V(UnboundScript_GetColumnNumber)                         \
   V(UnboundScript_GetId)                                   \
   V(UnboundScript_GetLineNumber)                           \
@@ -386,6 +392,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmInlining)                    \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmLoopPeeling)                 \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmLoopUnrolling)               \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmLoopVectorization)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmOptimization)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmTyping)                      \
                                                                             \
@@ -468,6 +475,7 @@ class RuntimeCallTimer final {
   V(ObjectVerify)                              \
   V(Object_DeleteProperty)                     \
   V(OptimizeBackgroundDispatcherJob)           \
+  V(OptimizeBackgroundMaglev)                  \
   V(OptimizeCode)                              \
   V(OptimizeConcurrentFinalize)                \
   V(OptimizeConcurrentPrepare)                 \
@@ -620,8 +628,19 @@ class RuntimeCallStats final {
   void Add(RuntimeCallStats* other);
   V8_EXPORT_PRIVATE void Print(std::ostream& os);
   V8_EXPORT_PRIVATE void Print();
+  // Writes all counters with a non-zero count to {os} in a compact binary
+  // format: a {kBinaryDumpMagic, kBinaryDumpVersion, entry count} header
+  // followed by one {counter id, count, time in microseconds} record per
+  // counter, all in host byte order. Counter ids follow the
+  // RuntimeCallCounterId enum order and are stable within a build. This is
+  // much cheaper than the formatted Print() output and is meant for
+  // periodically scraping the stats while they are being collected.
+  V8_EXPORT_PRIVATE void DumpBinary(std::ostream& os);
   V8_NOINLINE void Dump(v8::tracing::TracedValue* value);
 
+  static constexpr uint32_t kBinaryDumpMagic = 0x52435344;  // "RCSD"
+  static constexpr uint32_t kBinaryDumpVersion = 1;
+
   ThreadId thread_id() const { return thread_id_; }
   RuntimeCallTimer* current_timer() { return current_timer_.Value(); }
   RuntimeCallCounter* current_counter() { return current_counter_.Value(); }
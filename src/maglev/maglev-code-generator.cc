@@ -973,6 +973,16 @@ class SafepointingNodeProcessor {
   LocalIsolate* local_isolate_;
 };
 
+// Builds the deopt translations for Maglev code. Note that only registers,
+// stack slots and literals can be expressed here so far; there is no support
+// for captured objects yet. That is the blocker for doing escape analysis and
+// scalar replacement of short-lived allocations (iterator result objects in
+// for-of loops, arguments objects, spread targets) in the Maglev pipeline:
+// eliding such an allocation requires describing the dematerialized object in
+// the translation so the deoptimizer can rebuild it, like TurboFan does via
+// TranslationArrayBuilder::BeginCapturedObject.
+// TODO(v8:7700): Support captured objects here and add escape analysis to the
+// Maglev pipeline.
 class MaglevTranslationArrayBuilder {
  public:
   MaglevTranslationArrayBuilder(
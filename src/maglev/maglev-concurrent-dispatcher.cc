@@ -10,6 +10,7 @@
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/handles/persistent-handles.h"
+#include "src/logging/runtime-call-stats-scope.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
@@ -139,6 +140,8 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
     LocalIsolate local_isolate(isolate(), ThreadKind::kBackground);
     DCHECK(local_isolate.heap()->IsParked());
 
+    RCS_SCOPE(&local_isolate, RuntimeCallCounterId::kOptimizeBackgroundMaglev);
+
     while (!incoming_queue()->IsEmpty() && !delegate->ShouldYield()) {
       std::unique_ptr<MaglevCompilationJob> job;
       if (!incoming_queue()->Dequeue(&job)) break;
@@ -146,8 +149,8 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
       TRACE_EVENT_WITH_FLOW0(
           TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.MaglevBackground",
           job.get(), TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
-      RuntimeCallStats* rcs = nullptr;  // TODO(v8:7700): Implement.
-      CompilationJob::Status status = job->ExecuteJob(rcs, &local_isolate);
+      CompilationJob::Status status =
+          job->ExecuteJob(local_isolate.runtime_call_stats(), &local_isolate);
       CHECK_EQ(status, CompilationJob::SUCCEEDED);
       outgoing_queue()->Enqueue(std::move(job));
     }
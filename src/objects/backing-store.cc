@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/platform.h"
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
 #include "src/logging/counters.h"
@@ -223,7 +225,20 @@ BackingStore::~BackingStore() {
     return;
   }
   if (free_on_destruct_) {
-    // JSArrayBuffer backing store. Deallocate through the embedder's allocator.
+    // JSArrayBuffer backing store. Try to return the memory to the pool;
+    // pooling requires the allocator to be kept alive by a shared_ptr.
+    if (v8_flags.backing_store_pool && !is_shared_ &&
+        holds_shared_ptr_to_allocator_ && buffer_start_ != nullptr &&
+        byte_length_ == byte_capacity_ &&
+        BackingStorePool::Get()->Add(
+            buffer_start_, byte_length_,
+            type_specific_data_.v8_api_array_buffer_allocator_shared)) {
+      TRACE_BS("BS:pooled bs=%p mem=%p (length=%zu)\n", this, buffer_start_,
+               byte_length());
+      Clear();
+      return;
+    }
+    // Deallocate through the embedder's allocator.
     auto allocator = get_v8_api_array_buffer_allocator();
     TRACE_BS("BS:free   bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
              buffer_start_, byte_length(), byte_capacity_);
@@ -248,7 +263,18 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     if (shared == SharedFlag::kShared) {
       counters->shared_array_allocations()->AddSample(mb_length);
     }
-    auto allocate_buffer = [allocator, initialized](size_t byte_length) {
+    auto allocate_buffer = [allocator, initialized,
+                            shared](size_t byte_length) {
+      if (v8_flags.backing_store_pool && shared == SharedFlag::kNotShared) {
+        void* pooled = BackingStorePool::Get()->Take(allocator, byte_length);
+        if (pooled != nullptr) {
+          // Pooled blocks come back with undefined contents.
+          if (initialized == InitializedFlag::kZeroInitialized) {
+            memset(pooled, 0, byte_length);
+          }
+          return pooled;
+        }
+      }
       if (initialized == InitializedFlag::kUninitialized) {
         return allocator->AllocateUninitialized(byte_length);
       }
@@ -817,6 +843,84 @@ inline GlobalBackingStoreRegistryImpl* impl() {
 }
 }  // namespace
 
+// static
+BackingStorePool* BackingStorePool::Get() {
+  static base::LeakyObject<BackingStorePool> pool;
+  return pool.get();
+}
+
+void* BackingStorePool::Take(v8::ArrayBuffer::Allocator* allocator,
+                             size_t byte_length) {
+  base::MutexGuard guard(&mutex_);
+  auto it = free_lists_.find({allocator, byte_length});
+  if (it == free_lists_.end()) return nullptr;
+  DCHECK(!it->second.empty());
+  Entry entry = std::move(it->second.back());
+  it->second.pop_back();
+  if (it->second.empty()) free_lists_.erase(it);
+  DCHECK_GE(total_bytes_, byte_length);
+  total_bytes_ -= byte_length;
+  TRACE_BS("BSp:take  mem=%p (length=%zu)\n", entry.buffer_start, byte_length);
+  // Dropping the entry's allocator shared_ptr is fine: the caller obtained
+  // the raw allocator pointer from a live isolate.
+  return entry.buffer_start;
+}
+
+bool BackingStorePool::Add(
+    void* buffer_start, size_t byte_length,
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator) {
+  if (byte_length < kMinPooledByteLength ||
+      byte_length > kMaxPooledByteLength) {
+    return false;
+  }
+  // Discarding requires page granularity.
+  const size_t page_size = base::OS::CommitPageSize();
+  if (!IsAligned(reinterpret_cast<Address>(buffer_start), page_size) ||
+      !IsAligned(byte_length, page_size)) {
+    return false;
+  }
+  // Release the physical pages before the block becomes visible to Take: a
+  // discard in flight after publishing could wipe pages that another thread
+  // has already taken and started writing. The contents need not be
+  // preserved; if the pool turns out to be full the block is freed anyway.
+  CHECK(base::OS::DiscardSystemPages(buffer_start, byte_length));
+  {
+    base::MutexGuard guard(&mutex_);
+    if (total_bytes_ + byte_length > kMaxPooledBytes) return false;
+    total_bytes_ += byte_length;
+    free_lists_[{allocator.get(), byte_length}].push_back(
+        Entry{buffer_start, byte_length, std::move(allocator)});
+  }
+  TRACE_BS("BSp:pool  mem=%p (length=%zu)\n", buffer_start, byte_length);
+  return true;
+}
+
+void BackingStorePool::ReleaseForAllocator(
+    v8::ArrayBuffer::Allocator* allocator) {
+  std::vector<Entry> to_free;
+  {
+    base::MutexGuard guard(&mutex_);
+    for (auto it = free_lists_.begin(); it != free_lists_.end();) {
+      if (it->first.first == allocator) {
+        for (Entry& entry : it->second) {
+          DCHECK_GE(total_bytes_, entry.byte_length);
+          total_bytes_ -= entry.byte_length;
+          to_free.push_back(std::move(entry));
+        }
+        it = free_lists_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+  // Free outside the lock; the entries keep the allocator alive.
+  for (Entry& entry : to_free) {
+    TRACE_BS("BSp:evict mem=%p (length=%zu)\n", entry.buffer_start,
+             entry.byte_length);
+    entry.allocator->Free(entry.buffer_start, entry.byte_length);
+  }
+}
+
 void GlobalBackingStoreRegistry::Register(
     std::shared_ptr<BackingStore> backing_store) {
   if (!backing_store || !backing_store->buffer_start()) return;
@@ -5,11 +5,15 @@
 #ifndef V8_OBJECTS_BACKING_STORE_H_
 #define V8_OBJECTS_BACKING_STORE_H_
 
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "include/v8-array-buffer.h"
 #include "include/v8-internal.h"
 #include "src/base/optional.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles/handles.h"
 
 namespace v8 {
@@ -241,6 +245,55 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   void Clear();  // Internally clears fields after deallocation.
 };
 
+// A global, per-process pool of reusable JSArrayBuffer backing memory,
+// enabled with --backing-store-pool. Blocks are pooled by exact size and
+// allocator, and their physical pages are discarded (madvise) while pooled,
+// so the pool costs address space but little memory. Only backing stores
+// that keep their allocator alive through a shared_ptr are pooled; the
+// pooled entries retain that shared_ptr, which makes reuse safe even after
+// the originating isolate is gone. The pool is engine-owned memory and is
+// not part of the array buffer external memory accounting.
+class V8_EXPORT_PRIVATE BackingStorePool {
+ public:
+  static BackingStorePool* Get();
+
+  // Returns a pooled block of exactly {byte_length} bytes allocated by
+  // {allocator}, or nullptr. The contents of the returned block are
+  // undefined.
+  void* Take(v8::ArrayBuffer::Allocator* allocator, size_t byte_length);
+
+  // Attempts to take ownership of the given block, discarding its physical
+  // pages. Returns false if the block is not poolable (size out of range or
+  // not page-aligned) or the pool is full; the caller then frees the block
+  // as usual.
+  bool Add(void* buffer_start, size_t byte_length,
+           std::shared_ptr<v8::ArrayBuffer::Allocator> allocator);
+
+  // Frees all pooled blocks belonging to the given allocator. Called on
+  // isolate teardown so that pooled blocks do not keep an embedder's
+  // allocator alive indefinitely.
+  void ReleaseForAllocator(v8::ArrayBuffer::Allocator* allocator);
+
+ private:
+  // Only buffers in this size range are pooled; smaller ones are cheap to
+  // allocate and larger ones would empty the pool too quickly.
+  static constexpr size_t kMinPooledByteLength = 64 * KB;
+  static constexpr size_t kMaxPooledByteLength = 1 * MB;
+  static constexpr size_t kMaxPooledBytes = 64 * MB;
+
+  struct Entry {
+    void* buffer_start;
+    size_t byte_length;
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator;
+  };
+
+  base::Mutex mutex_;
+  // Exact-size free lists, keyed by allocator and byte length.
+  std::map<std::pair<v8::ArrayBuffer::Allocator*, size_t>, std::vector<Entry>>
+      free_lists_;
+  size_t total_bytes_ = 0;
+};
+
 // A global, per-process mapping from buffer addresses to backing stores
 // of wasm memory objects.
 class GlobalBackingStoreRegistry {
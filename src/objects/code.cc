@@ -309,10 +309,13 @@ int AbstractCode::SourcePosition(PtrComprCageBase cage_base, int offset) {
   // Subtract one because the current PC is one instruction after the call site.
   if (IsCode(cage_base)) offset--;
   int position = 0;
-  for (SourcePositionTableIterator iterator(
-           source_position_table, SourcePositionTableIterator::kJavaScriptOnly,
-           SourcePositionTableIterator::kDontSkipFunctionEntry);
-       !iterator.done() && iterator.code_offset() <= offset;
+  SourcePositionTableIterator iterator(
+      source_position_table, SourcePositionTableIterator::kJavaScriptOnly,
+      SourcePositionTableIterator::kDontSkipFunctionEntry);
+  // Large tables carry a checkpoint index; skip ahead instead of decoding
+  // the whole delta-encoded stream.
+  iterator.SkipToPosition(offset);
+  for (; !iterator.done() && iterator.code_offset() <= offset;
        iterator.Advance()) {
     position = iterator.source_position().ScriptOffset();
   }
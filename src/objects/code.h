@@ -341,6 +341,16 @@ class Code : public HeapObject {
   // In other words, the variable-size 'body' consists of 'instructions' and
   // 'metadata'.
   //
+  // Note that most non-executed data associated with a Code object already
+  // lives outside the code range: relocation info, deoptimization data and
+  // the source position table are separate old-space arrays referenced from
+  // the header, and with V8_EXTERNAL_CODE_SPACE the mutable header fields
+  // live in an old-space CodeDataContainer. Only the inline metadata tables
+  // listed above (safepoint table, handler table, constant pool, code
+  // comments, unwinding info) occupy code-range pages alongside the
+  // instructions. Splitting those out as well would require decoupling the
+  // body from the instruction stream and is not attempted here.
+  //
   // Note the accessor functions below may be prefixed with 'raw'. In this case,
   // raw accessors (e.g. raw_instruction_start) always refer to the on-heap
   // Code object, while camel-case accessors (e.g. InstructionStart) may refer
@@ -1225,6 +1235,14 @@ class DependentCode : public WeakArrayList {
 DEFINE_OPERATORS_FOR_FLAGS(DependentCode::DependencyGroups)
 
 // BytecodeArray represents a sequence of interpreter bytecodes.
+//
+// The bytecodes themselves are immutable once BytecodeArrayWriter has emitted
+// them, but the object as a whole is not: the GC mutates {bytecode_age} for
+// bytecode flushing, the constant pool holds per-isolate heap references, and
+// the source position table is attached lazily. Any scheme that shares one
+// read-only copy of the bytecode across isolates (akin to the embedded
+// builtins blob) must first move these mutable parts into a per-isolate
+// wrapper object.
 class BytecodeArray
     : public TorqueGeneratedBytecodeArray<BytecodeArray, FixedArrayBase> {
  public:
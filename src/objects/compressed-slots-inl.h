@@ -213,12 +213,14 @@ void OffHeapCompressedObjectSlot<CompressionScheme>::Release_Store(
 }
 
 template <typename CompressionScheme>
-void OffHeapCompressedObjectSlot<CompressionScheme>::Release_CompareAndSwap(
+Object OffHeapCompressedObjectSlot<CompressionScheme>::Release_CompareAndSwap(
     Object old, Object target) const {
   Tagged_t old_ptr = CompressionScheme::CompressTagged(old.ptr());
   Tagged_t target_ptr = CompressionScheme::CompressTagged(target.ptr());
-  AsAtomicTagged::Release_CompareAndSwap(TSlotBase::location(), old_ptr,
-                                         target_ptr);
+  Tagged_t result = AsAtomicTagged::Release_CompareAndSwap(
+      TSlotBase::location(), old_ptr, target_ptr);
+  return Object(CompressionScheme::DecompressTaggedAny(TSlotBase::address(),
+                                                       result));
 }
 
 }  // namespace v8::internal
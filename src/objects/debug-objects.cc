@@ -420,6 +420,14 @@ void ErrorStackData::EnsureStackFrameInfos(Isolate* isolate,
   }
   int limit = Smi::cast(error_stack->limit_or_stack_frame_infos()).value();
   Handle<FixedArray> call_site_infos(error_stack->call_site_infos(), isolate);
+  {
+    Handle<FixedArray> materialized =
+        isolate->MaterializeCallSiteInfos(call_site_infos);
+    if (!materialized.is_identical_to(call_site_infos)) {
+      call_site_infos = materialized;
+      error_stack->set_call_site_infos(*call_site_infos);
+    }
+  }
   Handle<FixedArray> stack_frame_infos =
       isolate->factory()->NewFixedArray(call_site_infos->length());
   int index = 0;
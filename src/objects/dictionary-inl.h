@@ -106,6 +106,34 @@ int BaseNameDictionary<Derived, Shape>::Hash() const {
   return hash;
 }
 
+bool NameDictionary::TryGetCachedEnumKeys(FixedArray* keys_out) {
+  Object cache = this->get(kCachedEnumKeysIndex);
+  if (!cache.IsFixedArray()) return false;
+  FixedArray entry = FixedArray::cast(cache);
+  if (Smi::ToInt(entry.get(kCachedEnumKeysNofIndex)) != NumberOfElements() ||
+      Smi::ToInt(entry.get(kCachedEnumKeysDeletedIndex)) !=
+          NumberOfDeletedElements() ||
+      Smi::ToInt(entry.get(kCachedEnumKeysEnumIndexIndex)) !=
+          next_enumeration_index()) {
+    return false;
+  }
+  *keys_out = FixedArray::cast(entry.get(kCachedEnumKeysKeysIndex));
+  return true;
+}
+
+void NameDictionary::ClearCachedEnumKeys() {
+  this->set(kCachedEnumKeysIndex, this->GetReadOnlyRoots().undefined_value(),
+            SKIP_WRITE_BARRIER);
+}
+
+void NameDictionary::DetailsAtPut(InternalIndex entry, PropertyDetails value) {
+  // Reconfiguring a property (e.g. changing its enumerability) is invisible
+  // to the counters checked by TryGetCachedEnumKeys, so the cached enum keys
+  // have to be dropped explicitly.
+  ClearCachedEnumKeys();
+  Dictionary<NameDictionary, NameDictionaryShape>::DetailsAtPut(entry, value);
+}
+
 GlobalDictionary::GlobalDictionary(Address ptr)
     : BaseNameDictionary<GlobalDictionary, GlobalDictionaryShape>(ptr) {
   SLOW_DCHECK(IsGlobalDictionary());
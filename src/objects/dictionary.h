@@ -123,7 +123,7 @@ class NameDictionaryShape : public BaseDictionaryShape<Handle<Name>> {
   static inline Handle<Object> AsHandle(Isolate* isolate, Handle<Name> key);
   static inline Handle<Object> AsHandle(LocalIsolate* isolate,
                                         Handle<Name> key);
-  static const int kPrefixSize = 2;
+  static const int kPrefixSize = 3;
   static const int kEntrySize = 3;
   static const int kEntryValueIndex = 1;
   static const bool kMatchNeedsHoleCheck = false;
@@ -198,6 +198,37 @@ class V8_EXPORT_PRIVATE NameDictionary
   static const int kEntryDetailsIndex = 2;
   static const int kInitialCapacity = 2;
 
+  // The dictionary-mode counterpart of the descriptor array's enum cache: the
+  // prefix slot at kCachedEnumKeysIndex holds either undefined or a
+  // kCachedEnumKeysSize-sized FixedArray with the enumerable own keys in
+  // enumeration order, together with a snapshot of NumberOfElements(),
+  // NumberOfDeletedElements() and next_enumeration_index() taken when the key
+  // list was computed. The cache is valid as long as all three values still
+  // match the dictionary: every addition bumps the next enumeration index and
+  // every deletion changes the element counts, which also covers mutations
+  // performed by CSA builtins. Property reconfiguration leaves all three
+  // untouched, so DetailsAtPut below drops the cache explicitly.
+  static const int kCachedEnumKeysIndex = kObjectHashIndex + 1;
+
+  // Layout of the FixedArray stored at kCachedEnumKeysIndex.
+  static const int kCachedEnumKeysKeysIndex = 0;
+  static const int kCachedEnumKeysNofIndex = 1;
+  static const int kCachedEnumKeysDeletedIndex = 2;
+  static const int kCachedEnumKeysEnumIndexIndex = 3;
+  static const int kCachedEnumKeysSize = 4;
+
+  // Returns true and stores the cached key list in |keys_out| if the cache is
+  // present and still valid.
+  inline bool TryGetCachedEnumKeys(FixedArray* keys_out);
+  inline void ClearCachedEnumKeys();
+  static void SetCachedEnumKeys(Isolate* isolate,
+                                Handle<NameDictionary> dictionary,
+                                Handle<FixedArray> keys);
+
+  // Shadows Dictionary::DetailsAtPut in order to drop the cached enum keys,
+  // see the comment at kCachedEnumKeysIndex.
+  inline void DetailsAtPut(InternalIndex entry, PropertyDetails value);
+
   inline Name NameAt(InternalIndex entry);
   inline Name NameAt(PtrComprCageBase cage_base, InternalIndex entry);
 
@@ -214,6 +245,9 @@ class V8_EXPORT_PRIVATE GlobalDictionaryShape : public NameDictionaryShape {
   static inline uint32_t HashForObject(ReadOnlyRoots roots, Object object);
 
   static const int kEntrySize = 1;  // Overrides NameDictionaryShape::kEntrySize
+  // Overrides NameDictionaryShape::kPrefixSize: global dictionaries have no
+  // enum keys cache slot.
+  static const int kPrefixSize = 2;
   static const bool kMatchNeedsHoleCheck = true;
 
   template <typename Dictionary>
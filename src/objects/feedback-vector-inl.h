@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_FEEDBACK_VECTOR_INL_H_
 #define V8_OBJECTS_FEEDBACK_VECTOR_INL_H_
 
+#include "src/base/bits.h"
 #include "src/common/globals.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/objects/code-inl.h"
@@ -122,6 +123,13 @@ void FeedbackVector::clear_invocation_count(RelaxedStoreTag tag) {
   set_invocation_count(0, tag);
 }
 
+int FeedbackVector::branch_bias(int bytecode_offset) const {
+  static_assert(base::bits::IsPowerOfTwo(kBranchBiasTableSize));
+  DCHECK_LE(0, bytecode_offset);
+  return static_cast<int8_t>(
+      branch_bias_table().get(bytecode_offset & (kBranchBiasTableSize - 1)));
+}
+
 int FeedbackVector::osr_urgency() const {
   return OsrUrgencyBits::decode(osr_state());
 }
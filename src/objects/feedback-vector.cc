@@ -464,6 +464,46 @@ bool FeedbackVector::ClearSlots(Isolate* isolate, ClearBehavior behavior) {
   return feedback_updated;
 }
 
+bool FeedbackVector::ClearNonPortableSlots(Isolate* isolate) {
+  if (!shared_function_info().HasFeedbackMetadata()) return false;
+  MaybeObject uninitialized_sentinel = MaybeObject::FromObject(
+      FeedbackVector::RawUninitializedSentinel(isolate));
+
+  bool feedback_updated = false;
+  FeedbackMetadataIterator iter(metadata());
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+
+    MaybeObject obj = Get(slot);
+    if (obj == uninitialized_sentinel) continue;
+
+    FeedbackNexus nexus(*this, slot);
+    switch (nexus.kind()) {
+      case FeedbackSlotKind::kLoadProperty:
+      case FeedbackSlotKind::kLoadKeyed:
+      case FeedbackSlotKind::kHasKeyed:
+      case FeedbackSlotKind::kSetNamedSloppy:
+      case FeedbackSlotKind::kSetNamedStrict:
+      case FeedbackSlotKind::kDefineNamedOwn:
+      case FeedbackSlotKind::kSetKeyedSloppy:
+      case FeedbackSlotKind::kSetKeyedStrict:
+      case FeedbackSlotKind::kStoreInArrayLiteral: {
+        HeapObject heap_object;
+        std::pair<MaybeObject, MaybeObject> pair = nexus.GetFeedbackPair();
+        if (pair.first->GetHeapObjectIfWeak(&heap_object) &&
+            heap_object.IsMap() && pair.second->IsSmi()) {
+          continue;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    feedback_updated |= nexus.Clear(ClearBehavior::kDefault);
+  }
+  return feedback_updated;
+}
+
 MaybeObjectHandle NexusConfig::NewHandle(MaybeObject object) const {
   if (mode() == Mode::MainThread) {
     return handle(object, isolate_);
@@ -233,6 +233,18 @@ class FeedbackVector
   DECL_RELAXED_INT32_ACCESSORS(invocation_count)
   inline void clear_invocation_count(RelaxedStoreTag tag);
 
+  // Conditional jump bytecode handlers bump a small saturating counter for
+  // the jump's bucket: incremented when the jump is taken and decremented
+  // when it falls through. Buckets are indexed by bytecode offset modulo the
+  // table size, so distinct jumps may share a counter; the signal is
+  // approximate by design and only used as a compilation hint.
+  static constexpr int kBranchBiasTableSize = 32;  // Must be a power of two.
+  // The absolute counter value from which on a branch counts as biased.
+  static constexpr int kBranchBiasHintThreshold = 16;
+  // Returns the recorded bias for the conditional jump at {bytecode_offset}:
+  // positive means mostly taken, negative mostly fall-through.
+  inline int branch_bias(int bytecode_offset) const;
+
   // The [osr_urgency] controls when OSR is attempted, and is incremented as
   // the function becomes hotter. When the current loop depth is less than the
   // osr_urgency, JumpLoop calls into runtime to attempt OSR optimization.
@@ -364,6 +376,14 @@ class FeedbackVector
     return ClearSlots(isolate, ClearBehavior::kClearAll);
   }
 
+  // Clears all slots except monomorphic map/handler pairs that remain valid
+  // in any isolate deserialized from a snapshot containing this vector: a
+  // weakly held map that is itself serialized into the snapshot, plus a
+  // Smi-encoded handler that is interpreted relative to that map and holds
+  // no isolate-specific pointers. Used by the context serializer when
+  // --serialize-ic-feedback is enabled.
+  bool ClearNonPortableSlots(Isolate* isolate);
+
   // The object that indicates an uninitialized cache.
   static inline Handle<Symbol> UninitializedSentinel(Isolate* isolate);
 
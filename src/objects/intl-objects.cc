@@ -1183,7 +1183,6 @@ bool CharCanFastCompareOrOutOfBounds(const String::FlatContent& string,
   return index >= string_length || CanFastCompare(string.Get(index));
 }
 
-#ifdef DEBUG
 bool USetContainsAllAsciiItem(USet* set) {
   static constexpr int kBufferSize = 64;
   UChar buffer[kBufferSize];
@@ -1280,7 +1279,6 @@ bool CollatorAllowsFastComparison(const icu::Collator& icu_collator) {
 
   return true;
 }
-#endif  // DEBUG
 
 // Fast comparison is implemented for charcodes for which the L1 collation
 // weight (see kCollactionWeightsL1 above) is not 0.
@@ -1408,6 +1406,11 @@ const uint8_t* Intl::AsciiCollationWeightsL3() {
 // static
 const int Intl::kAsciiCollationWeightsLength = kCollationWeightsLength;
 
+// static
+bool Intl::CollatorSupportsFastComparison(const icu::Collator& icu_collator) {
+  return CollatorAllowsFastComparison(icu_collator);
+}
+
 // ecma402/#sec-collator-comparestrings
 int Intl::CompareStrings(Isolate* isolate, const icu::Collator& icu_collator,
                          Handle<String> string1, Handle<String> string2,
@@ -141,6 +141,12 @@ class Intl {
       CompareStringsOptions compare_strings_options =
           CompareStringsOptions::kNone);
 
+  // Whether the collator's locale and settings permit the table-driven ASCII
+  // fast path of CompareStrings. Evaluating the conditions is not cheap, so
+  // JSCollator caches the answer at construction time.
+  V8_EXPORT_PRIVATE static bool CollatorSupportsFastComparison(
+      const icu::Collator& icu_collator);
+
   // ecma402/#sup-properties-of-the-number-prototype-object
   V8_WARN_UNUSED_RESULT static MaybeHandle<String> NumberToLocaleString(
       Isolate* isolate, Handle<Object> num, Handle<Object> locales,
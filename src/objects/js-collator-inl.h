@@ -24,6 +24,16 @@ TQ_OBJECT_CONSTRUCTORS_IMPL(JSCollator)
 
 ACCESSORS(JSCollator, icu_collator, Managed<icu::Collator>, kIcuCollatorOffset)
 
+inline void JSCollator::set_fast_comparable(bool value) {
+  int hints = flags();
+  hints = FastComparableBit::update(hints, value);
+  set_flags(hints);
+}
+
+inline bool JSCollator::fast_comparable() const {
+  return FastComparableBit::decode(flags());
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -531,6 +531,12 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
     DCHECK(U_SUCCESS(status));
   }
 
+  // Checking the collator settings is not cheap, so determine once at
+  // construction time whether comparisons may take the ASCII fast path of
+  // Intl::CompareStrings.
+  const bool fast_comparable =
+      Intl::CollatorSupportsFastComparison(*icu_collator);
+
   Handle<Managed<icu::Collator>> managed_collator =
       Managed<icu::Collator>::FromUniquePtr(isolate, 0,
                                             std::move(icu_collator));
@@ -544,6 +550,8 @@ MaybeHandle<JSCollator> JSCollator::New(Isolate* isolate, Handle<Map> map,
   DisallowGarbageCollection no_gc;
   collator->set_icu_collator(*managed_collator);
   collator->set_locale(*locale_str);
+  collator->set_flags(0);
+  collator->set_fast_comparable(fast_comparable);
 
   // 29. Return collator.
   return collator;
@@ -48,6 +48,13 @@ class JSCollator : public TorqueGeneratedJSCollator<JSCollator, JSObject> {
 
   DECL_ACCESSORS(icu_collator, Managed<icu::Collator>)
 
+  // Whether Intl::CompareStrings may use its ASCII fast path for this
+  // collator; cached at construction time.
+  inline void set_fast_comparable(bool value);
+  inline bool fast_comparable() const;
+
+  DEFINE_TORQUE_GENERATED_JS_COLLATOR_FLAGS()
+
   TQ_OBJECT_CONSTRUCTORS(JSCollator)
 };
 
@@ -27,7 +27,7 @@
 #include "src/objects/elements.h"
 #include "src/objects/field-type.h"
 #include "src/objects/fixed-array.h"
-#include "src/objects/heap-number.h"
+#include "src/objects/heap-number-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
@@ -279,6 +279,112 @@ bool HasExcludedProperty(
   return false;
 }
 
+// Copies all own properties of a fast-mode |from| object into an empty
+// fast-mode |target| in bulk: the final target map is built through the
+// transition tree (so repeated copies of the same shape reuse cached
+// transitions), property storage is allocated once, and the values are then
+// written directly into the fields. Returns false without observable side
+// effects if the objects don't qualify, in which case the caller falls back
+// to the generic per-property path.
+V8_WARN_UNUSED_RESULT bool TryBulkCopyOwnProperties(Isolate* isolate,
+                                                    Handle<JSObject> target,
+                                                    Handle<JSObject> from,
+                                                    Handle<Map> from_map,
+                                                    bool use_set) {
+  DCHECK(from_map->OnlyHasSimpleProperties());
+  const int nof = from_map->NumberOfOwnDescriptors();
+  if (nof == 0) return true;  // Nothing to copy.
+
+  {
+    DisallowGarbageCollection no_gc;
+    Map target_map = target->map();
+    // Only plain, still-empty fast-mode targets qualify. Note that the
+    // source has no elements, so all copied keys are non-index names and
+    // the target's elements don't matter.
+    if (target_map.instance_type() != JS_OBJECT_TYPE) return false;
+    if (!target_map.OnlyHasSimpleProperties()) return false;
+    if (!target_map.is_extensible()) return false;
+    if (target_map.NumberOfOwnDescriptors() != 0) return false;
+
+    DescriptorArray descriptors = from_map->instance_descriptors(isolate);
+    for (InternalIndex i : from_map->IterateOwnDescriptors()) {
+      PropertyDetails details = descriptors.GetDetails(i);
+      if (details.kind() != PropertyKind::kData || !details.IsEnumerable() ||
+          descriptors.GetKey(i).IsPrivateName()) {
+        return false;
+      }
+    }
+
+    if (use_set) {
+      // Set semantics are only equivalent to defining the properties on the
+      // target if no store can be observed anywhere on the prototype chain,
+      // i.e. all prototypes are simple objects and none of them has an own
+      // property with one of the copied names.
+      for (PrototypeIterator iter(isolate, *target); !iter.IsAtEnd();
+           iter.Advance()) {
+        HeapObject proto = iter.GetCurrent();
+        if (!proto.IsJSObject()) return false;
+        Map proto_map = proto.map();
+        if (!proto_map.OnlyHasSimpleProperties()) return false;
+        DescriptorArray proto_descriptors =
+            proto_map.instance_descriptors(isolate);
+        int proto_nof = proto_map.NumberOfOwnDescriptors();
+        for (InternalIndex i : from_map->IterateOwnDescriptors()) {
+          if (proto_descriptors.Search(descriptors.GetKey(i), proto_nof)
+                  .is_found()) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  // Read out all property values. This cannot run user code since the source
+  // has only data properties, but may allocate when boxing double fields.
+  Handle<DescriptorArray> descriptors(from_map->instance_descriptors(isolate),
+                                      isolate);
+  base::ScopedVector<Handle<Object>> values(nof);
+  for (InternalIndex i : from_map->IterateOwnDescriptors()) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.location() == PropertyLocation::kDescriptor) {
+      values[i.as_int()] = handle(descriptors->GetStrongValue(i), isolate);
+    } else {
+      Representation representation = details.representation();
+      FieldIndex index = FieldIndex::ForPropertyIndex(
+          *from_map, details.field_index(), representation);
+      values[i.as_int()] =
+          JSObject::FastPropertyAt(isolate, from, representation, index);
+    }
+  }
+
+  // Build the final target map by following (and, on first use, extending)
+  // the transition tree, exactly as a sequence of stores would, but without
+  // migrating the object at every step.
+  Handle<Map> target_map(target->map(), isolate);
+  for (InternalIndex i : from_map->IterateOwnDescriptors()) {
+    Handle<Name> key(descriptors->GetKey(i), isolate);
+    target_map = Map::TransitionToDataProperty(
+        isolate, target_map, key, values[i.as_int()], NONE,
+        PropertyConstness::kConst, StoreOrigin::kNamed);
+    // Adding the properties one at a time would have hit the same descriptor
+    // limit; normalizing the target is better left to the generic path.
+    if (target_map->is_dictionary_map()) return false;
+  }
+
+  // Allocate the property backing store for the final shape in one go and
+  // write the values directly into the fields.
+  JSObject::AllocateStorageForMap(target, target_map);
+  DisallowGarbageCollection no_gc;
+  DescriptorArray target_descriptors =
+      target_map->instance_descriptors(isolate);
+  for (InternalIndex i : target_map->IterateOwnDescriptors()) {
+    PropertyDetails details = target_descriptors.GetDetails(i);
+    DCHECK_EQ(PropertyLocation::kField, details.location());
+    target->WriteToField(i, details, *values[i.as_int()]);
+  }
+  return true;
+}
+
 V8_WARN_UNUSED_RESULT Maybe<bool> FastAssign(
     Handle<JSReceiver> target, Handle<Object> source,
     PropertiesEnumerationMode mode,
@@ -313,6 +419,14 @@ V8_WARN_UNUSED_RESULT Maybe<bool> FastAssign(
   // We should never try to copy properties from an object itself.
   CHECK_IMPLIES(!use_set, !target.is_identical_to(from));
 
+  // If the target is an empty fast-mode object, the properties can be copied
+  // in bulk instead of one at a time through the lookup machinery below.
+  if (excluded_properties == nullptr && target->IsJSObject() &&
+      TryBulkCopyOwnProperties(isolate, Handle<JSObject>::cast(target), from,
+                               map, use_set)) {
+    return Just(true);
+  }
+
   Handle<DescriptorArray> descriptors(map->instance_descriptors(isolate),
                                       isolate);
 
@@ -3511,6 +3625,143 @@ void JSObject::AllocateStorageForMap(Handle<JSObject> object, Handle<Map> map) {
   object->set_map(*map, kReleaseStore);
 }
 
+namespace {
+
+// DeepCopy only recurses into plain objects and arrays; everything else
+// (functions, dates, regexps, proxies, ...) is shared with the source graph.
+bool IsDeepCopyableObject(Object raw) {
+  if (!raw.IsJSObject()) return false;
+  InstanceType instance_type = HeapObject::cast(raw).map().instance_type();
+  return instance_type == JS_OBJECT_TYPE || instance_type == JS_ARRAY_TYPE;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<JSObject> JSObject::DeepCopy(Isolate* isolate,
+                                         Handle<JSObject> object) {
+  {
+    StackLimitCheck check(isolate);
+    if (check.HasOverflowed()) {
+      isolate->StackOverflow();
+      return MaybeHandle<JSObject>();
+    }
+  }
+
+  if (object->map(isolate).is_deprecated()) {
+    MigrateInstance(isolate, object);
+  }
+
+  Handle<JSObject> copy = isolate->factory()->CopyJSObject(object);
+
+  HandleScope scope(isolate);
+
+  // Deep copy own properties. Arrays only have 1 property "length".
+  if (!copy->IsJSArray(isolate)) {
+    if (copy->HasFastProperties(isolate)) {
+      Handle<DescriptorArray> descriptors(
+          copy->map(isolate).instance_descriptors(isolate), isolate);
+      for (InternalIndex i : copy->map(isolate).IterateOwnDescriptors()) {
+        PropertyDetails details = descriptors->GetDetails(i);
+        if (details.location() != PropertyLocation::kField ||
+            details.kind() != PropertyKind::kData) {
+          continue;
+        }
+        FieldIndex index = FieldIndex::ForPropertyIndex(
+            copy->map(isolate), details.field_index(),
+            details.representation());
+        Object raw = copy->RawFastPropertyAt(isolate, index);
+        if (IsDeepCopyableObject(raw)) {
+          Handle<JSObject> value(JSObject::cast(raw), isolate);
+          ASSIGN_RETURN_ON_EXCEPTION(isolate, value, DeepCopy(isolate, value),
+                                     JSObject);
+          copy->FastPropertyAtPut(index, *value);
+        } else if (details.representation().IsDouble()) {
+          // The shallow copy shares the HeapNumber boxes of double fields
+          // with the source; give the copy boxes of its own so that later
+          // stores do not alias.
+          uint64_t double_value =
+              HeapNumber::cast(raw).value_as_bits(kRelaxedLoad);
+          auto value = isolate->factory()->NewHeapNumberFromBits(double_value);
+          copy->FastPropertyAtPut(index, *value);
+        }
+      }
+    } else {
+      if (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+        Handle<SwissNameDictionary> dict(copy->property_dictionary_swiss(),
+                                         isolate);
+        for (InternalIndex i : dict->IterateEntries()) {
+          Object raw = dict->ValueAt(i);
+          if (!IsDeepCopyableObject(raw)) continue;
+          Handle<JSObject> value(JSObject::cast(raw), isolate);
+          ASSIGN_RETURN_ON_EXCEPTION(isolate, value, DeepCopy(isolate, value),
+                                     JSObject);
+          dict->ValueAtPut(i, *value);
+        }
+      } else {
+        Handle<NameDictionary> dict(copy->property_dictionary(), isolate);
+        for (InternalIndex i : dict->IterateEntries()) {
+          Object raw = dict->ValueAt(isolate, i);
+          if (!IsDeepCopyableObject(raw)) continue;
+          Handle<JSObject> value(JSObject::cast(raw), isolate);
+          ASSIGN_RETURN_ON_EXCEPTION(isolate, value, DeepCopy(isolate, value),
+                                     JSObject);
+          dict->ValueAtPut(i, *value);
+        }
+      }
+    }
+
+    // Assume non-arrays don't end up having elements.
+    if (copy->elements(isolate).length() == 0) return copy;
+  }
+
+  // Deep copy own elements.
+  switch (copy->GetElementsKind(isolate)) {
+    case PACKED_ELEMENTS:
+    case PACKED_FROZEN_ELEMENTS:
+    case PACKED_SEALED_ELEMENTS:
+    case PACKED_NONEXTENSIBLE_ELEMENTS:
+    case HOLEY_FROZEN_ELEMENTS:
+    case HOLEY_SEALED_ELEMENTS:
+    case HOLEY_NONEXTENSIBLE_ELEMENTS:
+    case HOLEY_ELEMENTS: {
+      Handle<FixedArray> elements(FixedArray::cast(copy->elements(isolate)),
+                                  isolate);
+      if (elements->map(isolate) !=
+          ReadOnlyRoots(isolate).fixed_cow_array_map()) {
+        for (int i = 0; i < elements->length(); i++) {
+          Object raw = elements->get(isolate, i);
+          if (!IsDeepCopyableObject(raw)) continue;
+          Handle<JSObject> value(JSObject::cast(raw), isolate);
+          ASSIGN_RETURN_ON_EXCEPTION(isolate, value, DeepCopy(isolate, value),
+                                     JSObject);
+          elements->set(i, *value);
+        }
+      }
+      break;
+    }
+    case DICTIONARY_ELEMENTS: {
+      Handle<NumberDictionary> element_dictionary(
+          copy->element_dictionary(isolate), isolate);
+      for (InternalIndex i : element_dictionary->IterateEntries()) {
+        Object raw = element_dictionary->ValueAt(isolate, i);
+        if (!IsDeepCopyableObject(raw)) continue;
+        Handle<JSObject> value(JSObject::cast(raw), isolate);
+        ASSIGN_RETURN_ON_EXCEPTION(isolate, value, DeepCopy(isolate, value),
+                                   JSObject);
+        element_dictionary->ValueAtPut(i, *value);
+      }
+      break;
+    }
+    default:
+      // Smi, double, typed-array and other exotic elements contain no objects
+      // to recurse into.
+      break;
+  }
+
+  return copy;
+}
+
 void JSObject::MigrateInstance(Isolate* isolate, Handle<JSObject> object) {
   Handle<Map> original_map(object->map(), isolate);
   Handle<Map> map = Map::Update(isolate, original_map);
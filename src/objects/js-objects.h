@@ -478,6 +478,13 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   // passed map. This also extends the property backing store if necessary.
   static void AllocateStorageForMap(Handle<JSObject> object, Handle<Map> map);
 
+  // Makes a deep, structure-preserving copy of {object}. Plain objects and
+  // arrays are copied recursively with their maps reused; all other values
+  // are shared with the source graph. Returns an empty handle with a pending
+  // exception if the graph is cyclic or too deep.
+  V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT static MaybeHandle<JSObject> DeepCopy(
+      Isolate* isolate, Handle<JSObject> object);
+
   // Migrates the given object to a map whose field representations are the
   // lowest upper bound of all known representations for that field.
   static void MigrateInstance(Isolate* isolate, Handle<JSObject> instance);
@@ -154,6 +154,10 @@ bool JSFinalizationRegistry::NeedsCleanup() const {
   return cleared_cells().IsWeakCell();
 }
 
+bool JSFinalizationRegistry::has_native_cleanup() const {
+  return native_cleanup().IsForeign();
+}
+
 HeapObject WeakCell::relaxed_target() const {
   return TaggedField<HeapObject>::Relaxed_Load(*this, kTargetOffset);
 }
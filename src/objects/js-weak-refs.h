@@ -56,6 +56,17 @@ class JSFinalizationRegistry
   // Returns true if the cleared_cells list is non-empty.
   inline bool NeedsCleanup() const;
 
+  // Returns true if a native cleanup function has been installed via
+  // v8::Isolate::SetFinalizationRegistryNativeCleanup.
+  inline bool has_native_cleanup() const;
+
+  // Pops the head of the cleared_cells list and returns its holdings. Must
+  // only be called when NeedsCleanup() is true. This is the C++ counterpart
+  // of the Torque PopClearedCell and is used by the native cleanup path; it
+  // does not shrink the key map.
+  V8_EXPORT_PRIVATE static Handle<Object> PopClearedCellHoldings(
+      Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate);
+
   // Remove the already-popped weak_cell from its unregister token linked list,
   // as well as removing the entry from the key map if it is the only WeakCell
   // with its unregister token. This method cannot GC and does not shrink the
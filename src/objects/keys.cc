@@ -910,6 +910,35 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   return storage;
 }
 
+// NameDictionary, the regular dictionary-mode property backing store, keeps
+// the computed key list in its enum keys cache so that repeated key
+// collection over an unchanged object does not walk and sort the table
+// again. DontEnum properties only matter as shadowing keys when collecting
+// keys along the prototype chain, so the cache is restricted to own-only
+// collection.
+template <>
+Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(
+    Isolate* isolate, KeyCollectionMode mode, KeyAccumulator* accumulator,
+    Handle<JSObject> object, NameDictionary raw_dictionary) {
+  Handle<NameDictionary> dictionary(raw_dictionary, isolate);
+  if (dictionary->NumberOfElements() == 0) {
+    return isolate->factory()->empty_fixed_array();
+  }
+  if (mode == KeyCollectionMode::kOwnOnly) {
+    FixedArray cached_keys;
+    if (dictionary->TryGetCachedEnumKeys(&cached_keys)) {
+      return handle(cached_keys, isolate);
+    }
+  }
+  int length = dictionary->NumberOfEnumerableProperties();
+  Handle<FixedArray> storage = isolate->factory()->NewFixedArray(length);
+  CopyEnumKeysTo(isolate, dictionary, storage, mode, accumulator);
+  if (mode == KeyCollectionMode::kOwnOnly) {
+    NameDictionary::SetCachedEnumKeys(isolate, dictionary, storage);
+  }
+  return storage;
+}
+
 // Collect the keys from |dictionary| into |keys|, in ascending chronological
 // order of property creation.
 template <typename Dictionary>
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_INL_H_
 #define V8_OBJECTS_LOOKUP_CACHE_INL_H_
 
+#include "src/objects/cell-inl.h"
 #include "src/objects/lookup-cache.h"
 #include "src/objects/map.h"
 #include "src/objects/name-inl.h"
@@ -40,6 +41,38 @@ void DescriptorLookupCache::Update(Map source, Name name, int result) {
   results_[index] = result;
 }
 
+// static
+int NegativeLookupCache::Hash(Map source, Name name) {
+  DCHECK(name.IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t source_hash = static_cast<uint32_t>(source.ptr()) >> kTaggedSizeLog2;
+  uint32_t name_hash = name.hash();
+  return (source_hash ^ name_hash) % kLength;
+}
+
+bool NegativeLookupCache::Lookup(Map source, Name name) {
+  if (!name.IsUniqueName()) return false;
+  int index = Hash(source, name);
+  Entry& entry = entries_[index];
+  // Pointers in the table might be stale, so use SafeEquals.
+  if (!entry.source.SafeEquals(source) || !entry.name.SafeEquals(name)) {
+    return false;
+  }
+  // The entry is only valid while the prototype chain it was recorded for is
+  // unchanged. The cache is cleared before any gc, so the cell can be
+  // dereferenced safely.
+  return entry.validity_cell.value() ==
+         Smi::FromInt(Map::kPrototypeChainValid);
+}
+
+void NegativeLookupCache::Update(Map source, Name name, Cell validity_cell) {
+  int index = Hash(source, name);
+  Entry& entry = entries_[index];
+  entry.source = source;
+  entry.name = name;
+  entry.validity_cell = validity_cell;
+}
+
 }  // namespace internal
 }  // namespace v8
 
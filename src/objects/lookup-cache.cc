@@ -4,6 +4,12 @@
 
 #include "src/objects/lookup-cache.h"
 
+#include "src/execution/isolate.h"
+#include "src/objects/lookup-cache-inl.h"
+#include "src/objects/map-inl.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/prototype-inl.h"
+
 namespace v8 {
 namespace internal {
 
@@ -11,5 +17,47 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void NegativeLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) entries_[index].source = Map();
+}
+
+// static
+void NegativeLookupCache::TryUpdate(Isolate* isolate, Handle<JSObject> object,
+                                    Handle<Name> name) {
+  if (!name->IsUniqueName()) return;
+  uint32_t index;
+  if (name->AsArrayIndex(&index)) return;
+  Handle<Map> map(object->map(), isolate);
+  // Dictionary mode objects can gain properties without changing their map,
+  // so absence cannot be keyed on the map.
+  if (map->is_dictionary_map()) return;
+  {
+    // The entry will only be guarded by the prototype chain validity cell, so
+    // |name|'s absence from every object on the chain must actually be
+    // tracked by that cell. Special receivers (interceptors, access checks,
+    // proxies, module namespaces, the global object) have lookup behavior the
+    // cell knows nothing about, and typed arrays shadow the chain for
+    // canonical numeric strings.
+    DisallowGarbageCollection no_gc;
+    if (map->IsSpecialReceiverMap()) return;
+    if (object->IsJSTypedArray()) return;
+    for (PrototypeIterator iter(isolate, *map); !iter.IsAtEnd();
+         iter.Advance()) {
+      HeapObject proto = iter.GetCurrent();
+      if (!proto.IsJSObject()) return;
+      Map proto_map = proto.map();
+      if (proto_map.IsSpecialReceiverMap()) return;
+      if (proto.IsJSTypedArray()) return;
+    }
+  }
+  Handle<Object> validity_cell =
+      Map::GetOrCreatePrototypeChainValidityCell(map, isolate);
+  // There's nothing to guard the entry with when the direct prototype is
+  // null; don't cache in that (rare) case.
+  if (!validity_cell->IsCell()) return;
+  isolate->negative_lookup_cache()->Update(*map, *name,
+                                           Cell::cast(*validity_cell));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/objects/cell.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -55,6 +56,57 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache for (map, property name) pairs where the name is known to be absent
+// from objects with that map and from everything on their prototype chain.
+// Each entry is guarded by the prototype chain validity cell that was current
+// when the entry was added, so prototype mutations invalidate entries without
+// explicit clearing. Cleared at startup and prior to any gc.
+class NegativeLookupCache {
+ public:
+  NegativeLookupCache(const NegativeLookupCache&) = delete;
+  NegativeLookupCache& operator=(const NegativeLookupCache&) = delete;
+
+  // Returns true if |name| is known to be absent from |source| objects and
+  // their entire prototype chains.
+  inline bool Lookup(Map source, Name name);
+
+  // Records that a full prototype chain walk starting at |object| did not
+  // find |name|. No entry is added if absence cannot be guarded by the map
+  // identity and the prototype chain validity cell alone (e.g. dictionary
+  // mode receivers, or interceptors, access checks, typed arrays or proxies
+  // anywhere on the chain).
+  static void TryUpdate(Isolate* isolate, Handle<JSObject> object,
+                        Handle<Name> name);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  NegativeLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      entries_[i].source = Map();
+      entries_[i].name = Name();
+      entries_[i].validity_cell = Cell();
+    }
+  }
+
+  // Update an element in the cache.
+  inline void Update(Map source, Name name, Cell validity_cell);
+
+  static inline int Hash(Map source, Name name);
+
+  static const int kLength = 64;
+  struct Entry {
+    Map source;
+    Name name;
+    Cell validity_cell;
+  };
+
+  Entry entries_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
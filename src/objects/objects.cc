@@ -97,6 +97,7 @@
 #include "src/objects/js-segment-iterator.h"
 #include "src/objects/js-segmenter.h"
 #include "src/objects/js-segments.h"
+#include "src/objects/js-struct-inl.h"
 #endif  // V8_INTL_SUPPORT
 #include "src/codegen/source-position-table.h"
 #include "src/objects/js-weak-refs-inl.h"
@@ -2957,6 +2958,132 @@ MaybeHandle<Object> Object::ShareSlow(Isolate* isolate,
   return MaybeHandle<Object>();
 }
 
+namespace {
+
+// Maps already-shared source objects to their shared copies, so that aliasing
+// and cycles in the source graph are preserved in the shared copy.
+using SharedStructMap =
+    IdentityMap<Handle<JSSharedStruct>, FreeStoreAllocationPolicy>;
+
+MaybeHandle<Object> ShareDeepInternal(Isolate* isolate, Handle<Object> value,
+                                      ShouldThrow throw_if_cannot_be_shared,
+                                      SharedStructMap* shared_structs) {
+  if (value->IsShared()) return value;
+
+  // Values other than plain objects (strings, heap numbers) are shared
+  // through the regular slow path; anything it rejects cannot be shared.
+  if (!value->IsJSObject() ||
+      Handle<JSObject>::cast(value)->map().instance_type() != JS_OBJECT_TYPE) {
+    return Object::Share(isolate, value, throw_if_cannot_be_shared);
+  }
+  Handle<JSObject> object = Handle<JSObject>::cast(value);
+
+  Handle<JSSharedStruct>* existing = shared_structs->Find(object);
+  if (existing != nullptr) return *existing;
+
+  StackLimitCheck stack_check(isolate);
+  if (stack_check.HasOverflowed()) {
+    isolate->StackOverflow();
+    return MaybeHandle<Object>();
+  }
+
+  // Shared structs do not support elements, so only string-keyed properties
+  // can be shared.
+  Handle<FixedArray> keys;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, keys,
+      KeyAccumulator::GetKeys(isolate, object, KeyCollectionMode::kOwnOnly,
+                              ENUMERABLE_STRINGS),
+      Object);
+  int num_properties = keys->length();
+  if (num_properties > kMaxNumberOfDescriptors) {
+    THROW_NEW_ERROR(isolate,
+                    NewRangeError(MessageTemplate::kStructFieldCountOutOfRange),
+                    Object);
+  }
+
+  // Build the field layout up front, following the SharedStructType
+  // constructor: all-tagged frozen fields described by a descriptor array in
+  // the shared heap. The instance can then be allocated and registered before
+  // its field values are shared, which keeps cycles finite.
+  Handle<DescriptorArray> descriptors = isolate->factory()->NewDescriptorArray(
+      num_properties, 0, AllocationType::kSharedOld);
+  for (int i = 0; i < num_properties; ++i) {
+    Handle<Object> raw_key(keys->get(i), isolate);
+    if (!raw_key->IsName()) {
+      if (throw_if_cannot_be_shared == kThrowOnError) {
+        THROW_NEW_ERROR(
+            isolate, NewTypeError(MessageTemplate::kCannotBeShared, object),
+            Object);
+      }
+      return MaybeHandle<Object>();
+    }
+    Handle<Name> field_name =
+        isolate->factory()->InternalizeName(Handle<Name>::cast(raw_key));
+    PropertyDetails details(PropertyKind::kData, FROZEN,
+                            PropertyLocation::kField,
+                            PropertyConstness::kConst,
+                            Representation::Tagged(), i);
+    descriptors->Set(InternalIndex(i), *field_name,
+                     MaybeObject::FromObject(FieldType::Any()), details);
+  }
+  descriptors->Sort();
+
+  int instance_size;
+  int in_object_properties;
+  JSFunction::CalculateInstanceSizeHelper(JS_SHARED_STRUCT_TYPE, false, 0,
+                                          num_properties, &instance_size,
+                                          &in_object_properties);
+  Handle<Map> instance_map = isolate->factory()->NewMap(
+      JS_SHARED_STRUCT_TYPE, instance_size, TERMINAL_FAST_ELEMENTS_KIND,
+      in_object_properties, AllocationType::kSharedMap);
+  instance_map->InitializeDescriptors(isolate, *descriptors);
+  instance_map->SetInObjectUnusedPropertyFields(0);
+  instance_map->set_is_extensible(false);
+  instance_map->set_constructor_or_back_pointer(
+      ReadOnlyRoots(isolate).null_value());
+
+  SharedObjectSafePublishGuard publish_guard;
+  Handle<JSSharedStruct> instance =
+      Handle<JSSharedStruct>::cast(isolate->factory()->NewJSObjectFromMap(
+          instance_map, AllocationType::kSharedOld));
+  if (instance_map->HasOutOfObjectProperties()) {
+    int num_oob_fields =
+        instance_map->NumberOfFields(ConcurrencyMode::kSynchronous) -
+        instance_map->GetInObjectProperties();
+    Handle<PropertyArray> property_array = isolate->factory()->NewPropertyArray(
+        num_oob_fields, AllocationType::kSharedOld);
+    instance->SetProperties(*property_array);
+  }
+  shared_structs->Insert(object, instance);
+
+  for (InternalIndex i : instance_map->IterateOwnDescriptors()) {
+    Handle<Name> field_name(descriptors->GetKey(i), isolate);
+    Handle<Object> field_value;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, field_value,
+        JSReceiver::GetProperty(isolate, object, field_name), Object);
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, field_value,
+        ShareDeepInternal(isolate, field_value, throw_if_cannot_be_shared,
+                          shared_structs),
+        Object);
+    FieldIndex field_index = FieldIndex::ForDescriptor(*instance_map, i);
+    instance->FastPropertyAtPut(field_index, *field_value);
+  }
+  return instance;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<Object> Object::ShareDeep(Isolate* isolate, Handle<Object> value,
+                                      ShouldThrow throw_if_cannot_be_shared) {
+  SharedStructMap shared_structs(isolate->heap());
+  return ShareDeepInternal(isolate, value, throw_if_cannot_be_shared,
+                           &shared_structs);
+}
+
 template <class T>
 static int AppendUniqueCallbacks(Isolate* isolate,
                                  Handle<TemplateList> callbacks,
@@ -5115,11 +5242,13 @@ MaybeHandle<SharedFunctionInfo> Script::FindSharedFunctionInfo(
     Handle<Script> script, IsolateT* isolate,
     FunctionLiteral* function_literal) {
   int function_literal_id = function_literal->function_literal_id();
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   if (V8_UNLIKELY(script->type() == Script::TYPE_WEB_SNAPSHOT &&
                   function_literal_id >=
                       script->shared_function_info_count())) {
     return FindWebSnapshotSharedFunctionInfo(script, isolate, function_literal);
   }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   CHECK_NE(function_literal_id, kFunctionLiteralIdInvalid);
   // If this check fails, the problem is most probably the function id
@@ -5141,6 +5270,7 @@ template MaybeHandle<SharedFunctionInfo> Script::FindSharedFunctionInfo(
     Handle<Script> script, LocalIsolate* isolate,
     FunctionLiteral* function_literal);
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
 MaybeHandle<SharedFunctionInfo> Script::FindWebSnapshotSharedFunctionInfo(
     Handle<Script> script, Isolate* isolate,
     FunctionLiteral* function_literal) {
@@ -5211,6 +5341,7 @@ MaybeHandle<SharedFunctionInfo> Script::FindWebSnapshotSharedFunctionInfo(
   // Off-thread serialization of web snapshots is not implemented.
   UNREACHABLE();
 }
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
 Script::Iterator::Iterator(Isolate* isolate)
     : iterator_(isolate->heap()->script_list()) {}
@@ -6134,6 +6265,23 @@ int BaseNameDictionary<Derived, Shape>::NextEnumerationIndex(
   return index;
 }
 
+// static
+void NameDictionary::SetCachedEnumKeys(Isolate* isolate,
+                                       Handle<NameDictionary> dictionary,
+                                       Handle<FixedArray> keys) {
+  DCHECK_NE(*dictionary, ReadOnlyRoots(isolate).empty_property_dictionary());
+  Handle<FixedArray> entry =
+      isolate->factory()->NewFixedArray(kCachedEnumKeysSize);
+  entry->set(kCachedEnumKeysKeysIndex, *keys);
+  entry->set(kCachedEnumKeysNofIndex,
+             Smi::FromInt(dictionary->NumberOfElements()));
+  entry->set(kCachedEnumKeysDeletedIndex,
+             Smi::FromInt(dictionary->NumberOfDeletedElements()));
+  entry->set(kCachedEnumKeysEnumIndexIndex,
+             Smi::FromInt(dictionary->next_enumeration_index()));
+  dictionary->set(kCachedEnumKeysIndex, *entry);
+}
+
 template <typename Derived, typename Shape>
 Handle<Derived> Dictionary<Derived, Shape>::DeleteEntry(
     Isolate* isolate, Handle<Derived> dictionary, InternalIndex entry) {
@@ -7017,6 +7165,32 @@ EXTERN_DEFINE_BASE_NAME_DICTIONARY(GlobalDictionary, GlobalDictionaryShape)
 #undef EXTERN_DEFINE_DICTIONARY
 #undef EXTERN_DEFINE_BASE_NAME_DICTIONARY
 
+Handle<Object> JSFinalizationRegistry::PopClearedCellHoldings(
+    Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate) {
+  DCHECK(finalization_registry->NeedsCleanup());
+  Handle<WeakCell> weak_cell(
+      WeakCell::cast(finalization_registry->cleared_cells()), isolate);
+  DCHECK(weak_cell->prev().IsUndefined(isolate));
+  finalization_registry->set_cleared_cells(weak_cell->next());
+  weak_cell->set_next(ReadOnlyRoots(isolate).undefined_value());
+
+  if (finalization_registry->cleared_cells().IsWeakCell()) {
+    WeakCell cleared_cells_head =
+        WeakCell::cast(finalization_registry->cleared_cells());
+    DCHECK_EQ(cleared_cells_head.prev(), *weak_cell);
+    cleared_cells_head.set_prev(ReadOnlyRoots(isolate).undefined_value());
+  } else {
+    DCHECK(finalization_registry->cleared_cells().IsUndefined(isolate));
+  }
+
+  if (!weak_cell->unregister_token().IsUndefined(isolate)) {
+    RemoveCellFromUnregisterTokenMap(isolate, finalization_registry->ptr(),
+                                     weak_cell->ptr());
+  }
+
+  return handle(weak_cell->holdings(), isolate);
+}
+
 void JSFinalizationRegistry::RemoveCellFromUnregisterTokenMap(
     Isolate* isolate, Address raw_finalization_registry,
     Address raw_weak_cell) {
@@ -791,6 +791,14 @@ class Object : public TaggedImpl<HeapObjectReferenceType::STRONG, Address> {
                                        Handle<HeapObject> value,
                                        ShouldThrow throw_if_cannot_be_shared);
 
+  // Returns a deeply-immutable copy of value in the shared heap: plain
+  // objects become JSSharedStructs with frozen fields, while other values are
+  // shared through Share(). Aliasing and cycles in the source graph are
+  // preserved. Requires a shared heap.
+  V8_EXPORT_PRIVATE static MaybeHandle<Object> ShareDeep(
+      Isolate* isolate, Handle<Object> value,
+      ShouldThrow throw_if_cannot_be_shared);
+
   // Whether this Object can be held weakly, i.e. whether it can be used as a
   // key in WeakMap, as a key in WeakSet, as the target of a WeakRef, or as a
   // target or unregister token of a FinalizationRegistry.
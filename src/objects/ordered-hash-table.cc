@@ -271,40 +271,73 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   if (!new_table_candidate.ToHandle(&new_table)) {
     return new_table_candidate;
   }
-  int new_buckets = new_table->NumberOfBuckets();
-  int new_entry = 0;
-  int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
-
-  for (InternalIndex old_entry : table->IterateEntries()) {
-    int old_entry_raw = old_entry.as_int();
-    Object key = table->KeyAt(old_entry);
-    if (key.IsTheHole(isolate)) {
-      table->SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
-      continue;
+  Derived raw_table = *table;
+  Derived raw_new_table = *new_table;
+  int new_buckets = raw_new_table.NumberOfBuckets();
+  int nof = raw_table.NumberOfElements();
+  WriteBarrierMode mode = raw_new_table.GetWriteBarrierMode(no_gc);
+
+  // Without deleted entries the entry area is a dense prefix that keeps its
+  // layout in the new table, so it can be copied in bulk. Only the buckets
+  // and the per-entry chain links have to be recomputed, and both are Smis
+  // that need no write barrier. CopyRange is main-thread only, so background
+  // threads take the entry-by-entry path below.
+  constexpr bool kIsMainThreadIsolate = std::is_same<IsolateT, Isolate>::value;
+  if (kIsMainThreadIsolate && raw_table.NumberOfDeletedElements() == 0 &&
+      nof > 0) {
+    if constexpr (kIsMainThreadIsolate) {
+      raw_new_table.CopyElements(
+          isolate, HashTableStartIndex() + new_buckets, raw_table,
+          HashTableStartIndex() + raw_table.NumberOfBuckets(),
+          nof * kEntrySize, mode);
+    }
+    for (int entry = 0; entry < nof; ++entry) {
+      int new_index = raw_new_table.EntryToIndexRaw(entry);
+      Object key = raw_new_table.get(new_index);
+      int bucket = Smi::ToInt(key.GetHash()) & (new_buckets - 1);
+      Object chain_entry = raw_new_table.get(HashTableStartIndex() + bucket);
+      raw_new_table.set(HashTableStartIndex() + bucket, Smi::FromInt(entry),
+                        SKIP_WRITE_BARRIER);
+      raw_new_table.set(new_index + kChainOffset, chain_entry,
+                        SKIP_WRITE_BARRIER);
     }
+  } else {
+    int new_entry = 0;
+    int removed_holes_index = 0;
+
+    for (InternalIndex old_entry : raw_table.IterateEntries()) {
+      int old_entry_raw = old_entry.as_int();
+      Object key = raw_table.KeyAt(old_entry);
+      if (key.IsTheHole(isolate)) {
+        raw_table.SetRemovedIndexAt(removed_holes_index++, old_entry_raw);
+        continue;
+      }
 
-    Object hash = key.GetHash();
-    int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Object chain_entry = new_table->get(HashTableStartIndex() + bucket);
-    new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
-    int new_index = new_table->EntryToIndexRaw(new_entry);
-    int old_index = table->EntryToIndexRaw(old_entry_raw);
-    for (int i = 0; i < entrysize; ++i) {
-      Object value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      Object hash = key.GetHash();
+      int bucket = Smi::ToInt(hash) & (new_buckets - 1);
+      Object chain_entry = raw_new_table.get(HashTableStartIndex() + bucket);
+      raw_new_table.set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry),
+                        SKIP_WRITE_BARRIER);
+      int new_index = raw_new_table.EntryToIndexRaw(new_entry);
+      int old_index = raw_table.EntryToIndexRaw(old_entry_raw);
+      for (int i = 0; i < entrysize; ++i) {
+        Object value = raw_table.get(old_index + i);
+        raw_new_table.set(new_index + i, value, mode);
+      }
+      raw_new_table.set(new_index + kChainOffset, chain_entry,
+                        SKIP_WRITE_BARRIER);
+      ++new_entry;
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
-    ++new_entry;
-  }
 
-  DCHECK_EQ(table->NumberOfDeletedElements(), removed_holes_index);
+    DCHECK_EQ(raw_table.NumberOfDeletedElements(), removed_holes_index);
+  }
 
-  new_table->SetNumberOfElements(table->NumberOfElements());
-  if (table->NumberOfBuckets() > 0) {
+  raw_new_table.SetNumberOfElements(nof);
+  if (raw_table.NumberOfBuckets() > 0) {
     // Don't try to modify the empty canonical table which lives in RO space.
-    table->SetNextTable(*new_table);
+    raw_table.SetNextTable(raw_new_table);
   }
 
   return new_table_candidate;
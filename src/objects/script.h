@@ -216,6 +216,7 @@ class Script : public TorqueGeneratedScript<Script, Struct> {
       Handle<Script> script, IsolateT* isolate,
       FunctionLiteral* function_literal);
 
+#ifdef V8_ENABLE_WEB_SNAPSHOTS
   static MaybeHandle<SharedFunctionInfo> FindWebSnapshotSharedFunctionInfo(
       Handle<Script> script, Isolate* isolate,
       FunctionLiteral* function_literal);
@@ -223,6 +224,7 @@ class Script : public TorqueGeneratedScript<Script, Struct> {
   static MaybeHandle<SharedFunctionInfo> FindWebSnapshotSharedFunctionInfo(
       Handle<Script> script, LocalIsolate* isolate,
       FunctionLiteral* function_literal);
+#endif  // V8_ENABLE_WEB_SNAPSHOTS
 
   // Iterate over all script objects on the heap.
   class V8_EXPORT_PRIVATE Iterator {
@@ -270,6 +270,12 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compilation_failed,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, sparkplug_compiled,
                     SharedFunctionInfo::SparkplugCompiledBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, maglev_compiled_before,
+                    SharedFunctionInfo::MaglevCompiledBeforeBit)
+
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, turbofan_compiled_before,
+                    SharedFunctionInfo::TurbofanCompiledBeforeBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, relaxed_flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -453,6 +453,19 @@ class SharedFunctionInfo
 
   DECL_BOOLEAN_ACCESSORS(sparkplug_compiled)
 
+  // True if Maglev code was installed for this function at some point. The bit
+  // survives code-cache serialization and serves as a tiering hint: functions
+  // that proved hot in a previous isolate are re-tiered with a reduced
+  // interrupt budget.
+  DECL_BOOLEAN_ACCESSORS(maglev_compiled_before)
+
+  // True if Turbofan code was installed for this function at some point.
+  // Like the maglev bit above, this survives code-cache serialization and the
+  // startup/context snapshot (SharedFunctionInfos are serialized with their
+  // raw flags), so training runs can seed fresh isolates with top-tier
+  // tiering decisions.
+  DECL_BOOLEAN_ACCESSORS(turbofan_compiled_before)
+
   // Is this function a top-level function (scripts, evals).
   DECL_BOOLEAN_ACCESSORS(is_toplevel)
 
@@ -4,6 +4,9 @@
 
 #include "src/objects/simd.h"
 
+#include <cstring>
+
+#include "src/base/bits.h"
 #include "src/base/cpu.h"
 #include "src/objects/compressed-slots.h"
 #include "src/objects/fixed-array-inl.h"
@@ -419,6 +422,102 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
       array_start, array_len, from_index, search_element);
 }
 
+uintptr_t StringIndexOfUint16Char(const uint16_t* subject,
+                                  uintptr_t subject_length, uintptr_t index,
+                                  uint16_t search_char) {
+#ifdef __SSE3__
+  const __m128i search = _mm_set1_epi16(search_char);
+  for (; index + 8 <= subject_length; index += 8) {
+    const __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + index));
+    const int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, search));
+    if (mask != 0) {
+      // Two mask bits per code unit.
+      return index + base::bits::CountTrailingZeros32(mask) / 2;
+    }
+  }
+#elif defined(NEON64)
+  const uint16x8_t search = vdupq_n_u16(search_char);
+  for (; index + 8 <= subject_length; index += 8) {
+    const uint16x8_t eq = vceqq_u16(vld1q_u16(subject + index), search);
+    // One mask byte per code unit.
+    const uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(eq)), 0);
+    if (mask != 0) {
+      return index + base::bits::CountTrailingZeros64(mask) / 8;
+    }
+  }
+#endif
+  for (; index < subject_length; index++) {
+    if (subject[index] == search_char) return index;
+  }
+  return -1;
+}
+
+uintptr_t StringIndexOfShortOneBytePattern(const uint8_t* subject,
+                                           uintptr_t subject_length,
+                                           uintptr_t index,
+                                           const uint8_t* pattern,
+                                           uintptr_t pattern_length) {
+  DCHECK_GE(pattern_length, 2);
+  DCHECK_GE(subject_length, pattern_length);
+  // Candidate positions are those where both the first and the last pattern
+  // character match; only candidates need a full comparison. The two
+  // characters of the filter are rarely adjacent in the subject, so false
+  // positives are much rarer than when anchoring on the first character only.
+  const uintptr_t tail = pattern_length - 1;
+  const uintptr_t max_index = subject_length - pattern_length;
+#ifdef __SSE3__
+  const __m128i first = _mm_set1_epi8(pattern[0]);
+  const __m128i last = _mm_set1_epi8(pattern[tail]);
+  for (; index + 16 <= max_index + 1; index += 16) {
+    const __m128i eq_first = _mm_cmpeq_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(subject + index)),
+        first);
+    const __m128i eq_last = _mm_cmpeq_epi8(
+        _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(subject + index + tail)),
+        last);
+    uint32_t mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_and_si128(eq_first, eq_last)));
+    while (mask != 0) {
+      const uintptr_t i = base::bits::CountTrailingZeros32(mask);
+      // The first and last characters already matched.
+      if (memcmp(subject + index + i + 1, pattern + 1, pattern_length - 2) ==
+          0) {
+        return index + i;
+      }
+      mask &= mask - 1;
+    }
+  }
+#elif defined(NEON64)
+  const uint8x16_t first = vdupq_n_u8(pattern[0]);
+  const uint8x16_t last = vdupq_n_u8(pattern[tail]);
+  for (; index + 16 <= max_index + 1; index += 16) {
+    const uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(subject + index), first),
+                                   vceqq_u8(vld1q_u8(subject + index + tail), last));
+    // Narrow the 16 byte lanes to one nibble each.
+    uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    while (mask != 0) {
+      const uintptr_t i = base::bits::CountTrailingZeros64(mask) / 4;
+      // The first and last characters already matched.
+      if (memcmp(subject + index + i + 1, pattern + 1, pattern_length - 2) ==
+          0) {
+        return index + i;
+      }
+      mask &= ~(uint64_t{0xF} << (i * 4));
+    }
+  }
+#endif
+  for (; index <= max_index; index++) {
+    if (subject[index] == pattern[0] &&
+        memcmp(subject + index + 1, pattern + 1, pattern_length - 1) == 0) {
+      return index;
+    }
+  }
+  return -1;
+}
+
 #ifdef NEON64
 #undef NEON64
 #endif
@@ -20,6 +20,22 @@ uintptr_t ArrayIndexOfIncludesDouble(Address array_start, uintptr_t array_len,
                                      uintptr_t from_index,
                                      Address search_element);
 
+// Returns the index of the first occurrence of |search_char| in
+// |subject[index..subject_length[|, or -1 if there is none.
+uintptr_t StringIndexOfUint16Char(const uint16_t* subject,
+                                  uintptr_t subject_length, uintptr_t index,
+                                  uint16_t search_char);
+
+// Returns the index of the first occurrence of |pattern| in
+// |subject[index..subject_length[|, or -1 if there is none. Meant for short
+// patterns (a few characters), for which building Boyer-Moore tables is not
+// worth it; |pattern_length| must be at least 2.
+uintptr_t StringIndexOfShortOneBytePattern(const uint8_t* subject,
+                                           uintptr_t subject_length,
+                                           uintptr_t index,
+                                           const uint8_t* pattern,
+                                           uintptr_t pattern_length);
+
 }  // namespace internal
 }  // namespace v8
 
@@ -1403,6 +1403,92 @@ void StringCharacterStream::VisitTwoByteString(const uint16_t* chars,
   end_ = reinterpret_cast<const uint8_t*>(chars + length);
 }
 
+// Iterates the flat segments (leaves) of an arbitrary string from left to
+// right, exposing each one as a raw character vector. This lets read-only
+// operations walk a ConsString tree in bulk instead of flattening the string
+// first. No GC must happen while a segment is in use.
+class StringSegmentIterator {
+ public:
+  inline explicit StringSegmentIterator(String string, int offset = 0);
+  StringSegmentIterator(const StringSegmentIterator&) = delete;
+  StringSegmentIterator& operator=(const StringSegmentIterator&) = delete;
+
+  // Advances to the next segment. Returns false when the string is exhausted.
+  inline bool Next();
+
+  bool is_one_byte() const { return is_one_byte_; }
+  base::Vector<const uint8_t> one_byte_segment() const {
+    DCHECK(is_one_byte_);
+    return base::Vector<const uint8_t>(buffer8_, length_);
+  }
+  base::Vector<const uint16_t> two_byte_segment() const {
+    DCHECK(!is_one_byte_);
+    return base::Vector<const uint16_t>(buffer16_, length_);
+  }
+
+  inline void VisitOneByteString(const uint8_t* chars, int length);
+  inline void VisitTwoByteString(const uint16_t* chars, int length);
+
+ private:
+  ConsStringIterator iter_;
+  bool is_one_byte_;
+  bool first_segment_pending_;
+  union {
+    const uint8_t* buffer8_;
+    const uint16_t* buffer16_;
+  };
+  int length_;
+  SharedStringAccessGuardIfNeeded access_guard_;
+};
+
+StringSegmentIterator::StringSegmentIterator(String string, int offset)
+    : is_one_byte_(false),
+      first_segment_pending_(false),
+      buffer8_(nullptr),
+      length_(0),
+      access_guard_(string) {
+  ConsString cons_string =
+      String::VisitFlat(this, string, offset, access_guard_);
+  if (cons_string.is_null()) {
+    first_segment_pending_ = length_ > 0;
+    return;
+  }
+  iter_.Reset(cons_string, offset);
+  String leaf = iter_.Next(&offset);
+  if (!leaf.is_null()) {
+    String::VisitFlat(this, leaf, offset, access_guard_);
+    first_segment_pending_ = length_ > 0;
+  }
+}
+
+bool StringSegmentIterator::Next() {
+  if (first_segment_pending_) {
+    first_segment_pending_ = false;
+    return true;
+  }
+  int offset;
+  String leaf = iter_.Next(&offset);
+  DCHECK_EQ(offset, 0);
+  if (leaf.is_null()) return false;
+  String::VisitFlat(this, leaf, 0, access_guard_);
+  DCHECK_GT(length_, 0);
+  return true;
+}
+
+void StringSegmentIterator::VisitOneByteString(const uint8_t* chars,
+                                               int length) {
+  is_one_byte_ = true;
+  buffer8_ = chars;
+  length_ = length;
+}
+
+void StringSegmentIterator::VisitTwoByteString(const uint16_t* chars,
+                                               int length) {
+  is_one_byte_ = false;
+  buffer16_ = chars;
+  length_ = length;
+}
+
 bool String::AsArrayIndex(uint32_t* index) {
   DisallowGarbageCollection no_gc;
   uint32_t field = raw_hash_field();
@@ -8,17 +8,20 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/yield-processor.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate-utils-inl.h"
 #include "src/heap/safepoint.h"
+#include "src/objects/fixed-array-inl.h"
 #include "src/objects/internal-index.h"
 #include "src/objects/object-list-macros.h"
 #include "src/objects/slots-inl.h"
 #include "src/objects/slots.h"
 #include "src/objects/string-inl.h"
 #include "src/objects/string-table-inl.h"
+#include "src/roots/roots-inl.h"
 #include "src/snapshot/deserializer.h"
 #include "src/utils/allocation.h"
 #include "src/utils/ostreams.h"
@@ -87,7 +90,9 @@ bool KeyIsMatch(IsolateT* isolate, StringTableKey* key, String string) {
 //
 // The elements themselves are stored as an open-addressed hash table, with
 // quadratic probing and Smi 0 and Smi 1 as the empty and deleted sentinels,
-// respectively.
+// respectively. Smi 2 marks an entry that a concurrent insertion has claimed
+// but not yet published a string into; such entries only exist transiently
+// while an insertion is in progress.
 class StringTable::Data {
  public:
   static std::unique_ptr<Data> New(int capacity);
@@ -106,24 +111,9 @@ class StringTable::Data {
     slot(index).Release_Store(entry);
   }
 
-  void ElementAdded() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements(), 1));
-
-    number_of_elements_++;
-  }
-  void DeletedElementOverwritten() {
-    DCHECK_LT(number_of_elements_ + 1, capacity());
-    DCHECK(StringTableHasSufficientCapacityToAdd(
-        capacity(), number_of_elements(), number_of_deleted_elements() - 1, 1));
-
-    number_of_elements_++;
-    number_of_deleted_elements_--;
-  }
   void ElementsRemoved(int count) {
-    DCHECK_LE(count, number_of_elements_);
-    number_of_elements_ -= count;
+    DCHECK_LE(count, number_of_elements());
+    number_of_elements_.fetch_sub(count, std::memory_order_relaxed);
     number_of_deleted_elements_ += count;
   }
 
@@ -132,7 +122,11 @@ class StringTable::Data {
   void operator delete(void* description);
 
   int capacity() const { return capacity_; }
-  int number_of_elements() const { return number_of_elements_; }
+  int number_of_elements() const {
+    return number_of_elements_.load(std::memory_order_relaxed);
+  }
+  // Deleted elements are only produced inside GC safepoints, which exclude
+  // concurrent insertions, so a plain read is sufficient.
   int number_of_deleted_elements() const { return number_of_deleted_elements_; }
 
   template <typename IsolateT, typename StringTableKey>
@@ -142,10 +136,14 @@ class StringTable::Data {
   InternalIndex FindInsertionEntry(PtrComprCageBase cage_base,
                                    uint32_t hash) const;
 
+  // Finds the entry matching |key|, or claims an empty entry for it with a
+  // compare-and-swap and publishes the string the key creates. Safe to call
+  // from several threads concurrently; the caller must guarantee sufficient
+  // capacity and that this table is not resized away while the call is in
+  // progress.
   template <typename IsolateT, typename StringTableKey>
-  InternalIndex FindEntryOrInsertionEntry(IsolateT* isolate,
-                                          StringTableKey* key,
-                                          uint32_t hash) const;
+  Handle<String> FindOrInsert(IsolateT* isolate, StringTableKey* key,
+                              uint32_t hash);
 
   // Helper method for StringTable::TryStringToIndexOrLookupExisting.
   template <typename Char>
@@ -176,7 +174,7 @@ class StringTable::Data {
 
  private:
   std::unique_ptr<Data> previous_data_;
-  int number_of_elements_;
+  std::atomic<int> number_of_elements_;
   int number_of_deleted_elements_;
   const int capacity_;
   Tagged_t elements_[1];
@@ -233,17 +231,20 @@ std::unique_ptr<StringTable::Data> StringTable::Data::Resize(
       new_data->capacity(), new_data->number_of_elements(),
       new_data->number_of_deleted_elements(), data->number_of_elements()));
 
-  // Rehash the elements.
+  // Rehash the elements. The caller has drained all concurrent insertions, so
+  // no entry can be in the claimed state here.
   for (InternalIndex i : InternalIndex::Range(data->capacity())) {
     Object element = data->Get(cage_base, i);
     if (element == empty_element() || element == deleted_element()) continue;
+    DCHECK_NE(element, claimed_element());
     String string = String::cast(element);
     uint32_t hash = string.hash();
     InternalIndex insertion_index =
         new_data->FindInsertionEntry(cage_base, hash);
     new_data->Set(insertion_index, string);
   }
-  new_data->number_of_elements_ = data->number_of_elements();
+  new_data->number_of_elements_.store(data->number_of_elements(),
+                                      std::memory_order_relaxed);
 
   new_data->previous_data_ = std::move(data);
   return new_data;
@@ -261,7 +262,9 @@ InternalIndex StringTable::Data::FindEntry(IsolateT* isolate,
     // comparisons against empty/deleted.
     Object element = Get(isolate, entry);
     if (element == empty_element()) return InternalIndex::NotFound();
-    if (element == deleted_element()) continue;
+    // Claimed entries are mid-insertion by another thread; skipping them is
+    // fine, as lock-free reads are allowed to produce false negatives.
+    if (element == deleted_element() || element == claimed_element()) continue;
     String string = String::cast(element);
     if (KeyIsMatch(isolate, key, string)) return entry;
   }
@@ -282,31 +285,54 @@ InternalIndex StringTable::Data::FindInsertionEntry(PtrComprCageBase cage_base,
 }
 
 template <typename IsolateT, typename StringTableKey>
-InternalIndex StringTable::Data::FindEntryOrInsertionEntry(
-    IsolateT* isolate, StringTableKey* key, uint32_t hash) const {
-  InternalIndex insertion_entry = InternalIndex::NotFound();
+Handle<String> StringTable::Data::FindOrInsert(IsolateT* isolate,
+                                               StringTableKey* key,
+                                               uint32_t hash) {
   uint32_t count = 1;
-  // EnsureCapacity will guarantee the hash table is never full.
+  // The caller guarantees sufficient capacity, so the probe sequence always
+  // terminates at a match or an empty entry.
   for (InternalIndex entry = FirstProbe(hash, capacity_);;
        entry = NextProbe(entry, count++, capacity_)) {
-    // TODO(leszeks): Consider delaying the decompression until after the
-    // comparisons against empty/deleted.
     Object element = Get(isolate, entry);
-    if (element == empty_element()) {
-      // Empty entry, it's our insertion entry if there was no previous Hole.
-      if (insertion_entry.is_not_found()) return entry;
-      return insertion_entry;
-    }
-
-    if (element == deleted_element()) {
-      // Holes are potential insertion candidates, but we continue the search
-      // in case we find the actual matching entry.
-      if (insertion_entry.is_not_found()) insertion_entry = entry;
-      continue;
+    while (true) {
+      if (element == empty_element()) {
+        // Try to claim the empty entry for this key. Claiming rather than
+        // directly storing the string lets us delay (potentially in-place)
+        // internalization until this thread is known to be the unique
+        // inserter of the key.
+        Object old = slot(entry).Release_CompareAndSwap(empty_element(),
+                                                        claimed_element());
+        if (old == empty_element()) {
+          // Successfully claimed; publish the string. There is no allocation
+          // (and thus no GC) between the claim and the publish, so safepoints
+          // never observe a claimed entry.
+          Handle<String> new_string = key->GetHandleForInsertion();
+          DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+          number_of_elements_.fetch_add(1, std::memory_order_relaxed);
+          Set(entry, *new_string);
+          return new_string;
+        }
+        // Lost the race; re-read the entry with acquire semantics, so that
+        // reads from the winning string's contents are ordered after its
+        // publication, and re-examine.
+        element = Get(isolate, entry);
+        continue;
+      }
+      if (element == claimed_element()) {
+        // Another thread is about to publish a string here, and does so
+        // without blocking. We cannot skip the entry -- the pending string
+        // may match this key -- so spin until the store is visible.
+        YIELD_PROCESSOR;
+        element = Get(isolate, entry);
+        continue;
+      }
+      break;
     }
-
+    // Deleted entries are not reused by concurrent insertions, to keep equal
+    // keys on identical probe paths; they are only reclaimed on resize.
+    if (element == deleted_element()) continue;
     String string = String::cast(element);
-    if (KeyIsMatch(isolate, key, string)) return entry;
+    if (KeyIsMatch(isolate, key, string)) return handle(string, isolate);
   }
 }
 
@@ -335,10 +361,7 @@ int StringTable::Capacity() const {
   return data_.load(std::memory_order_acquire)->capacity();
 }
 int StringTable::NumberOfElements() const {
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->number_of_elements();
-  }
+  return data_.load(std::memory_order_acquire)->number_of_elements();
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -422,8 +445,8 @@ class InternalizedStringKey final : public StringTableKey {
     if (maybe_internalized_map_.ToHandle(&internalized_map)) {
       // It is always safe to overwrite the map. The only transition possible
       // is another thread migrated the string to internalized already.
-      // Migrations to thin are impossible, as we only call this method on table
-      // misses inside the critical section.
+      // Migrations to thin are impossible, as we only call this method after
+      // claiming the table entry, as the unique inserter of this key.
       string_->set_map_safe_transition_no_write_barrier(*internalized_map);
       DCHECK(string_->IsInternalizedString());
       return string_;
@@ -510,9 +533,9 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
   //
   //  - In-place internalizable strings do not incur a copy regardless of string
   //    table sharing. The map mutation is threadsafe even with relaxed memory
-  //    order, because for concurrent table lookups, the "losing" thread will be
-  //    correctly ordered by LookupKey's write mutex and see the updated map
-  //    during the re-lookup.
+  //    order, because a concurrent "losing" thread waits on the winning
+  //    thread's claimed table entry and is correctly ordered by the
+  //    release-store that publishes the string, so it sees the updated map.
   //
   // For lookup misses, the internalized string map is the same map in RO space
   // regardless of which thread is doing the lookup.
@@ -521,6 +544,23 @@ Handle<String> StringTable::LookupString(Isolate* isolate,
   // delay the transition into a ThinString to the next stop-the-world GC.
   Handle<String> result = String::Flatten(isolate, string);
   if (!result->IsInternalizedString()) {
+    // One-character strings resolve against the single character string table
+    // without hashing or probing. Its entries are the canonical internalized
+    // strings for all one-byte codes and live in the read-only heap, so this
+    // front-end is shared across isolates even without a shared string table.
+    // Digits are excluded so that their hash fields keep caching the integer
+    // index instead of a forwarding index (see SetInternalizedReference).
+    if (result->length() == 1) {
+      const uint16_t code = result->Get(0, isolate);
+      if (code <= String::kMaxOneByteCharCode && (code < '0' || code > '9')) {
+        Handle<String> internalized =
+            isolate->factory()->LookupSingleCharacterStringFromCode(code);
+        if (*string != *internalized && !string->IsThinString()) {
+          SetInternalizedReference(isolate, *string, *internalized);
+        }
+        return internalized;
+      }
+    }
     uint32_t raw_hash_field = result->raw_hash_field(kAcquireLoad);
 
     if (String::IsInternalizedForwardingIndex(raw_hash_field)) {
@@ -549,11 +589,12 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
-  //     mutex,
-  //   - Resizes of the string table first copies the old contents to the new
-  //     table, and only then sets the new string table pointer to the new
-  //     table,
+  //   - Insertions claim their entry with a compare-and-swap before publishing
+  //     the string into it, so an entry is only ever written by one thread,
+  //   - Resizes of the string table are guarded by the Isolate string table
+  //     mutex, first exclude all concurrent insertions, then copy the old
+  //     contents to the new table, and only then set the new string table
+  //     pointer to the new table,
   //   - Only GCs can remove elements from the string table.
   //
   // These assumptions allow us to make the following statement:
@@ -569,14 +610,14 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
   //
   // We therefore try to optimistically read from the string table without
   // taking the lock (both here and in the NoAllocate version of the lookup),
-  // and on a miss we take the lock and try to write the entry, with a second
-  // read lookup in case the non-locked read missed a write.
+  // and on a miss we run the lock-free insertion protocol, which re-checks for
+  // a matching entry along the way in case the non-locked read missed a write.
   //
-  // One complication is allocation -- we don't want to allocate while holding
-  // the string table lock. This applies to both allocation of new strings, and
+  // One complication is allocation -- we don't want to allocate while blocking
+  // other writers. This applies to both allocation of new strings, and
   // re-allocation of the string table on resize. So, we optimistically allocate
-  // (without copying values) outside the lock, and potentially discard the
-  // allocation if another write also did an allocation. This assumes that
+  // (without copying values) before claiming an entry, and potentially discard
+  // the allocation if another write raced us to the entry. This assumes that
   // writes are rarer than reads.
 
   // Load the current string table data, in case another thread updates the
@@ -598,36 +639,32 @@ Handle<String> StringTable::LookupKey(IsolateT* isolate, StringTableKey* key) {
 
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-
-    Data* data = EnsureCapacity(isolate, 1);
-
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = data->FindEntryOrInsertionEntry(isolate, key, key->hash());
-
-    Object element = data->Get(isolate, entry);
-    if (element == empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      data->Set(entry, *new_string);
-      data->ElementAdded();
-      return new_string;
-    } else if (element == deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      Handle<String> new_string = key->GetHandleForInsertion();
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      data->Set(entry, *new_string);
-      data->DeletedElementOverwritten();
-      return new_string;
-    } else {
-      // Return the existing string as a handle.
-      return handle(String::cast(element), isolate);
+  while (true) {
+    // Register as an active inserter. Inserters and resizes exclude each
+    // other: a resize first sets resize_requested_ and then waits for the
+    // inserter count to drain, while an inserter first increments the count
+    // and then checks the flag, so at least one side always observes the
+    // other (both accesses are sequentially consistent).
+    active_inserters_.fetch_add(1, std::memory_order_seq_cst);
+    if (V8_LIKELY(!resize_requested_.load(std::memory_order_seq_cst))) {
+      Data* data = data_.load(std::memory_order_acquire);
+      // Pre-check the capacity. Concurrent inserters may each admit
+      // themselves against the same counters, but the 50%-free growth
+      // headroom comfortably absorbs an overshoot of a few elements.
+      if (V8_LIKELY(StringTableHasSufficientCapacityToAdd(
+              data->capacity(), data->number_of_elements(),
+              data->number_of_deleted_elements(), 1))) {
+        Handle<String> result = data->FindOrInsert(isolate, key, key->hash());
+        active_inserters_.fetch_sub(1, std::memory_order_release);
+        return result;
+      }
     }
+    active_inserters_.fetch_sub(1, std::memory_order_release);
+
+    // Either a resize is in progress or the table is getting full: take the
+    // write mutex, grow the table if that is still needed, and try again.
+    base::MutexGuard table_write_guard(&write_mutex_);
+    EnsureCapacity(isolate, 1);
   }
 }
 
@@ -679,6 +716,15 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
   }
 
   if (new_capacity != -1) {
+    // Exclude concurrent lock-free insertions while the table is copied: no
+    // new inserter starts while resize_requested_ is set, and once the count
+    // below has drained, no thread holds a claimed entry in the old table.
+    // The drain also makes all published entries visible to the copy.
+    resize_requested_.store(true, std::memory_order_seq_cst);
+    while (active_inserters_.load(std::memory_order_seq_cst) != 0) {
+      YIELD_PROCESSOR;
+    }
+
     std::unique_ptr<Data> new_data =
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
@@ -688,6 +734,7 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
     // the pointer.
     data = new_data.release();
     data_.store(data, std::memory_order_release);
+    resize_requested_.store(false, std::memory_order_release);
   }
 
   return data;
@@ -812,6 +859,20 @@ Address StringTable::TryStringToIndexOrLookupExisting(Isolate* isolate,
     }
   }
 
+  // One-character keys resolve against the single character string table
+  // without hashing or probing. Digits are array indices and keep going
+  // through the index path below. Read the entry raw from the read-only
+  // table: this C call must not create handles in the caller's HandleScope.
+  if (string.length() == 1) {
+    const uint16_t code = source.Get(static_cast<int>(start), isolate);
+    if (code <= String::kMaxOneByteCharCode && (code < '0' || code > '9')) {
+      String internalized = String::cast(
+          ReadOnlyRoots(isolate).single_character_string_table().get(code));
+      SetInternalizedReference(isolate, string, internalized);
+      return internalized.ptr();
+    }
+  }
+
   if (source.IsOneByteRepresentation()) {
     return StringTable::Data::TryStringToIndexOrLookupExisting<uint8_t>(
         isolate, string, source, start);
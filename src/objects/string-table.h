@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_STRING_TABLE_H_
 #define V8_OBJECTS_STRING_TABLE_H_
 
+#include <atomic>
+
 #include "src/common/assert-scope.h"
 #include "src/objects/string.h"
 #include "src/roots/roots.h"
@@ -49,6 +51,10 @@ class V8_EXPORT_PRIVATE StringTable {
  public:
   static constexpr Smi empty_element() { return Smi::FromInt(0); }
   static constexpr Smi deleted_element() { return Smi::FromInt(1); }
+  // Sentinel for an entry that a concurrent insertion has claimed but not yet
+  // published a string into. Claimed entries are transient: they are resolved
+  // without blocking and are never visible during a GC safepoint.
+  static constexpr Smi claimed_element() { return Smi::FromInt(2); }
 
   explicit StringTable(Isolate* isolate);
   ~StringTable();
@@ -89,9 +95,15 @@ class V8_EXPORT_PRIVATE StringTable {
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
   std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  // The write mutex only guards resizes; insertions are lock-free, claiming
+  // empty entries with a compare-and-swap. Resizes and lock-free inserters
+  // exclude each other via the flag and counter below: a resize sets
+  // resize_requested_ and waits for active_inserters_ to drain, while an
+  // inserter registers in active_inserters_ and backs off onto the mutex if
+  // it then observes resize_requested_. See LookupKey.
+  base::Mutex write_mutex_;
+  std::atomic<int> active_inserters_{0};
+  std::atomic<bool> resize_requested_{false};
   Isolate* isolate_;
 };
 
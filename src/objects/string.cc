@@ -1049,6 +1049,16 @@ template Handle<FixedArray> String::CalculateLineEnds(LocalIsolate* isolate,
                                                       Handle<String> src,
                                                       bool include_ending_line);
 
+namespace {
+
+// Read-only operations on cons strings longer than this walk the segments of
+// the tree directly instead of paying the memory cost of flattening the
+// string first. Shorter strings are still flattened: that is cheap and
+// speeds up subsequent accesses.
+constexpr int kConsStringReadOnlyFlattenBudget = 64 * KB;
+
+}  // namespace
+
 bool String::SlowEquals(String other) const {
   DCHECK(!SharedStringAccessGuardIfNeeded::IsNeeded(*this));
   DCHECK(!SharedStringAccessGuardIfNeeded::IsNeeded(other));
@@ -1163,6 +1173,16 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  // Compare large cons strings segment by segment instead of paying the
+  // memory cost of flattening both sides for a read-only comparison.
+  if (one_length > kConsStringReadOnlyFlattenBudget &&
+      (one->IsConsString() || two->IsConsString())) {
+    DisallowGarbageCollection no_gc;
+    StringComparator comparator;
+    return comparator.Equals(*one, *two,
+                             SharedStringAccessGuardIfNeeded::NotNeeded());
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
@@ -1297,6 +1317,35 @@ int SearchString(Isolate* isolate, String::FlatContent receiver_content,
                       start_index);
 }
 
+// Searches {receiver} for a single character without flattening it, by
+// walking its flat segments in order. A single character pattern can never
+// span a segment boundary, so this is equivalent to a search over the
+// flattened string.
+template <typename PatternChar>
+int SearchConsStringForChar(Isolate* isolate, String receiver,
+                            PatternChar pattern_char, int start_index) {
+  DisallowGarbageCollection no_gc;
+  base::Vector<const PatternChar> pat_vector(&pattern_char, 1);
+  int position = start_index;
+  StringSegmentIterator it(receiver, start_index);
+  while (it.Next()) {
+    int found;
+    int segment_length;
+    if (it.is_one_byte()) {
+      base::Vector<const uint8_t> segment = it.one_byte_segment();
+      found = SearchString(isolate, segment, pat_vector, 0);
+      segment_length = segment.length();
+    } else {
+      base::Vector<const base::uc16> segment = it.two_byte_segment();
+      found = SearchString(isolate, segment, pat_vector, 0);
+      segment_length = segment.length();
+    }
+    if (found >= 0) return position + found;
+    position += segment_length;
+  }
+  return -1;
+}
+
 }  // namespace
 
 int String::IndexOf(Isolate* isolate, Handle<String> receiver,
@@ -1310,6 +1359,24 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
+  // A single-character search over a large cons string walks the segments of
+  // the tree directly: flattening a megabyte rope just to locate one
+  // character doubles the memory traffic. Longer patterns may match across
+  // segment boundaries and go through the flattening path below.
+  if (search_length == 1 && receiver->IsConsString() &&
+      receiver_length >
+          static_cast<uint32_t>(kConsStringReadOnlyFlattenBudget)) {
+    uint16_t pattern_char = search->Get(0);
+    if (pattern_char <= unibrow::Latin1::kMaxChar) {
+      return SearchConsStringForChar(isolate, *receiver,
+                                     static_cast<uint8_t>(pattern_char),
+                                     start_index);
+    }
+    return SearchConsStringForChar(isolate, *receiver,
+                                   static_cast<base::uc16>(pattern_char),
+                                   start_index);
+  }
+
   receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
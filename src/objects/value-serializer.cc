@@ -286,6 +286,10 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetVectoredOutput(bool mode) {
+  vectored_output_ = mode;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -419,6 +423,29 @@ std::pair<uint8_t*, size_t> ValueSerializer::Release() {
   return result;
 }
 
+std::vector<ValueSerializer::OutputChunk> ValueSerializer::GetOutputChunks()
+    const {
+  DCHECK(vectored_output_);
+  std::vector<OutputChunk> chunks;
+  chunks.reserve(2 * out_of_line_chunks_.size() + 1);
+  size_t inline_start = 0;
+  for (const OutOfLineChunk& chunk : out_of_line_chunks_) {
+    if (chunk.inline_end > inline_start) {
+      chunks.push_back(
+          {buffer_ + inline_start, chunk.inline_end - inline_start, nullptr});
+    }
+    inline_start = chunk.inline_end;
+    chunks.push_back(
+        {reinterpret_cast<const uint8_t*>(chunk.backing_store->buffer_start()),
+         chunk.size, chunk.backing_store});
+  }
+  if (buffer_size_ > inline_start) {
+    chunks.push_back(
+        {buffer_ + inline_start, buffer_size_ - inline_start, nullptr});
+  }
+  return chunks;
+}
+
 void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
                                           Handle<JSArrayBuffer> array_buffer) {
   DCHECK(!array_buffer_transfer_map_.Find(array_buffer));
@@ -941,6 +968,19 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
   // bumped.
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(byte_length);
+  if (vectored_output_ && byte_length > 0) {
+    std::shared_ptr<BackingStore> backing_store =
+        array_buffer->GetBackingStore();
+    if (backing_store) {
+      // Splice the contents into the stream as an out-of-line chunk rather
+      // than copying them; the refcount keeps the backing store alive until
+      // the chunk list is dropped.
+      out_of_line_chunks_.push_back({buffer_size_,
+                                     static_cast<size_t>(byte_length),
+                                     std::move(backing_store)});
+      return ThrowIfOutOfMemory();
+    }
+  }
   WriteRawBytes(array_buffer->backing_store(), byte_length);
   return ThrowIfOutOfMemory();
 }
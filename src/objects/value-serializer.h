@@ -6,6 +6,8 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -20,6 +22,7 @@
 namespace v8 {
 namespace internal {
 
+class BackingStore;
 class BigInt;
 class HeapNumber;
 class Isolate;
@@ -70,6 +73,26 @@ class ValueSerializer {
    */
   std::pair<uint8_t*, size_t> Release();
 
+  /*
+   * A piece of the serialized data, produced in vectored output mode. If
+   * |backing_store| is null, |data| points into the serializer's buffer;
+   * otherwise it points at the contents of a serialized ArrayBuffer, kept
+   * alive by |backing_store|.
+   */
+  struct OutputChunk {
+    const uint8_t* data;
+    size_t size;
+    std::shared_ptr<BackingStore> backing_store;
+  };
+
+  /*
+   * Returns the serialized data as an ordered list of chunks whose
+   * concatenation is the ordinary wire format. May only be called in
+   * vectored output mode. Does not transfer ownership of the buffer; the
+   * chunks are invalidated by Release() or by destroying the serializer.
+   */
+  std::vector<OutputChunk> GetOutputChunks() const;
+
   /*
    * Marks an ArrayBuffer as havings its contents transferred out of band.
    * Pass the corresponding JSArrayBuffer in the deserializing context to
@@ -97,6 +120,16 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Indicate whether ArrayBuffer contents should be kept out of line as
+   * refcounted references to their backing stores rather than copied into
+   * the buffer. In this mode the serialized data must be retrieved with
+   * GetOutputChunks() instead of Release().
+   *
+   * The default is to copy ArrayBuffer contents into the buffer.
+   */
+  void SetVectoredOutput(bool mode);
+
  private:
   friend class WebSnapshotSerializer;
 
@@ -175,9 +208,20 @@ class ValueSerializer {
   size_t buffer_size_ = 0;
   size_t buffer_capacity_ = 0;
   bool treat_array_buffer_views_as_host_objects_ = false;
+  bool vectored_output_ = false;
   bool out_of_memory_ = false;
   Zone zone_;
 
+  // In vectored output mode, the ArrayBuffer contents spliced into the wire
+  // format, in stream order. |inline_end| is the offset in |buffer_| at which
+  // the chunk's bytes logically appear.
+  struct OutOfLineChunk {
+    size_t inline_end;
+    size_t size;
+    std::shared_ptr<BackingStore> backing_store;
+  };
+  std::vector<OutOfLineChunk> out_of_line_chunks_;
+
   // To avoid extra lookups in the identity map, ID+1 is actually stored in the
   // map (checking if the used identity is zero is the fast way of checking if
   // the entry is new).
@@ -38,6 +38,20 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of code units that are all known to be one-byte. Used by the
+  // scanner's bulk ASCII fast paths.
+  V8_INLINE void AddOneByteChars(const uint16_t* code_units, int length) {
+    DCHECK(is_one_byte());
+    DCHECK_GE(length, 0);
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    for (int i = 0; i < length; i++) {
+      DCHECK_LE(code_units[i],
+                static_cast<uint16_t>(unibrow::Latin1::kMaxChar));
+      backing_store_[position_ + i] = static_cast<byte>(code_units[i]);
+    }
+    position_ += length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
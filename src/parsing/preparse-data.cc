@@ -4,11 +4,18 @@
 
 #include "src/parsing/preparse-data.h"
 
+#include <cstring>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "src/ast/scopes.h"
 #include "src/ast/variables.h"
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
 #include "src/handles/handles.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -850,5 +857,180 @@ std::unique_ptr<ConsumedPreparseData> ConsumedPreparseData::For(
   return std::make_unique<ZoneConsumedPreparseData>(zone, data);
 }
 
+namespace {
+
+// Zone- and isolate-independent copy of a PreparseData tree. Ownership is
+// shared between the process-wide cache and in-flight lookups, so evicting an
+// entry cannot free a tree another thread is still consuming.
+struct SharedPreparseTree {
+  std::vector<uint8_t> data;
+  std::vector<std::shared_ptr<const SharedPreparseTree>> children;
+};
+
+// A cache entry keeps the raw characters of the publishing source span so
+// that Lookup can verify actual content equality: the 64-bit key is a
+// non-cryptographic hash, and a collision must result in a cache miss rather
+// than handing wrong scope data to the parser, which trusts it.
+struct SharedPreparseEntry {
+  bool source_is_one_byte;
+  std::vector<uint8_t> source_bytes;
+  std::shared_ptr<const SharedPreparseTree> tree;
+};
+
+// Bound on the number of cached entries. Publishing into a full cache drops
+// the oldest generation wholesale, like the isolate's compilation cache does;
+// in-flight consumers keep their trees alive through the shared_ptr.
+constexpr size_t kPreparseDataCacheMaxEntries = 1024;
+
+base::LazyMutex preparse_data_cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(std::unordered_map<uint64_t,
+                                                   SharedPreparseEntry>,
+                                GetPreparseDataCacheMap)
+
+// Copies the raw characters of [start_position, end_position) of the flat
+// |source| into |bytes_out| (two bytes per character for two-byte sources)
+// and returns whether the source was one-byte.
+bool CopySourceSpan(String source, int start_position, int end_position,
+                    std::vector<uint8_t>* bytes_out) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    bytes_out->assign(chars.begin() + start_position,
+                      chars.begin() + end_position);
+    return true;
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  const uint8_t* bytes =
+      reinterpret_cast<const uint8_t*>(chars.begin() + start_position);
+  bytes_out->assign(bytes, bytes + (end_position - start_position) *
+                               static_cast<size_t>(sizeof(base::uc16)));
+  return false;
+}
+
+bool SourceSpanEquals(const SharedPreparseEntry& entry, String source,
+                      int start_position, int end_position) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte() != entry.source_is_one_byte) return false;
+  const uint8_t* bytes;
+  size_t length;
+  if (content.IsOneByte()) {
+    bytes = content.ToOneByteVector().begin() + start_position;
+    length = end_position - start_position;
+  } else {
+    bytes = reinterpret_cast<const uint8_t*>(content.ToUC16Vector().begin() +
+                                             start_position);
+    length = (end_position - start_position) *
+             static_cast<size_t>(sizeof(base::uc16));
+  }
+  return entry.source_bytes.size() == length &&
+         memcmp(entry.source_bytes.data(), bytes, length) == 0;
+}
+
+std::shared_ptr<const SharedPreparseTree> CopyPreparseTree(PreparseData data) {
+  DisallowGarbageCollection no_gc;
+  auto tree = std::make_shared<SharedPreparseTree>();
+  const int data_length = data.data_length();
+  tree->data.resize(data_length);
+  for (int i = 0; i < data_length; i++) tree->data[i] = data.get(i);
+  const int children_length = data.children_length();
+  tree->children.reserve(children_length);
+  for (int i = 0; i < children_length; i++) {
+    tree->children.push_back(CopyPreparseTree(data.get_child(i)));
+  }
+  return tree;
+}
+
+Handle<PreparseData> NewPreparseDataFromTree(Isolate* isolate,
+                                             const SharedPreparseTree* tree) {
+  Handle<PreparseData> data = isolate->factory()->NewPreparseData(
+      static_cast<int>(tree->data.size()),
+      static_cast<int>(tree->children.size()));
+  data->copy_in(0, tree->data.data(), static_cast<int>(tree->data.size()));
+  for (size_t i = 0; i < tree->children.size(); i++) {
+    Handle<PreparseData> child =
+        NewPreparseDataFromTree(isolate, tree->children[i].get());
+    data->set_child(static_cast<int>(i), *child);
+  }
+  return data;
+}
+
+}  // namespace
+
+// static
+bool PreparseDataCache::ComputeKey(String source, int start_position,
+                                   int end_position,
+                                   LanguageMode language_mode,
+                                   uint64_t* key_out) {
+  DisallowGarbageCollection no_gc;
+  if (!source.IsFlat()) return false;
+  DCHECK_LE(0, start_position);
+  DCHECK_LE(start_position, end_position);
+  DCHECK_LE(end_position, source.length());
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  size_t content_hash;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    content_hash = base::hash_range(chars.begin() + start_position,
+                                    chars.begin() + end_position);
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    content_hash = base::hash_range(chars.begin() + start_position,
+                                    chars.begin() + end_position);
+  }
+  *key_out = base::hash_combine(content_hash, start_position, end_position,
+                                static_cast<int>(language_mode));
+  return true;
+}
+
+// static
+void PreparseDataCache::Publish(uint64_t key, String source,
+                                int start_position, int end_position,
+                                PreparseData data) {
+  DCHECK(source.IsFlat());
+  {
+    base::MutexGuard guard(preparse_data_cache_mutex.Pointer());
+    if (GetPreparseDataCacheMap()->count(key) > 0) return;
+  }
+  // Copy the span and the tree outside the lock; racing publishers for the
+  // same key waste at most one copy.
+  SharedPreparseEntry entry;
+  entry.source_is_one_byte =
+      CopySourceSpan(source, start_position, end_position,
+                     &entry.source_bytes);
+  entry.tree = CopyPreparseTree(data);
+  base::MutexGuard guard(preparse_data_cache_mutex.Pointer());
+  auto* map = GetPreparseDataCacheMap();
+  if (map->size() >= kPreparseDataCacheMaxEntries &&
+      map->count(key) == 0) {
+    map->clear();
+  }
+  map->emplace(key, std::move(entry));
+}
+
+// static
+MaybeHandle<PreparseData> PreparseDataCache::Lookup(Isolate* isolate,
+                                                    uint64_t key,
+                                                    String source,
+                                                    int start_position,
+                                                    int end_position) {
+  DCHECK(source.IsFlat());
+  std::shared_ptr<const SharedPreparseTree> tree;
+  {
+    base::MutexGuard guard(preparse_data_cache_mutex.Pointer());
+    auto it = GetPreparseDataCacheMap()->find(key);
+    if (it == GetPreparseDataCacheMap()->end()) return {};
+    // The key is a hash; treat a collision as a miss so that the parser never
+    // consumes scope data produced for different source.
+    if (!SourceSpanEquals(it->second, source, start_position, end_position)) {
+      return {};
+    }
+    tree = it->second.tree;
+  }
+  return NewPreparseDataFromTree(isolate, tree.get());
+}
+
 }  // namespace internal
 }  // namespace v8
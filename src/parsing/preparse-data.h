@@ -309,6 +309,34 @@ class ConsumedPreparseData {
   ConsumedPreparseData() = default;
 };
 
+// Process-wide, content-addressed store of serialized preparse trees. When a
+// lazy function whose preparse data was discarded (e.g. by bytecode flushing)
+// or never attached is compiled, the store allows recreating the on-heap
+// PreparseData from a copy published by an earlier compile of the same source
+// span -- possibly in a different isolate -- instead of re-preparsing all
+// inner functions. Controlled by --shared-preparse-data.
+class V8_EXPORT_PRIVATE PreparseDataCache : public AllStatic {
+ public:
+  // Computes a seed-independent key for the span
+  // [start_position, end_position) of |source| compiled under
+  // |language_mode|. Returns false if the source string is not flat.
+  static bool ComputeKey(String source, int start_position, int end_position,
+                         LanguageMode language_mode, uint64_t* key_out);
+
+  // Publishes a copy of the tree rooted at |data| under |key|, together with
+  // a copy of the source span it was produced for. No-op if the key is
+  // already present; a full cache is flushed before inserting.
+  static void Publish(uint64_t key, String source, int start_position,
+                      int end_position, PreparseData data);
+
+  // Recreates an on-heap PreparseData tree from the entry for |key|, if any.
+  // The entry's stored source span must match the given one character for
+  // character; a key collision between different sources is a miss.
+  static MaybeHandle<PreparseData> Lookup(Isolate* isolate, uint64_t key,
+                                          String source, int start_position,
+                                          int end_position);
+};
+
 }  // namespace internal
 }  // namespace v8
 
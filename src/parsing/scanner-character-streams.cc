@@ -153,10 +153,13 @@ template <typename Char>
 class ChunkedStream {
  public:
   explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
-      : source_(source), chunks_(std::make_shared<std::vector<Chunk>>()) {}
+      : source_(source),
+        owns_chunks_(!source->RetainsOwnershipOfChunks()),
+        chunks_(std::make_shared<std::vector<Chunk>>()) {}
 
   ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
       : source_(nullptr),
+        owns_chunks_(other.owns_chunks_),
         chunks_(other.chunks_) {}
 
   // The no_gc argument is only here because of the templated way this class
@@ -166,7 +169,7 @@ class ChunkedStream {
     Chunk& chunk = FindChunk(pos, stats);
     size_t buffer_end = chunk.length;
     size_t buffer_pos = std::min(buffer_end, pos - chunk.position);
-    return {&chunk.data.get()[buffer_pos], &chunk.data.get()[buffer_end]};
+    return {&chunk.data[buffer_pos], &chunk.data[buffer_end]};
   }
 
   static const bool kCanBeCloned = true;
@@ -174,9 +177,15 @@ class ChunkedStream {
 
  private:
   struct Chunk {
-    Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    std::unique_ptr<const Char[]> data;
+    Chunk(const Char* const data, size_t position, size_t length, bool owned)
+        : data(data),
+          owned_data(owned ? data : nullptr),
+          position(position),
+          length(length) {}
+    const Char* const data;
+    // Frees the chunk bytes when the last stream clone drops them; null when
+    // the embedder retains ownership.
+    std::unique_ptr<const Char[]> owned_data;
     // The logical position of data.
     const size_t position;
     const size_t length;
@@ -206,7 +215,7 @@ class ChunkedStream {
     // Incoming data has to be aligned to Char size.
     DCHECK_EQ(0, length % sizeof(Char));
     chunks_->emplace_back(reinterpret_cast<const Char*>(data), position,
-                          length / sizeof(Char));
+                          length / sizeof(Char), owns_chunks_);
   }
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
@@ -224,6 +233,7 @@ class ChunkedStream {
   }
 
   ScriptCompiler::ExternalSourceStream* source_;
+  bool owns_chunks_;
 
  protected:
   std::shared_ptr<std::vector<struct Chunk>> chunks_;
@@ -521,7 +531,8 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
       ScriptCompiler::ExternalSourceStream* source_stream)
       : chunks_(std::make_shared<std::vector<Chunk>>()),
         current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
-        source_stream_(source_stream) {}
+        source_stream_(source_stream),
+        owns_chunks_(!source_stream->RetainsOwnershipOfChunks()) {}
   ~Utf8ExternalStreamingStream() final = default;
 
   bool can_access_heap() const final { return false; }
@@ -560,9 +571,15 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   // - The chunk data (data pointer and length), and
   // - the position at the first byte of the chunk.
   struct Chunk {
-    Chunk(const uint8_t* data, size_t length, StreamPosition start)
-        : data(data), length(length), start(start) {}
-    std::unique_ptr<const uint8_t[]> data;
+    Chunk(const uint8_t* data, size_t length, StreamPosition start, bool owned)
+        : data(data),
+          owned_data(owned ? data : nullptr),
+          length(length),
+          start(start) {}
+    const uint8_t* data;
+    // Frees the chunk bytes when the last stream clone drops them; null when
+    // the embedder retains ownership.
+    std::unique_ptr<const uint8_t[]> owned_data;
     size_t length;
     StreamPosition start;
   };
@@ -570,7 +587,8 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   Utf8ExternalStreamingStream(const Utf8ExternalStreamingStream& source_stream)
       V8_NOEXCEPT : chunks_(source_stream.chunks_),
                     current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
-                    source_stream_(nullptr) {}
+                    source_stream_(nullptr),
+                    owns_chunks_(source_stream.owns_chunks_) {}
 
   // Within the current chunk, skip forward from current_ towards position.
   bool SkipToPosition(size_t position);
@@ -601,8 +619,8 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   unibrow::Utf8::State state = chunk.start.state;
   uint32_t incomplete_char = chunk.start.incomplete_char;
   size_t it = current_.pos.bytes - chunk.start.bytes;
-  const uint8_t* cursor = &chunk.data.get()[it];
-  const uint8_t* end = &chunk.data.get()[chunk.length];
+  const uint8_t* cursor = &chunk.data[it];
+  const uint8_t* end = &chunk.data[chunk.length];
 
   size_t chars = current_.pos.chars;
 
@@ -628,7 +646,7 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
     }
   }
 
-  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
+  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
   current_.pos.chars = chars;
   current_.pos.incomplete_char = incomplete_char;
   current_.pos.state = state;
@@ -668,8 +686,8 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
-  const uint8_t* cursor = chunk.data.get() + it;
-  const uint8_t* end = chunk.data.get() + chunk.length;
+  const uint8_t* cursor = chunk.data + it;
+  const uint8_t* end = chunk.data + chunk.length;
 
   // Deal with possible BOM.
   if (V8_UNLIKELY(current_.pos.bytes < 3 && current_.pos.chars == 0)) {
@@ -717,7 +735,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     output_cursor += ascii_length;
   }
 
-  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data.get());
+  current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
   current_.pos.chars += (output_cursor - buffer_end_);
   current_.pos.incomplete_char = incomplete_char;
   current_.pos.state = state;
@@ -741,7 +759,7 @@ bool Utf8ExternalStreamingStream::FetchChunk() {
 
   const uint8_t* chunk = nullptr;
   size_t length = source_stream_->GetMoreData(&chunk);
-  chunks_->emplace_back(chunk, length, current_.pos);
+  chunks_->emplace_back(chunk, length, current_.pos, owns_chunks_);
   return length > 0;
 }
 
@@ -273,6 +273,17 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
+      // Bulk-scan the identifier body within the current buffer chunk using
+      // SIMD classification, then let the per-character loop below deal with
+      // chunk refills, non-ASCII input and the terminating character.
+      base::Vector<const uint16_t> run =
+          source_->AdvanceOverAsciiIdentifierChars();
+      if (!run.empty()) {
+        // Identifier characters never set IdentifierNeedsSlowPath.
+        for (uint16_t c : run) scan_flags |= character_scan_flags[c];
+        DCHECK(!IdentifierNeedsSlowPath(scan_flags));
+        AddLiteralAsciiChars(run);
+      }
       AdvanceUntil([this, &scan_flags](base::uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
@@ -329,6 +340,11 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
+    if (next().after_line_terminator) {
+      // The line terminator state is settled for this token, so the rest of
+      // the ASCII whitespace run can be skipped in bulk.
+      source_->AdvanceOverAsciiWhiteSpace();
+    }
     Advance();
   }
 
@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/numbers/conversions-inl.h"
 #include "src/objects/bigint.h"
@@ -18,9 +19,122 @@
 #include "src/parsing/scanner-inl.h"
 #include "src/zone/zone.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define SCANNER_NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+size_t AsciiIdentifierPrefixLength(const uint16_t* chars, size_t length) {
+  size_t index = 0;
+#ifdef __SSE3__
+  while (index + 8 <= length) {
+    __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + index));
+    // Letters: fold to lowercase first. The OR can only produce a value in
+    // 'a'..'z' if the input was an ASCII letter; anything above 0x7F keeps
+    // its high bits and fails the range check.
+    __m128i lower = _mm_or_si128(in, _mm_set1_epi16(0x20));
+    __m128i letter =
+        _mm_and_si128(_mm_cmpgt_epi16(lower, _mm_set1_epi16('a' - 1)),
+                      _mm_cmplt_epi16(lower, _mm_set1_epi16('z' + 1)));
+    __m128i digit =
+        _mm_and_si128(_mm_cmpgt_epi16(in, _mm_set1_epi16('0' - 1)),
+                      _mm_cmplt_epi16(in, _mm_set1_epi16('9' + 1)));
+    __m128i special = _mm_or_si128(_mm_cmpeq_epi16(in, _mm_set1_epi16('_')),
+                                   _mm_cmpeq_epi16(in, _mm_set1_epi16('$')));
+    __m128i ok = _mm_or_si128(_mm_or_si128(letter, digit), special);
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(ok));
+    if (mask == 0xFFFF) {
+      index += 8;
+      continue;
+    }
+    // Two mask bits per code unit.
+    return index + base::bits::CountTrailingZeros32(~mask & 0xFFFF) / 2;
+  }
+#elif defined(SCANNER_NEON64)
+  while (index + 8 <= length) {
+    uint16x8_t in = vld1q_u16(chars + index);
+    uint16x8_t lower = vorrq_u16(in, vdupq_n_u16(0x20));
+    uint16x8_t letter = vandq_u16(vcgeq_u16(lower, vdupq_n_u16('a')),
+                                  vcleq_u16(lower, vdupq_n_u16('z')));
+    uint16x8_t digit = vandq_u16(vcgeq_u16(in, vdupq_n_u16('0')),
+                                 vcleq_u16(in, vdupq_n_u16('9')));
+    uint16x8_t special = vorrq_u16(vceqq_u16(in, vdupq_n_u16('_')),
+                                   vceqq_u16(in, vdupq_n_u16('$')));
+    uint16x8_t ok = vorrq_u16(vorrq_u16(letter, digit), special);
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(ok)), 0);
+    if (mask == ~uint64_t{0}) {
+      index += 8;
+      continue;
+    }
+    // One mask byte per code unit.
+    return index + base::bits::CountTrailingZeros64(~mask) / 8;
+  }
+#endif
+  while (index < length && IsAsciiIdentifier(chars[index])) index++;
+  return index;
+}
+
+size_t AsciiWhiteSpacePrefixLength(const uint16_t* chars, size_t length) {
+  // Matches ' ' plus the '\t'..'\r' block (TAB, LF, VT, FF, CR), i.e. all
+  // ASCII characters for which IsWhiteSpaceOrLineTerminator holds.
+  size_t index = 0;
+#ifdef __SSE3__
+  while (index + 8 <= length) {
+    __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + index));
+    __m128i block =
+        _mm_and_si128(_mm_cmpgt_epi16(in, _mm_set1_epi16('\t' - 1)),
+                      _mm_cmplt_epi16(in, _mm_set1_epi16('\r' + 1)));
+    __m128i ok =
+        _mm_or_si128(block, _mm_cmpeq_epi16(in, _mm_set1_epi16(' ')));
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(ok));
+    if (mask == 0xFFFF) {
+      index += 8;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros32(~mask & 0xFFFF) / 2;
+  }
+#elif defined(SCANNER_NEON64)
+  while (index + 8 <= length) {
+    uint16x8_t in = vld1q_u16(chars + index);
+    uint16x8_t block = vandq_u16(vcgeq_u16(in, vdupq_n_u16('\t')),
+                                 vcleq_u16(in, vdupq_n_u16('\r')));
+    uint16x8_t ok = vorrq_u16(block, vceqq_u16(in, vdupq_n_u16(' ')));
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(ok)), 0);
+    if (mask == ~uint64_t{0}) {
+      index += 8;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros64(~mask) / 8;
+  }
+#endif
+  while (index < length &&
+         (chars[index] == ' ' ||
+          (chars[index] >= '\t' && chars[index] <= '\r'))) {
+    index++;
+  }
+  return index;
+}
+
 class Scanner::ErrorState {
  public:
   ErrorState(MessageTemplate* message_stack, Scanner::Location* location_stack)
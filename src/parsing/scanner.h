@@ -33,6 +33,18 @@ class ParserRecorder;
 class RuntimeCallStats;
 class Zone;
 
+// Returns the length of the prefix of [chars, chars + length) consisting
+// solely of ASCII identifier characters [0-9A-Za-z_$]. Classifies eight code
+// units per step when SIMD is available.
+V8_EXPORT_PRIVATE size_t AsciiIdentifierPrefixLength(const uint16_t* chars,
+                                                     size_t length);
+
+// Returns the length of the prefix of [chars, chars + length) consisting
+// solely of ASCII whitespace and line terminator characters. Classifies eight
+// code units per step when SIMD is available.
+V8_EXPORT_PRIVATE size_t AsciiWhiteSpacePrefixLength(const uint16_t* chars,
+                                                     size_t length);
+
 // ---------------------------------------------------------------------
 // Buffered stream of UTF-16 code units, using an internal UTF-16 buffer.
 // A code unit is a 16 bit value representing either a 16 bit code point
@@ -93,6 +105,26 @@ class Utf16CharacterStream {
     }
   }
 
+  // Advances past the run of ASCII identifier characters [0-9A-Za-z_$] at
+  // the cursor and returns it. Stops at the end of the current buffer chunk;
+  // the caller is expected to resume with AdvanceUntil, which handles chunk
+  // refills and the terminating character.
+  V8_INLINE base::Vector<const uint16_t> AdvanceOverAsciiIdentifierChars() {
+    size_t length = AsciiIdentifierPrefixLength(
+        buffer_cursor_, static_cast<size_t>(buffer_end_ - buffer_cursor_));
+    const uint16_t* run_start = buffer_cursor_;
+    buffer_cursor_ += length;
+    return base::Vector<const uint16_t>(run_start, length);
+  }
+
+  // Advances past the run of ASCII whitespace and line terminator characters
+  // at the cursor within the current buffer chunk. Only to be used once the
+  // scanner has settled its line terminator state for the current token.
+  V8_INLINE void AdvanceOverAsciiWhiteSpace() {
+    buffer_cursor_ += AsciiWhiteSpacePrefixLength(
+        buffer_cursor_, static_cast<size_t>(buffer_end_ - buffer_cursor_));
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -514,6 +546,10 @@ class V8_EXPORT_PRIVATE Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  V8_INLINE void AddLiteralAsciiChars(base::Vector<const uint16_t> chars) {
+    next().literal_chars.AddOneByteChars(chars.begin(), chars.length());
+  }
+
   V8_INLINE void AddRawLiteralChar(base::uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
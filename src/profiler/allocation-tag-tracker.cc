@@ -0,0 +1,92 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/allocation-tag-tracker.h"
+
+#include <memory>
+
+#include "src/api/api-inl.h"
+#include "src/base/ieee754.h"
+#include "src/base/utils/random-number-generator.h"
+#include "src/execution/isolate.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+// Sampling follows the same Poisson process as the sampling heap profiler:
+// with rate R (average bytes between samples), the next sample is taken after
+// (- ln u) * R bytes for uniformly distributed u.
+intptr_t AllocationTagTracker::Observer::GetNextStepSize() {
+  if (v8_flags.sampling_heap_profiler_suppress_randomness) {
+    return static_cast<intptr_t>(rate_);
+  }
+  double u = random_->NextDouble();
+  double next = (-base::ieee754::log(u)) * rate_;
+  return next < kTaggedSize
+             ? kTaggedSize
+             : (next > INT_MAX ? INT_MAX : static_cast<intptr_t>(next));
+}
+
+AllocationTagTracker::AllocationTagTracker(Heap* heap, uint64_t rate)
+    : isolate_(Isolate::FromHeap(heap)),
+      heap_(heap),
+      allocation_observer_(heap_, static_cast<intptr_t>(rate), rate, this,
+                           isolate_->random_number_generator()),
+      rate_(rate) {
+  CHECK_GT(rate_, 0u);
+  heap_->AddAllocationObserversToAllSpaces(&allocation_observer_,
+                                           &allocation_observer_);
+}
+
+AllocationTagTracker::~AllocationTagTracker() {
+  heap_->RemoveAllocationObserversFromAllSpaces(&allocation_observer_,
+                                                &allocation_observer_);
+}
+
+size_t AllocationTagTracker::ScaleSample(size_t size) const {
+  double scale = 1.0 / (1.0 - std::exp(-static_cast<double>(size) / rate_));
+  return static_cast<size_t>(size * scale + 0.5);
+}
+
+size_t AllocationTagTracker::GetRetainedBytesEstimate(uint64_t tag) const {
+  auto it = retained_estimate_.find(tag);
+  return it == retained_estimate_.end() ? 0 : it->second;
+}
+
+void AllocationTagTracker::SampleObject(Address soon_object, size_t size) {
+  DisallowGarbageCollection no_gc;
+
+  // Check if the area is iterable by confirming that it starts with a map.
+  DCHECK(HeapObject::FromAddress(soon_object).map(isolate_).IsMap(isolate_));
+
+  HandleScope scope(isolate_);
+  HeapObject heap_object = HeapObject::FromAddress(soon_object);
+  Handle<Object> obj(heap_object, isolate_);
+
+  Local<v8::Value> loc = v8::Utils::ToLocal(obj);
+
+  const size_t scaled_size = ScaleSample(size);
+  auto sample =
+      std::make_unique<Sample>(this, current_tag_, scaled_size, loc);
+  sample->global.SetWeak(sample.get(), OnWeakCallback,
+                         WeakCallbackType::kParameter);
+  retained_estimate_[current_tag_] += scaled_size;
+  samples_.emplace(sample.get(), std::move(sample));
+}
+
+// static
+void AllocationTagTracker::OnWeakCallback(
+    const WeakCallbackInfo<Sample>& data) {
+  Sample* sample = data.GetParameter();
+  AllocationTagTracker* tracker = sample->tracker;
+  auto it = tracker->retained_estimate_.find(sample->tag);
+  DCHECK_NE(it, tracker->retained_estimate_.end());
+  DCHECK_GE(it->second, sample->scaled_size);
+  it->second -= sample->scaled_size;
+  tracker->samples_.erase(sample);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,111 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_ALLOCATION_TAG_TRACKER_H_
+#define V8_PROFILER_ALLOCATION_TAG_TRACKER_H_
+
+#include <memory>
+#include <unordered_map>
+
+#include "include/v8-profiler.h"
+#include "src/heap/heap.h"
+
+namespace v8 {
+
+namespace base {
+class RandomNumberGenerator;
+}  // namespace base
+
+namespace internal {
+
+// Estimates bytes retained per embedder-defined allocation tag, for embedders
+// that multiplex several tenants within one isolate. The embedder sets the
+// current tag around each unit of work (e.g. a request); allocations are
+// sampled with a Poisson process like the sampling heap profiler, and each
+// sample holds a weak handle to its object, so the sample's bytes count
+// towards its tag until the object is collected. Overhead is proportional to
+// the sampling rate, independent of the allocation volume between samples.
+class AllocationTagTracker {
+ public:
+  AllocationTagTracker(Heap* heap, uint64_t rate);
+  ~AllocationTagTracker();
+  AllocationTagTracker(const AllocationTagTracker&) = delete;
+  AllocationTagTracker& operator=(const AllocationTagTracker&) = delete;
+
+  void set_current_tag(uint64_t tag) { current_tag_ = tag; }
+  uint64_t current_tag() const { return current_tag_; }
+
+  // Returns an estimate of the bytes currently retained by objects allocated
+  // under `tag`, extrapolated from the live samples.
+  size_t GetRetainedBytesEstimate(uint64_t tag) const;
+
+ private:
+  struct Sample {
+    Sample(AllocationTagTracker* tracker_, uint64_t tag_, size_t scaled_size_,
+           Local<Value> local_)
+        : tracker(tracker_),
+          tag(tag_),
+          scaled_size(scaled_size_),
+          global(reinterpret_cast<v8::Isolate*>(tracker_->isolate_), local_) {}
+    Sample(const Sample&) = delete;
+    Sample& operator=(const Sample&) = delete;
+    AllocationTagTracker* const tracker;
+    const uint64_t tag;
+    const size_t scaled_size;
+    Global<Value> global;
+  };
+
+  class Observer : public AllocationObserver {
+   public:
+    Observer(Heap* heap, intptr_t step_size, uint64_t rate,
+             AllocationTagTracker* tracker,
+             base::RandomNumberGenerator* random)
+        : AllocationObserver(step_size),
+          tracker_(tracker),
+          heap_(heap),
+          random_(random),
+          rate_(rate) {}
+
+   protected:
+    void Step(int bytes_allocated, Address soon_object, size_t size) override {
+      USE(heap_);
+      DCHECK(heap_->gc_state() == Heap::NOT_IN_GC);
+      if (soon_object) {
+        tracker_->SampleObject(soon_object, size);
+      }
+    }
+
+    intptr_t GetNextStepSize() override;
+
+   private:
+    AllocationTagTracker* const tracker_;
+    Heap* const heap_;
+    base::RandomNumberGenerator* const random_;
+    uint64_t const rate_;
+  };
+
+  void SampleObject(Address soon_object, size_t size);
+  static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
+
+  // The number of bytes a sample of the given size stands for, given the
+  // sampling rate: an allocation of size S is sampled with probability
+  // 1 - exp(-S/R), so each sample represents S / (1 - exp(-S/R)) bytes.
+  size_t ScaleSample(size_t size) const;
+
+  Isolate* const isolate_;
+  Heap* const heap_;
+  Observer allocation_observer_;
+  uint64_t const rate_;
+  uint64_t current_tag_ = 0;
+
+  // Sum of the scaled sizes of live samples, per tag. Updated as samples are
+  // taken and as their objects are collected.
+  std::unordered_map<uint64_t, size_t> retained_estimate_;
+  std::unordered_map<Sample*, std::unique_ptr<Sample>> samples_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_ALLOCATION_TAG_TRACKER_H_
@@ -12,6 +12,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/profiler/allocation-tag-tracker.h"
 #include "src/profiler/allocation-tracker.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
 #include "src/profiler/sampling-heap-profiler.h"
@@ -128,6 +129,30 @@ void HeapProfiler::StopSamplingHeapProfiler() {
   MaybeClearStringsStorage();
 }
 
+bool HeapProfiler::StartAllocationTagTracking(uint64_t sample_interval) {
+  if (allocation_tag_tracker_.get()) {
+    return false;
+  }
+  allocation_tag_tracker_.reset(
+      new AllocationTagTracker(heap(), sample_interval));
+  return true;
+}
+
+void HeapProfiler::StopAllocationTagTracking() {
+  allocation_tag_tracker_.reset();
+}
+
+void HeapProfiler::SetCurrentAllocationTag(uint64_t tag) {
+  if (allocation_tag_tracker_.get()) {
+    allocation_tag_tracker_->set_current_tag(tag);
+  }
+}
+
+size_t HeapProfiler::GetRetainedBytesForAllocationTag(uint64_t tag) const {
+  if (!allocation_tag_tracker_.get()) return 0;
+  return allocation_tag_tracker_->GetRetainedBytesEstimate(tag);
+}
+
 
 v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
   if (sampling_heap_profiler_.get()) {
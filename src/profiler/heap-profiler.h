@@ -18,6 +18,7 @@ namespace v8 {
 namespace internal {
 
 // Forward declarations.
+class AllocationTagTracker;
 class AllocationTracker;
 class HeapObjectsMap;
 class HeapSnapshot;
@@ -40,6 +41,12 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
 
+  bool StartAllocationTagTracking(uint64_t sample_interval);
+  void StopAllocationTagTracking();
+  bool is_tracking_allocation_tags() const { return !!allocation_tag_tracker_; }
+  void SetCurrentAllocationTag(uint64_t tag);
+  size_t GetRetainedBytesForAllocationTag(uint64_t tag) const;
+
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
   AllocationTracker* allocation_tracker() const {
@@ -106,6 +113,7 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   bool is_taking_snapshot_;
   base::Mutex profiler_mutex_;
   std::unique_ptr<SamplingHeapProfiler> sampling_heap_profiler_;
+  std::unique_ptr<AllocationTagTracker> allocation_tag_tracker_;
   std::vector<std::pair<v8::HeapProfiler::BuildEmbedderGraphCallback, void*>>
       build_embedder_graph_callbacks_;
   std::pair<v8::HeapProfiler::GetDetachednessCallback, void*>
@@ -2696,6 +2696,8 @@ HeapSnapshotGenerator::HeapSnapshotGenerator(
       control_(control),
       v8_heap_explorer_(snapshot_, this, resolver),
       dom_explorer_(snapshot_, this),
+      slice_budget_(base::TimeDelta::FromMilliseconds(
+          v8_flags.heap_snapshot_slice_budget_ms)),
       heap_(heap) {}
 
 namespace {
@@ -2768,8 +2770,16 @@ void HeapSnapshotGenerator::ProgressStep() {
 
 bool HeapSnapshotGenerator::ProgressReport(bool force) {
   const int kProgressReportGranularity = 10000;
-  if (control_ != nullptr &&
-      (force || progress_counter_ % kProgressReportGranularity == 0)) {
+  // Reading the clock once per object would dominate the graph walk, so the
+  // slice budget is only checked at a coarser interval.
+  const int kSliceBudgetCheckGranularity = 256;
+  if (control_ == nullptr) return true;
+  bool budget_expired = !slice_budget_.IsZero() &&
+                        progress_counter_ % kSliceBudgetCheckGranularity == 0 &&
+                        slice_timer_.Elapsed() >= slice_budget_;
+  if (force || budget_expired ||
+      progress_counter_ % kProgressReportGranularity == 0) {
+    if (budget_expired) slice_timer_.Restart();
     return control_->ReportProgressValue(progress_counter_, progress_total_) ==
            v8::ActivityControl::kContinue;
   }
@@ -2780,6 +2790,7 @@ void HeapSnapshotGenerator::InitProgressCounter() {
   if (control_ == nullptr) return;
   progress_total_ = v8_heap_explorer_.EstimateObjectsCount();
   progress_counter_ = 0;
+  if (!slice_budget_.IsZero()) slice_timer_.Start();
 }
 
 bool HeapSnapshotGenerator::FillReferences() {
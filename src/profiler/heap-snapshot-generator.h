@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "include/v8-profiler.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/objects/fixed-array.h"
@@ -648,6 +649,11 @@ class HeapSnapshotGenerator : public SnapshottingProgressReportingInterface {
   // Used during snapshot generation.
   uint32_t progress_counter_;
   uint32_t progress_total_;
+  // When --heap-snapshot-slice-budget-ms is non-zero, bounds the time between
+  // two progress reports so the embedder gets a chance to abort a snapshot of
+  // a large heap promptly instead of every kProgressReportGranularity objects.
+  base::TimeDelta slice_budget_;
+  base::ElapsedTimer slice_timer_;
   Heap* heap_;
 
 #ifdef V8_ENABLE_HEAP_SNAPSHOT_VERIFY
@@ -800,11 +800,13 @@ void CodeMap::Clear() {
   }
 
   code_map_.clear();
+  InvalidateCachedEntry();
 }
 
 void CodeMap::AddCode(Address addr, CodeEntry* entry, unsigned size) {
   code_map_.emplace(addr, CodeEntryMapInfo{entry, size});
   entry->set_instruction_start(addr);
+  InvalidateCachedEntry();
 }
 
 bool CodeMap::RemoveCode(CodeEntry* entry) {
@@ -813,6 +815,7 @@ bool CodeMap::RemoveCode(CodeEntry* entry) {
     if (i->second.entry == entry) {
       code_entries_.DecRef(entry);
       code_map_.erase(i);
+      InvalidateCachedEntry();
       return true;
     }
   }
@@ -830,9 +833,17 @@ void CodeMap::ClearCodesInRange(Address start, Address end) {
     code_entries_.DecRef(right->second.entry);
   }
   code_map_.erase(left, right);
+  InvalidateCachedEntry();
 }
 
 CodeEntry* CodeMap::FindEntry(Address addr, Address* out_instruction_start) {
+  // Fast path: repeated lookup in the code object found last. Frames of one
+  // sample, and samples processed back-to-back, mostly hit the same code.
+  if (cached_entry_ != nullptr && addr >= cached_entry_start_ &&
+      addr < cached_entry_end_) {
+    if (out_instruction_start) *out_instruction_start = cached_entry_start_;
+    return cached_entry_;
+  }
   // Note that an address may correspond to multiple CodeEntry objects. An
   // arbitrary selection is made (as per multimap spec) in the event of a
   // collision.
@@ -843,7 +854,12 @@ CodeEntry* CodeMap::FindEntry(Address addr, Address* out_instruction_start) {
   Address end_address = start_address + it->second.size;
   CodeEntry* ret = addr < end_address ? it->second.entry : nullptr;
   DCHECK(!ret || (addr >= start_address && addr < end_address));
-  if (ret && out_instruction_start) *out_instruction_start = start_address;
+  if (ret) {
+    cached_entry_ = ret;
+    cached_entry_start_ = start_address;
+    cached_entry_end_ = end_address;
+    if (out_instruction_start) *out_instruction_start = start_address;
+  }
   return ret;
 }
 
@@ -868,6 +884,7 @@ void CodeMap::MoveCode(Address from, Address to) {
   }
 
   code_map_.erase(range.first, it);
+  InvalidateCachedEntry();
 }
 
 void CodeMap::Print() {
@@ -514,8 +514,18 @@ class V8_EXPORT_PRIVATE CodeMap {
     unsigned size;
   };
 
+  void InvalidateCachedEntry() { cached_entry_ = nullptr; }
+
   std::multimap<Address, CodeEntryMapInfo> code_map_;
   CodeEntryStorage& code_entries_;
+
+  // Memoization of the last successful {FindEntry} lookup. Symbolizing a
+  // sample looks up every frame, and consecutive frames mostly fall into the
+  // same code object, so this avoids most of the multimap searches. Must be
+  // invalidated whenever {code_map_} is mutated.
+  CodeEntry* cached_entry_ = nullptr;
+  Address cached_entry_start_ = kNullAddress;
+  Address cached_entry_end_ = kNullAddress;
 };
 
 // Manages the lifetime of CodeEntry objects, and stores shared resources
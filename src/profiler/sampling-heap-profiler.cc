@@ -9,6 +9,7 @@
 
 #include "src/api/api-inl.h"
 #include "src/base/ieee754.h"
+#include "src/base/small-vector.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
@@ -144,7 +145,9 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::FindOrAddChildNode(
 SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   AllocationNode* node = &profile_root_;
 
-  std::vector<SharedFunctionInfo> stack;
+  // Inline storage covers the default stack depth, so sampling does not have
+  // to heap-allocate scratch space for typical stacks.
+  base::SmallVector<SharedFunctionInfo, 64> stack;
   JavaScriptFrameIterator frame_it(isolate_);
   int frames_captured = 0;
   bool found_arguments_marker_frames = false;
@@ -203,13 +206,27 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared.script().IsScript()) {
       Script script = Script::cast(shared.script());
       script_id = script.id();
     }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+    const int start_position = shared.StartPosition();
+    if (script_id != v8::UnboundScript::kNoScriptId) {
+      // The function id of scripted frames is a fingerprint of the stable
+      // (script id, start position) pair and does not involve the function
+      // name. Probing with it first keeps name symbolization off the hot
+      // path: names are resolved once when a node is created and all
+      // subsequent samples with the same stack reuse the node.
+      AllocationNode::FunctionId id =
+          AllocationNode::function_id(script_id, start_position, nullptr);
+      if (AllocationNode* child = node->FindChildNode(id)) {
+        node = child;
+        continue;
+      }
+    }
+    const char* name = this->names()->GetCopy(shared.DebugNameCStr().get());
+    node = FindOrAddChildNode(node, name, script_id, start_position);
   }
 
   if (found_arguments_marker_frames) {
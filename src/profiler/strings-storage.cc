@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/objects/objects-inl.h"
 #include "src/utils/allocation.h"
@@ -13,30 +14,56 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+inline uint32_t ComputeStringHash(const char* str, int len) {
+  uint32_t raw_hash_field =
+      StringHasher::HashSequentialString(str, len, kZeroHashSeed);
+  return Name::HashBits::decode(raw_hash_field);
+}
+
+}  // namespace
+
 bool StringsStorage::StringsMatch(void* key1, void* key2) {
   return strcmp(reinterpret_cast<char*>(key1), reinterpret_cast<char*>(key2)) ==
          0;
 }
 
-StringsStorage::StringsStorage() : names_(StringsMatch) {}
+StringsStorage::Shard::Shard() : names(StringsMatch) {}
+
+StringsStorage::StringsStorage() = default;
 
 StringsStorage::~StringsStorage() {
-  for (base::HashMap::Entry* p = names_.Start(); p != nullptr;
-       p = names_.Next(p)) {
-    DeleteArray(reinterpret_cast<const char*>(p->key));
+  for (Shard& shard : shards_) {
+    for (base::HashMap::Entry* p = shard.names.Start(); p != nullptr;
+         p = shard.names.Next(p)) {
+      DeleteArray(reinterpret_cast<const char*>(p->key));
+    }
   }
 }
 
+StringsStorage::Shard& StringsStorage::GetShard(uint32_t hash) {
+  static_assert(base::bits::IsPowerOfTwo(kShardCount));
+  static_assert(kShardCountLog2 < Name::HashBits::kSize);
+  // The hash map underlying each shard selects buckets with the low bits of
+  // the hash, so pick the shard with the high bits to keep the two
+  // independent.
+  return shards_[hash >> (Name::HashBits::kSize - kShardCountLog2)];
+}
+
 const char* StringsStorage::GetCopy(const char* src) {
-  base::MutexGuard guard(&mutex_);
   int len = static_cast<int>(strlen(src));
-  base::HashMap::Entry* entry = GetEntry(src, len);
+  uint32_t hash = ComputeStringHash(src, len);
+  Shard& shard = GetShard(hash);
+  base::MutexGuard guard(&shard.mutex);
+  base::HashMap::Entry* entry =
+      shard.names.LookupOrInsert(const_cast<char*>(src), hash);
   if (entry->value == nullptr) {
     base::Vector<char> dst = base::Vector<char>::New(len + 1);
     base::StrNCpy(dst, src, len);
     dst[len] = '\0';
     entry->key = dst.begin();
-    string_size_ += len;
+    shard.string_size += len;
   }
   entry->value =
       reinterpret_cast<void*>(reinterpret_cast<size_t>(entry->value) + 1);
@@ -52,12 +79,14 @@ const char* StringsStorage::GetFormatted(const char* format, ...) {
 }
 
 const char* StringsStorage::AddOrDisposeString(char* str, int len) {
-  base::MutexGuard guard(&mutex_);
-  base::HashMap::Entry* entry = GetEntry(str, len);
+  uint32_t hash = ComputeStringHash(str, len);
+  Shard& shard = GetShard(hash);
+  base::MutexGuard guard(&shard.mutex);
+  base::HashMap::Entry* entry = shard.names.LookupOrInsert(str, hash);
   if (entry->value == nullptr) {
     // New entry added.
     entry->key = str;
-    string_size_ += len;
+    shard.string_size += len;
   } else {
     DeleteArray(str);
   }
@@ -133,21 +162,13 @@ const char* StringsStorage::GetConsName(const char* prefix, Name name) {
   return "";
 }
 
-namespace {
-
-inline uint32_t ComputeStringHash(const char* str, int len) {
-  uint32_t raw_hash_field =
-      StringHasher::HashSequentialString(str, len, kZeroHashSeed);
-  return Name::HashBits::decode(raw_hash_field);
-}
-
-}  // namespace
-
 bool StringsStorage::Release(const char* str) {
-  base::MutexGuard guard(&mutex_);
   int len = static_cast<int>(strlen(str));
   uint32_t hash = ComputeStringHash(str, len);
-  base::HashMap::Entry* entry = names_.Lookup(const_cast<char*>(str), hash);
+  Shard& shard = GetShard(hash);
+  base::MutexGuard guard(&shard.mutex);
+  base::HashMap::Entry* entry =
+      shard.names.Lookup(const_cast<char*>(str), hash);
 
   // If an entry wasn't found or the address of the found entry doesn't match
   // the one passed in, this string wasn't managed by this StringsStorage
@@ -161,25 +182,35 @@ bool StringsStorage::Release(const char* str) {
       reinterpret_cast<void*>(reinterpret_cast<size_t>(entry->value) - 1);
 
   if (entry->value == 0) {
-    string_size_ -= len;
-    names_.Remove(const_cast<char*>(str), hash);
+    shard.string_size -= len;
+    shard.names.Remove(const_cast<char*>(str), hash);
     DeleteArray(str);
   }
   return true;
 }
 
 size_t StringsStorage::GetStringCountForTesting() const {
-  return names_.occupancy();
+  size_t count = 0;
+  for (const Shard& shard : shards_) {
+    count += shard.names.occupancy();
+  }
+  return count;
 }
 
 size_t StringsStorage::GetStringSize() {
-  base::MutexGuard guard(&mutex_);
-  return string_size_;
+  size_t size = 0;
+  for (Shard& shard : shards_) {
+    base::MutexGuard guard(&shard.mutex);
+    size += shard.string_size;
+  }
+  return size;
 }
 
-base::HashMap::Entry* StringsStorage::GetEntry(const char* str, int len) {
-  uint32_t hash = ComputeStringHash(str, len);
-  return names_.LookupOrInsert(const_cast<char*>(str), hash);
+bool StringsStorage::empty() const {
+  for (const Shard& shard : shards_) {
+    if (shard.names.occupancy() != 0) return false;
+  }
+  return true;
 }
 
 }  // namespace internal
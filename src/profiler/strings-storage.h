@@ -51,21 +51,33 @@ class V8_EXPORT_PRIVATE StringsStorage {
   size_t GetStringSize();
 
   // Returns true if the strings table is empty.
-  bool empty() const { return names_.occupancy() == 0; }
+  bool empty() const;
 
  private:
+  // The table is sharded by string hash, each shard guarded by its own lock,
+  // so that concurrent users (e.g. the heap snapshot generator running next
+  // to the sampling heap profiler, or several profiler threads) do not
+  // serialize all interning on a single mutex.
+  static constexpr int kShardCountLog2 = 4;
+  static constexpr int kShardCount = 1 << kShardCountLog2;
+
+  struct Shard {
+    Shard();
+    base::CustomMatcherHashMap names;
+    base::Mutex mutex;
+    size_t string_size = 0;
+  };
+
   static bool StringsMatch(void* key1, void* key2);
   // Adds the string to storage and returns it, or if a matching string exists
   // in the storage, deletes str and returns the matching string instead.
   const char* AddOrDisposeString(char* str, int len);
-  base::CustomMatcherHashMap::Entry* GetEntry(const char* str, int len);
+  Shard& GetShard(uint32_t hash);
   PRINTF_FORMAT(2, 0)
   const char* GetVFormatted(const char* format, va_list args);
   const char* GetSymbol(Symbol sym);
 
-  base::CustomMatcherHashMap names_;
-  base::Mutex mutex_;
-  size_t string_size_ = 0;
+  Shard shards_[kShardCount];
 };
 
 }  // namespace internal
@@ -215,8 +215,9 @@ class NfaInterpreter {
     // next instruction to be executed.
     int pc;
     // Pointer to the array of registers, which is always size
-    // `register_count_per_match_`.  Should be deallocated with
-    // `register_array_allocator_`.
+    // `register_count_per_match_`.  The array is copy-on-write and possibly
+    // shared with other threads; see `EnsureOwnedRegisterArray`.  Should be
+    // deallocated with `FreeRegisterArray`.
     int* register_array_begin;
   };
 
@@ -391,12 +392,7 @@ class NfaInterpreter {
           break;
         case RegExpInstruction::FORK: {
           InterpreterThread fork{inst.payload.pc,
-                                 NewRegisterArrayUninitialized()};
-          base::Vector<int> fork_registers = GetRegisterArray(fork);
-          base::Vector<int> t_registers = GetRegisterArray(t);
-          DCHECK_EQ(fork_registers.length(), t_registers.length());
-          std::copy(t_registers.begin(), t_registers.end(),
-                    fork_registers.begin());
+                                 ShareRegisterArray(t.register_array_begin)};
           active_threads_.Add(fork, zone_);
 
           ++t.pc;
@@ -417,10 +413,12 @@ class NfaInterpreter {
           active_threads_.DropAndClear();
           return;
         case RegExpInstruction::SET_REGISTER_TO_CP:
+          EnsureOwnedRegisterArray(t);
           GetRegisterArray(t)[inst.payload.register_index] = input_index_;
           ++t.pc;
           break;
         case RegExpInstruction::CLEAR_REGISTER:
+          EnsureOwnedRegisterArray(t);
           GetRegisterArray(t)[inst.payload.register_index] =
               kUndefinedRegisterValue;
           ++t.pc;
@@ -466,8 +464,19 @@ class NfaInterpreter {
     return base::Vector<int>(t.register_array_begin, register_count_per_match_);
   }
 
+  // Register arrays are copy-on-write: a forked thread shares its parent's
+  // array, and a private copy is only made when a thread writes to a register
+  // while still sharing.  The reference count is stored in the slot preceding
+  // the registers themselves.
+  int& RegisterArrayRefCount(int* register_array_begin) {
+    return register_array_begin[-1];
+  }
+
   int* NewRegisterArrayUninitialized() {
-    return register_array_allocator_.allocate(register_count_per_match_);
+    int* array_begin =
+        register_array_allocator_.allocate(register_count_per_match_ + 1) + 1;
+    RegisterArrayRefCount(array_begin) = 1;
+    return array_begin;
   }
 
   int* NewRegisterArray(int fill_value) {
@@ -477,9 +486,27 @@ class NfaInterpreter {
     return array_begin;
   }
 
+  int* ShareRegisterArray(int* register_array_begin) {
+    ++RegisterArrayRefCount(register_array_begin);
+    return register_array_begin;
+  }
+
   void FreeRegisterArray(int* register_array_begin) {
-    register_array_allocator_.deallocate(register_array_begin,
-                                         register_count_per_match_);
+    DCHECK_GT(RegisterArrayRefCount(register_array_begin), 0);
+    if (--RegisterArrayRefCount(register_array_begin) > 0) return;
+    register_array_allocator_.deallocate(register_array_begin - 1,
+                                         register_count_per_match_ + 1);
+  }
+
+  // Make `t` the sole owner of its register array, cloning the array first if
+  // it is currently shared with other threads.
+  void EnsureOwnedRegisterArray(InterpreterThread& t) {
+    if (RegisterArrayRefCount(t.register_array_begin) == 1) return;
+    int* copy = NewRegisterArrayUninitialized();
+    base::Vector<int> registers = GetRegisterArray(t);
+    std::copy(registers.begin(), registers.end(), copy);
+    FreeRegisterArray(t.register_array_begin);
+    t.register_array_begin = copy;
   }
 
   void DestroyThread(InterpreterThread t) {
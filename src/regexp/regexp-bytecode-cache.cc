@@ -0,0 +1,71 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/lazy-instance.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCache, GetRegExpBytecodeCache)
+
+}  // namespace
+
+// static
+RegExpBytecodeCache* RegExpBytecodeCache::Get() {
+  return GetRegExpBytecodeCache();
+}
+
+// static
+RegExpBytecodeCache::Key RegExpBytecodeCache::MakeKey(
+    base::Vector<const base::uc16> pattern, RegExpFlags flags) {
+  return Key{std::u16string(pattern.begin(), pattern.end()),
+             static_cast<int>(flags)};
+}
+
+bool RegExpBytecodeCache::Lookup(base::Vector<const base::uc16> pattern,
+                                 RegExpFlags flags, bool is_one_byte,
+                                 LookupResult* result) {
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(MakeKey(pattern, flags));
+  if (it == entries_.end()) return false;
+  const Bytecode* bytecode = it->second.bytecode[is_one_byte ? 1 : 0].get();
+  if (bytecode == nullptr) return false;
+  result->bytecode = bytecode->bytes;
+  result->register_count = bytecode->register_count;
+  return true;
+}
+
+void RegExpBytecodeCache::Insert(base::Vector<const base::uc16> pattern,
+                                 RegExpFlags flags, bool is_one_byte,
+                                 base::Vector<const uint8_t> bytecode,
+                                 int register_count) {
+  base::MutexGuard guard(&mutex_);
+  std::unique_ptr<Bytecode>& slot =
+      entries_[MakeKey(pattern, flags)].bytecode[is_one_byte ? 1 : 0];
+  // Concurrent isolates may compile the same specialization; the outputs are
+  // equivalent (modulo subject-sampling heuristics), so keep the first one.
+  if (slot != nullptr) return;
+  slot.reset(new Bytecode{
+      std::vector<uint8_t>(bytecode.begin(), bytecode.end()), register_count});
+}
+
+void RegExpBytecodeCache::RecordTierUp(base::Vector<const base::uc16> pattern,
+                                       RegExpFlags flags) {
+  base::MutexGuard guard(&mutex_);
+  entries_[MakeKey(pattern, flags)].tiered_up = true;
+}
+
+bool RegExpBytecodeCache::WasTieredUp(base::Vector<const base::uc16> pattern,
+                                      RegExpFlags flags) {
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(MakeKey(pattern, flags));
+  return it != entries_.end() && it->second.tiered_up;
+}
+
+}  // namespace internal
+}  // namespace v8
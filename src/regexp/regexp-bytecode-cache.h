@@ -0,0 +1,96 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of compiled irregexp bytecode and tier-up decisions,
+// keyed on (pattern, flags). Irregexp bytecode contains no heap pointers, so
+// it can be reused verbatim by every isolate that compiles the same pattern.
+// Native irregexp code cannot be shared this way -- it embeds
+// isolate-specific external references -- but recording that a pattern was
+// promoted to native code lets fresh isolates skip the interpreted warm-up
+// phase and compile natively on their first execution.
+//
+// Entries are retained for the lifetime of the process; like the per-isolate
+// regexp compilation cache, memory usage is bounded by the variety of
+// patterns the embedder compiles.
+class V8_EXPORT_PRIVATE RegExpBytecodeCache {
+ public:
+  static RegExpBytecodeCache* Get();
+
+  struct LookupResult {
+    std::vector<uint8_t> bytecode;
+    int register_count = 0;
+  };
+
+  // Returns true and fills |result| if some isolate already compiled bytecode
+  // for the given pattern specialization.
+  bool Lookup(base::Vector<const base::uc16> pattern, RegExpFlags flags,
+              bool is_one_byte, LookupResult* result);
+
+  // Stores a copy of freshly compiled bytecode.
+  void Insert(base::Vector<const base::uc16> pattern, RegExpFlags flags,
+              bool is_one_byte, base::Vector<const uint8_t> bytecode,
+              int register_count);
+
+  // Records that the pattern was promoted to native code.
+  void RecordTierUp(base::Vector<const base::uc16> pattern, RegExpFlags flags);
+
+  // Returns true if some isolate promoted the pattern to native code before.
+  bool WasTieredUp(base::Vector<const base::uc16> pattern, RegExpFlags flags);
+
+ private:
+  struct Key {
+    std::u16string pattern;
+    int flags;
+
+    bool operator==(const Key& other) const {
+      return flags == other.flags && pattern == other.pattern;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return std::hash<std::u16string>()(key.pattern) ^
+             std::hash<int>()(key.flags);
+    }
+  };
+
+  struct Bytecode {
+    std::vector<uint8_t> bytes;
+    int register_count = 0;
+  };
+
+  struct Entry {
+    // Indexed by is_one_byte; both subject specializations of a pattern are
+    // compiled independently.
+    std::unique_ptr<Bytecode> bytecode[2];
+    bool tiered_up = false;
+  };
+
+  static Key MakeKey(base::Vector<const base::uc16> pattern,
+                     RegExpFlags flags);
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
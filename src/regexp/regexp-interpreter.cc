@@ -6,11 +6,13 @@
 
 #include "src/regexp/regexp-interpreter.h"
 
+#include "src/base/bits.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/execution/isolate.h"
 #include "src/logging/counters.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/simd.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-macro-assembler.h"
@@ -24,6 +26,30 @@
 #include "unicode/uchar.h"
 #endif  // V8_INTL_SUPPORT
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3/SSSE3. However, it does define AVX, and AVX implies
+// both.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#ifndef __SSSE3__
+#define __SSSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define INTERPRETER_NEON64
+#include <arm_neon.h>
+#endif
+
 // Use token threaded dispatch iff the compiler supports computed gotos and the
 // build argument v8_enable_regexp_interpreter_threaded_dispatch was set.
 #if V8_HAS_COMPUTED_GOTO && \
@@ -322,6 +348,253 @@ bool IndexIsInBounds(int index, int length) {
   return static_cast<uintptr_t>(index) < static_cast<uintptr_t>(length);
 }
 
+// The SKIP_UNTIL_* bytecodes scan the subject for the next position at which
+// the body of the match could possibly start. When they advance the current
+// position by 1, the candidate positions are contiguous, and the scan reduces
+// to searching a character range for the next match of a simple predicate --
+// which the helpers below do with vector instructions where available. Each
+// helper scans |subject[from..to[| and returns the index of the first match,
+// or |to| if there is none.
+
+template <typename Char>
+int SkipUntilChar(base::Vector<const Char> subject, int from, int to,
+                  uint32_t search_char) {
+  DCHECK_LE(to, subject.length());
+  if (from >= to) return to;
+  if constexpr (sizeof(Char) == 1) {
+    if (search_char > 0xFF) return to;
+    const void* found = memchr(subject.begin() + from,
+                               static_cast<uint8_t>(search_char), to - from);
+    if (found == nullptr) return to;
+    return static_cast<int>(reinterpret_cast<const Char*>(found) -
+                            subject.begin());
+  } else {
+    if (search_char > 0xFFFF) return to;
+    int found = static_cast<int>(StringIndexOfUint16Char(
+        reinterpret_cast<const uint16_t*>(subject.begin()), to, from,
+        static_cast<uint16_t>(search_char)));
+    return found < 0 ? to : found;
+  }
+}
+
+template <typename Char>
+int SkipUntilEitherChar(base::Vector<const Char> subject, int from, int to,
+                        uint32_t c1, uint32_t c2) {
+  DCHECK_LE(to, subject.length());
+  constexpr uint32_t kMaxChar = sizeof(Char) == 1 ? 0xFF : 0xFFFF;
+  if (c1 > kMaxChar) return SkipUntilChar(subject, from, to, c2);
+  if (c2 > kMaxChar) return SkipUntilChar(subject, from, to, c1);
+  int index = from;
+#ifdef __SSE3__
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i needle1 = _mm_set1_epi8(static_cast<char>(c1));
+    const __m128i needle2 = _mm_set1_epi8(static_cast<char>(c2));
+    while (index + 16 <= to) {
+      const __m128i chunk = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + index));
+      const __m128i match = _mm_or_si128(_mm_cmpeq_epi8(chunk, needle1),
+                                         _mm_cmpeq_epi8(chunk, needle2));
+      const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+      if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+      index += 16;
+    }
+  } else {
+    const __m128i needle1 = _mm_set1_epi16(static_cast<int16_t>(c1));
+    const __m128i needle2 = _mm_set1_epi16(static_cast<int16_t>(c2));
+    while (index + 8 <= to) {
+      const __m128i chunk = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + index));
+      const __m128i match = _mm_or_si128(_mm_cmpeq_epi16(chunk, needle1),
+                                         _mm_cmpeq_epi16(chunk, needle2));
+      const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(match));
+      if (mask != 0) return index + base::bits::CountTrailingZeros32(mask) / 2;
+      index += 8;
+    }
+  }
+#elif defined(INTERPRETER_NEON64)
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t needle1 = vdupq_n_u8(static_cast<uint8_t>(c1));
+    const uint8x16_t needle2 = vdupq_n_u8(static_cast<uint8_t>(c2));
+    while (index + 16 <= to) {
+      const uint8x16_t chunk =
+          vld1q_u8(reinterpret_cast<const uint8_t*>(subject.begin() + index));
+      const uint8x16_t match =
+          vorrq_u8(vceqq_u8(chunk, needle1), vceqq_u8(chunk, needle2));
+      // Narrow the 16 byte lanes to one nibble each.
+      const uint64_t mask = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+      if (mask != 0) {
+        return index + base::bits::CountTrailingZeros64(mask) / 4;
+      }
+      index += 16;
+    }
+  } else {
+    const uint16x8_t needle1 = vdupq_n_u16(static_cast<uint16_t>(c1));
+    const uint16x8_t needle2 = vdupq_n_u16(static_cast<uint16_t>(c2));
+    while (index + 8 <= to) {
+      const uint16x8_t chunk =
+          vld1q_u16(reinterpret_cast<const uint16_t*>(subject.begin() + index));
+      const uint16x8_t match =
+          vorrq_u16(vceqq_u16(chunk, needle1), vceqq_u16(chunk, needle2));
+      // Narrow the 8 halfword lanes to one byte each.
+      const uint64_t mask =
+          vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(match)), 0);
+      if (mask != 0) {
+        return index + base::bits::CountTrailingZeros64(mask) / 8;
+      }
+      index += 8;
+    }
+  }
+#endif
+  for (; index < to; index++) {
+    const uint32_t c = subject[index];
+    if (c == c1 || c == c2) return index;
+  }
+  return to;
+}
+
+template <typename Char>
+int SkipUntilCharAnd(base::Vector<const Char> subject, int from, int to,
+                     uint32_t search_char, uint32_t mask) {
+  DCHECK_LE(to, subject.length());
+  constexpr uint32_t kMaxChar = sizeof(Char) == 1 ? 0xFF : 0xFFFF;
+  // (c & mask) == search_char cannot hold if search_char has bits outside
+  // either the mask or the character range.
+  if ((search_char & ~mask) != 0 || search_char > kMaxChar) return to;
+  int index = from;
+#ifdef __SSE3__
+  if constexpr (sizeof(Char) == 1) {
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(search_char));
+    const __m128i char_mask = _mm_set1_epi8(static_cast<char>(mask));
+    while (index + 16 <= to) {
+      const __m128i chunk = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + index));
+      const __m128i match =
+          _mm_cmpeq_epi8(_mm_and_si128(chunk, char_mask), needle);
+      const uint32_t found = static_cast<uint32_t>(_mm_movemask_epi8(match));
+      if (found != 0) return index + base::bits::CountTrailingZeros32(found);
+      index += 16;
+    }
+  } else {
+    const __m128i needle = _mm_set1_epi16(static_cast<int16_t>(search_char));
+    const __m128i char_mask = _mm_set1_epi16(static_cast<int16_t>(mask));
+    while (index + 8 <= to) {
+      const __m128i chunk = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + index));
+      const __m128i match =
+          _mm_cmpeq_epi16(_mm_and_si128(chunk, char_mask), needle);
+      const uint32_t found = static_cast<uint32_t>(_mm_movemask_epi8(match));
+      if (found != 0) {
+        return index + base::bits::CountTrailingZeros32(found) / 2;
+      }
+      index += 8;
+    }
+  }
+#elif defined(INTERPRETER_NEON64)
+  if constexpr (sizeof(Char) == 1) {
+    const uint8x16_t needle = vdupq_n_u8(static_cast<uint8_t>(search_char));
+    const uint8x16_t char_mask = vdupq_n_u8(static_cast<uint8_t>(mask));
+    while (index + 16 <= to) {
+      const uint8x16_t chunk =
+          vld1q_u8(reinterpret_cast<const uint8_t*>(subject.begin() + index));
+      const uint8x16_t match = vceqq_u8(vandq_u8(chunk, char_mask), needle);
+      // Narrow the 16 byte lanes to one nibble each.
+      const uint64_t found = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+      if (found != 0) {
+        return index + base::bits::CountTrailingZeros64(found) / 4;
+      }
+      index += 16;
+    }
+  } else {
+    const uint16x8_t needle = vdupq_n_u16(static_cast<uint16_t>(search_char));
+    const uint16x8_t char_mask = vdupq_n_u16(static_cast<uint16_t>(mask));
+    while (index + 8 <= to) {
+      const uint16x8_t chunk =
+          vld1q_u16(reinterpret_cast<const uint16_t*>(subject.begin() + index));
+      const uint16x8_t match = vceqq_u16(vandq_u16(chunk, char_mask), needle);
+      // Narrow the 8 halfword lanes to one byte each.
+      const uint64_t found =
+          vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(match)), 0);
+      if (found != 0) {
+        return index + base::bits::CountTrailingZeros64(found) / 8;
+      }
+      index += 8;
+    }
+  }
+#endif
+  for (; index < to; index++) {
+    const uint32_t c = subject[index];
+    if ((c & mask) == search_char) return index;
+  }
+  return to;
+}
+
+// One-byte subjects only; a character's bit is looked up in the table modulo
+// kTableSize, as in CheckBitInTable.
+int SkipUntilBitInTable(base::Vector<const uint8_t> subject, int from, int to,
+                        const byte* table) {
+  DCHECK_LE(to, subject.length());
+  int index = from;
+#ifdef __SSSE3__
+  {
+    static_assert(RegExpMacroAssembler::kTableSize == 16 * kBitsPerByte);
+    const __m128i rows =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+    const __m128i bit_select =
+        _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64,
+                      -128);
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i low3_mask = _mm_set1_epi8(0x07);
+    const __m128i zero = _mm_setzero_si128();
+    while (index + 16 <= to) {
+      const __m128i chunk = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(subject.begin() + index));
+      // The table row of a character c is (c & kTableMask) >> 3, which equals
+      // (c >> 3) & 0xF; the bit within the row is c & 7.
+      const __m128i row = _mm_shuffle_epi8(
+          rows, _mm_and_si128(_mm_srli_epi16(chunk, 3), nibble_mask));
+      const __m128i bit =
+          _mm_shuffle_epi8(bit_select, _mm_and_si128(chunk, low3_mask));
+      const __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(row, bit), zero);
+      const uint32_t mask =
+          static_cast<uint32_t>(_mm_movemask_epi8(miss)) ^ 0xFFFF;
+      if (mask != 0) return index + base::bits::CountTrailingZeros32(mask);
+      index += 16;
+    }
+  }
+#elif defined(INTERPRETER_NEON64)
+  {
+    static_assert(RegExpMacroAssembler::kTableSize == 16 * kBitsPerByte);
+    const uint8x16_t rows = vld1q_u8(table);
+    static constexpr uint8_t kBitSelect[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                               1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bit_select = vld1q_u8(kBitSelect);
+    while (index + 16 <= to) {
+      const uint8x16_t chunk = vld1q_u8(subject.begin() + index);
+      // The table row of a character c is (c & kTableMask) >> 3, which equals
+      // (c >> 3) & 0xF; the bit within the row is c & 7.
+      const uint8x16_t row = vqtbl1q_u8(
+          rows, vandq_u8(vshrq_n_u8(chunk, 3), vdupq_n_u8(0x0F)));
+      const uint8x16_t bit =
+          vqtbl1q_u8(bit_select, vandq_u8(chunk, vdupq_n_u8(0x07)));
+      const uint8x16_t hit = vtstq_u8(row, bit);
+      // Narrow the 16 byte lanes to one nibble each.
+      const uint64_t mask = vget_lane_u64(
+          vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+      if (mask != 0) {
+        return index + base::bits::CountTrailingZeros64(mask) / 4;
+      }
+      index += 16;
+    }
+  }
+#endif
+  for (; index < to; index++) {
+    if (CheckBitInTable(subject[index], table)) return index;
+  }
+  return to;
+}
+
 // If computed gotos are supported by the compiler, we can get addresses to
 // labels directly in C/C++. Every bytecode handler has its own label and we
 // store the addresses in a dispatch table indexed by bytecode. To execute the
@@ -440,6 +713,11 @@ IrregexpInterpreter::Result RawMatch(
   const byte* pc = code_array.GetDataStartAddress();
   const byte* code_base = pc;
 
+  // The subject length is invariant for the whole match. Keeping it in a
+  // local allows the compiler to hold it in a register across handlers
+  // instead of reloading it for every bounds check.
+  const int subject_length = subject.length();
+
   InterpreterRegisters registers(total_register_count, output_registers,
                                  output_register_count);
   BacktrackStack backtrack_stack;
@@ -577,7 +855,7 @@ IrregexpInterpreter::Result RawMatch(
     }
     BYTECODE(LOAD_CURRENT_CHAR) {
       int pos = current + LoadPacked24Signed(insn);
-      if (pos >= subject.length() || pos < 0) {
+      if (!IndexIsInBounds(pos, subject_length)) {
         SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
       } else {
         ADVANCE(LOAD_CURRENT_CHAR);
@@ -593,7 +871,7 @@ IrregexpInterpreter::Result RawMatch(
     }
     BYTECODE(LOAD_2_CURRENT_CHARS) {
       int pos = current + LoadPacked24Signed(insn);
-      if (pos + 2 > subject.length() || pos < 0) {
+      if (pos + 2 > subject_length || pos < 0) {
         SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
       } else {
         ADVANCE(LOAD_2_CURRENT_CHARS);
@@ -612,7 +890,7 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(LOAD_4_CURRENT_CHARS) {
       DCHECK_EQ(1, sizeof(Char));
       int pos = current + LoadPacked24Signed(insn);
-      if (pos + 4 > subject.length() || pos < 0) {
+      if (pos + 4 > subject_length || pos < 0) {
         SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
       } else {
         ADVANCE(LOAD_4_CURRENT_CHARS);
@@ -801,7 +1079,7 @@ IrregexpInterpreter::Result RawMatch(
       int from = registers[LoadPacked24Unsigned(insn)];
       int len = registers[LoadPacked24Unsigned(insn) + 1] - from;
       if (from >= 0 && len > 0) {
-        if (current + len > subject.length() ||
+        if (current + len > subject_length ||
             !CompareCharsEqual(&subject[from], &subject[current], len)) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
           DISPATCH();
@@ -829,7 +1107,7 @@ IrregexpInterpreter::Result RawMatch(
       int from = registers[LoadPacked24Unsigned(insn)];
       int len = registers[LoadPacked24Unsigned(insn) + 1] - from;
       if (from >= 0 && len > 0) {
-        if (current + len > subject.length() ||
+        if (current + len > subject_length ||
             !BackRefMatchesNoCase(isolate, from, current, len, subject, true)) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
           DISPATCH();
@@ -843,7 +1121,7 @@ IrregexpInterpreter::Result RawMatch(
       int from = registers[LoadPacked24Unsigned(insn)];
       int len = registers[LoadPacked24Unsigned(insn) + 1] - from;
       if (from >= 0 && len > 0) {
-        if (current + len > subject.length() ||
+        if (current + len > subject_length ||
             !BackRefMatchesNoCase(isolate, from, current, len, subject,
                                   false)) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
@@ -903,15 +1181,18 @@ IrregexpInterpreter::Result RawMatch(
     BYTECODE(SET_CURRENT_POSITION_FROM_END) {
       ADVANCE(SET_CURRENT_POSITION_FROM_END);
       int by = LoadPacked24Unsigned(insn);
-      if (subject.length() - current > by) {
-        SET_CURRENT_POSITION(subject.length() - by);
+      if (subject_length - current > by) {
+        SET_CURRENT_POSITION(subject_length - by);
         current_char = subject[current - 1];
       }
       DISPATCH();
     }
     BYTECODE(CHECK_CURRENT_POSITION) {
       int pos = current + LoadPacked24Signed(insn);
-      if (pos > subject.length() || pos < 0) {
+      // One-past-the-end is a valid position; fold both sides of the check
+      // into a single unsigned comparison.
+      if (static_cast<uintptr_t>(pos) >
+          static_cast<uintptr_t>(subject_length)) {
         SET_PC_FROM_OFFSET(Load32Aligned(pc + 4));
       } else {
         ADVANCE(CHECK_CURRENT_POSITION);
@@ -922,7 +1203,28 @@ IrregexpInterpreter::Result RawMatch(
       int32_t load_offset = LoadPacked24Signed(insn);
       int32_t advance = Load16AlignedSigned(pc + 4);
       uint32_t c = Load16Aligned(pc + 6);
-      while (IndexIsInBounds(current + load_offset, subject.length())) {
+      if (advance == 1) {
+        // Candidate positions are consecutive, so the loop reduces to a plain
+        // character search, which SkipUntilChar vectorizes.
+        const int from = current + load_offset;
+        const int to = subject_length;
+        if (!IndexIsInBounds(from, to)) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+          DISPATCH();
+        }
+        const int found = SkipUntilChar(subject, from, to, c);
+        if (found < to) {
+          SET_CURRENT_POSITION(found - load_offset);
+          current_char = subject[found];
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+          DISPATCH();
+        }
+        SET_CURRENT_POSITION(to - load_offset);
+        current_char = subject[to - 1];
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+        DISPATCH();
+      }
+      while (IndexIsInBounds(current + load_offset, subject_length)) {
         current_char = subject[current + load_offset];
         if (c == current_char) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
@@ -939,8 +1241,30 @@ IrregexpInterpreter::Result RawMatch(
       uint16_t c = Load16Aligned(pc + 6);
       uint32_t mask = Load32Aligned(pc + 8);
       int32_t maximum_offset = Load32Aligned(pc + 12);
+      if (advance == 1) {
+        if (static_cast<uintptr_t>(current + maximum_offset) >
+            static_cast<uintptr_t>(subject_length)) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 20));
+          DISPATCH();
+        }
+        const int from = current + load_offset;
+        const int to = subject_length - maximum_offset + load_offset + 1;
+        DCHECK_GE(from, 0);
+        DCHECK_LE(to, subject_length);
+        const int found = SkipUntilCharAnd(subject, from, to, c, mask);
+        if (found < to) {
+          SET_CURRENT_POSITION(found - load_offset);
+          current_char = subject[found];
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+          DISPATCH();
+        }
+        SET_CURRENT_POSITION(subject_length - maximum_offset + 1);
+        current_char = subject[to - 1];
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 20));
+        DISPATCH();
+      }
       while (static_cast<uintptr_t>(current + maximum_offset) <=
-             static_cast<uintptr_t>(subject.length())) {
+             static_cast<uintptr_t>(subject_length)) {
         current_char = subject[current + load_offset];
         if (c == (current_char & mask)) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
@@ -956,8 +1280,30 @@ IrregexpInterpreter::Result RawMatch(
       int32_t advance = Load16AlignedSigned(pc + 4);
       uint16_t c = Load16Aligned(pc + 6);
       int32_t maximum_offset = Load32Aligned(pc + 8);
+      if (advance == 1) {
+        if (static_cast<uintptr_t>(current + maximum_offset) >
+            static_cast<uintptr_t>(subject_length)) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+          DISPATCH();
+        }
+        const int from = current + load_offset;
+        const int to = subject_length - maximum_offset + load_offset + 1;
+        DCHECK_GE(from, 0);
+        DCHECK_LE(to, subject_length);
+        const int found = SkipUntilChar(subject, from, to, c);
+        if (found < to) {
+          SET_CURRENT_POSITION(found - load_offset);
+          current_char = subject[found];
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+          DISPATCH();
+        }
+        SET_CURRENT_POSITION(subject_length - maximum_offset + 1);
+        current_char = subject[to - 1];
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+        DISPATCH();
+      }
       while (static_cast<uintptr_t>(current + maximum_offset) <=
-             static_cast<uintptr_t>(subject.length())) {
+             static_cast<uintptr_t>(subject_length)) {
         current_char = subject[current + load_offset];
         if (c == current_char) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
@@ -972,7 +1318,28 @@ IrregexpInterpreter::Result RawMatch(
       int32_t load_offset = LoadPacked24Signed(insn);
       int32_t advance = Load16AlignedSigned(pc + 4);
       const byte* table = pc + 8;
-      while (IndexIsInBounds(current + load_offset, subject.length())) {
+      if constexpr (sizeof(Char) == 1) {
+        if (advance == 1) {
+          const int from = current + load_offset;
+          const int to = subject_length;
+          if (!IndexIsInBounds(from, to)) {
+            SET_PC_FROM_OFFSET(Load32Aligned(pc + 28));
+            DISPATCH();
+          }
+          const int found = SkipUntilBitInTable(subject, from, to, table);
+          if (found < to) {
+            SET_CURRENT_POSITION(found - load_offset);
+            current_char = subject[found];
+            SET_PC_FROM_OFFSET(Load32Aligned(pc + 24));
+            DISPATCH();
+          }
+          SET_CURRENT_POSITION(to - load_offset);
+          current_char = subject[to - 1];
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 28));
+          DISPATCH();
+        }
+      }
+      while (IndexIsInBounds(current + load_offset, subject_length)) {
         current_char = subject[current + load_offset];
         if (CheckBitInTable(current_char, table)) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 24));
@@ -988,7 +1355,7 @@ IrregexpInterpreter::Result RawMatch(
       int32_t advance = Load16AlignedSigned(pc + 4);
       uint16_t limit = Load16Aligned(pc + 6);
       const byte* table = pc + 8;
-      while (IndexIsInBounds(current + load_offset, subject.length())) {
+      while (IndexIsInBounds(current + load_offset, subject_length)) {
         current_char = subject[current + load_offset];
         if (current_char > limit) {
           SET_PC_FROM_OFFSET(Load32Aligned(pc + 24));
@@ -1008,7 +1375,26 @@ IrregexpInterpreter::Result RawMatch(
       int32_t advance = Load32Aligned(pc + 4);
       uint16_t c = Load16Aligned(pc + 8);
       uint16_t c2 = Load16Aligned(pc + 10);
-      while (IndexIsInBounds(current + load_offset, subject.length())) {
+      if (advance == 1) {
+        const int from = current + load_offset;
+        const int to = subject_length;
+        if (!IndexIsInBounds(from, to)) {
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+          DISPATCH();
+        }
+        const int found = SkipUntilEitherChar(subject, from, to, c, c2);
+        if (found < to) {
+          SET_CURRENT_POSITION(found - load_offset);
+          current_char = subject[found];
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+          DISPATCH();
+        }
+        SET_CURRENT_POSITION(to - load_offset);
+        current_char = subject[to - 1];
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
+        DISPATCH();
+      }
+      while (IndexIsInBounds(current + load_offset, subject_length)) {
         current_char = subject[current + load_offset];
         // The two if-statements below are split up intentionally, as combining
         // them seems to result in register allocation behaving quite
@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -21,6 +22,7 @@
 #include "src/regexp/regexp-parser.h"
 #include "src/regexp/regexp-utils.h"
 #include "src/strings/string-search.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -184,6 +186,18 @@ bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Copies the pattern into a flat two-byte buffer, to serve as a key into the
+// process-wide RegExpBytecodeCache regardless of the pattern's in-heap
+// representation.
+base::Vector<const base::uc16> PatternForBytecodeCache(
+    Handle<String> pattern, std::unique_ptr<base::uc16[]>* buffer) {
+  DisallowGarbageCollection no_gc;
+  const int length = pattern->length();
+  buffer->reset(new base::uc16[length]);
+  String::WriteToFlat(*pattern, buffer->get(), 0, length);
+  return base::Vector<const base::uc16>(buffer->get(), length);
+}
+
 }  // namespace
 
 // Generic RegExp methods. Dispatches to implementation specific methods.
@@ -267,6 +281,21 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
   if (!has_been_compiled) {
     RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
                                    parse_result.capture_count, backtrack_limit);
+    // If some other isolate already promoted this pattern to native code,
+    // skip the interpreted warm-up phase and compile natively on the first
+    // execution.
+    if (v8_flags.regexp_bytecode_cache && v8_flags.regexp_tier_up &&
+        is_compilation_cache_enabled) {
+      std::unique_ptr<base::uc16[]> buffer;
+      if (RegExpBytecodeCache::Get()->WasTieredUp(
+              PatternForBytecodeCache(pattern, &buffer), flags)) {
+        re->MarkTierUpForNextExec();
+        if (v8_flags.trace_regexp_tier_up) {
+          PrintF("JSRegExp object %p tiers up from cross-isolate profile\n",
+                 reinterpret_cast<void*>(re->ptr()));
+        }
+      }
+    }
   }
   DCHECK(re->data().IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -563,13 +592,60 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re->backtrack_limit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    RegExp::ThrowRegExpException(isolate, re, compile_data.error);
-    return false;
+  // As in RegExp::Compile, a present backtrack limit specializes the generated
+  // code and is rare, so such patterns skip the process-wide cache.
+  const bool is_cacheable = v8_flags.regexp_bytecode_cache &&
+                            backtrack_limit == JSRegExp::kNoBacktrackLimit;
+  std::unique_ptr<base::uc16[]> cache_key_buffer;
+  base::Vector<const base::uc16> cache_key;
+  if (is_cacheable) {
+    cache_key = PatternForBytecodeCache(pattern, &cache_key_buffer);
+  }
+
+  bool reused_cached_bytecode = false;
+  if (is_cacheable &&
+      compile_data.compilation_target == RegExpCompilationTarget::kBytecode) {
+    RegExpBytecodeCache::LookupResult cached;
+    if (RegExpBytecodeCache::Get()->Lookup(cache_key, flags, is_one_byte,
+                                           &cached)) {
+      // Some isolate already compiled this specialization; reuse its bytecode
+      // instead of re-running the compiler.
+      Handle<ByteArray> bytecode = isolate->factory()->NewByteArray(
+          static_cast<int>(cached.bytecode.size()));
+      MemCopy(bytecode->GetDataStartAddress(), cached.bytecode.data(),
+              cached.bytecode.size());
+      compile_data.code = bytecode;
+      compile_data.register_count = cached.register_count;
+      reused_cached_bytecode = true;
+    }
+  }
+
+  if (!reused_cached_bytecode) {
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      RegExp::ThrowRegExpException(isolate, re, compile_data.error);
+      return false;
+    }
+    if (is_cacheable) {
+      if (compile_data.compilation_target ==
+          RegExpCompilationTarget::kBytecode) {
+        DisallowGarbageCollection no_gc;
+        ByteArray bytecode = ByteArray::cast(*compile_data.code);
+        RegExpBytecodeCache::Get()->Insert(
+            cache_key, flags, is_one_byte,
+            base::Vector<const uint8_t>(bytecode.GetDataStartAddress(),
+                                        bytecode.length()),
+            compile_data.register_count);
+      } else {
+        // Native code embeds isolate-specific external references and cannot
+        // be shared, but remembering the promotion lets other isolates skip
+        // the interpreted warm-up for this pattern.
+        RegExpBytecodeCache::Get()->RecordTierUp(cache_key, flags);
+      }
+    }
   }
 
   Handle<FixedArray> data =
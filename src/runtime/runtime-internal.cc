@@ -360,6 +360,12 @@ Object BytecodeBudgetInterruptWithStackCheck(Isolate* isolate,
   Handle<JSFunction> function = args.at<JSFunction>(0);
   TRACE_EVENT0("v8.execute", "V8.BytecodeBudgetInterruptWithStackCheck");
 
+  // Budget interrupts fire at a steady rate in interpreted and baseline code,
+  // which makes them a good place to check whether the isolate has used up its
+  // CPU time slice. A requested preemption is handled by the interrupt check
+  // directly below.
+  isolate->MaybeRequestPreemption();
+
   // Check for stack interrupts here so that we can fold the interrupt check
   // into bytecode budget interrupts.
   StackLimitCheck check(isolate);
@@ -387,6 +393,10 @@ Object BytecodeBudgetInterrupt(Isolate* isolate, RuntimeArguments& args,
   Handle<JSFunction> function = args.at<JSFunction>(0);
   TRACE_EVENT0("v8.execute", "V8.BytecodeBudgetInterrupt");
 
+  // See BytecodeBudgetInterruptWithStackCheck; a requested preemption is
+  // handled at the next stack check.
+  isolate->MaybeRequestPreemption();
+
   isolate->tiering_manager()->OnInterruptTick(function, code_kind);
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -6,6 +6,7 @@
 #include "src/common/globals.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/objects/allocation-site-scopes-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-number-inl.h"
@@ -563,6 +564,22 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     creation_context.ExitScope(site, boilerplate);
 
     vector->SynchronizedSet(literals_slot, *site);
+
+    // Seed the fresh site with a decision learned in an earlier isolate, or
+    // start tracking it so its decision can be published.
+    if (v8_flags.pretenuring_prediction_cache &&
+        v8_flags.allocation_site_pretenuring) {
+      uint64_t site_key;
+      if (PretenuringPredictionCache::ComputeSiteKey(
+              isolate, vector, literals_slot.ToInt(), &site_key)) {
+        if (PretenuringPredictionCache::ShouldPretenure(site_key)) {
+          site->set_pretenure_decision(AllocationSite::kTenure);
+        } else {
+          isolate->heap()->pretenuring_handler()->TrackSiteForPrediction(
+              *site, site_key);
+        }
+      }
+    }
   }
 
   static_assert(static_cast<int>(ObjectLiteral::kDisableMementos) ==
@@ -12,6 +12,7 @@
 #include "src/execution/messages.h"
 #include "src/handles/maybe-handles.h"
 #include "src/heap/heap-inl.h"  // For ToBoolean. TODO(jkummerow): Drop.
+#include "src/objects/lookup-cache-inl.h"
 #include "src/objects/map-updater.h"
 #include "src/objects/property-descriptor-object.h"
 #include "src/objects/property-descriptor.h"
@@ -834,6 +835,14 @@ RUNTIME_FUNCTION(Runtime_GetProperty) {
           }
         }
       }
+
+      // The name may already be known to be absent from the entire prototype
+      // chain from an earlier full walk, in which case the lookup below can
+      // be skipped.
+      if (isolate->negative_lookup_cache()->Lookup(lookup_start_object->map(),
+                                                   *key)) {
+        return ReadOnlyRoots(isolate).undefined_value();
+      }
     } else if (key_obj->IsSmi()) {
       // JSObject without a name key. If the key is a Smi, check for a
       // definite out-of-bounds access to elements, which is a strong indicator
@@ -865,9 +874,18 @@ RUNTIME_FUNCTION(Runtime_GetProperty) {
   }
 
   // Fall back to GetObjectProperty.
-  RETURN_RESULT_OR_FAILURE(
-      isolate, Runtime::GetObjectProperty(isolate, lookup_start_obj, key_obj,
-                                          receiver_obj));
+  bool is_found = false;
+  Handle<Object> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result,
+      Runtime::GetObjectProperty(isolate, lookup_start_obj, key_obj,
+                                 receiver_obj, &is_found));
+  if (!is_found && lookup_start_obj->IsJSObject() && key_obj->IsName()) {
+    NegativeLookupCache::TryUpdate(isolate,
+                                   Handle<JSObject>::cast(lookup_start_obj),
+                                   Handle<Name>::cast(key_obj));
+  }
+  return *result;
 }
 
 RUNTIME_FUNCTION(Runtime_SetKeyedProperty) {
@@ -997,9 +1015,20 @@ RUNTIME_FUNCTION(Runtime_HasProperty) {
   ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, name,
                                      Object::ToName(isolate, key));
 
+  // The name may already be known to be absent from the entire prototype
+  // chain from an earlier full walk.
+  if (receiver->IsJSObject() &&
+      isolate->negative_lookup_cache()->Lookup(receiver->map(), *name)) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+
   // Lookup the {name} on {receiver}.
   Maybe<bool> maybe = JSReceiver::HasProperty(isolate, receiver, name);
   if (maybe.IsNothing()) return ReadOnlyRoots(isolate).exception();
+  if (!maybe.FromJust() && receiver->IsJSObject()) {
+    NegativeLookupCache::TryUpdate(isolate, Handle<JSObject>::cast(receiver),
+                                   name);
+  }
   return isolate->heap()->ToBoolean(maybe.FromJust());
 }
 
@@ -1061,13 +1090,11 @@ RUNTIME_FUNCTION(Runtime_GetDerivedMap) {
   }
 }
 
-RUNTIME_FUNCTION(Runtime_CompleteInobjectSlackTrackingForMap) {
-  DisallowGarbageCollection no_gc;
-  HandleScope scope(isolate);
+RUNTIME_FUNCTION_LEAF(Runtime_CompleteInobjectSlackTrackingForMap) {
   DCHECK_EQ(1, args.length());
 
-  Handle<Map> initial_map = args.at<Map>(0);
-  MapUpdater::CompleteInobjectSlackTracking(isolate, *initial_map);
+  Map initial_map = Map::cast(args[0]);
+  MapUpdater::CompleteInobjectSlackTracking(isolate, initial_map);
 
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -1623,12 +1623,11 @@ RUNTIME_FUNCTION(Runtime_TypedArrayMaxLength) {
   return *isolate->factory()->NewNumber(JSTypedArray::kMaxLength);
 }
 
-RUNTIME_FUNCTION(Runtime_CompleteInobjectSlackTracking) {
-  HandleScope scope(isolate);
+RUNTIME_FUNCTION_LEAF(Runtime_CompleteInobjectSlackTracking) {
   DCHECK_EQ(1, args.length());
 
-  Handle<JSObject> object = args.at<JSObject>(0);
-  MapUpdater::CompleteInobjectSlackTracking(isolate, object->map());
+  JSObject object = JSObject::cast(args[0]);
+  MapUpdater::CompleteInobjectSlackTracking(isolate, object.map());
 
   return ReadOnlyRoots(isolate).undefined_value();
 }
@@ -2,10 +2,20 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <array>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/atomicops.h"
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
@@ -59,23 +69,287 @@ RUNTIME_FUNCTION(Runtime_GrowableSharedArrayBufferByteLength) {
 
 namespace {
 
-template <typename T>
-bool CompareNum(T x, T y) {
-  if (x < y) {
-    return true;
-  } else if (x > y) {
-    return false;
-  } else if (!std::is_integral<T>::value) {
-    double _x = x, _y = y;
-    if (x == 0 && x == y) {
-      /* -0.0 is less than +0.0 */
-      return std::signbit(_x) && !std::signbit(_y);
-    } else if (!std::isnan(_x) && std::isnan(_y)) {
-      /* number is less than NaN */
-      return true;
+// Below this length std::sort wins over the radix sort; the counting passes
+// only pay off once the array clearly exceeds the bucket table size.
+constexpr size_t kRadixSortMinLength = 512;
+// Above this length the radix sort is parallelized over worker threads.
+constexpr size_t kParallelRadixSortMinLength = size_t{1} << 20;
+// Upper bound on the number of counting/scatter chunks of the parallel sort,
+// which bounds the per-chunk bucket tables to a few dozen KB.
+constexpr size_t kMaxSortChunks = 16;
+
+// Runs {process} for every item in [0, num_items) on the calling thread and
+// the platform's worker threads, returning once all items are done.
+class SortJobTask : public v8::JobTask {
+ public:
+  SortJobTask(size_t num_items, const std::function<void(size_t)>* process)
+      : num_items_(num_items), process_(process) {}
+
+  void Run(JobDelegate* delegate) override {
+    while (true) {
+      size_t item = next_item_.fetch_add(1, std::memory_order_relaxed);
+      if (item >= num_items_) return;
+      (*process_)(item);
+      // Items are claimed before GetMaxConcurrency drops, so yielding here
+      // never strands unprocessed work: the joining thread picks it up.
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_item_.load(std::memory_order_relaxed);
+    return num_items_ - std::min(num_items_, next);
+  }
+
+ private:
+  const size_t num_items_;
+  const std::function<void(size_t)>* process_;
+  std::atomic<size_t> next_item_{0};
+};
+
+void RunSortJob(size_t num_items, const std::function<void(size_t)>& process) {
+  if (num_items == 1) {
+    process(0);
+    return;
+  }
+  V8::GetCurrentPlatform()
+      ->CreateJob(v8::TaskPriority::kUserBlocking,
+                  std::make_unique<SortJobTask>(num_items, &process))
+      ->Join();
+}
+
+// LSD radix sort over the low {num_digits} bytes of {length} keys starting
+// at {from}, using {to} as scratch space of the same size. The sorted result
+// always ends up at {from}. Keys may be unaligned; all accesses go through
+// the unaligned helpers.
+template <typename Uint>
+void RadixSortLSD(Address from, Address to, size_t length, int num_digits) {
+  constexpr size_t kSize = sizeof(Uint);
+  const Address original = from;
+  for (int digit = 0; digit < num_digits; digit++) {
+    const int shift = digit * kBitsPerByte;
+    size_t counts[256] = {0};
+    for (size_t i = 0; i < length; i++) {
+      Uint value = base::ReadUnalignedValue<Uint>(from + i * kSize);
+      counts[(value >> shift) & 0xFF]++;
+    }
+    // Skip passes where all keys share the current byte.
+    Uint first = base::ReadUnalignedValue<Uint>(from);
+    if (counts[(first >> shift) & 0xFF] == length) continue;
+    size_t offsets[256];
+    size_t offset = 0;
+    for (int bucket = 0; bucket < 256; bucket++) {
+      offsets[bucket] = offset;
+      offset += counts[bucket];
+    }
+    for (size_t i = 0; i < length; i++) {
+      Uint value = base::ReadUnalignedValue<Uint>(from + i * kSize);
+      base::WriteUnalignedValue(to + offsets[(value >> shift) & 0xFF]++ * kSize,
+                                value);
+    }
+    std::swap(from, to);
+  }
+  if (from != original) {
+    memcpy(reinterpret_cast<void*>(original), reinterpret_cast<void*>(from),
+           length * kSize);
+  }
+}
+
+// Parallel variant: partitions the keys by their most significant byte in
+// parallel (per-chunk counting pass, exclusive scan on the main thread,
+// disjoint parallel scatter), then radix-sorts the resulting buckets over
+// the remaining digits as independent job items.
+template <typename Uint>
+void ParallelRadixSort(Address data, Address scratch, size_t length) {
+  constexpr size_t kSize = sizeof(Uint);
+  constexpr int kMsdShift = static_cast<int>(kSize - 1) * kBitsPerByte;
+  const size_t num_workers = V8::GetCurrentPlatform()->NumberOfWorkerThreads();
+  const size_t num_chunks = std::min(num_workers + 1, kMaxSortChunks);
+  const size_t chunk_size = (length + num_chunks - 1) / num_chunks;
+  const auto chunk_begin = [&](size_t chunk) { return chunk * chunk_size; };
+  const auto chunk_end = [&](size_t chunk) {
+    return std::min((chunk + 1) * chunk_size, length);
+  };
+
+  std::vector<std::array<size_t, 256>> chunk_counts(num_chunks);
+  RunSortJob(num_chunks, [&](size_t chunk) {
+    std::array<size_t, 256>& counts = chunk_counts[chunk];
+    counts.fill(0);
+    for (size_t i = chunk_begin(chunk); i < chunk_end(chunk); i++) {
+      Uint value = base::ReadUnalignedValue<Uint>(data + i * kSize);
+      counts[(value >> kMsdShift) & 0xFF]++;
+    }
+  });
+
+  // For each bucket, assign each chunk the range of the bucket that its own
+  // elements will occupy. This keeps the scatter stores of different chunks
+  // disjoint and preserves stability within a bucket.
+  std::vector<std::array<size_t, 256>> chunk_offsets(num_chunks);
+  size_t bucket_start[257];
+  size_t offset = 0;
+  for (int bucket = 0; bucket < 256; bucket++) {
+    bucket_start[bucket] = offset;
+    for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+      chunk_offsets[chunk][bucket] = offset;
+      offset += chunk_counts[chunk][bucket];
+    }
+  }
+  DCHECK_EQ(length, offset);
+  bucket_start[256] = length;
+
+  RunSortJob(num_chunks, [&](size_t chunk) {
+    std::array<size_t, 256> offsets = chunk_offsets[chunk];
+    for (size_t i = chunk_begin(chunk); i < chunk_end(chunk); i++) {
+      Uint value = base::ReadUnalignedValue<Uint>(data + i * kSize);
+      base::WriteUnalignedValue(
+          scratch + offsets[(value >> kMsdShift) & 0xFF]++ * kSize, value);
+    }
+  });
+
+  RunSortJob(256, [&](size_t bucket) {
+    const size_t begin = bucket_start[bucket];
+    const size_t end = bucket_start[bucket + 1];
+    if (begin == end) return;
+    RadixSortLSD<Uint>(scratch + begin * kSize, data + begin * kSize,
+                       end - begin, static_cast<int>(kSize) - 1);
+    memcpy(reinterpret_cast<void*>(data + begin * kSize),
+           reinterpret_cast<void*>(scratch + begin * kSize),
+           (end - begin) * kSize);
+  });
+}
+
+// Sorts {length} unsigned keys starting at {data} in ascending order.
+template <typename Uint>
+void SortKeys(Address data, size_t length) {
+  DCHECK_LE(kRadixSortMinLength, length);
+  std::vector<Uint> scratch(length);
+  Address scratch_start = reinterpret_cast<Address>(scratch.data());
+  if (length >= kParallelRadixSortMinLength &&
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0) {
+    ParallelRadixSort<Uint>(data, scratch_start, length);
+  } else {
+    RadixSortLSD<Uint>(data, scratch_start, length, sizeof(Uint));
+  }
+}
+
+// Maps the bit pattern of a floating point number to an unsigned integer key
+// whose unsigned order is the sort order %TypedArray%.prototype.sort requires
+// of non-NaN values: negative numbers ascending, then -0.0 before +0.0, then
+// positive numbers ascending. The mapping is a bijection, so sorting the keys
+// with branchless integer comparisons and mapping back sorts the floats. NaNs
+// don't obey the mapping (negative NaNs would order first) and have to be
+// moved out of the way by the caller beforehand.
+template <typename Uint>
+Uint FloatToOrderedKey(Uint bits) {
+  constexpr Uint kSignBit = Uint{1} << (sizeof(Uint) * kBitsPerByte - 1);
+  return (bits & kSignBit) ? ~bits : bits ^ kSignBit;
+}
+
+template <typename Uint>
+Uint OrderedKeyToFloat(Uint key) {
+  constexpr Uint kSignBit = Uint{1} << (sizeof(Uint) * kBitsPerByte - 1);
+  return (key & kSignBit) ? key ^ kSignBit : ~key;
+}
+
+// Sorts a Float32 or Float64 backing store. NaNs compare greater than
+// everything else, so they are first compacted to the tail (preserving their
+// bit patterns; their relative order is unspecified, as with std::sort), and
+// the remaining elements are sorted through the ordered-key bijection above.
+// {data} may be unaligned on pointer-compressed builds; all element accesses
+// go through the unaligned helpers.
+template <typename Ctype>
+void SortFloats(Ctype* data, size_t length) {
+  if constexpr (std::is_floating_point_v<Ctype>) {
+    using Uint = std::conditional_t<sizeof(Ctype) == 4, uint32_t, uint64_t>;
+    static_assert(sizeof(Uint) == sizeof(Ctype));
+    constexpr Uint kSignBit = Uint{1} << (sizeof(Uint) * kBitsPerByte - 1);
+    const Uint inf_bits =
+        base::bit_cast<Uint>(std::numeric_limits<Ctype>::infinity());
+    const Address begin = reinterpret_cast<Address>(data);
+
+    // Move NaNs to the tail. In the common NaN-free case this is a single
+    // read-only pass.
+    std::vector<Uint> nans;
+    size_t num_values = 0;
+    for (size_t i = 0; i < length; i++) {
+      Uint bits = base::ReadUnalignedValue<Uint>(begin + i * sizeof(Uint));
+      if (V8_UNLIKELY((bits & ~kSignBit) > inf_bits)) {
+        nans.push_back(bits);
+      } else if (V8_UNLIKELY(!nans.empty())) {
+        base::WriteUnalignedValue(begin + num_values * sizeof(Uint), bits);
+        num_values++;
+      } else {
+        num_values++;
+      }
+    }
+    for (size_t i = 0; i < nans.size(); i++) {
+      base::WriteUnalignedValue(begin + (num_values + i) * sizeof(Uint),
+                                nans[i]);
+    }
+
+    for (size_t i = 0; i < num_values; i++) {
+      Address p = begin + i * sizeof(Uint);
+      base::WriteUnalignedValue(
+          p, FloatToOrderedKey(base::ReadUnalignedValue<Uint>(p)));
+    }
+    Uint* keys = reinterpret_cast<Uint*>(data);
+    if (num_values >= kRadixSortMinLength) {
+      SortKeys<Uint>(begin, num_values);
+    } else if (COMPRESS_POINTERS_BOOL && alignof(Uint) > kTaggedSize) {
+      // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+      std::sort(UnalignedSlot<Uint>(keys),
+                UnalignedSlot<Uint>(keys + num_values));
+    } else {
+      std::sort(keys, keys + num_values);
+    }
+    for (size_t i = 0; i < num_values; i++) {
+      Address p = begin + i * sizeof(Uint);
+      base::WriteUnalignedValue(
+          p, OrderedKeyToFloat(base::ReadUnalignedValue<Uint>(p)));
+    }
+  } else {
+    UNREACHABLE();
+  }
+}
+
+// Sorts an integer-kind backing store. Large arrays go through the radix
+// sort; signed values are mapped to unsigned keys of the same order by
+// flipping the sign bit. {data} may be unaligned on pointer-compressed
+// builds, see above.
+template <typename Ctype>
+void SortIntegers(Ctype* data, size_t length) {
+  if constexpr (std::is_integral_v<Ctype>) {
+    if (length < kRadixSortMinLength) {
+      if (COMPRESS_POINTERS_BOOL && alignof(Ctype) > kTaggedSize) {
+        // TODO(ishell, v8:8875): See UnalignedSlot<T> for details.
+        std::sort(UnalignedSlot<Ctype>(data),
+                  UnalignedSlot<Ctype>(data + length));
+      } else {
+        std::sort(data, data + length);
+      }
+      return;
+    }
+    using Uint = std::make_unsigned_t<Ctype>;
+    constexpr Uint kSignBit = Uint{1} << (sizeof(Uint) * kBitsPerByte - 1);
+    const Address begin = reinterpret_cast<Address>(data);
+    if constexpr (std::is_signed_v<Ctype>) {
+      for (size_t i = 0; i < length; i++) {
+        Address p = begin + i * sizeof(Uint);
+        base::WriteUnalignedValue<Uint>(
+            p, base::ReadUnalignedValue<Uint>(p) ^ kSignBit);
+      }
+    }
+    SortKeys<Uint>(begin, length);
+    if constexpr (std::is_signed_v<Ctype>) {
+      for (size_t i = 0; i < length; i++) {
+        Address p = begin + i * sizeof(Uint);
+        base::WriteUnalignedValue<Uint>(
+            p, base::ReadUnalignedValue<Uint>(p) ^ kSignBit);
+      }
     }
+  } else {
+    UNREACHABLE();
   }
-  return false;
 }
 
 }  // namespace
@@ -134,21 +408,9 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
                             : static_cast<ctype*>(array->DataPtr());       \
     if (kExternal##Type##Array == kExternalFloat64Array ||                 \
         kExternal##Type##Array == kExternalFloat32Array) {                 \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length), CompareNum<ctype>); \
-      } else {                                                             \
-        std::sort(data, data + length, CompareNum<ctype>);                 \
-      }                                                                    \
+      SortFloats(data, length);                                            \
     } else {                                                               \
-      if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
-        /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
-        std::sort(UnalignedSlot<ctype>(data),                              \
-                  UnalignedSlot<ctype>(data + length));                    \
-      } else {                                                             \
-        std::sort(data, data + length);                                    \
-      }                                                                    \
+      SortIntegers(data, length);                                          \
     }                                                                      \
     break;                                                                 \
   }
@@ -821,7 +821,8 @@ class Runtime : public AllStatic {
   static bool IsNonReturning(FunctionId id);
 
   // Check if a runtime function with the given {id} may trigger a heap
-  // allocation.
+  // allocation. Functions declared with RUNTIME_FUNCTION_LEAF should be
+  // listed here as non-allocating.
   static bool MayAllocate(FunctionId id);
 
   // Check if a runtime function with the given {id} is allowlisted for
@@ -171,8 +171,20 @@ void ContextSerializer::SerializeObjectImpl(Handle<HeapObject> obj) {
 
   InstanceType instance_type = obj->map().instance_type();
   if (InstanceTypeChecker::IsFeedbackVector(instance_type)) {
-    // Clear literal boilerplates and feedback.
-    Handle<FeedbackVector>::cast(obj)->ClearSlots(isolate());
+    // Clear literal boilerplates and feedback. Note that the tiering hint
+    // bits on SharedFunctionInfo (maglev/turbofan_compiled_before)
+    // intentionally survive serialization: they carry no heap pointers and
+    // let deserialized isolates re-tier functions that proved hot during a
+    // training run without repeating the warm-up.
+    if (v8_flags.serialize_ic_feedback) {
+      // Keep monomorphic map/handler pairs whose map is serialized into this
+      // snapshot and whose handler is Smi-encoded. Both stay valid in any
+      // isolate deserialized from the snapshot and spare its first requests
+      // the megamorphic warm-up.
+      Handle<FeedbackVector>::cast(obj)->ClearNonPortableSlots(isolate());
+    } else {
+      Handle<FeedbackVector>::cast(obj)->ClearSlots(isolate());
+    }
   } else if (InstanceTypeChecker::IsFeedbackCell(instance_type)) {
     // Clear InterruptBudget when serializing FeedbackCell.
     Handle<FeedbackCell>::cast(obj)->SetInitialInterruptBudget();
@@ -44,6 +44,13 @@ uint32_t EmbeddedData::InstructionSizeOfBuiltin(Builtin builtin) const {
   return desc.instruction_length;
 }
 
+Builtin EmbeddedData::GetBuiltinAtLayoutPosition(uint32_t position) const {
+  DCHECK_LT(position, kTableSize);
+  const uint32_t* table = reinterpret_cast<const uint32_t*>(
+      data_ + BuiltinLayoutOrderTableOffset());
+  return Builtins::FromInt(table[position]);
+}
+
 Address EmbeddedData::MetadataStartOfBuiltin(Builtin builtin) const {
   DCHECK(Builtins::IsBuiltinId(builtin));
   const struct LayoutDescription& desc = LayoutDescription(builtin);
@@ -4,8 +4,13 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <cctype>
+#include <fstream>
+#include <unordered_map>
+
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
+#include "src/flags/flags.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/snapshot-utils.h"
 
@@ -17,18 +22,22 @@ namespace {
 Builtin TryLookupCode(const EmbeddedData& d, Address address) {
   if (!d.IsInCodeRange(address)) return Builtin::kNoBuiltinId;
 
-  if (address < d.InstructionStartOfBuiltin(static_cast<Builtin>(0))) {
+  if (address <
+      d.InstructionStartOfBuiltin(d.GetBuiltinAtLayoutPosition(0))) {
     return Builtin::kNoBuiltinId;
   }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
   // to the preceding builtin.
+  //
+  // The search runs over layout positions rather than builtin IDs, since with
+  // --builtins-ordering-file instruction offsets are not monotonic in IDs.
 
   int l = 0, r = Builtins::kBuiltinCount;
   while (l < r) {
     const int mid = (l + r) / 2;
-    const Builtin builtin = Builtins::FromInt(mid);
+    const Builtin builtin = d.GetBuiltinAtLayoutPosition(mid);
     Address start = d.InstructionStartOfBuiltin(builtin);
     Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
@@ -271,21 +280,81 @@ void EnsureRelocatable(CodeT codet) {
   }
 }
 
+// Returns the order in which builtins are laid out in the code section.
+// By default this is simply Builtin enum order. With
+// --builtins-ordering-file, builtins listed in the file (one name per line,
+// '#' starts a comment) come first in file order, followed by all unlisted
+// builtins in enum order. Bytecode handlers must not be listed since
+// InstructionStartOfBytecodeHandlers assumes they remain a contiguous
+// section at the end of the blob.
+std::vector<Builtin> BuiltinLayoutOrder() {
+  std::vector<Builtin> order;
+  order.reserve(Builtins::kBuiltinCount);
+  const char* filename = v8_flags.builtins_ordering_file;
+  if (filename == nullptr) {
+    for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+         ++builtin) {
+      order.push_back(builtin);
+    }
+    return order;
+  }
+
+  std::unordered_map<std::string, Builtin> builtins_by_name;
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    builtins_by_name[Builtins::name(builtin)] = builtin;
+  }
+
+  std::vector<bool> listed(Builtins::kBuiltinCount, false);
+  std::ifstream file(filename);
+  if (!file.good()) {
+    FATAL("Failed to open builtins ordering file: %s", filename);
+  }
+  for (std::string line; std::getline(file, line);) {
+    size_t comment = line.find('#');
+    if (comment != std::string::npos) line.resize(comment);
+    while (!line.empty() && std::isspace(line.back())) line.pop_back();
+    if (line.empty()) continue;
+    auto it = builtins_by_name.find(line);
+    if (it == builtins_by_name.end()) {
+      FATAL("Unknown builtin in ordering file: %s", line.c_str());
+    }
+    Builtin builtin = it->second;
+    if (builtin >= Builtin::kFirstBytecodeHandler) {
+      FATAL("Bytecode handlers cannot be reordered: %s", line.c_str());
+    }
+    if (listed[static_cast<int>(builtin)]) {
+      FATAL("Duplicate builtin in ordering file: %s", line.c_str());
+    }
+    listed[static_cast<int>(builtin)] = true;
+    order.push_back(builtin);
+  }
+
+  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
+       ++builtin) {
+    if (!listed[static_cast<int>(builtin)]) order.push_back(builtin);
+  }
+  DCHECK_EQ(static_cast<int>(order.size()), Builtins::kBuiltinCount);
+  return order;
+}
+
 }  // namespace
 
 // static
 EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   Builtins* builtins = isolate->builtins();
 
-  // Store instruction stream lengths and offsets.
+  // Store instruction stream lengths and offsets. Code section offsets are
+  // assigned in layout order, which may differ from Builtin enum order when
+  // mksnapshot runs with --builtins-ordering-file.
+  const std::vector<Builtin> layout_order = BuiltinLayoutOrder();
   std::vector<struct LayoutDescription> layout_descriptions(kTableSize);
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
   uint32_t raw_data_size = 0;
   static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
+  for (Builtin builtin : layout_order) {
     Code code = FromCodeT(builtins->code(builtin));
 
     // Sanity-check that the given builtin is isolate-independent and does not
@@ -366,6 +435,19 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   std::memcpy(blob_data + LayoutDescriptionTableOffset(),
               layout_descriptions.data(), LayoutDescriptionTableSize());
 
+  // Write the builtin layout order table, used by TryLookupCode to binary
+  // search over code section positions.
+  {
+    std::vector<uint32_t> order_table(kTableSize);
+    for (uint32_t i = 0; i < kTableSize; i++) {
+      order_table[i] = static_cast<uint32_t>(layout_order[i]);
+    }
+    DCHECK_EQ(BuiltinLayoutOrderTableSize(),
+              sizeof(order_table[0]) * order_table.size());
+    std::memcpy(blob_data + BuiltinLayoutOrderTableOffset(),
+                order_table.data(), BuiltinLayoutOrderTableSize());
+  }
+
   // .. and the variable-size data section.
   uint8_t* const raw_metadata_start = blob_data + RawMetadataOffset();
   static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
@@ -134,6 +134,11 @@ class EmbeddedData final {
   inline Address InstructionEndOf(Builtin builtin) const;
   inline uint32_t InstructionSizeOfBuiltin(Builtin builtin) const;
 
+  // Returns the builtin at the given position in the code section layout,
+  // i.e. positions ordered by instruction offset. This matches Builtin enum
+  // order unless mksnapshot ran with --builtins-ordering-file.
+  inline Builtin GetBuiltinAtLayoutPosition(uint32_t position) const;
+
   inline Address InstructionStartOfBytecodeHandlers() const;
   inline Address InstructionEndOfBytecodeHandlers() const;
 
@@ -241,6 +246,7 @@ class EmbeddedData final {
   // [2] hash of embedded-blob-relevant heap objects
   // [3] layout description of instruction stream 0
   // ... layout descriptions
+  // [x] table of builtin IDs in code layout order
   // [x] metadata section of builtin 0
   // ... metadata sections
   //
@@ -265,9 +271,15 @@ class EmbeddedData final {
   static constexpr uint32_t LayoutDescriptionTableSize() {
     return sizeof(struct LayoutDescription) * kTableSize;
   }
-  static constexpr uint32_t FixedDataSize() {
+  static constexpr uint32_t BuiltinLayoutOrderTableOffset() {
     return LayoutDescriptionTableOffset() + LayoutDescriptionTableSize();
   }
+  static constexpr uint32_t BuiltinLayoutOrderTableSize() {
+    return kUInt32Size * kTableSize;
+  }
+  static constexpr uint32_t FixedDataSize() {
+    return BuiltinLayoutOrderTableOffset() + BuiltinLayoutOrderTableSize();
+  }
   // The variable-size data section starts here.
   static constexpr uint32_t RawMetadataOffset() { return FixedDataSize(); }
 
@@ -161,9 +161,10 @@ void EmbeddedFileWriter::WriteCodeSection(PlatformEmbeddedFileWriterBase* w,
   w->DeclareLabel(EmbeddedBlobCodeSymbol().c_str());
 
   static_assert(Builtins::kAllBuiltinsAreIsolateIndependent);
-  for (Builtin builtin = Builtins::kFirst; builtin <= Builtins::kLast;
-       ++builtin) {
-    WriteBuiltin(w, blob, builtin);
+  // Builtins are emitted in code layout order so that the assembled byte
+  // stream matches the in-memory blob, see EmbeddedData::FromIsolate.
+  for (uint32_t i = 0; i < Builtins::kBuiltinCount; i++) {
+    WriteBuiltin(w, blob, blob->GetBuiltinAtLayoutPosition(i));
   }
   w->AlignToPageSizeIfNeeded();
   w->Newline();
@@ -0,0 +1,179 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/shared-code-cache.h"
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/flags/flags.h"
+#include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/memcopy.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// An entry keeps the raw characters of the publishing source so that Lookup
+// can verify actual content equality: the map key is a non-cryptographic
+// hash, and a collision must be a cache miss: deserializing another
+// script's blob would silently run the wrong program. Entries are shared
+// with in-flight lookups so that eviction cannot free a blob another thread
+// is still deserializing.
+struct CacheEntry {
+  bool source_is_one_byte;
+  std::vector<uint8_t> source_bytes;
+  std::unique_ptr<byte[]> data;
+  int length;
+};
+
+// Bound on the number of cached scripts. Inserting into a full cache drops
+// the old generation wholesale, like the isolate's compilation cache ages
+// out entries.
+constexpr size_t kMaxEntries = 1024;
+
+// Hashes the source characters together with the length, the origin options
+// and the language mode. Collisions are handled by the content comparison in
+// Lookup; the hash only routes to a candidate entry.
+uint64_t CacheKey(Handle<String> source, ScriptOriginOptions origin_options,
+                  LanguageMode language_mode) {
+  DisallowGarbageCollection no_gc;
+  DCHECK(source->IsFlat());
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  size_t content_hash;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    content_hash = base::hash_range(chars.begin(), chars.end());
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    content_hash = base::hash_range(chars.begin(), chars.end());
+  }
+  return base::hash_combine(content_hash, source->length(),
+                            origin_options.Flags(),
+                            static_cast<int>(is_strict(language_mode)));
+}
+
+// Copies the raw characters of the flat |source| into |bytes_out| (two bytes
+// per character for two-byte sources) and returns whether the source was
+// one-byte.
+bool CopySourceBytes(String source, std::vector<uint8_t>* bytes_out) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    bytes_out->assign(chars.begin(), chars.end());
+    return true;
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(chars.begin());
+  bytes_out->assign(bytes, bytes + chars.length() * sizeof(base::uc16));
+  return false;
+}
+
+bool SourceEquals(const CacheEntry& entry, String source) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source.GetFlatContent(no_gc);
+  if (content.IsOneByte() != entry.source_is_one_byte) return false;
+  const uint8_t* bytes;
+  size_t length;
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    bytes = chars.begin();
+    length = chars.length();
+  } else {
+    base::Vector<const base::uc16> chars = content.ToUC16Vector();
+    bytes = reinterpret_cast<const uint8_t*>(chars.begin());
+    length = chars.length() * sizeof(base::uc16);
+  }
+  return entry.source_bytes.size() == length &&
+         memcmp(entry.source_bytes.data(), bytes, length) == 0;
+}
+
+base::LazyMutex cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+std::unordered_map<uint64_t, std::shared_ptr<const CacheEntry>>* Cache() {
+  // Deliberately leaked so that entries stay consumable until process exit.
+  static auto* cache =
+      new std::unordered_map<uint64_t, std::shared_ptr<const CacheEntry>>();
+  return cache;
+}
+
+}  // namespace
+
+// static
+MaybeHandle<SharedFunctionInfo> SharedCodeCache::Lookup(
+    Isolate* isolate, Handle<String> source, ScriptOriginOptions origin_options,
+    LanguageMode language_mode) {
+  DCHECK(v8_flags.shared_code_cache);
+  source = String::Flatten(isolate, source);
+  uint64_t key = CacheKey(source, origin_options, language_mode);
+  std::shared_ptr<const CacheEntry> entry;
+  {
+    base::MutexGuard guard(cache_mutex.Pointer());
+    auto it = Cache()->find(key);
+    if (it == Cache()->end()) return MaybeHandle<SharedFunctionInfo>();
+    // The key is a hash; a collision between different scripts must be a
+    // miss, never a deserialization of the other script's blob.
+    if (!SourceEquals(*it->second, *source)) {
+      return MaybeHandle<SharedFunctionInfo>();
+    }
+    entry = it->second;
+  }
+
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.SharedCodeCacheDeserialize");
+  AlignedCachedData cached_data(entry->data.get(), entry->length);
+  return CodeSerializer::Deserialize(isolate, &cached_data, source,
+                                     origin_options);
+}
+
+// static
+void SharedCodeCache::Insert(Isolate* isolate, Handle<String> source,
+                             ScriptOriginOptions origin_options,
+                             LanguageMode language_mode,
+                             Handle<SharedFunctionInfo> info) {
+  DCHECK(v8_flags.shared_code_cache);
+  if (!info->is_compiled()) return;
+  if (!info->script().IsScript()) return;
+  source = String::Flatten(isolate, source);
+  uint64_t key = CacheKey(source, origin_options, language_mode);
+  {
+    base::MutexGuard guard(cache_mutex.Pointer());
+    if (Cache()->count(key) != 0) return;
+  }
+
+  // Serialize outside the lock; racing inserts of the same script produce
+  // equivalent blobs, and the first one to publish wins.
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.SharedCodeCacheSerialize");
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      CodeSerializer::Serialize(info));
+  if (cached_data == nullptr) return;
+
+  auto entry = std::make_shared<CacheEntry>();
+  entry->source_is_one_byte = CopySourceBytes(*source, &entry->source_bytes);
+  entry->length = cached_data->length;
+  entry->data = std::make_unique<byte[]>(entry->length);
+  MemCopy(entry->data.get(), cached_data->data, entry->length);
+
+  base::MutexGuard guard(cache_mutex.Pointer());
+  if (Cache()->size() >= kMaxEntries && Cache()->count(key) == 0) {
+    Cache()->clear();
+  }
+  Cache()->emplace(key, std::move(entry));
+}
+
+}  // namespace internal
+}  // namespace v8
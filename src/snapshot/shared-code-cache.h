@@ -0,0 +1,48 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+#define V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+
+#include "include/v8-script.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class SharedFunctionInfo;
+class String;
+
+// Process-wide cache of serialized script code, keyed by a hash of the source
+// with the source text stored per entry and verified on lookup. Scripts
+// compiled by one isolate are serialized with CodeSerializer and published in
+// a shared table; other isolates deserialize the cached blob instead of
+// compiling from source. Heap objects cannot be adopted directly across
+// isolate heaps, so the cache stores serialized bytes; deserializing them is
+// still far cheaper than a full parse and compile. Entries are immutable; the
+// table is bounded and flushed wholesale when full. Enabled with
+// --shared-code-cache.
+class V8_EXPORT_PRIVATE SharedCodeCache final : public AllStatic {
+ public:
+  // Attempts to adopt a cached compilation of |source|. Returns an empty
+  // handle on a cache miss or when the cached blob fails its sanity checks
+  // for this isolate (e.g. differing flags).
+  static MaybeHandle<SharedFunctionInfo> Lookup(
+      Isolate* isolate, Handle<String> source,
+      ScriptOriginOptions origin_options, LanguageMode language_mode);
+
+  // Serializes |info| and publishes it for other isolates. No-op if an entry
+  // for |source| already exists or |info| is not in a serializable state.
+  static void Insert(Isolate* isolate, Handle<String> source,
+                     ScriptOriginOptions origin_options,
+                     LanguageMode language_mode,
+                     Handle<SharedFunctionInfo> info);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_SHARED_CODE_CACHE_H_
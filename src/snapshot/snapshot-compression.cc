@@ -4,7 +4,15 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/semaphore.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -18,6 +26,100 @@ uint32_t GetUncompressedSize(const Bytef* compressed_data) {
   return size;
 }
 
+namespace {
+
+// Snapshots are compressed as a sequence of independently deflated chunks so
+// that decompression can be spread over worker threads. The layout of the
+// compressed payload is:
+//   uint32_t uncompressed_payload_length
+//   uint32_t num_chunks
+//   uint32_t compressed_chunk_size[num_chunks]
+//   <the deflated chunks, back to back>
+// Each chunk covers kUncompressedChunkSize bytes of the uncompressed payload,
+// except for the last one, which covers the remainder.
+constexpr uint32_t kUncompressedChunkSize = 256 * KB;
+
+constexpr uint32_t NumberOfChunks(uint32_t payload_length) {
+  return payload_length == 0
+             ? 0
+             : 1 + (payload_length - 1) / kUncompressedChunkSize;
+}
+
+constexpr uint32_t HeaderSize(uint32_t num_chunks) {
+  return (2 + num_chunks) * sizeof(uint32_t);
+}
+
+constexpr uint32_t ChunkUncompressedSize(uint32_t payload_length,
+                                         uint32_t chunk_index) {
+  return std::min(kUncompressedChunkSize,
+                  payload_length - chunk_index * kUncompressedChunkSize);
+}
+
+// Shared state for decompressing chunks in parallel. Workers and the main
+// thread pull chunk indices from an atomic counter until all chunks are done;
+// the chunks write to disjoint regions of the output, so no further
+// synchronization is needed.
+class ChunkedDecompressor {
+ public:
+  ChunkedDecompressor(const Bytef* compressed_data,
+                      const std::vector<uint32_t>& chunk_offsets,
+                      const std::vector<uint32_t>& chunk_sizes,
+                      uint32_t payload_length, byte* output)
+      : compressed_data_(compressed_data),
+        chunk_offsets_(chunk_offsets),
+        chunk_sizes_(chunk_sizes),
+        payload_length_(payload_length),
+        output_(output) {}
+
+  void DecompressChunks() {
+    const uint32_t num_chunks = static_cast<uint32_t>(chunk_sizes_.size());
+    while (true) {
+      uint32_t i = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (i >= num_chunks) return;
+      uLongf uncompressed_size = ChunkUncompressedSize(payload_length_, i);
+      CHECK_EQ(
+          zlib_internal::UncompressHelper(
+              zlib_internal::ZRAW,
+              base::bit_cast<Bytef*>(
+                  output_ + static_cast<size_t>(i) * kUncompressedChunkSize),
+              &uncompressed_size, compressed_data_ + chunk_offsets_[i],
+              chunk_sizes_[i]),
+          Z_OK);
+    }
+  }
+
+  void SignalWorkerDone() { worker_done_.Signal(); }
+
+  void WaitForWorkers(int num_workers) {
+    for (int i = 0; i < num_workers; i++) worker_done_.Wait();
+  }
+
+ private:
+  const Bytef* const compressed_data_;
+  const std::vector<uint32_t>& chunk_offsets_;
+  const std::vector<uint32_t>& chunk_sizes_;
+  const uint32_t payload_length_;
+  byte* const output_;
+  std::atomic<uint32_t> next_chunk_{0};
+  base::Semaphore worker_done_{0};
+};
+
+class DecompressChunksTask final : public v8::Task {
+ public:
+  explicit DecompressChunksTask(ChunkedDecompressor* decompressor)
+      : decompressor_(decompressor) {}
+
+  void Run() override {
+    decompressor_->DecompressChunks();
+    decompressor_->SignalWorkerDone();
+  }
+
+ private:
+  ChunkedDecompressor* const decompressor_;
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,33 +127,47 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
   uint32_t payload_length =
       static_cast<uint32_t>(uncompressed_data->RawData().size());
+  const uint32_t num_chunks = NumberOfChunks(payload_length);
+  const uint32_t header_size = HeaderSize(num_chunks);
 
-  uLongf compressed_data_size = compressBound(input_size);
+  uLongf max_compressed_size = 0;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    max_compressed_size +=
+        compressBound(ChunkUncompressedSize(payload_length, i));
+  }
 
   // Allocating >= the final amount we will need.
   snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+      static_cast<uint32_t>(header_size + max_compressed_size));
 
   byte* compressed_data = const_cast<byte*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
+  // manually store the uncompressed size and the chunk size table.
   MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          base::bit_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  MemCopy(compressed_data + sizeof(uint32_t), &num_chunks, sizeof(num_chunks));
+
+  const Bytef* input =
+      base::bit_cast<const Bytef*>(uncompressed_data->RawData().begin());
+  uint32_t offset = header_size;
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    const uint32_t chunk_length = ChunkUncompressedSize(payload_length, i);
+    uLongf compressed_chunk_size = compressBound(chunk_length);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + offset,
+                 &compressed_chunk_size,
+                 input + static_cast<size_t>(i) * kUncompressedChunkSize,
+                 chunk_length, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+             Z_OK);
+    const uint32_t chunk_size = static_cast<uint32_t>(compressed_chunk_size);
+    MemCopy(compressed_data + (2 + i) * sizeof(uint32_t), &chunk_size,
+            sizeof(chunk_size));
+    offset += chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
+  snapshot_data.Resize(offset);
   DCHECK_EQ(payload_length,
             GetUncompressedSize(snapshot_data.RawData().begin()));
 
@@ -72,20 +188,41 @@ SnapshotData SnapshotCompression::Decompress(
       base::bit_cast<const Bytef*>(compressed_data.begin());
 
   // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
+  // manually retrieve the uncompressed size and the chunk size table.
   uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  uint32_t num_chunks;
+  MemCopy(&num_chunks, input_bytef + sizeof(uint32_t), sizeof(num_chunks));
+  DCHECK_EQ(num_chunks, NumberOfChunks(uncompressed_payload_length));
 
   snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               base::bit_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  byte* output = const_cast<byte*>(snapshot_data.RawData().begin());
+
+  std::vector<uint32_t> chunk_sizes(num_chunks);
+  std::vector<uint32_t> chunk_offsets(num_chunks);
+  uint32_t offset = HeaderSize(num_chunks);
+  for (uint32_t i = 0; i < num_chunks; i++) {
+    MemCopy(&chunk_sizes[i], input_bytef + (2 + i) * sizeof(uint32_t),
+            sizeof(uint32_t));
+    chunk_offsets[i] = offset;
+    offset += chunk_sizes[i];
+  }
+  DCHECK_EQ(offset, compressed_data.size());
+
+  ChunkedDecompressor decompressor(input_bytef, chunk_offsets, chunk_sizes,
+                                   uncompressed_payload_length, output);
+  const int num_workers =
+      num_chunks == 0
+          ? 0
+          : std::min<int>(num_chunks - 1,
+                          V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  for (int i = 0; i < num_workers; i++) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<DecompressChunksTask>(&decompressor));
+  }
+  decompressor.DecompressChunks();
+  // The workers write into disjoint regions of {output}, but we must not
+  // return before all of them are done with it.
+  decompressor.WaitForWorkers(num_workers);
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
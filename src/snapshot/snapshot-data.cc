@@ -42,6 +42,17 @@ SnapshotData::SnapshotData(const Serializer* serializer) {
             static_cast<size_t>(payload->size()));
 }
 
+// static
+base::Vector<const byte> SnapshotData::TrimPadding(
+    base::Vector<const byte> snapshot) {
+  CHECK_LE(kHeaderSize, static_cast<uint32_t>(snapshot.length()));
+  uint32_t payload_length = base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(snapshot.begin()) + kPayloadLengthOffset);
+  uint32_t trimmed_length = kHeaderSize + payload_length;
+  CHECK_LE(trimmed_length, static_cast<uint32_t>(snapshot.length()));
+  return snapshot.SubVector(0, trimmed_length);
+}
+
 base::Vector<const byte> SnapshotData::Payload() const {
   const byte* payload = data_ + kHeaderSize;
   uint32_t length = GetHeaderValue(kPayloadLengthOffset);
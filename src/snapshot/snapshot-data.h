@@ -83,6 +83,13 @@ class V8_EXPORT_PRIVATE SnapshotData : public SerializedData {
     return base::Vector<const byte>(data_, size_);
   }
 
+  // Trims trailing padding off a serialized section, using the payload length
+  // recorded in the section's own header. Sections extracted from a blob
+  // produced with --page-aligned-snapshot extend to the next page boundary;
+  // the result is the exact serialized data.
+  static base::Vector<const byte> TrimPadding(
+      base::Vector<const byte> snapshot);
+
  protected:
   // Empty constructor used by SnapshotCompression so it can manually allocate
   // memory.
@@ -6,10 +6,12 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include "src/base/platform/platform.h"
 #include "src/common/assert-scope.h"
 #include "src/heap/parked-scope.h"
 #include "src/heap/safepoint.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
@@ -18,6 +20,7 @@
 #include "src/snapshot/shared-heap-serializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/startup-serializer.h"
+#include "src/tasks/cancelable-task.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/version.h"
 
@@ -112,6 +115,42 @@ class SnapshotImpl : public AllStatic {
   }
 };
 
+// Touches the snapshot blob's pages on a worker thread so that fault latency
+// overlaps with deserialization work on the main thread instead of stalling
+// Deserializer::ReadObject on cold pages. Tied to the isolate's cancelable
+// task manager so that isolate teardown waits for the task; the blob itself
+// is required to outlive the isolate anyway.
+class SnapshotPrefaultTask final : public CancelableTask {
+ public:
+  SnapshotPrefaultTask(Isolate* isolate, const v8::StartupData* blob)
+      : CancelableTask(isolate), blob_(blob) {}
+
+  void RunInternal() override {
+    const size_t size = static_cast<size_t>(blob_->raw_size);
+    // Hint first so the kernel can read ahead over the whole range, then
+    // touch one byte per page in case the advice is ignored.
+    base::OS::AdviseWillNeed(const_cast<char*>(blob_->data), size);
+    const volatile char* data = blob_->data;
+    char sink = 0;
+    for (size_t offset = 0; offset < size; offset += kPageStride) {
+      sink ^= data[offset];
+    }
+    USE(sink);
+  }
+
+ private:
+  static constexpr size_t kPageStride = 4 * KB;
+
+  const v8::StartupData* const blob_;
+};
+
+void MaybePrefaultSnapshot(Isolate* isolate, const v8::StartupData* blob) {
+  if (!v8_flags.prefault_snapshot) return;
+  if (V8::GetCurrentPlatform()->NumberOfWorkerThreads() == 0) return;
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      std::make_unique<SnapshotPrefaultTask>(isolate, blob));
+}
+
 }  // namespace
 
 SnapshotData MaybeDecompress(Isolate* isolate,
@@ -121,7 +160,11 @@ SnapshotData MaybeDecompress(Isolate* isolate,
   RCS_SCOPE(isolate, RuntimeCallCounterId::kSnapshotDecompress);
   return SnapshotCompression::Decompress(snapshot_data);
 #else
-  return SnapshotData(snapshot_data);
+  // Sections extracted from a blob produced with --page-aligned-snapshot
+  // carry trailing padding up to the next page boundary; trim to the length
+  // recorded in the section's own header. (The compressed path reads chunk
+  // sizes from its header and ignores trailing bytes.)
+  return SnapshotData(SnapshotData::TrimPadding(snapshot_data));
 #endif
 }
 
@@ -161,6 +204,10 @@ bool Snapshot::Initialize(Isolate* isolate) {
   if (v8_flags.profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
+  // Start faulting in the blob's pages in the background before any of the
+  // work below reads them. If checksum verification runs it touches the whole
+  // blob anyway, in which case the task merely races it harmlessly.
+  MaybePrefaultSnapshot(isolate, blob);
   SnapshotImpl::CheckVersion(blob);
   if (Snapshot::ShouldVerifyChecksum(blob)) {
     CHECK(VerifyChecksum(blob));
@@ -179,6 +226,10 @@ bool Snapshot::Initialize(Isolate* isolate) {
   SnapshotData shared_heap_snapshot_data(
       MaybeDecompress(isolate, shared_heap_data));
 
+  // Kick off context snapshot preparation as early as possible so that it
+  // overlaps with the isolate deserialization below.
+  ContextSnapshotPrep::Start(isolate);
+
   bool success = isolate->InitWithSnapshot(
       &startup_snapshot_data, &read_only_snapshot_data,
       &shared_heap_snapshot_data, ExtractRehashability(blob));
@@ -203,10 +254,16 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   bool can_rehash = ExtractRehashability(blob);
   base::Vector<const byte> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
-  SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
+  base::Optional<SnapshotData> snapshot_data;
+  const SnapshotData* snapshot_data_ptr =
+      ContextSnapshotPrep::TryGet(isolate, context_index);
+  if (snapshot_data_ptr == nullptr) {
+    snapshot_data.emplace(MaybeDecompress(isolate, context_data));
+    snapshot_data_ptr = &snapshot_data.value();
+  }
 
   MaybeHandle<Context> maybe_result = ContextDeserializer::DeserializeContext(
-      isolate, &snapshot_data, can_rehash, global_proxy,
+      isolate, snapshot_data_ptr, can_rehash, global_proxy,
       embedder_fields_deserializer);
 
   Handle<Context> result;
@@ -221,6 +278,91 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   return result;
 }
 
+// Decompresses context snapshot sections on a worker thread. Tied to the
+// isolate's cancelable task manager so that isolate teardown waits for the
+// task to finish before the ContextSnapshotPrep instance is freed.
+class ContextSnapshotPrepTask final : public CancelableTask {
+ public:
+  ContextSnapshotPrepTask(Isolate* isolate, ContextSnapshotPrep* prep,
+                          const v8::StartupData* blob)
+      : CancelableTask(isolate), prep_(prep), blob_(blob) {}
+
+  void RunInternal() override { prep_->PrepareAll(blob_); }
+
+ private:
+  ContextSnapshotPrep* const prep_;
+  const v8::StartupData* const blob_;
+};
+
+// static
+void ContextSnapshotPrep::Start(Isolate* isolate) {
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (!v8_flags.concurrent_context_snapshot_prep) return;
+  if (!isolate->snapshot_available()) return;
+  if (V8::GetCurrentPlatform()->NumberOfWorkerThreads() == 0) return;
+  const v8::StartupData* blob = isolate->snapshot_blob();
+  uint32_t num_contexts = SnapshotImpl::ExtractNumContexts(blob);
+  if (num_contexts == 0) return;
+  DCHECK_NULL(isolate->context_snapshot_prep());
+  auto* prep = new ContextSnapshotPrep(num_contexts);
+  isolate->set_context_snapshot_prep(prep);
+  V8::GetCurrentPlatform()->CallOnWorkerThread(
+      std::make_unique<ContextSnapshotPrepTask>(isolate, prep, blob));
+#else
+  // Without snapshot compression, preparing a section is a trivial wrapper
+  // around the blob bytes and not worth a task.
+  USE(isolate);
+#endif  // V8_SNAPSHOT_COMPRESSION
+}
+
+// static
+const SnapshotData* ContextSnapshotPrep::TryGet(Isolate* isolate,
+                                                size_t context_index) {
+  ContextSnapshotPrep* prep = isolate->context_snapshot_prep();
+  if (prep == nullptr || context_index >= prep->slots_.size()) return nullptr;
+  Slot& slot = prep->slots_[context_index];
+  uint8_t state = slot.state.load(std::memory_order_acquire);
+  if (state == kIdle) {
+    // Claim the section so the worker skips it; the caller decompresses
+    // inline. This also covers the case where the worker task was canceled
+    // before it ran.
+    if (slot.state.compare_exchange_strong(state, kSkipped,
+                                           std::memory_order_acq_rel)) {
+      return nullptr;
+    }
+  }
+  if (state == kBusy) {
+    base::MutexGuard guard(&prep->mutex_);
+    while ((state = slot.state.load(std::memory_order_acquire)) == kBusy) {
+      prep->ready_.Wait(&prep->mutex_);
+    }
+  }
+  return state == kReady ? &slot.data.value() : nullptr;
+}
+
+void ContextSnapshotPrep::PrepareAll(const v8::StartupData* blob) {
+#ifdef V8_SNAPSHOT_COMPRESSION
+  for (size_t i = 0; i < slots_.size(); i++) {
+    Slot& slot = slots_[i];
+    uint8_t expected = kIdle;
+    if (!slot.state.compare_exchange_strong(expected, kBusy,
+                                            std::memory_order_acq_rel)) {
+      // The main thread got here first.
+      continue;
+    }
+    base::Vector<const byte> context_data =
+        SnapshotImpl::ExtractContextData(blob, static_cast<uint32_t>(i));
+    SnapshotData decompressed = SnapshotCompression::Decompress(context_data);
+    base::MutexGuard guard(&mutex_);
+    slot.data.emplace(std::move(decompressed));
+    slot.state.store(kReady, std::memory_order_release);
+    ready_.NotifyAll();
+  }
+#else
+  UNREACHABLE();
+#endif  // V8_SNAPSHOT_COMPRESSION
+}
+
 // static
 void Snapshot::ClearReconstructableDataForSerialization(
     Isolate* isolate, bool clear_recompilable_data) {
@@ -502,21 +644,40 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
   context_snapshots = &context_snapshots_in;
 #endif
 
+  // With --page-aligned-snapshot, start the read-only, shared heap and
+  // context sections on OS page boundaries. Embedders that mmap the blob file
+  // then get section pages that stay clean and are shared copy-on-write
+  // across processes by the kernel. The startup section keeps its computed
+  // offset since that offset is not recorded in the header. Section offsets
+  // are always read back from the header, so page-aligned blobs remain
+  // readable by deserializers that do not know about the alignment.
+  const uint32_t section_alignment =
+      v8_flags.page_aligned_snapshot
+          ? static_cast<uint32_t>(base::OS::CommitPageSize())
+          : 1;
+
   uint32_t num_contexts = static_cast<uint32_t>(context_snapshots->size());
   uint32_t startup_snapshot_offset =
       SnapshotImpl::StartupSnapshotOffset(num_contexts);
   uint32_t total_length = startup_snapshot_offset;
   total_length += static_cast<uint32_t>(startup_snapshot->RawData().length());
+  total_length = RoundUp(total_length, section_alignment);
   total_length += static_cast<uint32_t>(read_only_snapshot->RawData().length());
+  total_length = RoundUp(total_length, section_alignment);
   total_length +=
       static_cast<uint32_t>(shared_heap_snapshot->RawData().length());
   for (const auto context_snapshot : *context_snapshots) {
+    total_length = RoundUp(total_length, section_alignment);
     total_length += static_cast<uint32_t>(context_snapshot->RawData().length());
   }
 
   char* data = new char[total_length];
-  // Zero out pre-payload data. Part of that is only used for padding.
-  memset(data, 0, SnapshotImpl::StartupSnapshotOffset(num_contexts));
+  // Zero out pre-payload data and, when page-aligning sections, the padding
+  // between sections. Part of that is only used for padding.
+  memset(data, 0,
+         section_alignment > 1
+             ? total_length
+             : SnapshotImpl::StartupSnapshotOffset(num_contexts));
 
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kNumberOfContextsOffset,
                                num_contexts);
@@ -544,6 +705,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
   payload_offset += payload_length;
 
   // Read-only.
+  payload_offset = RoundUp(payload_offset, section_alignment);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kReadOnlyOffsetOffset,
                                payload_offset);
   payload_length = read_only_snapshot->RawData().length();
@@ -557,6 +719,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
   payload_offset += payload_length;
 
   // Shared heap.
+  payload_offset = RoundUp(payload_offset, section_alignment);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kSharedHeapOffsetOffset,
                                payload_offset);
   payload_length = shared_heap_snapshot->RawData().length();
@@ -571,6 +734,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
 
   // Context snapshots (context-specific data).
   for (uint32_t i = 0; i < num_contexts; i++) {
+    payload_offset = RoundUp(payload_offset, section_alignment);
     SnapshotImpl::SetHeaderValue(
         data, SnapshotImpl::ContextSnapshotOffsetOffset(i), payload_offset);
     SnapshotData* context_snapshot = (*context_snapshots)[i];
@@ -5,11 +5,16 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_H_
 #define V8_SNAPSHOT_SNAPSHOT_H_
 
+#include <atomic>
 #include <vector>
 
 #include "include/v8-snapshot.h"  // For StartupData.
+#include "src/base/optional.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
+#include "src/snapshot/snapshot-data.h"
 
 namespace v8 {
 namespace internal {
@@ -17,7 +22,6 @@ namespace internal {
 class Context;
 class GlobalSafepointScope;
 class Isolate;
-class SnapshotData;
 class JSGlobalProxy;
 
 class Snapshot : public AllStatic {
@@ -122,6 +126,54 @@ class Snapshot : public AllStatic {
 #endif  // DEBUG
 };
 
+// Prepares context snapshot sections for deserialization on a platform worker
+// thread, overlapping their decompression with the startup deserializer
+// running on the main thread. NewContextFromSnapshot picks up prepared
+// sections and falls back to inline decompression for sections that are not
+// ready. The worker task is registered with the isolate's cancelable task
+// manager, so isolate teardown waits for it. Enabled with
+// --concurrent-context-snapshot-prep; only effective for compressed
+// snapshots.
+class V8_EXPORT_PRIVATE ContextSnapshotPrep final {
+ public:
+  ~ContextSnapshotPrep() = default;
+  ContextSnapshotPrep(const ContextSnapshotPrep&) = delete;
+  ContextSnapshotPrep& operator=(const ContextSnapshotPrep&) = delete;
+
+  // Posts the preparation task if enabled and worthwhile. Called at the end
+  // of Snapshot::Initialize.
+  static void Start(Isolate* isolate);
+
+  // Returns the prepared section for |context_index|, waiting if the worker
+  // is currently decompressing exactly that section, or nullptr if the
+  // section was not prepared. The returned data is owned by the prep instance
+  // and stays valid until isolate teardown.
+  static const SnapshotData* TryGet(Isolate* isolate, size_t context_index);
+
+ private:
+  enum SlotState : uint8_t {
+    kIdle,     // Nobody has claimed the section yet.
+    kBusy,     // The worker is decompressing the section.
+    kReady,    // The decompressed section is available in |data|.
+    kSkipped,  // The main thread claimed the section before the worker.
+  };
+
+  struct Slot {
+    std::atomic<uint8_t> state{kIdle};
+    base::Optional<SnapshotData> data;
+  };
+
+  explicit ContextSnapshotPrep(size_t num_contexts) : slots_(num_contexts) {}
+
+  void PrepareAll(const v8::StartupData* blob);
+
+  base::Mutex mutex_;
+  base::ConditionVariable ready_;
+  std::vector<Slot> slots_;
+
+  friend class ContextSnapshotPrepTask;
+};
+
 // Convenience wrapper around snapshot data blob creation used e.g. by tests and
 // mksnapshot.
 V8_EXPORT_PRIVATE v8::StartupData CreateSnapshotDataBlobInternal(
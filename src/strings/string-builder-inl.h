@@ -5,6 +5,8 @@
 #ifndef V8_STRINGS_STRING_BUILDER_INL_H_
 #define V8_STRINGS_STRING_BUILDER_INL_H_
 
+#include <cstring>
+
 #include "src/common/assert-scope.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -156,6 +158,25 @@ class IncrementalStringBuilder {
     }
   }
 
+  // Appends a string of known length, copying it into the current part in
+  // one go when it fits; falls back to the character-at-a-time loop at part
+  // boundaries and for two-byte parts.
+  V8_INLINE void AppendCString(const char* s, int length) {
+    DCHECK_EQ(static_cast<size_t>(length), strlen(s));
+    if (encoding_ == String::ONE_BYTE_ENCODING &&
+        CurrentPartCanFit(length + 1)) {
+      SeqOneByteString::cast(*current_part_)
+          .SeqOneByteStringSetChars(current_index_,
+                                    reinterpret_cast<const uint8_t*>(s),
+                                    length);
+      current_index_ += length;
+      if (current_index_ == part_length_) Extend();
+      DCHECK(HasValidCurrentIndex());
+      return;
+    }
+    AppendCString(s);
+  }
+
   V8_INLINE void AppendCString(const base::uc16* s) {
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       while (*s != '\0') Append<base::uc16, uint8_t>(*(s++));
@@ -9,6 +9,26 @@
 #include "src/common/globals.h"
 #include "src/utils/utils.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and some
+// types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -58,6 +78,44 @@ static inline word_t AsciiRangeMask(word_t w, char m, char n) {
   return (tmp1 & tmp2 & (kOneInEveryByte * 0x80));
 }
 
+#if defined(__SSE3__) || defined(NEON64)
+
+const int kSimdBlockSize = 16;
+
+// Converts one 16-byte block, strictly in the range (m, n), flipping the
+// case bit of every byte in the range. Returns false without writing to
+// |dst| if the block contains a non-ASCII byte; the caller then falls
+// through to the scalar code, which locates the exact bail-out position.
+// Sets *changed if any byte was converted. Loads and stores are unaligned,
+// so no alignment of |src| or |dst| is required.
+static inline bool AsciiConvertBlock(char* dst, const char* src, char m,
+                                     char n, bool* changed) {
+#ifdef __SSE3__
+  const __m128i w =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  if (_mm_movemask_epi8(w) != 0) return false;
+  // All bytes are ASCII at this point, so signed byte compares are safe.
+  const __m128i mask = _mm_and_si128(_mm_cmpgt_epi8(w, _mm_set1_epi8(m)),
+                                     _mm_cmpgt_epi8(_mm_set1_epi8(n), w));
+  *changed |= _mm_movemask_epi8(mask) != 0;
+  const __m128i flipped =
+      _mm_xor_si128(w, _mm_and_si128(mask, _mm_set1_epi8(1 << 5)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), flipped);
+  return true;
+#else   // NEON64
+  const uint8x16_t w = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+  if (vmaxvq_u8(w) > 0x7F) return false;
+  const uint8x16_t mask = vandq_u8(vcgtq_u8(w, vdupq_n_u8(m)),
+                                   vcltq_u8(w, vdupq_n_u8(n)));
+  *changed |= vmaxvq_u8(mask) != 0;
+  const uint8x16_t flipped = veorq_u8(w, vandq_u8(mask, vdupq_n_u8(1 << 5)));
+  vst1q_u8(reinterpret_cast<uint8_t*>(dst), flipped);
+  return true;
+#endif  // __SSE3__
+}
+
+#endif  // defined(__SSE3__) || defined(NEON64)
+
 template <bool is_lower>
 int FastAsciiConvert(char* dst, const char* src, int length,
                      bool* changed_out) {
@@ -75,7 +133,32 @@ int FastAsciiConvert(char* dst, const char* src, int length,
   bool changed = false;
   const char* const limit = src + length;
 
-  // dst is newly allocated and always aligned.
+#if defined(__SSE3__) || defined(NEON64)
+  // Process the bulk of the input two 16-byte vectors at a time. The
+  // vector loads and stores are unaligned, so no alignment prologue is
+  // needed. On the first block containing a non-ASCII byte we fall
+  // through to the scalar code below, which continues from the current
+  // position rather than redoing the converted prefix.
+  while (src <= limit - 2 * kSimdBlockSize) {
+    if (!AsciiConvertBlock(dst, src, lo, hi, &changed)) break;
+    if (!AsciiConvertBlock(dst + kSimdBlockSize, src + kSimdBlockSize, lo, hi,
+                           &changed)) {
+      src += kSimdBlockSize;
+      dst += kSimdBlockSize;
+      break;
+    }
+    src += 2 * kSimdBlockSize;
+    dst += 2 * kSimdBlockSize;
+  }
+  if (src <= limit - kSimdBlockSize &&
+      AsciiConvertBlock(dst, src, lo, hi, &changed)) {
+    src += kSimdBlockSize;
+    dst += kSimdBlockSize;
+  }
+#endif  // defined(__SSE3__) || defined(NEON64)
+
+  // dst is newly allocated and always aligned, and the vector loop above
+  // advances by multiples of the word size.
   DCHECK(IsAligned(reinterpret_cast<Address>(dst), sizeof(word_t)));
   // Only attempt processing one word at a time if src is also aligned.
   if (IsAligned(reinterpret_cast<Address>(src), sizeof(word_t))) {
@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,55 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+uint64_t StringHasher::MixHashLanes(uint64_t a, uint64_t b) {
+  // Fold the 128-bit product of |a| and |b| into 64 bits. Folding with xor
+  // keeps the mix invertible in neither operand, which is what makes the
+  // multiply usable as a compression step.
+  return base::bits::UnsignedMulHigh64(a, b) ^ (a * b);
+}
+
+template <typename uchar>
+uint64_t StringHasher::LoadFourCharacters(const uchar* chars) {
+  // Assemble four code units into the four 16-bit lanes of a word. Spelling
+  // out the shifts keeps the result independent of both the character width
+  // and the host byte order; compilers turn this into a single (widening)
+  // load on the platforms we care about.
+  return static_cast<uint64_t>(chars[0]) |
+         static_cast<uint64_t>(chars[1]) << 16 |
+         static_cast<uint64_t>(chars[2]) << 32 |
+         static_cast<uint64_t>(chars[3]) << 48;
+}
+
+template <typename uchar>
+uint32_t StringHasher::HashLongString(const uchar* chars, int length,
+                                      uint64_t seed) {
+  DCHECK_GT(length, kWideHashThreshold);
+  DCHECK_LE(length, String::kMaxHashCalcLength);
+  // Arbitrary odd constants; the first is 2^64 divided by the golden ratio.
+  constexpr uint64_t kWideHashMul0 = 0x9E3779B97F4A7C15;
+  constexpr uint64_t kWideHashMul1 = 0xC2B2AE3D27D4EB4F;
+  const uchar* end = chars + length;
+  uint64_t state = seed ^ kWideHashMul0;
+  // Compress eight code units into the state per step. The seeded state
+  // enters one side of every multiply, so as with the running hash below a
+  // hash value is only meaningful for a known seed.
+  while (end - chars >= 8) {
+    state = MixHashLanes(LoadFourCharacters(chars) ^ kWideHashMul1,
+                         LoadFourCharacters(chars + 4) ^ state);
+    chars += 8;
+  }
+  state = MixHashLanes(state ^ static_cast<uint64_t>(length), kWideHashMul1);
+  // Feed the folded state and the remaining (at most seven) code units
+  // through the regular finalizer, which also enforces the kZeroHash rule.
+  uint32_t running_hash =
+      static_cast<uint32_t>(state ^ (state >> 32));
+  while (chars != end) {
+    running_hash = AddCharacterCore(running_hash, *chars++);
+  }
+  return String::CreateHashFieldValue(GetHashCore(running_hash),
+                                      String::HashFieldType::kHash);
+}
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -111,6 +161,12 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     }
   }
 
+  if (length > kWideHashThreshold) {
+    // Long strings (typically interned keys such as source snippets or
+    // serialized data) are hashed four code units at a time.
+    return HashLongString(chars, length, seed);
+  }
+
   // Non-index hash.
   uint32_t running_hash = static_cast<uint32_t>(seed);
   const uchar* end = &chars[length];
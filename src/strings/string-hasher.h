@@ -40,6 +40,23 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+  // Strings longer than this number of characters are hashed four code units
+  // at a time with the multiply-based hash below instead of the
+  // character-at-a-time running hash.
+  static const int kWideHashThreshold = 64;
+
+ private:
+  // Multiply-based hash for strings longer than kWideHashThreshold. Produces
+  // the same value for one-byte and two-byte representations of the same
+  // content, and the same value on all platforms, so that hashes baked into
+  // the snapshot stay valid on the target.
+  template <typename uchar>
+  V8_INLINE static uint32_t HashLongString(const uchar* chars, int length,
+                                           uint64_t seed);
+  V8_INLINE static uint64_t MixHashLanes(uint64_t a, uint64_t b);
+  template <typename uchar>
+  V8_INLINE static uint64_t LoadFourCharacters(const uchar* chars);
 };
 
 // Useful for std containers that require something ()'able.
@@ -8,6 +8,7 @@
 #include "src/base/strings.h"
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
+#include "src/objects/simd.h"
 
 namespace v8 {
 namespace internal {
@@ -181,50 +182,30 @@ class StringSearch : private StringSearchBase {
   int start_;
 };
 
-template <typename T, typename U>
-inline T AlignDown(T value, U alignment) {
-  return reinterpret_cast<T>(
-      (reinterpret_cast<uintptr_t>(value) & ~(alignment - 1)));
-}
-
-inline uint8_t GetHighestValueByte(base::uc16 character) {
-  return std::max(static_cast<uint8_t>(character & 0xFF),
-                  static_cast<uint8_t>(character >> 8));
-}
-
-inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
-
 template <typename PatternChar, typename SubjectChar>
 inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
                               base::Vector<const SubjectChar> subject,
                               int index) {
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
-
-  if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
-    // Special-case looking for the 0 char in other than one-byte strings.
-    // memchr mostly fails in this case due to every other byte being 0 in text
-    // that is mostly ascii characters.
-    for (int i = index; i < max_n; ++i) {
-      if (subject[i] == 0) return i;
-    }
-    return -1;
-  }
-  const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
-  const SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
-  int pos = index;
-  do {
-    DCHECK_GE(max_n - pos, 0);
+  DCHECK_GE(max_n - index, 0);
+
+  if constexpr (sizeof(SubjectChar) == 2) {
+    // Scan whole code units at once, 8 per vector register where SIMD is
+    // available. This avoids the false positives that probing individual
+    // bytes with memchr produces on two-byte subjects, most notably when
+    // searching for the 0 char in text that is mostly ascii characters.
+    return static_cast<int>(StringIndexOfUint16Char(
+        reinterpret_cast<const uint16_t*>(subject.begin()), max_n, index,
+        static_cast<uint16_t>(pattern_first_char)));
+  } else {
+    const SubjectChar search_char =
+        static_cast<SubjectChar>(pattern_first_char);
     const SubjectChar* char_pos = reinterpret_cast<const SubjectChar*>(
-        memchr(subject.begin() + pos, search_byte,
-               (max_n - pos) * sizeof(SubjectChar)));
+        memchr(subject.begin() + index, search_char, max_n - index));
     if (char_pos == nullptr) return -1;
-    char_pos = AlignDown(char_pos, sizeof(SubjectChar));
-    pos = static_cast<int>(char_pos - subject.begin());
-    if (subject[pos] == search_char) return pos;
-  } while (++pos < max_n);
-
-  return -1;
+    return static_cast<int>(char_pos - subject.begin());
+  }
 }
 
 //---------------------------------------------------------------------
@@ -271,6 +252,14 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   base::Vector<const PatternChar> pattern = search->pattern_;
   DCHECK_GT(pattern.length(), 1);
   int pattern_length = pattern.length();
+  if constexpr (sizeof(PatternChar) == 1 && sizeof(SubjectChar) == 1) {
+    // Vectorized search filtering on the first and last pattern character at
+    // once, 16 candidate positions per iteration.
+    if (subject.length() < pattern_length) return -1;
+    return static_cast<int>(StringIndexOfShortOneBytePattern(
+        subject.begin(), subject.length(), index, pattern.begin(),
+        pattern_length));
+  }
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
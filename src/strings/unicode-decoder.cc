@@ -4,6 +4,7 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include "src/base/bits.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -11,10 +12,70 @@
 #include "src/third_party/utf8-decoder/generalized-utf8-decoder.h"
 #endif
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and
+// some types are not available). Note that ARM64 is guaranteed to have Neon.
+#define DECODER_NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
 namespace {
+
+// Returns the length of the longest prefix of |chars| consisting only of
+// ASCII bytes, scanning 16 bytes at a time where vector instructions are
+// available. ASCII runs need neither validation nor transcoding, so both
+// decoder passes use this to skip over them in bulk between multibyte
+// sequences.
+size_t AsciiRunLength(const uint8_t* chars, size_t length) {
+  size_t index = 0;
+#ifdef __SSE3__
+  while (index + 16 <= length) {
+    const __m128i in =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + index));
+    // The sign bit is set exactly for non-ASCII bytes.
+    const uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(in));
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros32(mask);
+  }
+#elif defined(DECODER_NEON64)
+  while (index + 16 <= length) {
+    const uint8x16_t non_ascii =
+        vcgeq_u8(vld1q_u8(chars + index), vdupq_n_u8(0x80));
+    // Narrow the 16 byte lanes to one nibble each.
+    const uint64_t mask = vget_lane_u64(
+        vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(non_ascii), 4)),
+        0);
+    if (mask == 0) {
+      index += 16;
+      continue;
+    }
+    return index + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+#endif
+  while (index < length && chars[index] <= unibrow::Utf8::kMaxOneByteChar) {
+    index++;
+  }
+  return index;
+}
 template <class Decoder>
 struct DecoderTraits;
 
@@ -77,9 +138,12 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // The entire ASCII run contributes one UTF-16 code unit per byte.
+      size_t run = AsciiRunLength(cursor, end - cursor);
+      DCHECK_GE(run, 1u);
+      previous = cursor[run - 1];
+      utf16_length_ += static_cast<int>(run);
+      cursor += run;
       continue;
     }
 
@@ -145,8 +209,12 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      // Bulk-copy the entire ASCII run; CopyChars widens as needed.
+      size_t run = AsciiRunLength(cursor, end - cursor);
+      DCHECK_GE(run, 1u);
+      CopyChars(out, cursor, run);
+      out += run;
+      cursor += run;
       continue;
     }
 
@@ -6,14 +6,129 @@
 
 #include <vector>
 
+#include "src/base/bits.h"
 #include "src/execution/isolate-inl.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-search.h"
 #include "src/strings/unicode-inl.h"
 
+#ifdef _MSC_VER
+// MSVC doesn't define SSSE3. However, it does define AVX, and AVX implies
+// SSSE3.
+#ifdef __AVX__
+#ifndef __SSSE3__
+#define __SSSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// We use Neon only on 64-bit ARM (because on 32-bit, some instructions and some
+// types are not available). Note that ARM64 is guaranteed to have Neon.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
 namespace v8 {
 namespace internal {
 
+#if defined(__SSSE3__) || defined(NEON64)
+
+namespace {  // anonymous namespace for SIMD helpers
+
+const int kUriSimdBlockSize = 16;
+
+// Nibble lookup tables classifying bytes that need no escaping ("safe").
+// A byte b is safe iff
+//   (safe_lo_nibble[b & 0x0F] & kUriSafeHiNibble[b >> 4]) != 0,
+// i.e. the lo-nibble entry holds a bitmask of the hi-nibbles for which
+// the byte is safe. Bytes >= 0x80 always classify as unsafe because their
+// hi-nibble entry is zero. The lo-nibble tables encode the
+// IsUnescapePredicateInUriComponent predicate below, for encodeURI
+// additionally extended by IsUriSeparator; CheckUriSafeTable verifies
+// them against the predicates in debug mode.
+alignas(16) const uint8_t kUriSafeHiNibble[16] = {1, 2, 4,  8,  16, 32, 64, 128,
+                                                  0, 0, 0,  0,  0,  0,  0,  0};
+alignas(16) const uint8_t kComponentSafeLoNibble[16] = {
+    0xA8, 0xFC, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFC,
+    0xFC, 0xFC, 0xF4, 0x50, 0x50, 0x54, 0xD4, 0x70};
+alignas(16) const uint8_t kUriSafeLoNibble[16] = {
+    0xB8, 0xFC, 0xF8, 0xFC, 0xFC, 0xF8, 0xFC, 0xFC,
+    0xFC, 0xFC, 0xFC, 0x5C, 0x54, 0x5C, 0xD4, 0x7C};
+
+// Counts how many bytes of the 16-byte block at |src| need escaping, and
+// how many of those are non-ASCII. Loads are unaligned, so no alignment
+// of |src| is required.
+inline void CountUnsafeBlock(const uint8_t* src, const uint8_t* safe_lo_nibble,
+                             int* unsafe_count, int* non_ascii_count) {
+#ifdef __SSSE3__
+  const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i lo_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(safe_lo_nibble));
+  const __m128i hi_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kUriSafeHiNibble));
+  const __m128i lo = _mm_and_si128(w, _mm_set1_epi8(0x0F));
+  const __m128i hi = _mm_and_si128(_mm_srli_epi16(w, 4), _mm_set1_epi8(0x0F));
+  const __m128i classified = _mm_and_si128(_mm_shuffle_epi8(lo_table, lo),
+                                           _mm_shuffle_epi8(hi_table, hi));
+  const __m128i unsafe_bytes = _mm_cmpeq_epi8(classified, _mm_setzero_si128());
+  *unsafe_count = base::bits::CountPopulation(
+      static_cast<uint32_t>(_mm_movemask_epi8(unsafe_bytes)));
+  *non_ascii_count = base::bits::CountPopulation(
+      static_cast<uint32_t>(_mm_movemask_epi8(w)));
+#else   // NEON64
+  const uint8x16_t w = vld1q_u8(src);
+  const uint8x16_t lo_table = vld1q_u8(safe_lo_nibble);
+  const uint8x16_t hi_table = vld1q_u8(kUriSafeHiNibble);
+  const uint8x16_t classified =
+      vandq_u8(vqtbl1q_u8(lo_table, vandq_u8(w, vdupq_n_u8(0x0F))),
+               vqtbl1q_u8(hi_table, vshrq_n_u8(w, 4)));
+  const uint8x16_t unsafe_bytes = vceqq_u8(classified, vdupq_n_u8(0));
+  *unsafe_count = vaddvq_u8(vandq_u8(unsafe_bytes, vdupq_n_u8(1)));
+  *non_ascii_count = vaddvq_u8(vshrq_n_u8(w, 7));
+#endif  // __SSSE3__
+}
+
+// Copies the 16-byte block at |src| to |dst| and returns true if none of
+// its bytes needs escaping; returns false without writing otherwise, and
+// the caller processes the block character by character.
+inline bool CopySafeBlock(uint8_t* dst, const uint8_t* src,
+                          const uint8_t* safe_lo_nibble) {
+#ifdef __SSSE3__
+  const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+  const __m128i lo_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(safe_lo_nibble));
+  const __m128i hi_table =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kUriSafeHiNibble));
+  const __m128i lo = _mm_and_si128(w, _mm_set1_epi8(0x0F));
+  const __m128i hi = _mm_and_si128(_mm_srli_epi16(w, 4), _mm_set1_epi8(0x0F));
+  const __m128i classified = _mm_and_si128(_mm_shuffle_epi8(lo_table, lo),
+                                           _mm_shuffle_epi8(hi_table, hi));
+  const __m128i unsafe_bytes = _mm_cmpeq_epi8(classified, _mm_setzero_si128());
+  if (_mm_movemask_epi8(unsafe_bytes) != 0) return false;
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), w);
+  return true;
+#else   // NEON64
+  const uint8x16_t w = vld1q_u8(src);
+  const uint8x16_t lo_table = vld1q_u8(safe_lo_nibble);
+  const uint8x16_t hi_table = vld1q_u8(kUriSafeHiNibble);
+  const uint8x16_t classified =
+      vandq_u8(vqtbl1q_u8(lo_table, vandq_u8(w, vdupq_n_u8(0x0F))),
+               vqtbl1q_u8(hi_table, vshrq_n_u8(w, 4)));
+  if (vminvq_u8(classified) == 0) return false;
+  vst1q_u8(dst, w);
+  return true;
+#endif  // __SSSE3__
+}
+
+}  // anonymous namespace
+
+#endif  // defined(__SSSE3__) || defined(NEON64)
+
 namespace {  // anonymous namespace for DecodeURI helper functions
 bool IsReservedPredicate(base::uc16 c) {
   switch (c) {
@@ -136,6 +251,40 @@ bool IntoTwoByte(int index, bool is_uri, int uri_length,
   return true;
 }
 
+// Returns the index of the first byte at or after |index| that is either
+// a '%' or non-ASCII, or the length of |vector| if every remaining byte
+// can be copied to the output unchanged.
+int FindEscapeOrNonAscii(base::Vector<const uint8_t> vector, int index) {
+  const int length = vector.length();
+#if defined(__SSSE3__) || defined(NEON64)
+  while (index + kUriSimdBlockSize <= length) {
+#ifdef __SSSE3__
+    const __m128i w = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(vector.begin() + index));
+    const int mask = _mm_movemask_epi8(w) |
+                     _mm_movemask_epi8(_mm_cmpeq_epi8(w, _mm_set1_epi8('%')));
+    if (mask != 0) {
+      return index +
+             base::bits::CountTrailingZeros(static_cast<uint32_t>(mask));
+    }
+#else   // NEON64
+    const uint8x16_t w = vld1q_u8(vector.begin() + index);
+    const uint8x16_t interesting = vorrq_u8(
+        vcgeq_u8(w, vdupq_n_u8(0x80)), vceqq_u8(w, vdupq_n_u8('%')));
+    // Let the scalar loop below locate the exact position in this block.
+    if (vmaxvq_u8(interesting) != 0) break;
+#endif  // __SSSE3__
+    index += kUriSimdBlockSize;
+  }
+#endif  // defined(__SSSE3__) || defined(NEON64)
+  while (index < length) {
+    uint8_t code = vector[index];
+    if (code == '%' || code > unibrow::Utf8::kMaxOneByteChar) break;
+    index++;
+  }
+  return index;
+}
+
 bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
                        std::vector<uint8_t>* one_byte_buffer,
                        std::vector<base::uc16>* two_byte_buffer) {
@@ -143,6 +292,39 @@ bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
   String::FlatContent uri_content = uri->GetFlatContent(no_gc);
 
   int uri_length = uri->length();
+
+  if (uri_content.IsOneByte()) {
+    // Fast path for flat one-byte content: find the next '%' or non-ASCII
+    // character and bulk-copy the run of passthrough bytes before it.
+    base::Vector<const uint8_t> vector = uri_content.ToOneByteVector();
+    int k = 0;
+    while (k < uri_length) {
+      int next = FindEscapeOrNonAscii(vector, k);
+      one_byte_buffer->insert(one_byte_buffer->end(), vector.begin() + k,
+                              vector.begin() + next);
+      if (next == uri_length) return true;
+      k = next;
+      if (vector[k] != '%') {
+        // A non-ASCII (Latin-1) character needs the two-byte path.
+        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
+                           two_byte_buffer);
+      }
+      int two_digits;
+      if (k + 2 >= uri_length ||
+          (two_digits = TwoDigitHex(vector[k + 1], vector[k + 2])) < 0) {
+        return false;
+      }
+      base::uc16 decoded = static_cast<base::uc16>(two_digits);
+      if (decoded > unibrow::Utf8::kMaxOneByteChar) {
+        return IntoTwoByte(k, is_uri, uri_length, &uri_content,
+                           two_byte_buffer);
+      }
+      AddToBuffer(decoded, &uri_content, k, is_uri, one_byte_buffer);
+      k += 3;
+    }
+    return true;
+  }
+
   for (int k = 0; k < uri_length; k++) {
     base::uc16 code = uri_content.Get(k);
     if (code == '%') {
@@ -179,6 +361,8 @@ MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
   uri = String::Flatten(isolate, uri);
   std::vector<uint8_t> one_byte_buffer;
   std::vector<base::uc16> two_byte_buffer;
+  // The unescaped result is never longer than the input.
+  one_byte_buffer.reserve(uri->length());
 
   if (!IntoOneAndTwoByte(uri, is_uri, &one_byte_buffer, &two_byte_buffer)) {
     THROW_NEW_ERROR(isolate, NewURIError(), String);
@@ -276,11 +460,139 @@ void EncodePair(base::uc16 cc1, base::uc16 cc2, std::vector<uint8_t>* buffer) {
   }
 }
 
+bool IsOneByteSafe(uint8_t c, bool is_uri) {
+  return c <= unibrow::Utf8::kMaxOneByteChar &&
+         (IsUnescapePredicateInUriComponent(c) || (is_uri && IsUriSeparator(c)));
+}
+
+uint8_t* WriteEncodedOctet(uint8_t octet, uint8_t* dst) {
+  *dst++ = '%';
+  *dst++ = base::HexCharOfValue(octet >> 4);
+  *dst++ = base::HexCharOfValue(octet & 0x0F);
+  return dst;
+}
+
+uint8_t* EncodeOneByteChar(uint8_t c, bool is_uri, uint8_t* dst) {
+  if (IsOneByteSafe(c, is_uri)) {
+    *dst++ = c;
+    return dst;
+  }
+  if (c <= unibrow::Utf8::kMaxOneByteChar) return WriteEncodedOctet(c, dst);
+  // Latin-1 characters above 0x7F encode to two UTF-8 octets.
+  dst = WriteEncodedOctet(0xC0 | (c >> 6), dst);
+  return WriteEncodedOctet(0x80 | (c & 0x3F), dst);
+}
+
+#if defined(__SSSE3__) || defined(NEON64)
+#ifdef DEBUG
+bool CheckUriSafeTable(const uint8_t* safe_lo_nibble, bool is_uri) {
+  for (int c = 0; c < 256; c++) {
+    bool table_safe =
+        (safe_lo_nibble[c & 0x0F] & kUriSafeHiNibble[c >> 4]) != 0;
+    if (table_safe != IsOneByteSafe(c, is_uri)) return false;
+  }
+  return true;
+}
+#endif
+#endif  // defined(__SSSE3__) || defined(NEON64)
+
+// Fast path for flat one-byte strings: no surrogate pairs can occur, so
+// each character maps to one output character if it is safe, three if it
+// is escaped ASCII, and six if it is Latin-1 above 0x7F. A counting pass
+// classifies 16 bytes at a time, then a copy pass writes into a pre-sized
+// result, bulk-copying blocks that contain no character to escape.
+MaybeHandle<String> EncodeOneByte(Isolate* isolate, Handle<String> uri,
+                                  bool is_uri) {
+  int uri_length = uri->length();
+#if defined(__SSSE3__) || defined(NEON64)
+  const uint8_t* safe_lo_nibble =
+      is_uri ? kUriSafeLoNibble : kComponentSafeLoNibble;
+  DCHECK(CheckUriSafeTable(safe_lo_nibble, is_uri));
+#endif
+
+  int escaped_length = 0;
+  {
+    DisallowGarbageCollection no_gc;
+    base::Vector<const uint8_t> vector =
+        uri->GetFlatContent(no_gc).ToOneByteVector();
+    int i = 0;
+#if defined(__SSSE3__) || defined(NEON64)
+    for (; i + kUriSimdBlockSize <= uri_length; i += kUriSimdBlockSize) {
+      int unsafe_count;
+      int non_ascii_count;
+      CountUnsafeBlock(vector.begin() + i, safe_lo_nibble, &unsafe_count,
+                       &non_ascii_count);
+      escaped_length +=
+          kUriSimdBlockSize + 2 * unsafe_count + 3 * non_ascii_count;
+
+      // We don't allow strings that are longer than a maximal length.
+      // Cannot overflow.
+      DCHECK_LT(String::kMaxLength, 0x7FFFFFFF - 6 * kUriSimdBlockSize);
+      if (escaped_length > String::kMaxLength) break;  // Provoke exception.
+    }
+#endif
+    for (; i < uri_length; i++) {
+      uint8_t c = vector[i];
+      if (c > unibrow::Utf8::kMaxOneByteChar) {
+        escaped_length += 6;
+      } else if (IsOneByteSafe(c, is_uri)) {
+        escaped_length++;
+      } else {
+        escaped_length += 3;
+      }
+
+      // We don't allow strings that are longer than a maximal length.
+      DCHECK_LT(String::kMaxLength, 0x7FFFFFFF - 6);   // Cannot overflow.
+      if (escaped_length > String::kMaxLength) break;  // Provoke exception.
+    }
+  }
+
+  if (escaped_length > String::kMaxLength) {
+    THROW_NEW_ERROR(isolate, NewInvalidStringLengthError(), String);
+  }
+
+  // No length change implies no change.  Return original string if no change.
+  if (escaped_length == uri_length) return uri;
+
+  Handle<SeqOneByteString> dest;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, dest, isolate->factory()->NewRawOneByteString(escaped_length),
+      String);
+
+  DisallowGarbageCollection no_gc;
+  base::Vector<const uint8_t> vector =
+      uri->GetFlatContent(no_gc).ToOneByteVector();
+  uint8_t* dst = dest->GetChars(no_gc);
+  int i = 0;
+#if defined(__SSSE3__) || defined(NEON64)
+  while (i + kUriSimdBlockSize <= uri_length) {
+    if (CopySafeBlock(dst, vector.begin() + i, safe_lo_nibble)) {
+      dst += kUriSimdBlockSize;
+      i += kUriSimdBlockSize;
+      continue;
+    }
+    // The block contains at least one character that needs escaping;
+    // process it character by character.
+    for (int j = 0; j < kUriSimdBlockSize; j++, i++) {
+      dst = EncodeOneByteChar(vector[i], is_uri, dst);
+    }
+  }
+#endif
+  for (; i < uri_length; i++) {
+    dst = EncodeOneByteChar(vector[i], is_uri, dst);
+  }
+  DCHECK_EQ(escaped_length, static_cast<int>(dst - dest->GetChars(no_gc)));
+  return dest;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(isolate, uri);
+  if (String::IsOneByteRepresentationUnderneath(*uri)) {
+    return EncodeOneByte(isolate, uri, is_uri);
+  }
   int uri_length = uri->length();
   std::vector<uint8_t> buffer;
   buffer.reserve(uri_length);
@@ -1226,10 +1226,53 @@ class LiftoffCompiler {
   void Loop(FullDecoder* decoder, Control* loop) {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // into registers at branches. Locals which are assigned inside the loop
+    // body are kept in registers instead, as long as unused registers are
+    // available: each assignment to a spilled local costs a store in the loop
+    // body, and each use a load, which is where baseline code spends most of
+    // its time in hot loops. Skip this when debugging, to keep frame contents
+    // predictable for inspection.
+    BitVector* assigned = V8_LIKELY(for_debugging_ == kNoDebugging)
+                              ? WasmDecoder<validate>::AnalyzeLoopAssignment(
+                                    decoder, decoder->pc(),
+                                    decoder->num_locals(), decoder->zone())
+                              : nullptr;
+    // Cap the number of locals kept in registers, to leave enough registers
+    // for the temporaries of the loop body itself.
+    constexpr int kMaxLocalsKeptInLoop = 4;
+    int locals_kept = 0;
+    LiftoffRegList keep_pinned;
+    for (uint32_t local = 0; local < __ num_locals(); ++local) {
+      auto* slot = &__ cache_state()->stack_state[local];
+      if (assigned != nullptr && assigned->Contains(local) &&
+          locals_kept < kMaxLocalsKeptInLoop) {
+        if (slot->is_reg() &&
+            __ cache_state()->get_use_count(slot->reg()) == 1) {
+          keep_pinned.set(slot->reg());
+          ++locals_kept;
+          continue;
+        }
+        RegClass rc = reg_class_for(slot->kind());
+        if (__ cache_state()->has_unused_register(rc, keep_pinned)) {
+          LiftoffRegister reg =
+              __ cache_state()->unused_register(rc, keep_pinned);
+          if (slot->is_reg()) {
+            __ Move(reg, slot->reg(), slot->kind());
+            __ cache_state()->dec_used(slot->reg());
+          } else if (slot->is_const()) {
+            __ LoadConstant(reg, slot->constant());
+          } else {
+            __ Fill(reg, slot->offset(), slot->kind());
+          }
+          slot->MakeRegister(reg);
+          __ cache_state()->inc_used(reg);
+          keep_pinned.set(reg);
+          ++locals_kept;
+          continue;
+        }
+      }
+      __ Spill(slot);
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <queue>
+#include <unordered_set>
 
 #include "src/api/api-inl.h"
 #include "src/base/enum-set.h"
@@ -196,10 +197,11 @@ class CompilationUnitQueues {
     DCHECK_LT(0, baseline_units.size() + top_tier_units.size());
     // Add to the individual queues in a round-robin fashion. No special care is
     // taken to balance them; they will be balanced by work stealing.
+    // The shared {queues_mutex_} guard also protects {compile_first_} below.
+    base::SharedMutexGuard<base::kShared> queues_guard{&queues_mutex_};
     QueueImpl* queue;
     {
       int queue_to_add = next_queue_to_add.load(std::memory_order_relaxed);
-      base::SharedMutexGuard<base::kShared> queues_guard{&queues_mutex_};
       while (!next_queue_to_add.compare_exchange_weak(
           queue_to_add, next_task_id(queue_to_add, queues_.size()),
           std::memory_order_relaxed)) {
@@ -216,22 +218,44 @@ class CompilationUnitQueues {
       base::Vector<WasmCompilationUnit> units = pair.second;
       if (units.empty()) continue;
       num_units_[tier].fetch_add(units.size(), std::memory_order_relaxed);
+      // Units prioritized via {SetFunctionsToCompileFirst} are collected
+      // separately and appended last: the queue is popped from the back, so
+      // they will be compiled before the other units added here.
+      std::vector<WasmCompilationUnit> prioritized_units;
       for (WasmCompilationUnit unit : units) {
+        const bool compile_first =
+            !compile_first_.empty() &&
+            compile_first_.count(unit.func_index()) != 0;
         size_t func_size = module->functions[unit.func_index()].code.length();
         if (func_size <= kBigUnitsLimit) {
-          queue->units[tier].push_back(unit);
+          if (compile_first) {
+            prioritized_units.push_back(unit);
+          } else {
+            queue->units[tier].push_back(unit);
+          }
         } else {
           if (!big_units_guard) {
             big_units_guard.emplace(&big_units_queue_.mutex);
           }
           big_units_queue_.has_units[tier].store(true,
                                                  std::memory_order_relaxed);
-          big_units_queue_.units[tier].emplace(func_size, unit);
+          big_units_queue_.units[tier].emplace(func_size, unit, compile_first);
         }
       }
+      for (WasmCompilationUnit unit : prioritized_units) {
+        queue->units[tier].push_back(unit);
+      }
     }
   }
 
+  // Hints functions whose compilation units should be returned before other
+  // units of the same tier, e.g. based on embedder profile data. Must be
+  // called before the units of these functions are added.
+  void SetFunctionsToCompileFirst(base::Vector<const uint32_t> indices) {
+    base::SharedMutexGuard<base::kExclusive> queues_guard{&queues_mutex_};
+    compile_first_.insert(indices.begin(), indices.end());
+  }
+
   void AddTopTierPriorityUnit(WasmCompilationUnit unit, size_t priority) {
     base::SharedMutexGuard<base::kShared> queues_guard{&queues_mutex_};
     // Add to the individual queues in a round-robin fashion. No special care is
@@ -281,13 +305,17 @@ class CompilationUnitQueues {
   static constexpr size_t kBigUnitsLimit = 4096;
 
   struct BigUnit {
-    BigUnit(size_t func_size, WasmCompilationUnit unit)
-        : func_size{func_size}, unit(unit) {}
+    BigUnit(size_t func_size, WasmCompilationUnit unit, bool compile_first)
+        : func_size{func_size}, unit(unit), compile_first(compile_first) {}
 
     size_t func_size;
     WasmCompilationUnit unit;
+    // Set for functions hinted via {SetFunctionsToCompileFirst}; those sort
+    // above all other big units.
+    bool compile_first;
 
     bool operator<(const BigUnit& other) const {
+      if (compile_first != other.compile_first) return other.compile_first;
       return func_size < other.func_size;
     }
   };
@@ -512,10 +540,14 @@ class CompilationUnitQueues {
     return returned_unit;
   }
 
-  // {queues_mutex_} protectes {queues_};
+  // {queues_mutex_} protectes {queues_} and {compile_first_};
   base::SharedMutex queues_mutex_;
   std::vector<std::unique_ptr<QueueImpl>> queues_;
 
+  // Function indices hinted via {SetFunctionsToCompileFirst}. Filled once
+  // before the code section is processed, read on every {AddUnits}.
+  std::unordered_set<uint32_t> compile_first_;
+
   const int num_declared_functions_;
 
   BigUnitsQueue big_units_queue_;
@@ -613,6 +645,13 @@ class CompilationStateImpl {
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Hints functions whose compilation units should be scheduled before
+  // others (see {WasmStreaming::SetFunctionsToCompileFirst}). Must be called
+  // before the corresponding units are committed.
+  void SetFunctionsToCompileFirst(base::Vector<const uint32_t> indices) {
+    compilation_unit_queues_.SetFunctionsToCompileFirst(indices);
+  }
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   base::Optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -2142,6 +2181,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
                                 int code_section_start,
                                 int code_section_length) override;
 
+  void SetFunctionsToCompileFirst(
+      std::vector<uint32_t> function_indices) override;
+
   void ProcessFunctionBody(base::Vector<const uint8_t> bytes,
                            uint32_t offset) override;
 
@@ -2167,6 +2209,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   ModuleDecoder decoder_;
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
+  // Embedder-provided hint which functions to compile first; handed to the
+  // {CompilationStateImpl} once the native module exists.
+  std::vector<uint32_t> functions_to_compile_first_;
   int num_functions_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
@@ -2909,6 +2954,10 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
 
   auto* compilation_state = Impl(job_->native_module_->compilation_state());
   compilation_state->SetWireBytesStorage(std::move(wire_bytes_storage));
+  if (!functions_to_compile_first_.empty()) {
+    compilation_state->SetFunctionsToCompileFirst(
+        base::VectorOf(functions_to_compile_first_));
+  }
   DCHECK_EQ(job_->native_module_->module()->origin, kWasmOrigin);
 
   // Set outstanding_finishers_ to 2, because both the AsyncCompileJob and the
@@ -2921,6 +2970,14 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   return true;
 }
 
+void AsyncStreamingProcessor::SetFunctionsToCompileFirst(
+    std::vector<uint32_t> function_indices) {
+  // Called before any bytes arrive, so before the native module exists; keep
+  // the hint until {ProcessCodeSectionHeader} sets up the compilation state.
+  DCHECK(before_code_section_);
+  functions_to_compile_first_ = std::move(function_indices);
+}
+
 // Process a function body.
 void AsyncStreamingProcessor::ProcessFunctionBody(
     base::Vector<const uint8_t> bytes, uint32_t offset) {
@@ -42,6 +42,11 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) override;
 
+  void SetFunctionsToCompileFirst(
+      std::vector<uint32_t> function_indices) override {
+    processor_->SetFunctionsToCompileFirst(std::move(function_indices));
+  }
+
  private:
   // The SectionBuffer is the data object for the content of a single section.
   // It stores all bytes of the section (including section id and section
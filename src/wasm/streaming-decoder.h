@@ -10,6 +10,7 @@
 #define V8_WASM_STREAMING_DECODER_H_
 
 #include <memory>
+#include <vector>
 
 #include "src/base/macros.h"
 #include "src/base/vector.h"
@@ -47,6 +48,11 @@ class V8_EXPORT_PRIVATE StreamingProcessor {
                                         int code_section_length) = 0;
 
   // Process a function body.
+  // Called when the embedder hints which functions should be compiled first,
+  // before any of the process callbacks above. Implementations which do not
+  // support prioritization can ignore the hint.
+  virtual void SetFunctionsToCompileFirst(std::vector<uint32_t>) {}
+
   virtual void ProcessFunctionBody(base::Vector<const uint8_t> bytes,
                                    uint32_t offset) = 0;
 
@@ -101,6 +107,12 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
     compiled_module_bytes_ = bytes;
   }
 
+  // Hints which functions (by index in the module's function index space)
+  // should be compiled first (see {WasmStreaming::SetFunctionsToCompileFirst}).
+  // Must be called before {OnBytesReceived}. No-op by default; the async
+  // decoder forwards the hint to the compilation pipeline.
+  virtual void SetFunctionsToCompileFirst(std::vector<uint32_t>) {}
+
   virtual void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) = 0;
 
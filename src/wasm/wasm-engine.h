@@ -63,7 +63,15 @@ class V8_EXPORT_PRIVATE InstantiationResultResolver {
   virtual ~InstantiationResultResolver() = default;
 };
 
-// Native modules cached by their wire bytes.
+// Native modules cached by their wire bytes. The cache key is the *content*
+// of the wire bytes (prefix hash plus a full byte comparison), not their
+// address, so isolates which compile the same module from different buffers
+// still share a single {NativeModule}: the compiled code, the {WasmModule}
+// metadata, and the canonical copy of the wire bytes. Per-instantiation data
+// (instance objects, memories, tables, globals) stays per-isolate. Entries
+// are held weakly; a cached module dies once the last embedder reference is
+// dropped. Only modules with {kWasmOrigin} are cached, and the cache can be
+// disabled via {--no-wasm-native-module-cache-enabled}.
 class NativeModuleCache {
  public:
   struct Key {
@@ -81,6 +81,11 @@ class WasmStreaming::WasmStreamingImpl {
     return true;
   }
 
+  void SetFunctionsToCompileFirst(std::vector<uint32_t> function_indices) {
+    streaming_decoder_->SetFunctionsToCompileFirst(
+        std::move(function_indices));
+  }
+
   void SetMoreFunctionsCanBeSerializedCallback(
       std::function<void(CompiledWasmModule)> callback) {
     streaming_decoder_->SetMoreFunctionsCanBeSerializedCallback(
@@ -128,6 +133,14 @@ bool WasmStreaming::SetCompiledModuleBytes(const uint8_t* bytes, size_t size) {
   return impl_->SetCompiledModuleBytes(base::VectorOf(bytes, size));
 }
 
+void WasmStreaming::SetFunctionsToCompileFirst(
+    MemorySpan<const uint32_t> function_indices) {
+  TRACE_EVENT0("v8.wasm", "wasm.SetFunctionsToCompileFirst");
+  impl_->SetFunctionsToCompileFirst(std::vector<uint32_t>(
+      function_indices.data(),
+      function_indices.data() + function_indices.size()));
+}
+
 void WasmStreaming::SetMoreFunctionsCanBeSerializedCallback(
     std::function<void(CompiledWasmModule)> callback) {
   impl_->SetMoreFunctionsCanBeSerializedCallback(std::move(callback));
@@ -801,6 +801,11 @@ MaybeHandle<WasmMemoryObject> WasmMemoryObject::New(
     heuristic_maximum = initial;
   }
 #else
+  // On 64-bit platforms we reserve address space for the maximum (or the
+  // engine maximum if none is declared) up front, so that memory.grow only
+  // has to change page permissions in {GrowWasmMemoryInPlace} and never has
+  // to reallocate and copy. {AllocateWasmMemory} falls back to smaller
+  // reservations only under address space pressure.
   int heuristic_maximum =
       has_maximum ? std::min(engine_maximum, maximum) : engine_maximum;
 #endif
@@ -932,6 +937,11 @@ int32_t WasmMemoryObject::Grow(Isolate* isolate,
 
   size_t new_pages = old_pages + pages;
   DCHECK_LT(old_pages, new_pages);
+  // Growing in place failed, so the backing store was allocated with a
+  // reservation smaller than the requested size. This only happens on 32-bit
+  // platforms (which reserve conservatively) or when the original reservation
+  // was reduced under address space pressure; on 64-bit hosts the full
+  // maximum is normally reserved and this path is never reached.
   // Try allocating a new backing store and copying.
   // To avoid overall quadratic complexity of many small grow operations, we
   // grow by at least 0.5 MB + 12.5% of the existing memory size.
@@ -860,6 +860,10 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   // TODO(titzer): module features should be part of the serialization format.
   WasmEngine* wasm_engine = GetWasmEngine();
   WasmFeatures enabled_features = WasmFeatures::FromIsolate(isolate);
+  // Note that function bodies are not validated here ({verify_functions} is
+  // false): functions which were serialized as {kLazyFunction} only get a
+  // lazy-compile jump table entry and are validated when they are compiled on
+  // first call, so startup only pays for the functions it actually executes.
   ModuleResult decode_result = DecodeWasmModule(
       enabled_features, owned_wire_bytes.start(), owned_wire_bytes.end(), false,
       i::wasm::kWasmOrigin, isolate->counters(), isolate->metrics_recorder(),
@@ -895,6 +899,10 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
                                            isolate);
       return {};
     }
+    // Set up lazy-compile jump table entries for functions deserialized
+    // without code; their validation and compilation happen on first call.
+    // Functions serialized as {kEagerFunction} are compiled on the
+    // background compile jobs before this returns.
     shared_native_module->compilation_state()->InitializeAfterDeserialization(
         deserializer.lazy_functions(), deserializer.eager_functions());
     wasm_engine->UpdateNativeModuleCache(error, &shared_native_module, isolate);
@@ -12,12 +12,15 @@
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
 #include "src/api/api-inl.h"
+#include "src/builtins/accessors.h"
 #include "src/handles/handles.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/api-callbacks-inl.h"
 #include "src/objects/bigint.h"
 #include "src/objects/contexts-inl.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/managed-inl.h"
 #include "src/objects/script.h"
 
 namespace v8 {
@@ -516,38 +519,55 @@ void WebSnapshotSerializer::WriteSnapshot(uint8_t*& buffer,
       array_buffer_serializer_.buffer_size_ +
       typed_array_serializer_.buffer_size_ +
       data_view_serializer_.buffer_size_ + object_serializer_.buffer_size_ +
-      export_serializer_.buffer_size_ + 14 * sizeof(uint32_t);
+      export_serializer_.buffer_size_ +
+      2 * kSectionCount * sizeof(uint32_t);
   if (total_serializer.ExpandBuffer(needed_size).IsNothing()) {
     Throw("Out of memory");
     return;
   }
 
   total_serializer.WriteRawBytes(kMagicNumber, 4);
-  WriteObjects(total_serializer, string_count(), string_serializer_, "strings");
-  WriteObjects(total_serializer, symbol_count(), symbol_serializer_, "symbols");
-  WriteObjects(total_serializer, bigint_count(), bigint_serializer_, "bigints");
-  WriteObjects(total_serializer, builtin_object_count(),
-               builtin_object_serializer_, "builtin_objects");
-  WriteObjects(total_serializer, map_count(), map_serializer_, "maps");
-  WriteObjects(total_serializer, context_count(), context_serializer_,
-               "contexts");
-  WriteObjects(total_serializer, function_count(), function_serializer_,
-               "functions");
-  WriteObjects(total_serializer, array_count(), array_serializer_, "arrays");
-  WriteObjects(total_serializer, array_buffer_count(), array_buffer_serializer_,
-               "array buffers");
-  WriteObjects(total_serializer, typed_array_count(), typed_array_serializer_,
-               "typed arrays");
-  WriteObjects(total_serializer, data_view_count(), data_view_serializer_,
-               "data views");
-  WriteObjects(total_serializer, object_count(), object_serializer_, "objects");
-  WriteObjects(total_serializer, class_count(), class_serializer_, "classes");
-  WriteObjects(total_serializer, export_count_, export_serializer_, "exports");
+
+  // Reserve space for the table of contents; the section sizes are patched in
+  // below once they are known.
+  uint32_t section_sizes[kSectionCount] = {};
+  size_t toc_offset = total_serializer.buffer_size_;
+  total_serializer.WriteRawBytes(section_sizes, sizeof(section_sizes));
+
+  int section_index = 0;
+  auto write_section = [&](size_t count, ValueSerializer& source,
+                           const char* name) {
+    size_t size_before = total_serializer.buffer_size_;
+    WriteObjects(total_serializer, count, source, name);
+    section_sizes[section_index++] =
+        static_cast<uint32_t>(total_serializer.buffer_size_ - size_before);
+  };
+
+  write_section(string_count(), string_serializer_, "strings");
+  write_section(symbol_count(), symbol_serializer_, "symbols");
+  write_section(bigint_count(), bigint_serializer_, "bigints");
+  write_section(builtin_object_count(), builtin_object_serializer_,
+                "builtin_objects");
+  write_section(map_count(), map_serializer_, "maps");
+  write_section(context_count(), context_serializer_, "contexts");
+  write_section(function_count(), function_serializer_, "functions");
+  write_section(array_count(), array_serializer_, "arrays");
+  write_section(array_buffer_count(), array_buffer_serializer_,
+                "array buffers");
+  write_section(typed_array_count(), typed_array_serializer_, "typed arrays");
+  write_section(data_view_count(), data_view_serializer_, "data views");
+  write_section(object_count(), object_serializer_, "objects");
+  write_section(class_count(), class_serializer_, "classes");
+  write_section(export_count_, export_serializer_, "exports");
+  DCHECK_EQ(kSectionCount, section_index);
 
   if (has_error()) {
     return;
   }
 
+  memcpy(total_serializer.buffer_ + toc_offset, section_sizes,
+         sizeof(section_sizes));
+
   auto result = total_serializer.Release();
   buffer = result.first;
   buffer_size = result.second;
@@ -2312,6 +2332,207 @@ bool WebSnapshotDeserializer::Deserialize(
   return true;
 }
 
+namespace {
+
+// Getter for the lazy accessors installed by DeserializeLazily. The data is a
+// 2-element FixedArray: the Managed<WebSnapshotData> keeping the buffer alive
+// and the FixedArray of export names. On the first access of any export, the
+// whole snapshot is materialized eagerly; the lazy accessors are removed
+// beforehand so that the materializing pass can define the real exports (and
+// so that it cannot re-enter this getter).
+void LazyExportGetter(v8::Local<v8::Name> name,
+                      const v8::PropertyCallbackInfo<v8::Value>& info) {
+  v8::Isolate* v8_isolate = info.GetIsolate();
+  Isolate* isolate = reinterpret_cast<Isolate*>(v8_isolate);
+  HandleScope scope(isolate);
+
+  Handle<FixedArray> accessor_data =
+      Handle<FixedArray>::cast(Utils::OpenHandle(*info.Data()));
+  std::shared_ptr<WebSnapshotData> snapshot_data =
+      Managed<WebSnapshotData>::cast(accessor_data->get(0)).get();
+  Handle<FixedArray> export_names(FixedArray::cast(accessor_data->get(1)),
+                                  isolate);
+
+  Handle<JSGlobalObject> global = isolate->global_object();
+  for (int i = 0; i < export_names->length(); ++i) {
+    Object maybe_name = export_names->get(i);
+    if (!maybe_name.IsString()) continue;
+    Handle<String> export_name(String::cast(maybe_name), isolate);
+    if (JSReceiver::DeleteProperty(global, export_name).IsNothing()) return;
+  }
+
+  WebSnapshotDeserializer deserializer(v8_isolate, snapshot_data->buffer,
+                                       snapshot_data->buffer_size);
+  if (!deserializer.Deserialize()) return;
+
+  Handle<Object> result;
+  if (!Object::GetProperty(isolate, global, Utils::OpenHandle(*name))
+           .ToHandle(&result)) {
+    return;
+  }
+  info.GetReturnValue().Set(Utils::ToLocal(result));
+}
+
+}  // namespace
+
+bool WebSnapshotDeserializer::DeserializeLazily(
+    Handle<Managed<WebSnapshotData>> snapshot_data) {
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize);
+  if (deserialized_) {
+    Throw("Can't reuse WebSnapshotDeserializer");
+    return false;
+  }
+  deserialized_ = true;
+
+  base::ElapsedTimer timer;
+  if (v8_flags.trace_web_snapshot) {
+    timer.Start();
+  }
+
+  const void* magic_bytes;
+  if (!deserializer_->ReadRawBytes(sizeof(kMagicNumber), &magic_bytes) ||
+      memcmp(magic_bytes, kMagicNumber, sizeof(kMagicNumber)) != 0) {
+    Throw("Invalid magic number");
+    return false;
+  }
+  if (!ReadSectionSizes()) {
+    return false;
+  }
+
+  // The export names refer to the string table, so it is the one section
+  // which is materialized eagerly.
+  DeserializeStrings();
+  if (has_error()) {
+    return false;
+  }
+
+  // Skip everything between the strings and the exports.
+  for (int i = 1; i < kSectionCount - 1; ++i) {
+    const void* skipped_bytes;
+    if (!deserializer_->ReadRawBytes(section_sizes_[i], &skipped_bytes)) {
+      Throw("Malformed section table");
+      return false;
+    }
+  }
+
+  if (!InstallLazyExports(snapshot_data)) {
+    return false;
+  }
+
+  if (v8_flags.trace_web_snapshot) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Lazily deserializing snapshot took %0.3f ms]\n", ms);
+  }
+  return true;
+}
+
+bool WebSnapshotDeserializer::InstallLazyExports(
+    Handle<Managed<WebSnapshotData>> snapshot_data) {
+  RCS_SCOPE(isolate_, RuntimeCallCounterId::kWebSnapshotDeserialize_Exports);
+  uint32_t count;
+  if (!ReadCount(count)) {
+    Throw("Malformed export table");
+    return false;
+  }
+
+  Handle<JSGlobalObject> global = isolate_->global_object();
+  Handle<FixedArray> export_names = factory()->NewFixedArray(count);
+  Handle<FixedArray> accessor_data = factory()->NewFixedArray(2);
+  accessor_data->set(0, *snapshot_data);
+  accessor_data->set(1, *export_names);
+
+  for (uint32_t i = 0; i < count; ++i) {
+    Handle<String> export_name(ReadString(InternalizeStrings::kYes), isolate_);
+    if (!SkipValue()) {
+      Throw("Malformed export");
+      return false;
+    }
+    if (export_name->length() == 0 && i == 0) {
+      // The return value (the first export with an empty name) cannot be
+      // produced without materializing the snapshot; it is not supported on
+      // the lazy path.
+      continue;
+    }
+    export_names->set(i, *export_name);
+    Handle<AccessorInfo> accessor_info = Accessors::MakeAccessor(
+        isolate_, export_name, &LazyExportGetter, nullptr);
+    accessor_info->set_data(*accessor_data);
+    if (JSObject::SetAccessor(global, export_name, accessor_info, NONE)
+            .is_null()) {
+      Throw("Failed to install a lazy export");
+      return false;
+    }
+  }
+  return !has_error();
+}
+
+bool WebSnapshotDeserializer::ReadSectionSizes() {
+  const void* toc_bytes;
+  if (!deserializer_->ReadRawBytes(sizeof(section_sizes_), &toc_bytes)) {
+    Throw("Malformed section table");
+    return false;
+  }
+  memcpy(section_sizes_, toc_bytes, sizeof(section_sizes_));
+  size_t total_size = 0;
+  for (int i = 0; i < kSectionCount; ++i) {
+    total_size += section_sizes_[i];
+  }
+  if (total_size >
+      static_cast<size_t>(deserializer_->end_ - deserializer_->position_)) {
+    Throw("Malformed section table");
+    return false;
+  }
+  return true;
+}
+
+// Reads one serialized value and discards it. Used by the lazy path for the
+// export values; they are materialized on demand later.
+bool WebSnapshotDeserializer::SkipValue() {
+  uint8_t value_type;
+  if (!deserializer_->ReadByte(&value_type)) {
+    return false;
+  }
+  switch (value_type) {
+    case ValueType::FALSE_CONSTANT:
+    case ValueType::TRUE_CONSTANT:
+    case ValueType::NULL_CONSTANT:
+    case ValueType::UNDEFINED_CONSTANT:
+    case ValueType::NO_ELEMENT_CONSTANT:
+      return true;
+    case ValueType::INTEGER:
+      return deserializer_->ReadZigZag<int32_t>().IsJust();
+    case ValueType::DOUBLE:
+      return deserializer_->ReadDouble().IsJust();
+    case ValueType::REGEXP: {
+      // The pattern and flags string ids; see ReadRegexp.
+      uint32_t pattern_id;
+      uint32_t flags_id;
+      return deserializer_->ReadUint32(&pattern_id) &&
+             deserializer_->ReadUint32(&flags_id);
+    }
+    case ValueType::IN_PLACE_STRING_ID:
+      ReadInPlaceString();
+      return !has_error();
+    case ValueType::STRING_ID:
+    case ValueType::ARRAY_ID:
+    case ValueType::OBJECT_ID:
+    case ValueType::FUNCTION_ID:
+    case ValueType::CLASS_ID:
+    case ValueType::SYMBOL_ID:
+    case ValueType::EXTERNAL_ID:
+    case ValueType::BUILTIN_OBJECT_ID:
+    case ValueType::ARRAY_BUFFER_ID:
+    case ValueType::TYPED_ARRAY_ID:
+    case ValueType::DATA_VIEW_ID:
+    case ValueType::BIGINT_ID: {
+      uint32_t id;
+      return deserializer_->ReadUint32(&id);
+    }
+    default:
+      return false;
+  }
+}
+
 #ifdef VERIFY_HEAP
 void WebSnapshotDeserializer::VerifyObjects() {
   for (int i = 0; i < strings_.length(); i++) {
@@ -2364,20 +2585,35 @@ bool WebSnapshotDeserializer::DeserializeSnapshot(bool skip_exports) {
     Throw("Invalid magic number");
     return false;
   }
+  if (!ReadSectionSizes()) {
+    return false;
+  }
 
-  DeserializeStrings();
-  DeserializeSymbols();
-  DeserializeBigInts();
-  DeserializeBuiltinObjects();
-  DeserializeMaps();
-  DeserializeContexts();
-  DeserializeFunctions();
-  DeserializeArrays();
-  DeserializeArrayBuffers();
-  DeserializeTypedArrays();
-  DeserializeDataViews();
-  DeserializeObjects();
-  DeserializeClasses();
+  int section_index = 0;
+  auto deserialize_section = [&](void (WebSnapshotDeserializer::*method)()) {
+    const uint8_t* section_start = deserializer_->position_;
+    (this->*method)();
+    if (!has_error() &&
+        static_cast<uint32_t>(deserializer_->position_ - section_start) !=
+            section_sizes_[section_index]) {
+      Throw("Section size mismatch");
+    }
+    ++section_index;
+  };
+
+  deserialize_section(&WebSnapshotDeserializer::DeserializeStrings);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeSymbols);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeBigInts);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeBuiltinObjects);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeMaps);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeContexts);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeFunctions);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeArrays);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeArrayBuffers);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeTypedArrays);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeDataViews);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeObjects);
+  deserialize_section(&WebSnapshotDeserializer::DeserializeClasses);
   ProcessDeferredReferences();
   DeserializeExports(skip_exports);
   DCHECK_EQ(0, deferred_references_->Length());
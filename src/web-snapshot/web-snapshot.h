@@ -27,6 +27,9 @@ class Map;
 class Object;
 class String;
 
+template <typename T>
+class Managed;
+
 struct WebSnapshotData : public std::enable_shared_from_this<WebSnapshotData> {
   uint8_t* buffer = nullptr;
   size_t buffer_size = 0;
@@ -95,6 +98,14 @@ class WebSnapshotSerializerDeserializer {
 
   static constexpr uint8_t kMagicNumber[4] = {'+', '+', '+', ';'};
 
+  // The magic number is followed by a table of contents: one fixed-width
+  // uint32 byte length per section, in the order the sections appear in the
+  // snapshot (strings, symbols, bigints, builtin objects, maps, contexts,
+  // functions, arrays, array buffers, typed arrays, data views, objects,
+  // classes, exports). The table lets the deserializer verify section
+  // boundaries and skip ahead to the exports without materializing anything.
+  static constexpr int kSectionCount = 14;
+
   enum ContextType : uint8_t { FUNCTION, BLOCK };
 
   enum PropertyAttributesType : uint8_t { DEFAULT, CUSTOM };
@@ -448,6 +459,14 @@ class V8_EXPORT WebSnapshotDeserializer
   bool Deserialize(MaybeHandle<FixedArray> external_references = {},
                    bool skip_exports = false);
 
+  // Instead of materializing the snapshot, installs a lazy accessor on the
+  // global object for each export. The accessor materializes the whole
+  // snapshot on the first access of any export. Only the string table is
+  // deserialized eagerly (the export names refer to it); |snapshot_data|
+  // keeps the snapshot buffer alive until then. External references and the
+  // return-value export are not supported on this path.
+  bool DeserializeLazily(Handle<Managed<WebSnapshotData>> snapshot_data);
+
   // For inspecting the state after deserializing a snapshot.
   uint32_t string_count() const { return string_count_; }
   uint32_t symbol_count() const { return symbol_count_; }
@@ -510,6 +529,9 @@ class V8_EXPORT WebSnapshotDeserializer
   void DeserializeObjectElements(Handle<JSObject> object,
                                  bool map_from_snapshot);
   void DeserializeExports(bool skip_exports);
+  bool ReadSectionSizes();
+  bool SkipValue();
+  bool InstallLazyExports(Handle<Managed<WebSnapshotData>> snapshot_data);
   void DeserializeObjectPrototype(Handle<Map> map);
   Handle<Map> DeserializeObjectPrototypeAndCreateEmptyMap();
   void DeserializeObjectPrototypeForFunction(Handle<JSFunction> function);
@@ -660,6 +682,8 @@ class V8_EXPORT WebSnapshotDeserializer
   std::unique_ptr<const uint8_t[]> owned_data_;
   ReadOnlyRoots roots_;
 
+  uint32_t section_sizes_[kSectionCount] = {};
+
   bool deserialized_ = false;
 };
 
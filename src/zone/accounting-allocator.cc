@@ -6,9 +6,12 @@
 
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/utils/allocation.h"
 #include "src/zone/zone-compression.h"
 #include "src/zone/zone-segment.h"
@@ -64,6 +67,85 @@ std::unique_ptr<v8::base::BoundedPageAllocator> CreateBoundedAllocator(
   return allocator;
 }
 
+// A process-wide pool of recycled zone segments, shared by the
+// {AccountingAllocator}s of all isolates. Parsing and compiling create and
+// destroy zones at a high rate; recycling their segments keeps most of that
+// churn away from the system allocator. Segments are kept in power-of-two
+// size classes such that every segment in class {k} can serve any request of
+// at most {2^k} bytes, and the total amount of pooled memory is bounded.
+class SegmentPool final {
+ public:
+  // Removes and returns a pooled segment of at least {bytes} bytes, or
+  // nullptr if no suitable segment is pooled.
+  Segment* Remove(size_t bytes) {
+    int size_class = SizeClassForRequest(bytes);
+    if (size_class < 0) return nullptr;
+    base::MutexGuard lock_guard(&mutex_);
+    Segment* segment = free_lists_[size_class - kMinSegmentSizePower];
+    if (segment == nullptr) return nullptr;
+    free_lists_[size_class - kMinSegmentSizePower] = segment->next();
+    DCHECK_LE(bytes, segment->total_size());
+    pooled_bytes_ -= segment->total_size();
+    return segment;
+  }
+
+  // Tries to add {segment} to the pool. Returns false if the segment does not
+  // fit any size class or the pool is full; the caller is then responsible
+  // for releasing the segment.
+  bool Add(Segment* segment) {
+    size_t size = segment->total_size();
+    int size_class = SizeClassForSegment(size);
+    if (size_class < 0) return false;
+    base::MutexGuard lock_guard(&mutex_);
+    if (pooled_bytes_ + size > kMaxPooledBytes) return false;
+    segment->set_next(free_lists_[size_class - kMinSegmentSizePower]);
+    free_lists_[size_class - kMinSegmentSizePower] = segment;
+    pooled_bytes_ += size;
+    return true;
+  }
+
+ private:
+  // Pool segments between 8 KB ({Zone::kMinimumSegmentSize}) and 256 KB, and
+  // at most 8 MB in total. Larger segments are rare one-off allocations and
+  // go straight back to the system allocator.
+  static constexpr int kMinSegmentSizePower = 13;
+  static constexpr int kMaxSegmentSizePower = 18;
+  static constexpr size_t kMaxPooledBytes = 8 * MB;
+  static constexpr int kNumSizeClasses =
+      kMaxSegmentSizePower - kMinSegmentSizePower + 1;
+
+  // The size class whose segments are all large enough to serve a request of
+  // {bytes} bytes (i.e. the exponent rounded up), or -1 if the request is too
+  // large to be served from the pool.
+  static int SizeClassForRequest(size_t bytes) {
+    DCHECK_LT(0, bytes);
+    int size_class =
+        64 - base::bits::CountLeadingZeros(static_cast<uint64_t>(bytes - 1));
+    if (size_class < kMinSegmentSizePower) size_class = kMinSegmentSizePower;
+    if (size_class > kMaxSegmentSizePower) return -1;
+    return size_class;
+  }
+
+  // The size class a segment of {size} bytes is inserted into: the exponent
+  // rounded down, so every member of a class is at least as large as the
+  // class size. The system allocator may over-allocate, hence sizes are not
+  // necessarily powers of two.
+  static int SizeClassForSegment(size_t size) {
+    DCHECK_LT(0, size);
+    int size_class =
+        63 - base::bits::CountLeadingZeros(static_cast<uint64_t>(size));
+    if (size_class < kMinSegmentSizePower) return -1;
+    if (size_class > kMaxSegmentSizePower) size_class = kMaxSegmentSizePower;
+    return size_class;
+  }
+
+  base::Mutex mutex_;
+  Segment* free_lists_[kNumSizeClasses] = {nullptr};
+  size_t pooled_bytes_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SegmentPool, GetSegmentPool)
+
 }  // namespace
 
 AccountingAllocator::AccountingAllocator()
@@ -90,6 +172,9 @@ Segment* AccountingAllocator::AllocateSegment(size_t bytes,
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
 
+  } else if (Segment* pooled = GetSegmentPool()->Remove(bytes)) {
+    memory = pooled;
+    bytes = pooled->total_size();
   } else {
     auto result = AllocAtLeastWithRetry(bytes);
     memory = result.ptr;
@@ -113,10 +198,14 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
+    segment->ZapHeader();
     FreePages(bounded_page_allocator_.get(), segment, segment_size);
   } else {
+    // The pool needs the header ({size_} and {next_}) intact, so only zap it
+    // when the segment is actually released.
+    if (GetSegmentPool()->Add(segment)) return;
+    segment->ZapHeader();
     free(segment);
   }
 }
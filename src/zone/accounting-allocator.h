@@ -31,11 +31,12 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   AccountingAllocator& operator=(const AccountingAllocator&) = delete;
   virtual ~AccountingAllocator();
 
-  // Allocates a new segment. Returns nullptr on failed allocation.
+  // Allocates a new segment, reusing a pooled one if possible. Returns
+  // nullptr on failed allocation.
   Segment* AllocateSegment(size_t bytes, bool supports_compression);
 
-  // Return unneeded segments to either insert them into the pool or release
-  // them if the pool is already full or memory pressure is high.
+  // Return unneeded segments to either insert them into the process-wide
+  // segment pool or release them if the pool is already full.
   void ReturnSegment(Segment* memory, bool supports_compression);
 
   size_t GetCurrentMemoryUsage() const {
@@ -0,0 +1,189 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmark harness for the embedder-facing hot paths: handle creation,
+// property reads through Object::Get, calls through Function::Call, code
+// cache serialization, and full GC pauses. Each benchmark prints one JSON
+// line so that runs can be stored as baselines and diffed across releases.
+//
+// The harness only uses the public API and carries its own timing loop so
+// that it can be built against an installed library without any test
+// scaffolding.
+
+#include <stdio.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-context.h"
+#include "include/v8-function.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+class Timer {
+ public:
+  Timer() : start_(Clock::now()) {}
+  double ElapsedMs() const {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start_)
+        .count();
+  }
+
+ private:
+  Clock::time_point start_;
+};
+
+void Report(const char* name, size_t iterations, double total_ms) {
+  printf(
+      "{\"name\": \"%s\", \"iterations\": %zu, \"total_ms\": %.3f, "
+      "\"ns_per_iteration\": %.1f}\n",
+      name, iterations, total_ms, total_ms * 1e6 / iterations);
+  fflush(stdout);
+}
+
+v8::Local<v8::Value> CompileRun(v8::Local<v8::Context> context,
+                                const char* source) {
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(
+          context,
+          v8::String::NewFromUtf8(isolate, source).ToLocalChecked())
+          .ToLocalChecked();
+  return script->Run(context).ToLocalChecked();
+}
+
+// Creation of local handles from a persistent handle. This is the pure API
+// boundary cost that every embedder callback pays before touching V8.
+void BenchHandleCreation(v8::Isolate* isolate,
+                         v8::Local<v8::Context> context) {
+  constexpr size_t kIterations = 1000000;
+  v8::Global<v8::Object> persistent(isolate, context->Global());
+  Timer timer;
+  for (size_t i = 0; i < kIterations; i++) {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Object> local = v8::Local<v8::Object>::New(isolate,
+                                                             persistent);
+    if (local.IsEmpty()) break;
+  }
+  Report("handle_creation", kIterations, timer.ElapsedMs());
+}
+
+// Property reads through Object::Get with an interned string key.
+void BenchObjectGet(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+  constexpr size_t kIterations = 1000000;
+  v8::Local<v8::Object> object =
+      CompileRun(context, "({a: 1, b: 'two', c: {}, d: 4.5})").As<v8::Object>();
+  v8::Local<v8::String> key = v8::String::NewFromUtf8Literal(
+      isolate, "b", v8::NewStringType::kInternalized);
+  Timer timer;
+  for (size_t i = 0; i < kIterations; i++) {
+    v8::HandleScope scope(isolate);
+    if (object->Get(context, key).IsEmpty()) break;
+  }
+  Report("object_get", kIterations, timer.ElapsedMs());
+}
+
+// Calls from the embedder into a JS function through Function::Call.
+void BenchFunctionCall(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+  constexpr size_t kIterations = 1000000;
+  v8::Local<v8::Function> function =
+      CompileRun(context, "(function add(a, b) { return a + b; })")
+          .As<v8::Function>();
+  v8::Local<v8::Value> receiver = v8::Undefined(isolate);
+  Timer timer;
+  for (size_t i = 0; i < kIterations; i++) {
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Value> args[] = {v8::Integer::New(isolate, 1),
+                                   v8::Integer::New(isolate, 2)};
+    if (function->Call(context, receiver, 2, args).IsEmpty()) break;
+  }
+  Report("function_call", kIterations, timer.ElapsedMs());
+}
+
+// Code cache production for a mid-sized script, approximating the serializer
+// throughput an embedder sees when persisting compilation results.
+void BenchCodeCacheCreate(v8::Isolate* isolate,
+                          v8::Local<v8::Context> context) {
+  constexpr size_t kIterations = 100;
+  std::string source;
+  for (int i = 0; i < 200; i++) {
+    source += "function f" + std::to_string(i) +
+              "(x) { return x * " + std::to_string(i) + " + 1; }\n";
+  }
+  source += "f0(1);";
+  v8::ScriptCompiler::Source script_source(
+      v8::String::NewFromUtf8(isolate, source.c_str()).ToLocalChecked());
+  v8::Local<v8::UnboundScript> script =
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate, &script_source, v8::ScriptCompiler::kEagerCompile)
+          .ToLocalChecked();
+  script->BindToCurrentContext()->Run(context).ToLocalChecked();
+  Timer timer;
+  for (size_t i = 0; i < kIterations; i++) {
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+        v8::ScriptCompiler::CreateCodeCache(script));
+    if (!cache) break;
+  }
+  Report("code_cache_create", kIterations, timer.ElapsedMs());
+}
+
+// Full GC pause over a retained object graph. LowMemoryNotification performs
+// a synchronous garbage collection, so the wall time per iteration is the
+// pause an embedder would observe.
+void BenchFullGcPause(v8::Isolate* isolate, v8::Local<v8::Context> context) {
+  constexpr size_t kIterations = 10;
+  CompileRun(context,
+             "globalThis.retained = [];"
+             "for (let i = 0; i < 100000; i++) {"
+             "  retained.push({index: i, payload: 'value' + i});"
+             "}");
+  Timer timer;
+  for (size_t i = 0; i < kIterations; i++) {
+    isolate->LowMemoryNotification();
+  }
+  Report("full_gc_pause", kIterations, timer.ElapsedMs());
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    BenchHandleCreation(isolate, context);
+    BenchObjectGet(isolate, context);
+    BenchFunctionCall(isolate, context);
+    BenchCodeCacheCreate(isolate, context);
+    BenchFullGcPause(isolate, context);
+  }
+
+  isolate->Dispose();
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  delete create_params.array_buffer_allocator;
+  return 0;
+}
@@ -244,6 +244,65 @@ TEST(HandleNull) {
 }
 
 
+TEST(SmiStringTable) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Strings for small non-negative integers come from the pre-allocated
+  // read-only table and are therefore internalized, canonical and carry an
+  // array index hash.
+  Handle<String> str = factory->SmiToString(Smi::FromInt(42));
+  CHECK(ReadOnlyHeap::Contains(*str));
+  CHECK(str->IsInternalizedString());
+  CHECK(str->IsOneByteEqualTo(base::StaticCharVector("42")));
+  uint32_t index;
+  CHECK(str->AsArrayIndex(&index));
+  CHECK_EQ(index, 42u);
+  CHECK_EQ(*str, *factory->SmiToString(Smi::FromInt(42)));
+  CHECK_EQ(*str, *factory->NumberToString(handle(Smi::FromInt(42), isolate)));
+
+  // Larger and negative values still go through the number string cache.
+  Handle<String> large = factory->SmiToString(Smi::FromInt(123456));
+  CHECK(!ReadOnlyHeap::Contains(*large));
+  CHECK(large->IsOneByteEqualTo(base::StaticCharVector("123456")));
+  Handle<String> negative = factory->SmiToString(Smi::FromInt(-7));
+  CHECK(!ReadOnlyHeap::Contains(*negative));
+  CHECK(negative->IsOneByteEqualTo(base::StaticCharVector("-7")));
+}
+
+TEST(FactoryAllocationBatch) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  const int kLength = 8;
+  const int kSize = ALIGN_TO_ALLOCATION_ALIGNMENT(FixedArray::SizeFor(kLength));
+  Handle<FixedArray> first;
+  Handle<FixedArray> second;
+  Handle<FixedArray> overflow;
+  {
+    Factory::Batch batch(isolate, 2 * kSize, AllocationType::kYoung);
+    first = factory->NewFixedArray(kLength, AllocationType::kYoung);
+    second = factory->NewFixedArray(kLength, AllocationType::kYoung);
+    // Both arrays are carved out of the same reservation.
+    CHECK_EQ(first->address() + kSize, second->address());
+    // An allocation that does not fit the exhausted reservation falls through
+    // to the regular allocator.
+    overflow = factory->NewFixedArray(kLength, AllocationType::kYoung);
+    CHECK(!overflow.is_null());
+  }
+  first->set(0, *second);
+  second->set(0, *first);
+
+  // The carved objects are ordinary heap objects and survive a full GC.
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(first->get(0), *second);
+  CHECK_EQ(second->get(0), *first);
+}
+
 TEST(HeapObjects) {
   CcTest::InitializeVM();
   Isolate* isolate = CcTest::i_isolate();
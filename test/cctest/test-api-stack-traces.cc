@@ -940,3 +940,41 @@ TEST(CurrentScriptNameOrSourceURL_SourceURL) {
 
   CHECK(CompileRunWithOrigin(source, "")->IsUndefined());
 }
+
+TEST(LazyErrorStackFramesMaterializeOnAccess) {
+  i::v8_flags.lazy_error_stack_frames = true;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<Value> error =
+      CompileRun("(function one() { return new Error('test'); })()");
+  i::Handle<i::JSReceiver> i_error =
+      v8::Utils::OpenHandle(*error.As<v8::Object>());
+  i::Isolate* i_isolate = CcTest::i_isolate();
+
+  // The freshly captured stack trace is stored in compact form, which is
+  // recognizable by the Smi-encoded flags of its first frame record.
+  i::Handle<i::Object> raw_stack = i::JSReceiver::GetDataProperty(
+      i_isolate, i_error, i_isolate->factory()->error_stack_symbol());
+  CHECK(raw_stack->IsFixedArray());
+  i::Handle<i::FixedArray> compact = i::Handle<i::FixedArray>::cast(raw_stack);
+  CHECK_GT(compact->length(), 0);
+  CHECK(compact->get(0).IsSmi());
+
+  // CallSiteInfo objects are only materialized on first access.
+  i::Handle<i::FixedArray> infos = i_isolate->GetSimpleStackTrace(i_error);
+  CHECK_GT(infos->length(), 0);
+  CHECK_LT(infos->length(), compact->length());
+  for (int i = 0; i < infos->length(); ++i) {
+    CHECK(infos->get(i).IsCallSiteInfo());
+  }
+
+  // Formatting still sees the captured frames.
+  v8::Local<Value> stack =
+      error.As<v8::Object>()
+          ->Get(context.local(), v8_str("stack"))
+          .ToLocalChecked();
+  v8::String::Utf8Value stack_utf8(isolate, stack);
+  CHECK_NOT_NULL(strstr(*stack_utf8, "at one"));
+}
@@ -27,6 +27,7 @@
 
 #include "test/cctest/test-api.h"
 
+#include <atomic>
 #include <climits>
 #include <csignal>
 #include <map>
@@ -900,6 +901,42 @@ TEST(ScavengeExternalOneByteString) {
 }
 
 
+TEST(NewExternalOneByteFromBackingStore) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const char* payload = "GET /index.html HTTP/1.1";
+  size_t payload_length = strlen(payload);
+  Local<v8::ArrayBuffer> buffer =
+      v8::ArrayBuffer::New(isolate, payload_length + 8);
+  std::shared_ptr<v8::BackingStore> backing_store = buffer->GetBackingStore();
+  memcpy(static_cast<uint8_t*>(backing_store->Data()) + 4, payload,
+         payload_length);
+
+  Local<String> string = String::NewExternalOneByteFromBackingStore(
+                             isolate, backing_store, 4, payload_length)
+                             .ToLocalChecked();
+  CHECK(string->IsExternalOneByte());
+  String::Utf8Value utf8(isolate, string);
+  CHECK_EQ(0, strcmp(payload, *utf8));
+
+  // The string holds a reference to the backing store, so detaching the
+  // buffer and dropping the local reference must not invalidate it.
+  CHECK(buffer->IsDetachable());
+  buffer->Detach();
+  backing_store.reset();
+  String::Utf8Value after_detach(isolate, string);
+  CHECK_EQ(0, strcmp(payload, *after_detach));
+
+  // Zero-length views come back as the empty string.
+  Local<v8::ArrayBuffer> other_buffer = v8::ArrayBuffer::New(isolate, 8);
+  Local<String> empty = String::NewExternalOneByteFromBackingStore(
+                            isolate, other_buffer->GetBackingStore(), 8, 0)
+                            .ToLocalChecked();
+  CHECK_EQ(0, empty->Length());
+}
+
 class TestOneByteResourceWithDisposeControl : public TestOneByteResource {
  public:
   // Only used by non-threaded tests, so it can use static fields.
@@ -4249,6 +4286,73 @@ TEST(TwoPassPhantomCallbacksTriggeredByStringAlloc) {
 
 namespace {
 
+std::atomic<int> thread_safe_second_pass_calls{0};
+
+struct ThreadSafeCallbackData {
+  v8::Global<v8::String> cell;
+};
+
+void ThreadSafeSecondPassCallback(
+    const v8::WeakCallbackInfo<ThreadSafeCallbackData>& data) {
+  // Thread-safe second pass callbacks must not touch the isolate; only
+  // release the embedder-side allocation.
+  delete data.GetParameter();
+  thread_safe_second_pass_calls++;
+}
+
+void ThreadSafeFirstPassCallback(
+    const v8::WeakCallbackInfo<ThreadSafeCallbackData>& data) {
+  data.GetParameter()->cell.Reset();
+  data.SetThreadSafeSecondPassCallback(ThreadSafeSecondPassCallback);
+}
+
+}  // namespace
+
+TEST(ThreadSafeTwoPassPhantomCallbacks) {
+  auto isolate = CcTest::isolate();
+  const int kLength = 20;
+  thread_safe_second_pass_calls = 0;
+  {
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < kLength; ++i) {
+      auto data = new ThreadSafeCallbackData;
+      data->cell.Reset(isolate, v8_str("value"));
+      data->cell.SetWeak(data, ThreadSafeFirstPassCallback,
+                         v8::WeakCallbackType::kParameter);
+    }
+  }
+  // Forced GCs process the second pass synchronously, so by the time the GC
+  // returns the fence is clear and every callback has run.
+  CcTest::CollectAllGarbage();
+  CHECK(!isolate->HasPendingThreadSafeSecondPassCallbacks());
+  CHECK_EQ(kLength, thread_safe_second_pass_calls.load());
+  EmptyMessageQueues(isolate);
+}
+
+TEST(PinImmutableObjectGraph) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var config = {a: 1, b: 'payload', c: [1, 2, 3], d: {e: 2.5}};"
+      "Object.freeze(config.c);"
+      "Object.freeze(config.d);"
+      "Object.freeze(config);");
+  CHECK(isolate->TryPinImmutableObjectGraph(CompileRun("config")));
+  // Not deeply frozen: the nested object is still extensible.
+  CompileRun("var partial = {x: {}}; Object.freeze(partial);");
+  CHECK(!isolate->TryPinImmutableObjectGraph(CompileRun("partial")));
+  // Functions carry mutable state and cannot be pinned.
+  CompileRun("var with_fn = {f: function() {}}; Object.freeze(with_fn);");
+  CHECK(!isolate->TryPinImmutableObjectGraph(CompileRun("with_fn")));
+  // The pinned graph survives GC intact.
+  CcTest::CollectAllGarbage();
+  v8::Local<v8::Value> value = CompileRun("config.c[2] + config.d.e");
+  CHECK_EQ(5.5, value.As<v8::Number>()->Value());
+}
+
+namespace {
+
 void* IntKeyToVoidPointer(int key) { return reinterpret_cast<void*>(key << 1); }
 
 
@@ -4903,6 +5007,38 @@ THREADED_TEST(GetSetProperty) {
 }
 
 
+THREADED_TEST(ObjectGetMany) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj = CompileRun(
+                              "({a: 1, b: 'two', 3: true,"
+                              "  get computed() { return this.a + 41; },"
+                              "  get throwing() { throw 'boom'; }})")
+                              .As<v8::Object>();
+  Local<Value> keys[] = {v8_str("a"), v8_str("b"), v8_num(3),
+                         v8_str("computed"), v8_str("missing")};
+  Local<Value> values[arraysize(keys)];
+  CHECK(obj->GetMany(context.local(), keys, arraysize(keys), values)
+            .FromJust());
+  CHECK_EQ(1, values[0]->Int32Value(context.local()).FromJust());
+  CHECK(values[1]->StrictEquals(v8_str("two")));
+  CHECK(values[2]->IsTrue());
+  CHECK_EQ(42, values[3]->Int32Value(context.local()).FromJust());
+  CHECK(values[4]->IsUndefined());
+
+  // A throwing getter aborts the batch and reports failure.
+  Local<Value> throwing_keys[] = {v8_str("a"), v8_str("throwing")};
+  Local<Value> throwing_values[arraysize(throwing_keys)];
+  v8::TryCatch try_catch(isolate);
+  CHECK(obj->GetMany(context.local(), throwing_keys, arraysize(throwing_keys),
+                     throwing_values)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(try_catch.Exception()->StrictEquals(v8_str("boom")));
+}
+
+
 THREADED_TEST(PropertyAttributes) {
   LocalContext context;
   v8::HandleScope scope(context->GetIsolate());
@@ -8616,6 +8752,44 @@ THREADED_TEST(Utf16Symbol) {
 }
 
 
+THREADED_TEST(NewFromUtf8Batch) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const char* keys[] = {"id", "method", "params", "S\xC3\xB8ren", ""};
+  constexpr size_t kCount = arraysize(keys);
+  Local<String> batch[kCount];
+  CHECK(v8::String::NewFromUtf8Batch(isolate, keys, nullptr, kCount, batch));
+
+  // Each result is the same internalized string that a one-at-a-time call
+  // produces.
+  for (size_t i = 0; i < kCount; i++) {
+    Local<String> single =
+        v8::String::NewFromUtf8(isolate, keys[i],
+                                v8::NewStringType::kInternalized)
+            .ToLocalChecked();
+    CHECK(SameSymbol(batch[i], single));
+  }
+
+  // Explicit lengths allow embedded NULs and substrings.
+  const char* data[] = {"methodName", "a\0b"};
+  int lengths[] = {6, 3};
+  Local<String> sliced[2];
+  CHECK(v8::String::NewFromUtf8Batch(isolate, data, lengths, 2, sliced));
+  CHECK(SameSymbol(sliced[0], v8_str("method")));
+  CHECK_EQ(3, sliced[1]->Length());
+
+  // Over-long inputs fail the whole batch without touching the output.
+  const char* bad_data[] = {"ok"};
+  int bad_lengths[] = {v8::String::kMaxLength + 1};
+  Local<String> unused[1];
+  CHECK(!v8::String::NewFromUtf8Batch(isolate, bad_data, bad_lengths, 1,
+                                      unused));
+  CHECK(unused[0].IsEmpty());
+}
+
+
 THREADED_TEST(Utf16MissingTrailing) {
   LocalContext context;
   v8::HandleScope scope(context->GetIsolate());
@@ -14592,6 +14766,83 @@ TEST(ObjectClone) {
 }
 
 
+TEST(ObjectDeepClone) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  const char* sample =
+      "var rv = {};"
+      "rv.nested = {alpha: 'hello', numbers: [1, 2.5, {beta: 3}]};"
+      "rv.fn = function() { return 42; };"
+      "rv;";
+
+  Local<Value> val = CompileRun(sample);
+  CHECK(val->IsObject());
+  Local<v8::Object> obj = val.As<v8::Object>();
+
+  Local<v8::Object> clone = obj->DeepClone(env.local()).ToLocalChecked();
+
+  // Nested objects and arrays are copied, not shared.
+  Local<Value> nested = obj->Get(env.local(), v8_str("nested")).ToLocalChecked();
+  Local<Value> nested_clone =
+      clone->Get(env.local(), v8_str("nested")).ToLocalChecked();
+  CHECK(nested_clone->IsObject());
+  CHECK(!nested->StrictEquals(nested_clone));
+
+  // Mutating the clone's nested graph must not affect the original.
+  CHECK(nested_clone.As<v8::Object>()
+            ->Set(env.local(), v8_str("alpha"), v8_str("changed"))
+            .FromJust());
+  CHECK(v8_str("hello")
+            ->Equals(env.local(), nested.As<v8::Object>()
+                                      ->Get(env.local(), v8_str("alpha"))
+                                      .ToLocalChecked())
+            .FromJust());
+
+  // Values other than plain objects and arrays are shared.
+  Local<Value> fn = obj->Get(env.local(), v8_str("fn")).ToLocalChecked();
+  Local<Value> fn_clone = clone->Get(env.local(), v8_str("fn")).ToLocalChecked();
+  CHECK(fn->StrictEquals(fn_clone));
+
+  // Cyclic graphs fail with an exception instead of crashing.
+  CompileRun("rv.cycle = {}; rv.cycle.back = rv.cycle;");
+  v8::TryCatch try_catch(isolate);
+  CHECK(obj->DeepClone(env.local()).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
+
+TEST(ObjectDeclareShape) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::Name> names[] = {v8_str("alpha"), v8_str("beta")};
+  Local<Value> values[] = {v8_num(1), v8_str("x")};
+  v8::Object::DeclareShape(env.local(), names, values, 2);
+
+  // An object built with the same property insertion order must land on the
+  // pre-built transition chain: fast properties, all descriptors in place,
+  // and no deprecation caused by mispredicted representations.
+  Local<Value> val =
+      CompileRun("var o = {}; o.alpha = 2; o.beta = 'y'; o");
+  CHECK(val->IsObject());
+  i::Handle<i::JSObject> obj = i::Handle<i::JSObject>::cast(
+      v8::Utils::OpenHandle(*val.As<v8::Object>()));
+  CHECK(obj->HasFastProperties());
+  CHECK_EQ(2, obj->map().NumberOfOwnDescriptors());
+  CHECK(!obj->map().is_deprecated());
+
+  // Two objects with the same shape share the map.
+  Local<Value> val2 =
+      CompileRun("var o2 = {}; o2.alpha = 3; o2.beta = 'z'; o2");
+  i::Handle<i::JSObject> obj2 = i::Handle<i::JSObject>::cast(
+      v8::Utils::OpenHandle(*val2.As<v8::Object>()));
+  CHECK_EQ(obj->map(), obj2->map());
+}
+
+
 class OneByteVectorResource : public v8::String::ExternalOneByteStringResource {
  public:
   explicit OneByteVectorResource(v8::base::Vector<const char> vector)
@@ -14896,6 +15147,59 @@ TEST(CreateDataProperty) {
 }
 
 
+TEST(CreateDataProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  CompileRun(
+      "var a = {};"
+      "Object.defineProperty(a, 'foo', {value: 23});");
+
+  v8::Local<v8::Object> obj = v8::Local<v8::Object>::Cast(
+      env->Global()->Get(env.local(), v8_str("a")).ToLocalChecked());
+  {
+    // Define a batch of regular properties.
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Name> keys[] = {v8_str("x"), v8_str("y"), v8_str("z")};
+    v8::Local<v8::Value> values[] = {v8::Integer::New(isolate, 1),
+                                     v8::Integer::New(isolate, 2),
+                                     v8::Integer::New(isolate, 3)};
+    CHECK(obj->CreateDataProperties(env.local(), keys, values, 3).FromJust());
+    CHECK(!try_catch.HasCaught());
+    for (int i = 0; i < 3; i++) {
+      v8::Local<v8::Value> val =
+          obj->Get(env.local(), keys[i]).ToLocalChecked();
+      CHECK(val->IsNumber());
+      CHECK_EQ(i + 1.0, val->NumberValue(env.local()).FromJust());
+    }
+  }
+
+  {
+    // The batch stops at the first property that can't be defined; earlier
+    // properties stay defined.
+    v8::TryCatch try_catch(isolate);
+    v8::Local<v8::Name> keys[] = {v8_str("before"), v8_str("foo"),
+                                  v8_str("after")};
+    v8::Local<v8::Value> values[] = {v8::Integer::New(isolate, 1),
+                                     v8::Integer::New(isolate, 2),
+                                     v8::Integer::New(isolate, 3)};
+    CHECK(!obj->CreateDataProperties(env.local(), keys, values, 3).FromJust());
+    CHECK(!try_catch.HasCaught());
+    CHECK(obj->Has(env.local(), v8_str("before")).FromJust());
+    CHECK(!obj->Has(env.local(), v8_str("after")).FromJust());
+  }
+
+  {
+    // An empty batch trivially succeeds.
+    v8::TryCatch try_catch(isolate);
+    CHECK(obj->CreateDataProperties(env.local(), nullptr, nullptr, 0)
+              .FromJust());
+    CHECK(!try_catch.HasCaught());
+  }
+}
+
+
 TEST(DefineOwnProperty) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -20727,6 +21031,45 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+
+  {
+    // A document split into chunks, with the two-byte UTF-8 sequence for
+    // U+00E9 ("\xC3\xA9") split across the chunk boundary.
+    v8::JSON::StreamingParser parser(isolate);
+    const char* chunk1 = "{\"x\": \"a\xC3";
+    const char* chunk2 = "\xA9\", \"y\": [1, 2]}";
+    parser.Append(chunk1, strlen(chunk1));
+    parser.Append(chunk2, strlen(chunk2));
+    Local<Value> obj = parser.Parse(context.local()).ToLocalChecked();
+    Local<Object> global = context->Global();
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectString("obj.x", "a\xC3\xA9");
+    ExpectString("JSON.stringify(obj.y)", "[1,2]");
+  }
+
+  {
+    // A truncated document throws the same SyntaxError as JSON.parse.
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::StreamingParser parser(isolate);
+    const char* chunk = "{\"x\": ";
+    parser.Append(chunk, strlen(chunk));
+    CHECK(parser.Parse(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+
+  {
+    // No appended input parses like the empty string.
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::StreamingParser parser(isolate);
+    CHECK(parser.Parse(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -24878,6 +25221,42 @@ TEST(Map) {
 }
 
 
+TEST(MapNewWithExpectedSize) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  LocalContext env;
+
+  v8::Local<v8::Map> map = v8::Map::New(isolate, 1000);
+  CHECK(map->IsMap());
+  CHECK_EQ(0U, map->Size());
+
+  // The pre-sized backing store must hold the hinted number of entries
+  // without being replaced by a grown table.
+  i::Handle<i::JSMap> i_map =
+      i::Handle<i::JSMap>::cast(v8::Utils::OpenHandle(*map));
+  i::Handle<i::Object> table_before(i_map->table(), CcTest::i_isolate());
+
+  for (int i = 0; i < 1000; i++) {
+    CHECK(!map->Set(env.local(), v8::Integer::New(isolate, i),
+                    v8::Integer::New(isolate, i * 2))
+               .IsEmpty());
+  }
+  CHECK_EQ(1000U, map->Size());
+  CHECK_EQ(*table_before, i_map->table());
+
+  CHECK_EQ(42, map->Get(env.local(), v8::Integer::New(isolate, 21))
+                   .ToLocalChecked()
+                   ->Int32Value(env.local())
+                   .FromJust());
+
+  // An oversized hint is clamped instead of failing.
+  v8::Local<v8::Map> clamped =
+      v8::Map::New(isolate, std::numeric_limits<size_t>::max());
+  CHECK(clamped->IsMap());
+  CHECK_EQ(0U, clamped->Size());
+}
+
+
 TEST(Set) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope handle_scope(isolate);
@@ -29062,6 +29441,12 @@ class MetricsRecorder : public v8::metrics::Recorder {
     ++count_;
     module_count_ = event.count;
   }
+
+  void AddMainThreadEvent(const v8::metrics::FunctionCompiled& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    function_events_.push_back(event);
+  }
+  std::vector<v8::metrics::FunctionCompiled> function_events_;
 };
 
 }  // namespace
@@ -29104,6 +29489,32 @@ TEST(TriggerMainThreadMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Unchanged.
 }
 
+TEST(FunctionCompiledMetricsEvent) {
+  v8::Isolate* iso = CcTest::isolate();
+  std::shared_ptr<MetricsRecorder> recorder =
+      std::make_shared<MetricsRecorder>(iso);
+  iso->SetMetricsRecorder(recorder);
+
+  v8::HandleScope scope(iso);
+  LocalContext env;
+  CompileRun("function add_one(a) { return a + 1; } add_one(1);");
+
+  // At least the top-level script and the lazily compiled function must have
+  // been reported.
+  CHECK_LE(2u, recorder->function_events_.size());
+  bool found_inner_function = false;
+  for (const v8::metrics::FunctionCompiled& event :
+       recorder->function_events_) {
+    CHECK(event.tier >= 0 && event.tier <= 3);
+    CHECK_LE(0, event.script_id);
+    CHECK_LE(0, event.start_position);
+    CHECK_LT(event.start_position, event.end_position);
+    CHECK_LE(0, event.wall_clock_duration_in_us);
+    if (event.start_position > 0) found_inner_function = true;
+  }
+  CHECK(found_inner_function);
+}
+
 TEST(TriggerDelayedMainThreadMetricsEvent) {
   using v8::Context;
   using v8::Local;
@@ -114,29 +114,8 @@ void NullifyWeakCell(Handle<WeakCell> weak_cell, Isolate* isolate) {
 
 Object PopClearedCellHoldings(
     Handle<JSFinalizationRegistry> finalization_registry, Isolate* isolate) {
-  // PopClearedCell is implemented in Torque. Reproduce that implementation here
-  // for testing.
-  Handle<WeakCell> weak_cell =
-      handle(WeakCell::cast(finalization_registry->cleared_cells()), isolate);
-  DCHECK(weak_cell->prev().IsUndefined(isolate));
-  finalization_registry->set_cleared_cells(weak_cell->next());
-  weak_cell->set_next(ReadOnlyRoots(isolate).undefined_value());
-
-  if (finalization_registry->cleared_cells().IsWeakCell()) {
-    WeakCell cleared_cells_head =
-        WeakCell::cast(finalization_registry->cleared_cells());
-    DCHECK_EQ(cleared_cells_head.prev(), *weak_cell);
-    cleared_cells_head.set_prev(ReadOnlyRoots(isolate).undefined_value());
-  } else {
-    DCHECK(finalization_registry->cleared_cells().IsUndefined(isolate));
-  }
-
-  if (!weak_cell->unregister_token().IsUndefined(isolate)) {
-    JSFinalizationRegistry::RemoveCellFromUnregisterTokenMap(
-        isolate, finalization_registry->ptr(), weak_cell->ptr());
-  }
-
-  return weak_cell->holdings();
+  return *JSFinalizationRegistry::PopClearedCellHoldings(finalization_registry,
+                                                         isolate);
 }
 
 // Usage: VerifyWeakCellChain(isolate, list_head, n, cell1, cell2, ..., celln);
@@ -2616,6 +2616,44 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+static int CompileRunInNewIsolate(const char* js_source) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  int result;
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::Script> script =
+        v8::Script::Compile(context, v8_str(js_source)).ToLocalChecked();
+    result = script->Run(context)
+                 .ToLocalChecked()
+                 ->Int32Value(context)
+                 .FromJust();
+  }
+  isolate->Dispose();
+  return result;
+}
+
+TEST(SharedCodeCacheDistinctScripts) {
+  i::v8_flags.shared_code_cache = true;
+  const char* js_source1 = "var a = 40 + 1; a";
+  const char* js_source2 = "var a = 40 + 2; a";
+  CHECK_EQ(strlen(js_source1), strlen(js_source2));
+
+  // The first compile publishes to the process-wide cache; a fresh isolate
+  // adopts the cached blob for the same source.
+  CHECK_EQ(41, CompileRunInNewIsolate(js_source1));
+  CHECK_EQ(41, CompileRunInNewIsolate(js_source1));
+
+  // A different script of the same length must not be resolved to the
+  // previously published blob.
+  CHECK_EQ(42, CompileRunInNewIsolate(js_source2));
+  CHECK_EQ(42, CompileRunInNewIsolate(js_source2));
+}
+
 TEST(CodeSerializerIsolatesEager) {
   const char* js_source =
       "function f() {"
@@ -2662,6 +2700,71 @@ TEST(CodeSerializerIsolatesEager) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerPreparseDataSurvival) {
+  // The preparse data of lazy functions, including the nested data for their
+  // inner functions, is part of the code cache, so a cache hit never needs to
+  // re-preparse any enclosing code before lazily compiling a function.
+  const char* js_source =
+      "function outer() {"
+      "  function middle() {"
+      "    function inner() { return 'abc'; }"
+      "    return inner;"
+      "  }"
+      "  return middle;"
+      "}"
+      "outer()()() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate2, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    // The deserialized script must still carry the preparse data of its
+    // uncompiled functions.
+    Handle<SharedFunctionInfo> toplevel =
+        Handle<SharedFunctionInfo>::cast(v8::Utils::OpenHandle(*script));
+    Script script_obj = Script::cast(toplevel->script());
+    bool found_preparse_data = false;
+    WeakFixedArray sfis = script_obj.shared_function_infos();
+    for (int i = 0; i < sfis.length(); i++) {
+      HeapObject heap_object;
+      if (sfis.Get(i)->GetHeapObjectIfWeak(&heap_object) &&
+          SharedFunctionInfo::cast(heap_object)
+              .HasUncompiledDataWithPreparseData()) {
+        found_preparse_data = true;
+        break;
+      }
+    }
+    CHECK(found_preparse_data);
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerAfterExecute) {
   // We test that no compilations happen when running this code. Forcing
   // to always optimize breaks this test.
@@ -3351,6 +3454,87 @@ UNINITIALIZED_TEST(SnapshotCreatorDuplicateFunctions) {
   FreeCurrentEmbeddedBlob();
 }
 
+v8::StartupData CreateCustomSnapshotConsumingCodeCache(
+    v8::ScriptCompiler::CachedData* cache, const char* js_source,
+    bool expect_rejection) {
+  v8::SnapshotCreator creator;
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(isolate, v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK_EQ(expect_rejection, cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    creator.SetDefaultContext(context);
+  }
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+UNINITIALIZED_TEST(SnapshotCreatorConsumeCodeCache) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+
+  const char* js_source = "function result() { return 'cached'; }";
+
+  // Rebuilding a snapshot from an up-to-date code cache deserializes the
+  // script instead of recompiling it.
+  {
+    v8::ScriptCompiler::CachedData* cache =
+        CompileRunAndProduceCache(js_source, CodeCacheType::kEager);
+    v8::StartupData blob =
+        CreateCustomSnapshotConsumingCodeCache(cache, js_source, false);
+
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectString("result()", "cached");
+    }
+    isolate->Dispose();
+    delete[] blob.data;
+  }
+
+  // A cache produced for an older version of the script is rejected via its
+  // embedded source hash, and the modified script is compiled from source.
+  {
+    const char* modified_source = "function result() { return 'changed'; }";
+    v8::ScriptCompiler::CachedData* stale_cache =
+        CompileRunAndProduceCache(js_source, CodeCacheType::kEager);
+    v8::StartupData blob = CreateCustomSnapshotConsumingCodeCache(
+        stale_cache, modified_source, true);
+
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      ExpectString("result()", "changed");
+    }
+    isolate->Dispose();
+    delete[] blob.data;
+  }
+
+  FreeCurrentEmbeddedBlob();
+}
+
 #ifndef V8_SHARED_RO_HEAP
 // We do not support building multiple snapshots when read-only heap is shared.
 
@@ -3606,6 +3790,68 @@ UNINITIALIZED_TEST(SnapshotCreatorTemplates) {
   FreeCurrentEmbeddedBlob();
 }
 
+// Covers the per-request embedding pattern: a context whose global object was
+// instantiated from templates is embedded in the blob once, and each request
+// then creates a fresh context from the snapshot index. The native bindings
+// (function callbacks, accessors, and External data pointers) are rebound
+// through the external references table at deserialization, so no template
+// re-instantiation through ApiNatives happens per context.
+UNINITIALIZED_TEST(SnapshotCreatorTemplateBoundGlobalsPerRequest) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator(original_external_references);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      creator.SetDefaultContext(v8::Context::New(isolate));
+
+      v8::Local<v8::ObjectTemplate> global_template =
+          v8::ObjectTemplate::New(isolate);
+      v8::Local<v8::External> external =
+          v8::External::New(isolate, &serialized_static_field);
+      v8::Local<v8::FunctionTemplate> callback =
+          v8::FunctionTemplate::New(isolate, SerializedCallback, external);
+      global_template->Set(isolate, "f", callback);
+      global_template->SetAccessor(v8_str("x"), AccessorForSerialization);
+      v8::Local<v8::Context> context =
+          v8::Context::New(isolate, nullptr, global_template);
+      CHECK_EQ(0u, creator.AddContext(context));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    params.external_references = original_external_references;
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      // The same snapshot index can be instantiated any number of times.
+      for (int i = 0; i < 3; i++) {
+        v8::Local<v8::Context> context =
+            v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+        v8::Context::Scope context_scope(context);
+        // Globals from a previous request's context must not leak in.
+        ExpectBoolean("this.request_local === undefined", true);
+        ExpectInt32("f()", 42);
+        ExpectInt32("x", 2017);
+        CompileRun("var request_local = 'request';");
+        ExpectString("request_local", "request");
+      }
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 MaybeLocal<v8::Module> ResolveCallback(Local<v8::Context> context,
                                        Local<v8::String> specifier,
                                        Local<v8::FixedArray> import_assertions,
@@ -2,7 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "include/v8-container.h"
+#include "include/v8-context.h"
+#include "include/v8-exception.h"
 #include "include/v8-initialization.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
 #include "src/api/api-inl.h"
 #include "src/base/strings.h"
 #include "src/common/globals.h"
@@ -756,6 +761,89 @@ UNINITIALIZED_TEST(StringShare) {
   }
 }
 
+UNINITIALIZED_TEST(ShareDeepObjectGraph) {
+  if (!V8_CAN_CREATE_SHARED_HEAP_BOOL) return;
+
+  v8_flags.shared_string_table = true;
+
+  MultiClientIsolateTest test;
+  v8::Isolate* isolate = test.main_isolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+
+  v8::Local<v8::String> num_key =
+      v8::String::NewFromUtf8Literal(isolate, "num");
+  v8::Local<v8::String> str_key =
+      v8::String::NewFromUtf8Literal(isolate, "str");
+  v8::Local<v8::String> inner_key =
+      v8::String::NewFromUtf8Literal(isolate, "inner");
+  v8::Local<v8::String> alias_key =
+      v8::String::NewFromUtf8Literal(isolate, "alias");
+  v8::Local<v8::String> self_key =
+      v8::String::NewFromUtf8Literal(isolate, "self");
+
+  v8::Local<v8::Object> inner = v8::Object::New(isolate);
+  v8::Local<v8::Object> outer = v8::Object::New(isolate);
+  CHECK(outer->Set(context, num_key, v8::Number::New(isolate, 1.5)).FromJust());
+  CHECK(outer
+            ->Set(context, str_key,
+                  v8::String::NewFromUtf8Literal(
+                      isolate, "a string long enough to not be cached"))
+            .FromJust());
+  CHECK(outer->Set(context, inner_key, inner).FromJust());
+  CHECK(outer->Set(context, alias_key, inner).FromJust());
+  // A cycle back to the root.
+  CHECK(inner->Set(context, self_key, outer).FromJust());
+
+  v8::Local<v8::Object> shared = outer->ShareDeep(context).ToLocalChecked();
+  Handle<JSReceiver> i_shared = Utils::OpenHandle(*shared);
+  CHECK(i_shared->IsJSSharedStruct());
+  CHECK(i_shared->InSharedHeap());
+
+  // Field values are shared and readable.
+  CHECK_EQ(shared->Get(context, num_key)
+               .ToLocalChecked()
+               ->NumberValue(context)
+               .FromJust(),
+           1.5);
+  Handle<Object> i_str =
+      Utils::OpenHandle(*shared->Get(context, str_key).ToLocalChecked());
+  CHECK(i_str->IsString());
+  CHECK(i_str->IsShared());
+
+  // Aliasing and the cycle are preserved.
+  v8::Local<v8::Value> shared_inner =
+      shared->Get(context, inner_key).ToLocalChecked();
+  v8::Local<v8::Value> shared_alias =
+      shared->Get(context, alias_key).ToLocalChecked();
+  CHECK_EQ(*Utils::OpenHandle(*shared_inner),
+           *Utils::OpenHandle(*shared_alias));
+  CHECK(Utils::OpenHandle(*shared_inner)->IsJSSharedStruct());
+  v8::Local<v8::Value> shared_self = shared_inner.As<v8::Object>()
+                                         ->Get(context, self_key)
+                                         .ToLocalChecked();
+  CHECK_EQ(*Utils::OpenHandle(*shared_self), *i_shared);
+
+  // The copy is frozen: overwriting a field has no effect.
+  CHECK(shared->Set(context, num_key, v8::Number::New(isolate, 2.5))
+            .IsJust());
+  CHECK_EQ(shared->Get(context, num_key)
+               .ToLocalChecked()
+               ->NumberValue(context)
+               .FromJust(),
+           1.5);
+
+  // Graphs containing unshareable values fail with a TypeError.
+  v8::Local<v8::Object> with_array = v8::Object::New(isolate);
+  CHECK(with_array->Set(context, inner_key, v8::Array::New(isolate, 3))
+            .FromJust());
+  v8::TryCatch try_catch(isolate);
+  CHECK(with_array->ShareDeep(context).IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 UNINITIALIZED_TEST(PromotionMarkCompact) {
   if (v8_flags.single_generation) return;
   if (!V8_CAN_CREATE_SHARED_HEAP_BOOL) return;
@@ -573,6 +573,63 @@ TEST(Traverse) {
   printf("18\n");
 }
 
+namespace {
+
+Handle<String> BuildRope(Isolate* isolate, Handle<String> chunk, int copies) {
+  Factory* factory = isolate->factory();
+  Handle<String> rope = chunk;
+  for (int i = 1; i < copies; i++) {
+    rope = factory->NewConsString(rope, chunk).ToHandleChecked();
+  }
+  return rope;
+}
+
+}  // namespace
+
+TEST(ConsStringSegmentSearch) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // Build ropes well above the read-only flatten budget, so that single
+  // character searches and equality checks walk the segments directly.
+  Handle<String> chunk = factory->NewStringFromAsciiChecked("abcdefghijklmnop");
+  Handle<String> double_chunk =
+      factory->NewStringFromAsciiChecked("abcdefghijklmnopabcdefghijklmnop");
+  const int kCopies = 8192;
+  const int kRopeLength = kCopies * chunk->length();
+  Handle<String> rope = BuildRope(isolate, chunk, kCopies);
+
+  // The only 'x' sits in the very last leaf.
+  Handle<String> marker = factory->NewStringFromAsciiChecked("x");
+  Handle<String> tail_rope =
+      factory->NewConsString(rope, marker).ToHandleChecked();
+  Handle<String> search_x = factory->NewStringFromAsciiChecked("x");
+  CHECK_EQ(kRopeLength, String::IndexOf(isolate, tail_rope, search_x, 0));
+  Handle<String> search_q = factory->NewStringFromAsciiChecked("q");
+  CHECK_EQ(-1, String::IndexOf(isolate, tail_rope, search_q, 0));
+  Handle<String> search_a = factory->NewStringFromAsciiChecked("a");
+  CHECK_EQ(chunk->length(), String::IndexOf(isolate, tail_rope, search_a, 1));
+  // The searches must not have flattened the rope.
+  CHECK(!tail_rope->IsFlat());
+
+  // Equality between two ropes with the same contents but different shapes
+  // is also segment-wise and must not flatten either side.
+  Handle<String> other_rope = BuildRope(isolate, double_chunk, kCopies / 2);
+  CHECK(String::Equals(isolate, rope, other_rope));
+  Handle<String> odd_chunk =
+      factory->NewStringFromAsciiChecked("abcdefghijklmnoq");
+  Handle<String> unequal_rope = factory
+                                    ->NewConsString(BuildRope(isolate, chunk,
+                                                              kCopies - 1),
+                                                    odd_chunk)
+                                    .ToHandleChecked();
+  CHECK(!String::Equals(isolate, rope, unequal_rope));
+  CHECK(!rope->IsFlat());
+  CHECK(!other_rope->IsFlat());
+}
+
 TEST(ConsStringWithEmptyFirstFlatten) {
   printf("ConsStringWithEmptyFirstFlatten\n");
   CcTest::InitializeVM();
@@ -1924,6 +1981,25 @@ TEST(InternalizeExternalString) {
   CHECK(string.equals(internal));
 }
 
+// Internalizing a fresh one-character string resolves to the canonical
+// single character string and turns the input into a ThinString.
+TEST(InternalizeSingleCharacterString) {
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  Handle<SeqTwoByteString> raw =
+      factory->NewRawTwoByteString(1).ToHandleChecked();
+  raw->SeqTwoByteStringSet(0, 'x');
+  Handle<String> string = raw;
+  CHECK(!string->IsInternalizedString());
+
+  Handle<String> internal = factory->InternalizeString(string);
+  CHECK(internal->IsInternalizedString());
+  CHECK_EQ(*internal, *factory->LookupSingleCharacterStringFromCode('x'));
+  CHECK(string->IsThinString());
+}
+
 // Show that it is possible to internalize an external string without a copy, as
 // long as it is not uncached. Two byte version.
 TEST(InternalizeExternalStringTwoByte) {
@@ -0,0 +1,68 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Exercises the reuse of the cached per-frame await resolve/reject
+// closures across many sequential awaits of the same async function.
+
+(function TestSequentialAwaits() {
+  let result;
+  async function f() {
+    let sum = 0;
+    for (let i = 0; i < 100; i++) {
+      sum += await i;
+    }
+    return sum;
+  }
+  f().then(value => result = value);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(4950, result);
+})();
+
+(function TestRejectionAfterReuse() {
+  let result;
+  async function f() {
+    await 1;
+    await 2;
+    try {
+      await Promise.reject(new Error("boom"));
+    } catch (e) {
+      return "caught " + e.message;
+    }
+  }
+  f().then(value => result = value);
+  %PerformMicrotaskCheckpoint();
+  assertEquals("caught boom", result);
+})();
+
+(function TestInterleavedFrames() {
+  let results = [];
+  async function f(tag) {
+    for (let i = 0; i < 10; i++) {
+      await 0;
+    }
+    results.push(tag);
+    return tag;
+  }
+  // Two frames awaiting in lock step must each resume with their own
+  // generator, even though both reuse their cached closures.
+  f("a");
+  f("b");
+  %PerformMicrotaskCheckpoint();
+  assertEquals(["a", "b"], results);
+})();
+
+(function TestThenablesBetweenAwaits() {
+  let result;
+  async function f() {
+    const plain = await 1;
+    const wrapped = await new Promise(resolve => resolve(2));
+    const thenable = await { then(resolve) { resolve(3); } };
+    return plain + wrapped + thenable;
+  }
+  f().then(value => result = value);
+  %PerformMicrotaskCheckpoint();
+  assertEquals(6, result);
+})();
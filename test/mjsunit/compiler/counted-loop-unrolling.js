@@ -0,0 +1,92 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-full-unrolling
+
+// Small counted loops with constant bounds; these are candidates for full
+// unrolling and must keep producing the same results when optimized.
+
+function sum4() {
+  var s = 0;
+  for (var i = 0; i < 4; i++) s += i;
+  return s;
+}
+%PrepareFunctionForOptimization(sum4);
+assertEquals(6, sum4());
+assertEquals(6, sum4());
+%OptimizeFunctionOnNextCall(sum4);
+assertEquals(6, sum4());
+
+function sumInclusive() {
+  var s = 0;
+  for (var i = 1; i <= 5; i++) s += i;
+  return s;
+}
+%PrepareFunctionForOptimization(sumInclusive);
+assertEquals(15, sumInclusive());
+assertEquals(15, sumInclusive());
+%OptimizeFunctionOnNextCall(sumInclusive);
+assertEquals(15, sumInclusive());
+
+function dot3(a, b) {
+  var s = 0;
+  for (var i = 0; i < 3; i++) s += a[i] * b[i];
+  return s;
+}
+%PrepareFunctionForOptimization(dot3);
+assertEquals(32, dot3([1, 2, 3], [4, 5, 6]));
+assertEquals(32, dot3([1, 2, 3], [4, 5, 6]));
+%OptimizeFunctionOnNextCall(dot3);
+assertEquals(32, dot3([1, 2, 3], [4, 5, 6]));
+
+function stepped() {
+  var s = 0;
+  for (var i = 0; i < 10; i += 3) s += i;
+  return s;
+}
+%PrepareFunctionForOptimization(stepped);
+assertEquals(18, stepped());
+assertEquals(18, stepped());
+%OptimizeFunctionOnNextCall(stepped);
+assertEquals(18, stepped());
+
+// Shapes that must not be unrolled but still have to stay correct: an early
+// exit, a non-constant bound, and a trip count above the unroll limit.
+
+function withBreak(a) {
+  var s = 0;
+  for (var i = 0; i < 6; i++) {
+    if (a[i] < 0) break;
+    s += a[i];
+  }
+  return s;
+}
+%PrepareFunctionForOptimization(withBreak);
+assertEquals(3, withBreak([1, 2, -1, 4, 5, 6]));
+assertEquals(3, withBreak([1, 2, -1, 4, 5, 6]));
+%OptimizeFunctionOnNextCall(withBreak);
+assertEquals(3, withBreak([1, 2, -1, 4, 5, 6]));
+
+function dynamicBound(n) {
+  var s = 0;
+  for (var i = 0; i < n; i++) s += i;
+  return s;
+}
+%PrepareFunctionForOptimization(dynamicBound);
+assertEquals(10, dynamicBound(5));
+assertEquals(10, dynamicBound(5));
+%OptimizeFunctionOnNextCall(dynamicBound);
+assertEquals(10, dynamicBound(5));
+assertEquals(21, dynamicBound(7));
+
+function manyIterations() {
+  var s = 0;
+  for (var i = 0; i < 100; i++) s += i;
+  return s;
+}
+%PrepareFunctionForOptimization(manyIterations);
+assertEquals(4950, manyIterations());
+assertEquals(4950, manyIterations());
+%OptimizeFunctionOnNextCall(manyIterations);
+assertEquals(4950, manyIterations());
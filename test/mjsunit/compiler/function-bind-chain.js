@@ -0,0 +1,70 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Rebinding a bound function with a custom prototype reuses the bound
+// function's map. Check that chains of binds stay spec-correct, both in the
+// interpreter and when the binds are created by optimized code.
+
+// A custom function prototype that keeps Function.prototype.bind reachable.
+var customProto = Object.create(Function.prototype);
+
+(function TestCustomPrototypeChain() {
+  "use strict";
+  function base(a, b, c) { return [this, a, b, c]; }
+  Object.setPrototypeOf(base, customProto);
+
+  function rebind(f, x) {
+    return f.bind(undefined, x);
+  }
+
+  %PrepareFunctionForOptimization(rebind);
+  var b1 = rebind(base, 1);
+  var b2 = rebind(b1, 2);
+  %OptimizeFunctionOnNextCall(rebind);
+  var b3 = rebind(b2, 3);
+
+  assertEquals([undefined, 1, 2, 3], b3());
+  assertSame(customProto, Object.getPrototypeOf(b1));
+  assertSame(customProto, Object.getPrototypeOf(b3));
+  assertEquals(0, b3.length);
+  assertEquals("bound bound bound base", b3.name);
+})();
+
+(function TestSubclassConstructorChain() {
+  class A { constructor(x) { this.x = x; } }
+  class B extends A {}
+
+  var bound = B.bind(undefined);
+  var rebound = bound.bind(undefined, 42);
+  assertSame(A, Object.getPrototypeOf(bound));
+  assertSame(A, Object.getPrototypeOf(rebound));
+  var o = new rebound();
+  assertInstanceof(o, B);
+  assertEquals(42, o.x);
+})();
+
+(function TestModifiedBoundFunctionIsNotShared() {
+  function base() { return this; }
+  Object.setPrototypeOf(base, customProto);
+
+  // A bound function with an extra own property must not pass its map on.
+  var withProp = base.bind();
+  withProp.extra = 1;
+  var fromProp = withProp.bind();
+  assertFalse(Object.prototype.hasOwnProperty.call(fromProp, "extra"));
+
+  // Nor must a frozen one, or one with elements.
+  var frozen = Object.freeze(base.bind());
+  var fromFrozen = frozen.bind();
+  assertFalse(Object.isFrozen(fromFrozen));
+  fromFrozen.ok = true;
+  assertTrue(fromFrozen.ok);
+
+  var withElements = base.bind();
+  withElements[0] = "el";
+  var fromElements = withElements.bind();
+  assertFalse(Object.prototype.hasOwnProperty.call(fromElements, 0));
+})();
@@ -0,0 +1,85 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Sorting without a comparator takes a radix-sort fast path once arrays
+// exceed a length threshold. Compare its result against a comparator sort,
+// which goes through the generic path.
+
+var typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  BigUint64Array,
+  BigInt64Array,
+  Float32Array,
+  Float64Array
+];
+
+// Past the radix-sort threshold (512), including the uneven tail case.
+const kLength = 2049;
+
+// Deterministic 32-bit PRNG so failures reproduce.
+var seed = 49734321;
+function random32() {
+  seed = (Math.imul(seed, 1103515245) + 12345) >>> 0;
+  return seed;
+}
+
+function toElement(constructor, bits) {
+  if (constructor === BigUint64Array || constructor === BigInt64Array) {
+    return BigInt(bits) << 32n | BigInt(random32());
+  }
+  if (constructor === Float32Array || constructor === Float64Array) {
+    // Mix of sign, magnitude and fractional values, plus signed zeros.
+    const r = bits % 8;
+    if (r === 0) return 0;
+    if (r === 1) return -0;
+    return (bits - 0x80000000) / (1 + (bits & 0xFF));
+  }
+  return bits;
+}
+
+// Reference comparator matching the spec'd default order, including -0
+// before +0.
+function compare(x, y) {
+  if (x < y) return -1;
+  if (x > y) return 1;
+  if (typeof x === "number") {
+    if (Object.is(x, -0) && Object.is(y, 0)) return -1;
+    if (Object.is(x, 0) && Object.is(y, -0)) return 1;
+  }
+  return 0;
+}
+
+for (var constructor of typedArrayConstructors) {
+  var a = new constructor(kLength);
+  for (var i = 0; i < kLength; i++) {
+    a[i] = toElement(constructor, random32());
+  }
+  var b = constructor.from(a);
+
+  a.sort();
+  b.sort(compare);
+
+  for (var i = 0; i < kLength; i++) {
+    // Use assertSame to differentiate between +-0.
+    assertSame(b[i], a[i], "index " + i + " of " + constructor.name);
+  }
+
+  // Already-sorted and uniform inputs hit the skipped-digit fast paths.
+  a.sort();
+  for (var i = 1; i < kLength; i++) {
+    assertFalse(a[i] < a[i - 1]);
+  }
+  var c = new constructor(kLength);
+  c.fill(toElement(constructor, 42));
+  var uniform = c[0];
+  c.sort();
+  assertSame(uniform, c[0]);
+  assertSame(uniform, c[kLength - 1]);
+}
@@ -0,0 +1,93 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the bulk copy path for Object.assign and object spread with an
+// empty fast-mode target and a source with only enumerable data properties.
+
+// Plain merge into an empty target.
+var source = {a: 1, b: 'two', c: 3.5, d: null};
+var target = Object.assign({}, source);
+assertEquals(source, target);
+assertEquals(['a', 'b', 'c', 'd'], Object.keys(target));
+assertFalse(source === target);
+
+// Values are shared, not cloned.
+var ref = {x: 1};
+assertSame(ref, Object.assign({}, {r: ref}).r);
+
+// Double fields keep their values and stay mutable on the copy.
+var doubles = Object.assign({}, {p: 0.5, q: 1e300});
+assertEquals(0.5, doubles.p);
+assertEquals(1e300, doubles.q);
+doubles.p = 2.5;
+assertEquals(2.5, doubles.p);
+assertEquals(0.5, Object.assign({}, {p: 0.5, q: 1e300}).p);
+
+// Repeated merges of the same shapes (the option-object pattern).
+var defaults = {timeout: 1000, retries: 3, secure: true};
+for (var i = 0; i < 10; i++) {
+  var merged = Object.assign({}, defaults, {retries: i});
+  assertEquals(1000, merged.timeout);
+  assertEquals(i, merged.retries);
+  assertTrue(merged.secure);
+}
+
+// Symbol keys are copied and come after string keys in the result.
+var sym = Symbol('s');
+var with_symbol = Object.assign({}, {[sym]: 1, a: 2});
+assertEquals(1, with_symbol[sym]);
+assertEquals(2, with_symbol.a);
+assertEquals(['a'], Object.keys(with_symbol));
+assertEquals([sym], Object.getOwnPropertySymbols(with_symbol));
+
+// A source key shadowing a prototype property must still end up as an own
+// data property of the target.
+var shadowing = Object.assign({}, {toString: 42, constructor: 'c'});
+assertEquals(42, shadowing.toString);
+assertEquals('c', shadowing.constructor);
+assertTrue(Object.getOwnPropertyDescriptor(shadowing, 'toString').writable);
+
+// A setter on the target's prototype chain must be triggered, not shadowed.
+var proto_log = [];
+var proto = {
+  set hooked(v) { proto_log.push(v); }
+};
+var hooked_target = Object.create(proto);
+Object.assign(hooked_target, {hooked: 7, plain: 8});
+assertEquals([7], proto_log);
+assertEquals(undefined,
+             Object.getOwnPropertyDescriptor(hooked_target, 'hooked'));
+assertEquals(8, hooked_target.plain);
+
+// Getters on the source are evaluated, and their results copied.
+var get_count = 0;
+var getter_source = {
+  get g() { return ++get_count; }
+};
+var from_getter = Object.assign({}, getter_source);
+assertEquals(1, from_getter.g);
+assertEquals(1, get_count);
+assertEquals(1, Object.getOwnPropertyDescriptor(from_getter, 'g').value);
+
+// Spread uses the same copy semantics.
+var spread = {...source};
+assertEquals(source, spread);
+assertEquals(['a', 'b', 'c', 'd'], Object.keys(spread));
+
+// Non-enumerable properties are not copied.
+var partly_hidden = {visible: 1};
+Object.defineProperty(partly_hidden, 'hidden', {value: 2, enumerable: false});
+assertEquals({visible: 1}, Object.assign({}, partly_hidden));
+
+// Frozen targets throw when the source is non-empty.
+assertThrows(() => Object.assign(Object.freeze({}), {a: 1}), TypeError);
+assertEquals({}, Object.assign(Object.freeze({}), {}));
+
+// Large sources that overflow the fast property limit still copy correctly.
+var big_source = {};
+for (var i = 0; i < 1100; i++) big_source['k' + i] = i;
+var big_copy = Object.assign({}, big_source);
+assertEquals(0, big_copy.k0);
+assertEquals(1099, big_copy.k1099);
+assertEquals(1100, Object.keys(big_copy).length);
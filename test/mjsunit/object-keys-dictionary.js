@@ -0,0 +1,99 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Key enumeration over dictionary-mode objects caches the computed key list
+// in the property dictionary. Ensure the cache is invalidated by every kind
+// of mutation and never observable through the returned arrays.
+
+function MakeSlowObject() {
+  const o = {};
+  o.a = 1;
+  o.b = 2;
+  o.c = 3;
+  delete o.c;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+// Repeated enumeration yields stable results.
+(function TestRepeatedKeys() {
+  const o = MakeSlowObject();
+  for (let i = 0; i < 5; i++) {
+    const k = Object.keys(o);
+    %HeapObjectVerify(k);
+    assertEquals(['a', 'b'], k);
+  }
+})();
+
+// Adding a property is reflected immediately.
+(function TestAddInvalidates() {
+  const o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  o.d = 4;
+  assertEquals(['a', 'b', 'd'], Object.keys(o));
+})();
+
+// Deleting a property is reflected immediately.
+(function TestDeleteInvalidates() {
+  const o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  delete o.a;
+  assertEquals(['b'], Object.keys(o));
+})();
+
+// Reconfiguring enumerability is reflected immediately.
+(function TestReconfigureInvalidates() {
+  const o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  Object.defineProperty(o, 'a', {enumerable: false});
+  assertEquals(['b'], Object.keys(o));
+  Object.defineProperty(o, 'a', {enumerable: true});
+  assertEquals(['a', 'b'], Object.keys(o));
+})();
+
+// Deleting and re-adding a property with a different name.
+(function TestDeleteThenAdd() {
+  const o = MakeSlowObject();
+  assertEquals(['a', 'b'], Object.keys(o));
+  delete o.b;
+  o.e = 5;
+  assertEquals(['a', 'e'], Object.keys(o));
+})();
+
+// for-in agrees with Object.keys and sees mutations.
+(function TestForIn() {
+  const o = MakeSlowObject();
+  let seen = [];
+  for (const key in o) seen.push(key);
+  assertEquals(['a', 'b'], seen);
+  o.f = 6;
+  seen = [];
+  for (const key in o) seen.push(key);
+  assertEquals(['a', 'b', 'f'], seen);
+})();
+
+// Mutating a returned key array must not affect later enumerations.
+(function TestResultNotAliased() {
+  const o = MakeSlowObject();
+  const k = Object.keys(o);
+  k[0] = 'clobbered';
+  k.length = 0;
+  assertEquals(['a', 'b'], Object.keys(o));
+  let seen = [];
+  for (const key in o) seen.push(key);
+  assertEquals(['a', 'b'], seen);
+})();
+
+// Symbol-keyed and non-enumerable properties stay invisible when the cache
+// is populated and when it is hit.
+(function TestFiltering() {
+  const o = MakeSlowObject();
+  o[Symbol('sym')] = 1;
+  Object.defineProperty(o, 'hidden', {value: 1, enumerable: false});
+  assertFalse(%HasFastProperties(o));
+  assertEquals(['a', 'b'], Object.keys(o));
+  assertEquals(['a', 'b'], Object.keys(o));
+})();
@@ -0,0 +1,40 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --relaxed-eval-cache
+
+// With --relaxed-eval-cache, identical snippets eval'd at global scope share
+// their compilation across call sites. Each cache hit must still report its
+// own eval origin and produce correct results.
+
+Error.prepareStackTrace = function(exception, frames) {
+  return frames[0].getEvalOrigin();
+};
+
+var source = "new Error()";
+var geval = eval;
+
+function site_one() { return geval(source).stack; }
+function site_two() { return geval(source).stack; }
+
+var origin_one = site_one();
+var origin_two = site_two();
+var origin_one_again = site_one();
+
+Error.prepareStackTrace = undefined;
+
+assertTrue(/site_one/.test(origin_one));
+assertTrue(/site_two/.test(origin_two));
+assertTrue(/site_one/.test(origin_one_again));
+
+// Results stay correct when the cache shares entries across sites.
+function calc_one() { return geval("6 * 7"); }
+function calc_two() { return geval("6 * 7"); }
+assertEquals(42, calc_one());
+assertEquals(42, calc_two());
+assertEquals(42, calc_one());
+
+// The language mode remains part of the cache key.
+assertEquals("undefined", geval("'use strict'; typeof undeclared_variable"));
+assertEquals("undefined", geval("typeof undeclared_variable"));
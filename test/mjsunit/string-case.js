@@ -83,3 +83,16 @@ for (var i = 1; i <= 128; i <<= 1); {
     }
   }
 }
+
+// Test the transition from the ASCII fast path to the generic algorithm
+// with a non-ASCII (Latin-1) character at various positions, so that the
+// fast path bails out after converting prefixes of various lengths.
+function testLatin1Bailout(prefixLength) {
+  var prefix = "aB".repeat((prefixLength >> 1) + 1).substring(0, prefixLength);
+  var str = %FlattenString(prefix + "éxYzÀ");
+  assertEquals(prefix.toLowerCase() + "éxyzà", str.toLowerCase());
+  assertEquals(prefix.toUpperCase() + "ÉXYZÀ", str.toUpperCase());
+}
+for (var i = 0; i < 80; i++) {
+  testLatin1Bailout(i);
+}
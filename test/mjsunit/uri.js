@@ -98,3 +98,20 @@ test("ab\u1234<\u0123");
   assertEquals('abc', encodeURI('abc'));
   assertEquals('abc', decodeURI('abc'));
 })();
+
+// Long strings exercise the block-wise fast paths; place characters that
+// need escaping at various offsets so blocks of every shape occur.
+(function TestLongStrings() {
+  for (var offset = 0; offset < 48; offset++) {
+    var prefix = "Abc-123_x".repeat(16).substring(0, 64 + offset);
+    assertEquals(prefix, encodeURIComponent(prefix));
+    assertEquals(prefix + "%20x", encodeURIComponent(prefix + " x"));
+    assertEquals(prefix + "%2F", encodeURIComponent(prefix + "/"));
+    assertEquals(prefix + "/", encodeURI(prefix + "/"));
+    assertEquals(prefix + "%C3%A9", encodeURIComponent(prefix + "é"));
+    assertEquals(prefix + " x", decodeURIComponent(prefix + "%20x"));
+    assertEquals(prefix + "/", decodeURIComponent(prefix + "%2F"));
+    assertEquals(prefix + "%2F", decodeURI(prefix + "%2F"));
+    assertEquals(prefix + "é", decodeURIComponent(prefix + "%C3%A9"));
+  }
+})();
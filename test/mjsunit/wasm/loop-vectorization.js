@@ -0,0 +1,107 @@
+// Copyright 2023 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-loop-vectorization --no-liftoff
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+const kCopyDstOffset = 2048;
+
+function MakeInstance() {
+  let builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, true);
+
+  // do { mem[i] = value; i += 1; } while (i <u limit)
+  builder.addFunction("fill8", makeSig([kWasmI32, kWasmI32], []))
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 2, kExprLocalGet, 1, kExprI32StoreMem8, 0, 0,
+        kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 2,
+        kExprLocalGet, 2, kExprLocalGet, 0, kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd])
+    .exportFunc();
+
+  // do { mem[i] = value; i += 4; } while (i <u limit)
+  builder.addFunction("fill32", makeSig([kWasmI32, kWasmI32], []))
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 2, kExprLocalGet, 1, kExprI32StoreMem, 0, 0,
+        kExprLocalGet, 2, kExprI32Const, 4, kExprI32Add, kExprLocalSet, 2,
+        kExprLocalGet, 2, kExprLocalGet, 0, kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd])
+    .exportFunc();
+
+  // do { mem[i + kCopyDstOffset] = mem[i]; i += 1; } while (i <u limit)
+  builder.addFunction("copy8", makeSig([kWasmI32], []))
+    .addLocals(kWasmI32, 1)
+    .addBody([
+      kExprLoop, kWasmVoid,
+        kExprLocalGet, 1,
+        kExprLocalGet, 1, kExprI32LoadMem8U, 0, 0,
+        kExprI32StoreMem8, 0, ...wasmUnsignedLeb(kCopyDstOffset),
+        kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalSet, 1,
+        kExprLocalGet, 1, kExprLocalGet, 0, kExprI32LtU,
+        kExprBrIf, 0,
+      kExprEnd])
+    .exportFunc();
+
+  return builder.instantiate();
+}
+
+(function TestFill8() {
+  print(arguments.callee.name);
+  let instance = MakeInstance();
+  let mem = new Uint8Array(instance.exports.memory.buffer);
+  // Cover limits below, at, and off the 16-byte block size, so that both the
+  // Simd128 fast path and the scalar tail are exercised.
+  for (let limit of [1, 3, 15, 16, 17, 31, 32, 33, 100, 255]) {
+    mem.fill(0, 0, 300);
+    instance.exports.fill8(limit, 0x42);
+    for (let i = 0; i < limit; i++) assertEquals(0x42, mem[i]);
+    assertEquals(0, mem[limit]);
+  }
+})();
+
+(function TestFill32() {
+  print(arguments.callee.name);
+  let instance = MakeInstance();
+  let mem = new Uint8Array(instance.exports.memory.buffer);
+  for (let limit of [4, 16, 20, 64, 68, 120]) {
+    mem.fill(0, 0, 300);
+    instance.exports.fill32(limit, 0x01020304);
+    for (let i = 0; i < limit; i += 4) {
+      assertEquals(0x04, mem[i]);
+      assertEquals(0x03, mem[i + 1]);
+      assertEquals(0x02, mem[i + 2]);
+      assertEquals(0x01, mem[i + 3]);
+    }
+    assertEquals(0, mem[limit]);
+  }
+})();
+
+(function TestCopy8() {
+  print(arguments.callee.name);
+  let instance = MakeInstance();
+  let mem = new Uint8Array(instance.exports.memory.buffer);
+  for (let limit of [1, 15, 16, 17, 33, 250]) {
+    for (let i = 0; i < 300; i++) mem[i] = (7 * i + 3) & 0xFF;
+    mem.fill(0, kCopyDstOffset, kCopyDstOffset + 300);
+    instance.exports.copy8(limit);
+    for (let i = 0; i < limit; i++) {
+      assertEquals(mem[i], mem[kCopyDstOffset + i]);
+    }
+    assertEquals(0, mem[kCopyDstOffset + limit]);
+  }
+})();
+
+(function TestFill8OutOfBounds() {
+  print(arguments.callee.name);
+  let instance = MakeInstance();
+  assertTraps(kTrapMemOutOfBounds,
+              () => instance.exports.fill8(kPageSize + 1, 0x42));
+})();
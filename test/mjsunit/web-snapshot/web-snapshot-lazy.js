@@ -0,0 +1,53 @@
+// Copyright 2022 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-d8-web-snapshot-api --allow-natives-syntax
+// Flags: --web-snapshot-lazy-exports
+
+'use strict';
+
+d8.file.execute('test/mjsunit/web-snapshot/web-snapshot-helpers.js');
+
+(function TestLazyExport() {
+  function createObjects() {
+    globalThis.foo = {
+      str: 'hello',
+      n: 42,
+    };
+  }
+  const { foo } = takeAndUseWebSnapshot(createObjects, ['foo']);
+  assertEquals('hello', foo.str);
+  assertEquals(42, foo.n);
+})();
+
+(function TestAccessingOneExportMaterializesAll() {
+  function createObjects() {
+    globalThis.one = { value: 1 };
+    globalThis.two = { value: 2 };
+  }
+  const realm = Realm.create();
+  takeAndUseWebSnapshot(createObjects, ['one', 'two'], realm);
+  // Touching "one" materializes the whole snapshot; "two" must then be a
+  // plain data property with the right value.
+  assertEquals(1, Realm.eval(realm, 'one.value'));
+  assertEquals(2, Realm.eval(realm, 'two.value'));
+})();
+
+(function TestLazyExportTopLevelPrimitives() {
+  function createObjects() {
+    globalThis.a = 6;
+    globalThis.b = 'str';
+  }
+  const { a, b } = takeAndUseWebSnapshot(createObjects, ['a', 'b']);
+  assertEquals(6, a);
+  assertEquals('str', b);
+})();
+
+(function TestLazyExportFunction() {
+  function createObjects() {
+    globalThis.bar = function () { return 11; };
+  }
+  const { bar } = takeAndUseWebSnapshot(createObjects, ['bar']);
+  assertEquals(11, bar());
+})();
@@ -133,6 +133,35 @@ TEST_F(IncumbentContextTest, Basic) {
   }
 }
 
+// Check that an isolate stays usable after Reset(): contexts created before
+// the reset are dropped, and a fresh context can still compile and run code.
+TEST_F(IsolateTest, ResetAllowsReuse) {
+  {
+    HandleScope scope(isolate());
+    Local<Context> context = Context::New(isolate());
+    Context::Scope context_scope(context);
+    Local<Script> script =
+        Script::Compile(context,
+                        String::NewFromUtf8Literal(isolate(), "var x = 6 * 7;"))
+            .ToLocalChecked();
+    script->Run(context).ToLocalChecked();
+  }
+
+  isolate()->Reset();
+
+  {
+    HandleScope scope(isolate());
+    Local<Context> context = Context::New(isolate());
+    Context::Scope context_scope(context);
+    Local<Script> script =
+        Script::Compile(context,
+                        String::NewFromUtf8Literal(isolate(), "6 * 7"))
+            .ToLocalChecked();
+    Local<Value> result = script->Run(context).ToLocalChecked();
+    EXPECT_EQ(42, result->Int32Value(context).FromJust());
+  }
+}
+
 namespace {
 thread_local std::multimap<v8::CrashKeyId, std::string> crash_keys;
 void CrashKeyCallback(v8::CrashKeyId id, const std::string& value) {
@@ -92,6 +92,36 @@ TEST_F(SourcePositionTableTest, EncodeAscendingNegative) {
   CHECK(!builder()->ToSourcePositionTable(isolate()).is_null());
 }
 
+TEST_F(SourcePositionTableTest, SkipToPosition) {
+  // Enough entries that the builder records checkpoints.
+  for (int i = 0; i < 1000; i++) {
+    builder()->AddPosition(i * 3, toPos(i * 7), i % 2 == 0);
+  }
+  Handle<ByteArray> table = builder()->ToSourcePositionTable(isolate());
+
+  for (int offset : {-1, 0, 1, 299, 1500, 2996, 2997, 10000}) {
+    // Reference result from a plain linear scan.
+    SourcePositionTableIterator reference(
+        *table, SourcePositionTableIterator::kJavaScriptOnly,
+        SourcePositionTableIterator::kDontSkipFunctionEntry);
+    int expected = -1;
+    for (; !reference.done() && reference.code_offset() <= offset;
+         reference.Advance()) {
+      expected = reference.source_position().ScriptOffset();
+    }
+
+    SourcePositionTableIterator it(
+        *table, SourcePositionTableIterator::kJavaScriptOnly,
+        SourcePositionTableIterator::kDontSkipFunctionEntry);
+    it.SkipToPosition(offset);
+    int actual = -1;
+    for (; !it.done() && it.code_offset() <= offset; it.Advance()) {
+      actual = it.source_position().ScriptOffset();
+    }
+    CHECK_EQ(expected, actual);
+  }
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
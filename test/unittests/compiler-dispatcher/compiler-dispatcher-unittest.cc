@@ -77,12 +77,14 @@ class LazyCompileDispatcherTest : public TestWithNativeContext {
     LazyCompileDispatcherTestFlags::RestoreFlags();
   }
 
-  static void EnqueueUnoptimizedCompileJob(LazyCompileDispatcher* dispatcher,
-                                           Isolate* isolate,
-                                           Handle<SharedFunctionInfo> shared) {
+  static void EnqueueUnoptimizedCompileJob(
+      LazyCompileDispatcher* dispatcher, Isolate* isolate,
+      Handle<SharedFunctionInfo> shared,
+      TaskPriority priority = TaskPriority::kUserVisible) {
     if (dispatcher->IsEnqueued(shared)) return;
     dispatcher->Enqueue(isolate->main_thread_local_isolate(), shared,
-                        test::SourceCharacterStreamForShared(isolate, shared));
+                        test::SourceCharacterStreamForShared(isolate, shared),
+                        priority);
   }
 };
 
@@ -358,6 +360,37 @@ TEST_F(LazyCompileDispatcherTest, IsEnqueued) {
   ASSERT_TRUE(platform.JobTaskPending());
 }
 
+TEST_F(LazyCompileDispatcherTest, EnqueuePriorityOrder) {
+  MockPlatform platform;
+  LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
+
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_3 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+
+  // Enqueue in ascending priority order; the pending queue must still end up
+  // with the user-blocking job at the back, where background threads pop.
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1,
+                               TaskPriority::kUserVisible);
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2,
+                               TaskPriority::kBestEffort);
+  EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_3,
+                               TaskPriority::kUserBlocking);
+
+  ASSERT_EQ(dispatcher.pending_background_jobs_.size(), 3u);
+  ASSERT_EQ(dispatcher.pending_background_jobs_.back()->priority,
+            TaskPriority::kUserBlocking);
+  ASSERT_EQ(dispatcher.pending_background_jobs_.front()->priority,
+            TaskPriority::kBestEffort);
+  ASSERT_EQ(dispatcher.pending_background_jobs_[1]->priority,
+            TaskPriority::kUserVisible);
+
+  dispatcher.AbortAll();
+}
+
 TEST_F(LazyCompileDispatcherTest, FinishNow) {
   MockPlatform platform;
   LazyCompileDispatcher dispatcher(i_isolate(), &platform, v8_flags.stack_size);
@@ -33,8 +33,11 @@ class DateCacheMock : public DateCache {
   DateCacheMock(int local_offset, Rule* rules, int rules_count)
       : local_offset_(local_offset), rules_(rules), rules_count_(rules_count) {}
 
+  int os_query_count() const { return os_query_count_; }
+
  protected:
   int GetDaylightSavingsOffsetFromOS(int64_t time_sec) override {
+    os_query_count_++;
     int days = DaysFromTime(time_sec * 1000);
     int time_in_day_sec = TimeInDay(time_sec * 1000, days) / 1000;
     int year, month, day;
@@ -85,6 +88,7 @@ class DateCacheMock : public DateCache {
   int local_offset_;
   Rule* rules_;
   int rules_count_;
+  int os_query_count_ = 0;
 };
 
 static int64_t TimeFromYearMonthDay(DateCache* date_cache, int year, int month,
@@ -141,6 +145,40 @@ TEST_F(DateTest, DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+TEST_F(DateTest, DaylightSavingsTransitionTable) {
+  v8::HandleScope scope(isolate());
+  DateCacheMock::Rule rules[] = {
+      {0, 2, 0, 10, 0, 3600},  // DST from March to November in any year.
+  };
+
+  int local_offset_ms = -36000000;  // -10 hours.
+
+  DateCacheMock* date_cache =
+      new DateCacheMock(local_offset_ms, rules, arraysize(rules));
+
+  reinterpret_cast<Isolate*>(isolate())->set_date_cache(date_cache);
+
+  // Sample times spread over several decades, far more than the DST segment
+  // cache can hold, to populate the transition table.
+  for (int year = 1990; year < 2020; year++) {
+    for (int month = 0; month < 12; month++) {
+      date_cache->LocalTimezone(TimeFromYearMonthDay(date_cache, year, month,
+                                                     5));
+    }
+  }
+  int queries_after_warmup = date_cache->os_query_count();
+
+  // A second sweep over the same epochs is served entirely from the
+  // transition table, without further OS time zone queries.
+  for (int year = 1990; year < 2020; year++) {
+    for (int month = 0; month < 12; month++) {
+      date_cache->LocalTimezone(TimeFromYearMonthDay(date_cache, year, month,
+                                                     5));
+    }
+  }
+  CHECK_EQ(queries_after_warmup, date_cache->os_query_count());
+}
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
@@ -116,6 +116,34 @@ TEST(WorkListTest, LocalPushPop) {
   EXPECT_EQ(&dummy, retrieved);
 }
 
+TEST(WorkListTest, LocalPublishIfConsumersStarving) {
+  TestWorklist worklist;
+  TestWorklist::Local worklist_local(worklist);
+  SomeObject dummy;
+  constexpr uint16_t kMinEntries = 4;
+  // Too few local entries: nothing is published.
+  for (uint16_t i = 0; i < kMinEntries - 1; i++) {
+    worklist_local.Push(&dummy);
+    worklist_local.PublishIfConsumersStarving(kMinEntries);
+  }
+  EXPECT_EQ(0U, worklist.Size());
+  // Reaching the threshold with an empty global worklist publishes the
+  // partial segment.
+  worklist_local.Push(&dummy);
+  worklist_local.PublishIfConsumersStarving(kMinEntries);
+  EXPECT_EQ(1U, worklist.Size());
+  EXPECT_TRUE(worklist_local.IsLocalEmpty());
+  // With global work available, local entries stay private.
+  for (uint16_t i = 0; i < kMinEntries; i++) {
+    worklist_local.Push(&dummy);
+    worklist_local.PublishIfConsumersStarving(kMinEntries);
+  }
+  EXPECT_EQ(1U, worklist.Size());
+  EXPECT_FALSE(worklist_local.IsLocalEmpty());
+  worklist.Clear();
+  worklist_local.Clear();
+}
+
 TEST(WorkListTest, LocalPushStaysPrivate) {
   TestWorklist worklist;
   TestWorklist::Local worklist_local1(worklist);
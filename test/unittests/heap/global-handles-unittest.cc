@@ -585,6 +585,55 @@ TEST_F(GlobalHandlesTest, MoveWeakGlobal) {
   CollectAllGarbage();
 }
 
+TEST_F(GlobalHandlesTest, CreateAndResetGlobalBatch) {
+  v8::Isolate* isolate = v8_isolate();
+  v8::HandleScope scope(isolate);
+
+  // More handles than fit into a single internal node block.
+  constexpr size_t kCount = 300;
+  std::vector<v8::Local<v8::Object>> locals;
+  for (size_t i = 0; i < kCount; ++i) {
+    locals.push_back(v8::Object::New(isolate));
+  }
+  std::vector<v8::Global<v8::Object>> globals(kCount);
+  v8::Global<v8::Object>::CreateBatch(isolate, locals.data(), globals.data(),
+                                      kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    CHECK(!globals[i].IsEmpty());
+    CHECK(locals[i] == globals[i].Get(isolate));
+  }
+  CollectAllGarbage();
+  for (size_t i = 0; i < kCount; ++i) {
+    CHECK(locals[i] == globals[i].Get(isolate));
+  }
+  v8::Global<v8::Object>::ResetBatch(globals.data(), kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    CHECK(globals[i].IsEmpty());
+  }
+}
+
+TEST_F(GlobalHandlesTest, CreateAndResetTracedReferenceBatch) {
+  v8::Isolate* isolate = v8_isolate();
+  v8::HandleScope scope(isolate);
+
+  constexpr size_t kCount = 300;
+  std::vector<v8::Local<v8::Object>> locals;
+  for (size_t i = 0; i < kCount; ++i) {
+    locals.push_back(v8::Object::New(isolate));
+  }
+  std::vector<v8::TracedReference<v8::Object>> refs(kCount);
+  v8::TracedReference<v8::Object>::CreateBatch(isolate, locals.data(),
+                                               refs.data(), kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    CHECK(!refs[i].IsEmpty());
+    CHECK(locals[i] == refs[i].Get(isolate));
+  }
+  v8::TracedReference<v8::Object>::ResetBatch(refs.data(), kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    CHECK(refs[i].IsEmpty());
+  }
+}
+
 TEST_F(GlobalHandlesTest, TotalSizeRegularNode) {
   v8::Isolate* isolate = v8_isolate();
   v8::HandleScope scope(isolate);
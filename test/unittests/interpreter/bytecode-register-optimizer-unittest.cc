@@ -191,6 +191,28 @@ TEST_F(BytecodeRegisterOptimizerTest, SingleTemporaryNotMaterializedForInput) {
   CHECK_EQ(1, reg_list.register_count());
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceKeptAcrossJump) {
+  FlagScope<bool> reo_across_jumps(&v8_flags.ignition_reo_across_jumps, true);
+  Initialize(3, 1);
+  Register parameter = Register::FromParameterIndex(1);
+  Register temp = NewTemporary();
+  optimizer()->DoLdar(parameter);
+  optimizer()->DoStar(temp);
+  CHECK_EQ(write_count(), 0u);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kJumpIfTrue,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  // The jump materializes the accumulator and the temporary.
+  CHECK_EQ(write_count(), 2u);
+  // On the fall-through path the equivalence set survives, so reloading the
+  // temporary into the accumulator does not emit anything.
+  optimizer()->DoLdar(temp);
+  optimizer()
+      ->PrepareForBytecode<Bytecode::kReturn,
+                           ImplicitRegisterUse::kReadAccumulator>();
+  CHECK_EQ(write_count(), 2u);
+}
+
 TEST_F(BytecodeRegisterOptimizerTest, RangeOfTemporariesMaterializedForInput) {
   Initialize(3, 1);
   Register parameter = Register::FromParameterIndex(1);
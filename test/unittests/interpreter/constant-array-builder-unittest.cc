@@ -397,6 +397,43 @@ TEST_F(ConstantArrayBuilderTest, AllocateEntriesWithFixedReservations) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, SharedConstantPoolCacheDeduplicates) {
+  Factory* factory = isolate()->factory();
+  Handle<String> name = factory->InternalizeUtf8String("shared_entry");
+  auto make_pool = [&]() {
+    Handle<FixedArray> pool = factory->NewFixedArray(3);
+    pool->set(0, Smi::FromInt(42));
+    pool->set(1, *name);
+    pool->set(2, *factory->NewHeapNumber(1.5));
+    return pool;
+  };
+  static const int kScriptId = 7;
+
+  Handle<FixedArray> first = make_pool();
+  CHECK_EQ(*SharedConstantPoolCache::Deduplicate(isolate(), kScriptId, first),
+           *first);
+
+  // An element-wise identical pool from the same script maps to the cached
+  // pool; HeapNumbers are compared by value.
+  Handle<FixedArray> second = make_pool();
+  CHECK_NE(*first, *second);
+  CHECK_EQ(*SharedConstantPoolCache::Deduplicate(isolate(), kScriptId, second),
+           *first);
+
+  // The same contents under another script id are not shared.
+  Handle<FixedArray> third = make_pool();
+  CHECK_EQ(
+      *SharedConstantPoolCache::Deduplicate(isolate(), kScriptId + 1, third),
+      *third);
+
+  // Pools that differ in a slot keep their own array.
+  Handle<FixedArray> different = make_pool();
+  different->set(0, Smi::FromInt(43));
+  CHECK_EQ(
+      *SharedConstantPoolCache::Deduplicate(isolate(), kScriptId, different),
+      *different);
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
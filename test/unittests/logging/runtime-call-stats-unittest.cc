@@ -304,6 +304,46 @@ TEST_F(RuntimeCallStatsTest, BasicPrintAndSnapshot) {
   EXPECT_EQ(0, counter3()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, DumpBinary) {
+  {
+    RCS_SCOPE(stats(), counter_id());
+    Sleep(50);
+  }
+  std::ostringstream out;
+  stats()->DumpBinary(out);
+  std::string data = out.str();
+
+  uint32_t header[3];
+  ASSERT_GE(data.size(), sizeof(header));
+  memcpy(header, data.data(), sizeof(header));
+  EXPECT_EQ(RuntimeCallStats::kBinaryDumpMagic, header[0]);
+  EXPECT_EQ(RuntimeCallStats::kBinaryDumpVersion, header[1]);
+  uint32_t num_entries = header[2];
+  constexpr size_t kRecordSize = sizeof(uint32_t) + 2 * sizeof(int64_t);
+  ASSERT_EQ(sizeof(header) + num_entries * kRecordSize, data.size());
+
+  // Only counters with a non-zero count are dumped, and the counter we just
+  // used must be among them.
+  bool found = false;
+  const char* record = data.data() + sizeof(header);
+  for (uint32_t i = 0; i < num_entries; i++) {
+    uint32_t id;
+    int64_t count;
+    int64_t time_us;
+    memcpy(&id, record, sizeof(id));
+    memcpy(&count, record + sizeof(id), sizeof(count));
+    memcpy(&time_us, record + sizeof(id) + sizeof(count), sizeof(time_us));
+    record += kRecordSize;
+    EXPECT_GT(count, 0);
+    if (id == static_cast<uint32_t>(counter_id())) {
+      found = true;
+      EXPECT_EQ(1, count);
+      EXPECT_EQ(50, time_us);
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
 TEST_F(RuntimeCallStatsTest, PrintAndSnapshot) {
   {
     RCS_SCOPE(stats(), counter_id());
@@ -324,6 +324,44 @@ TEST_F(IntlTest, StringLocaleCompareFastPath) {
   }
 }
 
+// Tests that JSCollator caches whether a collator may use the LocaleCompare
+// fast path.
+TEST_F(IntlTest, CollatorCachedFastComparable) {
+  Handle<JSFunction> collator_constructor = Handle<JSFunction>(
+      JSFunction::cast(
+          i_isolate()->context().native_context().intl_collator_function()),
+      i_isolate());
+  Handle<Map> constructor_map =
+      JSFunction::GetDerivedMap(i_isolate(), collator_constructor,
+                                collator_constructor)
+          .ToHandleChecked();
+  static const char* const kMethodName = "CollatorCachedFastComparable";
+
+  Handle<String> locale_string =
+      i_isolate()->factory()->NewStringFromAsciiChecked("en");
+  Handle<Object> undefined_options(
+      ReadOnlyRoots(i_isolate()).undefined_value(), i_isolate());
+
+  Handle<JSCollator> collator =
+      JSCollator::New(i_isolate(), constructor_map, locale_string,
+                      undefined_options, kMethodName)
+          .ToHandleChecked();
+  CHECK(collator->fast_comparable());
+  CHECK(Intl::CollatorSupportsFastComparison(*collator->icu_collator().raw()));
+
+  // Numeric collation compares digit sequences by value and is not compatible
+  // with the table-driven fast path.
+  Handle<JSObject> numeric_options = i_isolate()->factory()->NewJSObject(
+      i_isolate()->object_function());
+  JSObject::AddProperty(i_isolate(), numeric_options, "numeric",
+                        i_isolate()->factory()->true_value(), NONE);
+  collator = JSCollator::New(i_isolate(), constructor_map, locale_string,
+                             numeric_options, kMethodName)
+                 .ToHandleChecked();
+  CHECK(!collator->fast_comparable());
+  CHECK(!Intl::CollatorSupportsFastComparison(*collator->icu_collator().raw()));
+}
+
 TEST_F(IntlTest, IntlMathematicalValueFromString) {
   struct TestCase {
     bool is_nan;
@@ -1896,6 +1896,41 @@ TEST_F(ValueSerializerTest, RoundTripArrayBuffer) {
   ExpectScriptTrue("result.a === result.b");
 }
 
+TEST_F(ValueSerializerTest, VectoredOutputArrayBuffer) {
+  Context::Scope scope(serialization_context());
+  Local<Value> input = EvaluateScriptForInput(
+      "({ a: new Uint8Array([0, 128, 255]).buffer, b: 'hello' })");
+
+  ValueSerializer serializer(isolate());
+  serializer.SetVectoredOutput(true);
+  serializer.WriteHeader();
+  ASSERT_TRUE(
+      serializer.WriteValue(serialization_context(), input).FromMaybe(false));
+
+  // The ArrayBuffer contents are spliced in as a chunk aliasing the live
+  // backing store, with the surrounding wire bytes on either side.
+  std::vector<ValueSerializer::OutputChunk> chunks =
+      serializer.GetOutputChunks();
+  ASSERT_EQ(3u, chunks.size());
+  EXPECT_EQ(nullptr, chunks[0].backing_store);
+  ASSERT_NE(nullptr, chunks[1].backing_store);
+  EXPECT_EQ(3u, chunks[1].size);
+  EXPECT_EQ(chunks[1].backing_store->Data(),
+            static_cast<const void*>(chunks[1].data));
+  EXPECT_EQ(nullptr, chunks[2].backing_store);
+
+  // Concatenating the chunks yields the ordinary wire format.
+  std::vector<uint8_t> data;
+  for (const auto& chunk : chunks) {
+    data.insert(data.end(), chunk.data, chunk.data + chunk.size);
+  }
+  Local<Value> value = DecodeTest(data);
+  ASSERT_TRUE(value->IsObject());
+  ExpectScriptTrue("result.a instanceof ArrayBuffer");
+  ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,128,255'");
+  ExpectScriptTrue("result.b === 'hello'");
+}
+
 TEST_F(ValueSerializerTest, DecodeArrayBuffer) {
   DecodeTestFutureVersions(
       {0xFF, 0x09, 0x3F, 0x00, 0x42, 0x00}, [this](Local<Value> value) {
@@ -110,5 +110,44 @@ TEST_F(ScannerTest, AllThePushbacks) {
   }
 }
 
+TEST_F(ScannerTest, AsciiPrefixLengths) {
+  auto to_uc16 = [](const char* str) {
+    std::vector<uint16_t> result;
+    for (const char* p = str; *p != '\0'; p++) {
+      result.push_back(static_cast<uint16_t>(static_cast<uint8_t>(*p)));
+    }
+    return result;
+  };
+
+  const struct {
+    const char* src;
+    size_t identifier_prefix;
+    size_t whitespace_prefix;
+  } test_cases[] = {
+      {"", 0, 0},
+      {"x", 1, 0},
+      {"foo_bar$12 rest", 10, 0},
+      {"abcdefghijklmnopqrstuvwxyz(", 26, 0},  // Crosses a SIMD vector.
+      {"ABC-DEF", 3, 0},
+      {"  \t\r\n  x", 0, 7},
+      {"\n\n\n\n\n\n\n\n\n\n!", 0, 10},
+  };
+
+  for (const auto& test_case : test_cases) {
+    std::vector<uint16_t> chars = to_uc16(test_case.src);
+    CHECK_EQ(test_case.identifier_prefix,
+             AsciiIdentifierPrefixLength(chars.data(), chars.size()));
+    CHECK_EQ(test_case.whitespace_prefix,
+             AsciiWhiteSpacePrefixLength(chars.data(), chars.size()));
+  }
+
+  // Non-ASCII code units never match, including ones whose low byte looks
+  // like a match.
+  std::vector<uint16_t> non_ascii = {'a', 'b', 0x0161, 'c'};
+  CHECK_EQ(2u, AsciiIdentifierPrefixLength(non_ascii.data(), non_ascii.size()));
+  std::vector<uint16_t> nbsp = {' ', 0x00A0, ' '};
+  CHECK_EQ(1u, AsciiWhiteSpacePrefixLength(nbsp.data(), nbsp.size()));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -19,6 +19,7 @@
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -2365,6 +2366,33 @@ TEST_F(RegExpTestWithContext, RegExpInterruptReentrantExecution) {
   CHECK(result->IsNull());
 }
 
+TEST_F(RegExpTest, BytecodeCache) {
+  RegExpBytecodeCache* cache = RegExpBytecodeCache::Get();
+
+  const base::uc16 pattern_chars[] = {'a', 'b', '+', 'c'};
+  base::Vector<const base::uc16> pattern = base::ArrayVector(pattern_chars);
+  RegExpFlags flags = RegExpFlag::kGlobal;
+
+  RegExpBytecodeCache::LookupResult result;
+  CHECK(!cache->Lookup(pattern, flags, true, &result));
+  CHECK(!cache->WasTieredUp(pattern, flags));
+
+  const uint8_t bytes[] = {1, 2, 3, 4};
+  cache->Insert(pattern, flags, true, base::ArrayVector(bytes), 7);
+
+  CHECK(cache->Lookup(pattern, flags, true, &result));
+  CHECK_EQ(result.bytecode.size(), arraysize(bytes));
+  CHECK_EQ(0, memcmp(result.bytecode.data(), bytes, arraysize(bytes)));
+  CHECK_EQ(7, result.register_count);
+  // The two-byte specialization and other flag combinations are independent.
+  CHECK(!cache->Lookup(pattern, flags, false, &result));
+  CHECK(!cache->Lookup(pattern, RegExpFlag::kIgnoreCase, true, &result));
+
+  cache->RecordTierUp(pattern, flags);
+  CHECK(cache->WasTieredUp(pattern, flags));
+  CHECK(!cache->WasTieredUp(pattern, RegExpFlag::kIgnoreCase));
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
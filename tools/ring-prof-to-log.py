@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+#
+# Copyright 2022 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+#
+# This is an utility for converting the binary ring-buffer log produced by
+# V8 when run with --ring-prof (a v8.log.ring file) into the textual log
+# format understood by the other tools/ scripts.
+#
+# Usage: ring-prof-to-log.py <ring-log-filename>
+#
+# Record wire format (all fields little-endian, native struct packing):
+#   1 byte tag, uint32 payload size, payload.
+# Tags:
+#   'I': uint8 pointer size.
+#   'C': address, int32 code size, followed by the name bytes.
+#   'M': from address, to address.
+#   'D': uint64 count of records dropped on ring-buffer overflow.
+
+import struct
+import sys
+
+
+class RingLogReader(object):
+
+  def __init__(self, stream):
+    self.stream = stream
+    # Defaults, overwritten by the 'I' record at the start of the log.
+    self.pointer_format = "Q"
+    self.pointer_size = 8
+
+  def ReadRecords(self):
+    while True:
+      header = self.stream.read(5)
+      if len(header) < 5:
+        return
+      tag, payload_size = struct.unpack("<cI", header)
+      payload = self.stream.read(payload_size)
+      if len(payload) < payload_size:
+        return
+      yield tag, payload
+
+  def Convert(self, out):
+    for tag, payload in self.ReadRecords():
+      if tag == b"I":
+        (self.pointer_size,) = struct.unpack("<B", payload)
+        self.pointer_format = "I" if self.pointer_size == 4 else "Q"
+      elif tag == b"C":
+        record_size = struct.calcsize("<" + self.pointer_format + "i")
+        address, code_size = struct.unpack(
+            "<" + self.pointer_format + "i", payload[:record_size])
+        # The record struct is padded to the pointer size by the C++ side.
+        padded_size = ((record_size + self.pointer_size - 1) //
+                       self.pointer_size * self.pointer_size)
+        name = payload[padded_size:].decode("utf-8", "replace")
+        # Neither the code kind nor a timestamp is recorded; emit zeros to
+        # keep the field positions expected by the log processors.
+        out.write("code-creation,JS,0,0,0x%x,%d,\"%s\"\n" %
+                  (address, code_size, name))
+      elif tag == b"M":
+        from_address, to_address = struct.unpack(
+            "<" + self.pointer_format * 2, payload)
+        out.write("code-move,0x%x,0x%x\n" % (from_address, to_address))
+      elif tag == b"D":
+        (count,) = struct.unpack("<Q", payload)
+        sys.stderr.write("warning: %d records dropped on overflow\n" % count)
+      else:
+        sys.stderr.write("warning: skipping unknown record tag %r\n" % tag)
+
+
+def main():
+  if len(sys.argv) != 2:
+    sys.stderr.write("Usage: %s <ring-log-filename>\n" % sys.argv[0])
+    return 1
+  with open(sys.argv[1], "rb") as stream:
+    RingLogReader(stream).Convert(sys.stdout)
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main())